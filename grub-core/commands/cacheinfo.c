@@ -25,21 +25,59 @@
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
+static int
+print_device_stats (const struct grub_disk_cache_stats *stats,
+		    void *data __attribute__ ((unused)))
+{
+  grub_disk_dev_t dev;
+  const char *name = "unknown";
+  unsigned long ratio = 0;
+
+  for (dev = grub_disk_dev_list; dev; dev = dev->next)
+    if (dev->id == stats->dev_id)
+      {
+	name = dev->name;
+	break;
+      }
+
+  if (stats->hits + stats->misses)
+    ratio = stats->hits * 10000 / (stats->hits + stats->misses);
+  grub_printf_ (N_("%s %lu: hits = %lu (%lu.%02lu%%), misses = %lu\n"),
+		name, stats->disk_id, stats->hits, ratio / 100, ratio % 100,
+		stats->misses);
+  return 0;
+}
+
 static grub_err_t
 grub_rescue_cmd_info (struct grub_command *cmd __attribute__ ((unused)),
-    int argc __attribute__ ((unused)),
-    char *argv[] __attribute__ ((unused)))
+    int argc, char *argv[])
 {
   unsigned long hits, misses;
 
+  if (argc > 0)
+    {
+      char *end;
+      unsigned long size;
+
+      size = grub_strtoul (argv[0], &end, 0);
+      if (grub_errno)
+	return grub_errno;
+      if (*end)
+	return grub_error (GRUB_ERR_BAD_ARGUMENT, N_("unrecognized number"));
+      grub_disk_cache_set_budget ((grub_size_t) size << 10);
+    }
+
+  grub_printf_ (N_("Disk cache size: %lu KiB\n"),
+		(unsigned long) (grub_disk_cache_get_budget () >> 10));
+
   grub_disk_cache_get_performance (&hits, &misses);
   if (hits + misses)
     {
       unsigned long ratio = hits * 10000 / (hits + misses);
-      grub_printf ("(%lu.%lu%%)\n", ratio / 100, ratio % 100);
       grub_printf_ (N_("Disk cache statistics: hits = %lu (%lu.%02lu%%),"
-		     " misses = %lu\n"), ratio / 100, ratio % 100,
-		    hits, misses);
+		     " misses = %lu\n"), hits, ratio / 100, ratio % 100,
+		    misses);
+      grub_disk_cache_stats_iterate (print_device_stats, NULL);
     }
   else
     grub_printf ("%s\n", _("No disk cache statistics available\n"));    
@@ -53,7 +91,9 @@ GRUB_MOD_INIT(cacheinfo)
 {
   cmd_cacheinfo =
     grub_register_command ("cacheinfo", grub_rescue_cmd_info,
-			   0, N_("Get disk cache info."));
+			   N_("[SIZE]"),
+			   N_("Get disk cache info. If SIZE is given, limit"
+			      " the disk cache to SIZE KiB."));
 }
 
 GRUB_MOD_FINI(cacheinfo)
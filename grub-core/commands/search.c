@@ -30,6 +30,7 @@
 #include <grub/i18n.h>
 #include <grub/disk.h>
 #include <grub/partition.h>
+#include <grub/devindex.h>
 #if defined(DO_SEARCH_PART_UUID) || defined(DO_SEARCH_PART_LABEL) || \
     defined(DO_SEARCH_DISK_UUID)
 #include <grub/gpt_partition.h>
@@ -37,6 +38,64 @@
 
 GRUB_MOD_LICENSE ("GPLv3+");
 
+#if defined(DO_SEARCH_PART_UUID) || defined(DO_SEARCH_PART_LABEL) || \
+    defined(DO_SEARCH_DISK_UUID)
+
+#if defined(DO_SEARCH_PART_UUID)
+#define SEARCH_KEY GRUB_DEVINDEX_PART_UUID
+#define read_fn grub_gpt_part_uuid
+#elif defined(DO_SEARCH_PART_LABEL)
+#define SEARCH_KEY GRUB_DEVINDEX_PART_LABEL
+#define read_fn grub_gpt_part_label
+#else
+#define SEARCH_KEY GRUB_DEVINDEX_DISK_UUID
+#define read_fn grub_gpt_disk_uuid
+#endif
+
+/* Helper for iterate_device.  */
+static char *
+probe_key (grub_device_t dev)
+{
+  char *quid;
+
+  if (read_fn (dev, &quid) != GRUB_ERR_NONE)
+    return NULL;
+  return quid;
+}
+
+#elif !defined(DO_SEARCH_FILE)
+
+/* SEARCH_FS_UUID or SEARCH_LABEL */
+#ifdef DO_SEARCH_FS_UUID
+#define SEARCH_KEY GRUB_DEVINDEX_FS_UUID
+#define read_fn uuid
+#else
+#define SEARCH_KEY GRUB_DEVINDEX_FS_LABEL
+#define read_fn label
+#endif
+
+/* Helper for iterate_device.  */
+static char *
+probe_key (grub_device_t dev)
+{
+  grub_fs_t fs;
+  char *quid = NULL;
+
+  fs = grub_fs_probe (dev);
+  if (fs && fs->read_fn)
+    {
+      fs->read_fn (dev, &quid);
+      if (grub_errno != GRUB_ERR_NONE)
+	{
+	  grub_free (quid);
+	  return NULL;
+	}
+    }
+  return quid;
+}
+
+#endif
+
 struct cache_entry
 {
   struct cache_entry *next;
@@ -74,6 +133,14 @@ iterate_device (const char *name, void *data)
 #define compare_fn grub_strcasecmp
 #else
 #define compare_fn grub_strcmp
+#endif
+
+  /* Filesystem and GPT partition UUIDs match in any case, everything else
+     exactly, as each search did before the device index.  */
+#if defined(DO_SEARCH_FS_UUID) || defined(DO_SEARCH_PART_UUID)
+#define match_fn grub_strcasecmp
+#else
+#define match_fn grub_strcmp
 #endif
 
 #ifdef DO_SEARCH_FILE
@@ -94,96 +161,13 @@ iterate_device (const char *name, void *data)
 	}
       grub_free (buf);
     }
-#elif defined(DO_SEARCH_PART_UUID)
-    {
-      grub_device_t dev;
-      char *quid;
-
-      dev = grub_device_open (name);
-      if (dev)
-	{
-	  if (grub_gpt_part_uuid (dev, &quid) == GRUB_ERR_NONE)
-	    {
-	      if (grub_strcasecmp (quid, ctx->key) == 0)
-		    found = 1;
-
-	      grub_free (quid);
-	    }
-
-	  grub_device_close (dev);
-	}
-    }
-#elif defined(DO_SEARCH_PART_LABEL)
-    {
-      grub_device_t dev;
-      char *quid;
-
-      dev = grub_device_open (name);
-      if (dev)
-	{
-	  if (grub_gpt_part_label (dev, &quid) == GRUB_ERR_NONE)
-	    {
-	      if (grub_strcmp (quid, ctx->key) == 0)
-		    found = 1;
-
-	      grub_free (quid);
-	    }
-
-	  grub_device_close (dev);
-	}
-    }
-#elif defined(DO_SEARCH_DISK_UUID)
-    {
-      grub_device_t dev;
-      char *quid;
-
-      dev = grub_device_open (name);
-      if (dev)
-	{
-	  if (grub_gpt_disk_uuid (dev, &quid) == GRUB_ERR_NONE)
-	    {
-	      if (grub_strcmp (quid, ctx->key) == 0)
-		found = 1;
-
-	      grub_free (quid);
-	    }
-
-	  grub_device_close (dev);
-	}
-    }
 #else
     {
-      /* SEARCH_FS_UUID or SEARCH_LABEL */
-      grub_device_t dev;
-      grub_fs_t fs;
-      char *quid;
-
-      dev = grub_device_open (name);
-      if (dev)
-	{
-	  fs = grub_fs_probe (dev);
-
-#ifdef DO_SEARCH_FS_UUID
-#define read_fn uuid
-#else
-#define read_fn label
-#endif
+      const char *quid;
 
-	  if (fs && fs->read_fn)
-	    {
-	      fs->read_fn (dev, &quid);
-
-	      if (grub_errno == GRUB_ERR_NONE && quid)
-		{
-		  if (compare_fn (quid, ctx->key) == 0)
-		    found = 1;
-
-		  grub_free (quid);
-		}
-	    }
-
-	  grub_device_close (dev);
-	}
+      quid = grub_devindex_get (name, SEARCH_KEY, probe_key);
+      if (quid && match_fn (quid, ctx->key) == 0)
+	found = 1;
     }
 #endif
 
@@ -318,7 +302,11 @@ try (struct search_ctx *ctx)
 	    return;
 	}
     }
+#ifdef DO_SEARCH_FILE
   grub_device_iterate (iterate_device, ctx);
+#else
+  grub_devindex_iterate (iterate_device, ctx);
+#endif
 }
 
 void
@@ -31,6 +31,13 @@
 #include <grub/emu/hostdisk.h>
 #endif
 
+#if defined (__x86_64__) && (defined (GRUB_MACHINE_EFI) \
+			     || defined (GRUB_MACHINE_XEN))
+#define GRUB_CRYPTODISK_AESNI 1
+#include <grub/i386/cpuid.h>
+#include <grub/x86_64/aesni.h>
+#endif
+
 GRUB_MOD_LICENSE ("GPLv3+");
 
 grub_cryptodisk_dev_t grub_cryptodisk_list;
@@ -54,21 +61,19 @@ static inline int GF_PER_SECTOR (const struct grub_cryptodisk *dev)
 static grub_cryptodisk_t cryptodisk_list = NULL;
 static grub_uint8_t last_cryptodisk_id = 0;
 
+/* Store A * x in O.  Both are little-endian 128-bit values.  */
 static void
-gf_mul_x (grub_uint8_t *g)
+gf_mul_x (grub_uint8_t *o, const grub_uint8_t *a)
 {
-  int over = 0, over2 = 0;
-  unsigned j;
-
-  for (j = 0; j < GRUB_CRYPTODISK_GF_BYTES; j++)
-    {
-      over2 = !!(g[j] & 0x80);
-      g[j] <<= 1;
-      g[j] |= over;
-      over = over2;
-    }
-  if (over)
-    g[0] ^= GF_POLYNOM;
+  grub_uint64_t lo, hi, over;
+
+  lo = grub_le_to_cpu64 (grub_get_unaligned64 (a));
+  hi = grub_le_to_cpu64 (grub_get_unaligned64 (a + 8));
+  over = hi >> 63;
+  hi = (hi << 1) | (lo >> 63);
+  lo = (lo << 1) ^ (-over & GF_POLYNOM);
+  grub_set_unaligned64 (o, grub_cpu_to_le64 (lo));
+  grub_set_unaligned64 (o + 8, grub_cpu_to_le64 (hi));
 }
 
 
@@ -221,6 +226,168 @@ lrw_xor (const struct lrw_sector *sec,
 		   dev->lrw_precalc, sec->low_byte * GRUB_CRYPTODISK_GF_BYTES);
 }
 
+#ifdef GRUB_CRYPTODISK_AESNI
+
+struct grub_cryptodisk_accel
+{
+  struct grub_aesni_key aes;
+};
+
+static int
+grub_cryptodisk_have_aesni (void)
+{
+  static int have_aesni = -1;
+  grub_uint32_t eax, ebx, ecx, edx;
+
+  if (have_aesni != -1)
+    return have_aesni;
+
+  have_aesni = 0;
+  grub_cpuid (0, eax, ebx, ecx, edx);
+  if (eax < 1)
+    return have_aesni;
+  grub_cpuid (1, eax, ebx, ecx, edx);
+  /* CPUID.01H:ECX.AES[bit 25].  */
+  if (ecx & (1 << 25))
+    have_aesni = 1;
+  grub_dprintf ("cryptodisk", "AES-NI %savailable\n",
+		have_aesni ? "" : "not ");
+  return have_aesni;
+}
+
+/* FIPS-197 key expansion, followed by the schedule for the equivalent
+   inverse cipher.  */
+static void
+grub_cryptodisk_aesni_expand (struct grub_aesni_key *k,
+			      const grub_uint8_t *key, grub_size_t keysize)
+{
+  unsigned nk = keysize / 4, i;
+  grub_uint32_t *w = k->enc;
+  grub_uint32_t rcon = 1;
+
+  k->rounds = nk + 6;
+  for (i = 0; i < nk; i++)
+    w[i] = grub_le_to_cpu32 (grub_get_unaligned32 (key + 4 * i));
+  for (i = nk; i < 4 * (k->rounds + 1); i++)
+    {
+      grub_uint32_t t = w[i - 1];
+      if (i % nk == 0)
+	{
+	  t = grub_aesni_subword ((t >> 8) | (t << 24)) ^ rcon;
+	  rcon = (rcon << 1) ^ ((rcon & 0x80) ? 0x11b : 0);
+	}
+      else if (nk > 6 && i % nk == 4)
+	t = grub_aesni_subword (t);
+      w[i] = w[i - nk] ^ t;
+    }
+
+  grub_memcpy (k->dec, k->enc + 4 * k->rounds, GRUB_AESNI_BLOCKSIZE);
+  for (i = 1; i < k->rounds; i++)
+    grub_aesni_imc (k->dec + 4 * i, k->enc + 4 * (k->rounds - i));
+  grub_memcpy (k->dec + 4 * k->rounds, k->enc, GRUB_AESNI_BLOCKSIZE);
+}
+
+static void
+grub_cryptodisk_accel_free (grub_cryptodisk_t dev)
+{
+  if (!dev->accel)
+    return;
+  /* The schedule is as secret as the key.  */
+  grub_memset (dev->accel, 0, sizeof (*dev->accel));
+  grub_free (dev->accel);
+  dev->accel = NULL;
+}
+
+static gcry_err_code_t
+grub_cryptodisk_accel_setkey (grub_cryptodisk_t dev, const grub_uint8_t *key,
+			      grub_size_t keysize)
+{
+  if (dev->cipher->cipher->blocksize != GRUB_AESNI_BLOCKSIZE
+      || grub_strncmp (dev->cipher->cipher->name, "AES", 3) != 0
+      || (keysize != 16 && keysize != 24 && keysize != 32)
+      || !grub_cryptodisk_have_aesni ())
+    {
+      grub_cryptodisk_accel_free (dev);
+      return GPG_ERR_NO_ERROR;
+    }
+
+  if (!dev->accel)
+    {
+      dev->accel = grub_malloc (sizeof (*dev->accel));
+      if (!dev->accel)
+	return GPG_ERR_OUT_OF_MEMORY;
+    }
+  grub_cryptodisk_aesni_expand (&dev->accel->aes, key, keysize);
+  return GPG_ERR_NO_ERROR;
+}
+
+#endif
+
+/* Wipe and free the key schedule and the sector buffer of DEV, which
+   holds plaintext.  */
+void
+grub_cryptodisk_free_scratch (grub_cryptodisk_t dev)
+{
+#ifdef GRUB_CRYPTODISK_AESNI
+  grub_cryptodisk_accel_free (dev);
+#endif
+  if (dev->sector_buf)
+    {
+      grub_memset (dev->sector_buf, 0, 1U << dev->log_sector_size);
+      grub_free (dev->sector_buf);
+      dev->sector_buf = NULL;
+    }
+}
+
+/* Encrypt or decrypt LEN bytes of DATA in place in ECB mode with the
+   primary cipher, using the accelerated backend when one was selected
+   for the current key.  */
+static gcry_err_code_t
+grub_cryptodisk_ecb (struct grub_cryptodisk *dev, grub_uint8_t *data,
+		     grub_size_t len, int do_encrypt)
+{
+#ifdef GRUB_CRYPTODISK_AESNI
+  if (dev->accel)
+    {
+      if (len % GRUB_AESNI_BLOCKSIZE)
+	return GPG_ERR_INV_ARG;
+      if (do_encrypt)
+	grub_aesni_encrypt_blocks (dev->accel->aes.enc, dev->accel->aes.rounds,
+				   data, data, len / GRUB_AESNI_BLOCKSIZE);
+      else
+	grub_aesni_decrypt_blocks (dev->accel->aes.dec, dev->accel->aes.rounds,
+				   data, data, len / GRUB_AESNI_BLOCKSIZE);
+      return GPG_ERR_NO_ERROR;
+    }
+#endif
+  return (do_encrypt ? grub_crypto_ecb_encrypt (dev->cipher, data, data, len)
+	  : grub_crypto_ecb_decrypt (dev->cipher, data, data, len));
+}
+
+/* CBC decryption has no chaining dependency between blocks once the
+   ciphertext is saved, so decrypt the whole sector in one ECB pass
+   when that is faster than the per-block generic path.  */
+static gcry_err_code_t
+grub_cryptodisk_cbc_decrypt (struct grub_cryptodisk *dev, grub_uint8_t *data,
+			     grub_size_t len, void *iv)
+{
+  grub_size_t blocksize = dev->cipher->cipher->blocksize;
+  gcry_err_code_t err;
+
+  if (!dev->accel || !dev->sector_buf)
+    return grub_crypto_cbc_decrypt (dev->cipher, data, data, len, iv);
+
+  grub_memcpy (dev->sector_buf, data, len);
+  err = grub_cryptodisk_ecb (dev, data, len, 0);
+  if (err)
+    return err;
+  grub_crypto_xor (data, data, iv, blocksize);
+  grub_crypto_xor (data + blocksize, data + blocksize, dev->sector_buf,
+		   len - blocksize);
+  grub_memcpy (iv, dev->sector_buf + len - blocksize, blocksize);
+  return GPG_ERR_NO_ERROR;
+}
+
 static gcry_err_code_t
 grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
 			   grub_uint8_t * data, grub_size_t len,
@@ -234,8 +401,16 @@ grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
 
   /* The only mode without IV.  */
   if (dev->mode == GRUB_CRYPTODISK_MODE_ECB && !dev->rekey)
-    return (do_encrypt ? grub_crypto_ecb_encrypt (dev->cipher, data, data, len)
-	    : grub_crypto_ecb_decrypt (dev->cipher, data, data, len));
+    return grub_cryptodisk_ecb (dev, data, len, do_encrypt);
+
+  if (!dev->sector_buf && (dev->mode == GRUB_CRYPTODISK_MODE_XTS
+			   || (dev->accel
+			       && dev->mode == GRUB_CRYPTODISK_MODE_CBC)))
+    {
+      dev->sector_buf = grub_malloc (1U << dev->log_sector_size);
+      if (!dev->sector_buf)
+	return GPG_ERR_OUT_OF_MEMORY;
+    }
 
   for (i = 0; i < len; i += (1U << dev->log_sector_size))
     {
@@ -313,8 +488,9 @@ grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
 	    err = grub_crypto_cbc_encrypt (dev->cipher, data + i, data + i,
 					   (1U << dev->log_sector_size), iv);
 	  else
-	    err = grub_crypto_cbc_decrypt (dev->cipher, data + i, data + i,
-					   (1U << dev->log_sector_size), iv);
+	    err = grub_cryptodisk_cbc_decrypt (dev, data + i,
+					       (1U << dev->log_sector_size),
+					       iv);
 	  if (err)
 	    return err;
 	  break;
@@ -331,31 +507,33 @@ grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
 	  break;
 	case GRUB_CRYPTODISK_MODE_XTS:
 	  {
+	    grub_uint8_t *tweak = dev->sector_buf;
 	    unsigned j;
+
+	    if (dev->cipher->cipher->blocksize != GRUB_CRYPTODISK_GF_BYTES)
+	      return GPG_ERR_INV_ARG;
+
 	    err = grub_crypto_ecb_encrypt (dev->secondary_cipher, iv, iv,
-					   dev->cipher->cipher->blocksize);
+					   GRUB_CRYPTODISK_GF_BYTES);
 	    if (err)
 	      return err;
-	    
-	    for (j = 0; j < (1U << dev->log_sector_size);
-		 j += dev->cipher->cipher->blocksize)
-	      {
-		grub_crypto_xor (data + i + j, data + i + j, iv,
-				 dev->cipher->cipher->blocksize);
-		if (do_encrypt)
-		  err = grub_crypto_ecb_encrypt (dev->cipher, data + i + j, 
-						 data + i + j,
-						 dev->cipher->cipher->blocksize);
-		else
-		  err = grub_crypto_ecb_decrypt (dev->cipher, data + i + j, 
-						 data + i + j,
-						 dev->cipher->cipher->blocksize);
-		if (err)
-		  return err;
-		grub_crypto_xor (data + i + j, data + i + j, iv,
-				 dev->cipher->cipher->blocksize);
-		gf_mul_x ((grub_uint8_t *) iv);
-	      }
+
+	    /* Compute the tweaks for the whole sector first so that the
+	       sector can go through the cipher in a single call.  */
+	    grub_memcpy (tweak, iv, GRUB_CRYPTODISK_GF_BYTES);
+	    for (j = GRUB_CRYPTODISK_GF_BYTES; j < (1U << dev->log_sector_size);
+		 j += GRUB_CRYPTODISK_GF_BYTES)
+	      gf_mul_x (tweak + j, tweak + j - GRUB_CRYPTODISK_GF_BYTES);
+
+	    grub_crypto_xor (data + i, data + i, tweak,
+			     (1U << dev->log_sector_size));
+	    err = grub_cryptodisk_ecb (dev, data + i,
+				       (1U << dev->log_sector_size),
+				       do_encrypt);
+	    if (err)
+	      return err;
+	    grub_crypto_xor (data + i, data + i, tweak,
+			     (1U << dev->log_sector_size));
 	  }
 	  break;
 	case GRUB_CRYPTODISK_MODE_LRW:
@@ -365,26 +543,18 @@ grub_cryptodisk_endecrypt (struct grub_cryptodisk *dev,
 	    generate_lrw_sector (&sec, dev, (grub_uint8_t *) iv);
 	    lrw_xor (&sec, dev, data + i);
 
-	    if (do_encrypt)
-	      err = grub_crypto_ecb_encrypt (dev->cipher, data + i, 
-					     data + i,
-					     (1U << dev->log_sector_size));
-	    else
-	      err = grub_crypto_ecb_decrypt (dev->cipher, data + i, 
-					     data + i,
-					     (1U << dev->log_sector_size));
+	    err = grub_cryptodisk_ecb (dev, data + i,
+				       (1U << dev->log_sector_size),
+				       do_encrypt);
 	    if (err)
 	      return err;
 	    lrw_xor (&sec, dev, data + i);
 	  }
 	  break;
 	case GRUB_CRYPTODISK_MODE_ECB:
-	  if (do_encrypt)
-	    err = grub_crypto_ecb_encrypt (dev->cipher, data + i, data + i,
-					   (1U << dev->log_sector_size));
-	  else
-	    err = grub_crypto_ecb_decrypt (dev->cipher, data + i, data + i,
-					   (1U << dev->log_sector_size));
+	  err = grub_cryptodisk_ecb (dev, data + i,
+				     (1U << dev->log_sector_size),
+				     do_encrypt);
 	  if (err)
 	    return err;
 	  break;
@@ -420,6 +590,11 @@ grub_cryptodisk_setkey (grub_cryptodisk_t dev, grub_uint8_t *key, grub_size_t ke
   err = grub_crypto_cipher_set_key (dev->cipher, key, real_keysize);
   if (err)
     return err;
+#ifdef GRUB_CRYPTODISK_AESNI
+  err = grub_cryptodisk_accel_setkey (dev, key, real_keysize);
+  if (err)
+    return err;
+#endif
   grub_memcpy (dev->key, key, keysize);
   dev->keysize = keysize;
 
@@ -699,6 +874,7 @@ cryptodisk_cleanup (void)
       grub_free (dev->cipher);
       grub_free (dev->secondary_cipher);
       grub_free (dev->essiv_cipher);
+      grub_cryptodisk_free_scratch (dev);
       tmp = dev->next;
       grub_free (dev);
       dev = tmp;
@@ -816,6 +992,7 @@ cryptodisk_close (grub_cryptodisk_t dev)
   grub_crypto_cipher_close (dev->cipher);
   grub_crypto_cipher_close (dev->secondary_cipher);
   grub_crypto_cipher_close (dev->essiv_cipher);
+  grub_cryptodisk_free_scratch (dev);
   grub_free (dev);
 }
 
@@ -891,7 +1068,10 @@ grub_cryptodisk_cheat_mount (const char *sourcedev, const char *cheat)
     err = grub_cryptodisk_cheat_insert (dev, sourcedev, source, cheat);
     grub_disk_close (source);
     if (err)
-      grub_free (dev);
+      {
+	grub_cryptodisk_free_scratch (dev);
+	grub_free (dev);
+      }
 
     return GRUB_ERR_NONE;
   }
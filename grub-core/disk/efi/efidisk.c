@@ -33,11 +33,25 @@ struct grub_efidisk_data
   grub_efi_device_path_t *device_path;
   grub_efi_device_path_t *last_device_path;
   grub_efi_block_io_t *block_io;
+  /* NULL if the device has no asynchronous interface.  */
+  grub_efi_block_io2_t *block_io2;
   struct grub_efidisk_data *next;
 };
 
+/* The number of Block I/O 2 reads kept in flight per disk.  */
+#define GRUB_EFIDISK_QUEUE_DEPTH	16
+
+/* An asynchronous read in progress.  */
+struct grub_efidisk_io
+{
+  grub_efi_block_io2_token_t token;
+  /* Bounce buffer if the caller's buffer isn't aligned enough.  */
+  char *aligned_buf;
+};
+
 /* GUID.  */
 static grub_efi_guid_t block_io_guid = GRUB_EFI_BLOCK_IO_GUID;
+static grub_efi_guid_t block_io2_guid = GRUB_EFI_BLOCK_IO2_GUID;
 
 static struct grub_efidisk_data *fd_devices;
 static struct grub_efidisk_data *hd_devices;
@@ -107,6 +121,8 @@ make_devices (void)
       d->device_path = dp;
       d->last_device_path = ldp;
       d->block_io = bio;
+      d->block_io2 = grub_efi_open_protocol (*handle, &block_io2_guid,
+					     GRUB_EFI_OPEN_PROTOCOL_GET_PROTOCOL);
       d->next = devices;
       devices = d;
     }
@@ -520,6 +536,8 @@ grub_efidisk_open (const char *name, struct grub_disk *disk)
   for (disk->log_sector_size = 0;
        (1U << disk->log_sector_size) < m->block_size;
        disk->log_sector_size++);
+  if (d->block_io2)
+    disk->queue_depth = GRUB_EFIDISK_QUEUE_DEPTH;
   disk->data = d;
 
   grub_dprintf ("efidisk", "opening %s succeeded\n", name);
@@ -623,6 +641,108 @@ grub_efidisk_write (struct grub_disk *disk, grub_disk_addr_t sector,
   return GRUB_ERR_NONE;
 }
 
+static grub_err_t
+grub_efidisk_submit (struct grub_disk *disk, struct grub_disk_io *io)
+{
+  struct grub_efidisk_data *d = disk->data;
+  grub_efi_block_io2_t *bio2 = d->block_io2;
+  grub_efi_boot_services_t *b = grub_efi_system_table->boot_services;
+  struct grub_efidisk_io *eio;
+  grub_efi_status_t status;
+  grub_size_t io_align, num_bytes;
+  char *buf = io->buf;
+
+  if (! bio2)
+    return grub_error (GRUB_ERR_NOT_IMPLEMENTED_YET,
+		       "no asynchronous reads on `%s'", disk->name);
+
+  eio = grub_zalloc (sizeof (*eio));
+  if (! eio)
+    return grub_errno;
+
+  io_align = bio2->media->io_align ? bio2->media->io_align : 1;
+  num_bytes = io->size << disk->log_sector_size;
+  if ((grub_addr_t) buf & (io_align - 1))
+    {
+      eio->aligned_buf = grub_memalign (io_align, num_bytes);
+      if (! eio->aligned_buf)
+	{
+	  grub_free (eio);
+	  return grub_errno;
+	}
+      buf = eio->aligned_buf;
+    }
+
+  /* An event without notification function, polled with CheckEvent.  */
+  status = efi_call_5 (b->create_event, 0, GRUB_EFI_TPL_CALLBACK, NULL, NULL,
+		       &eio->token.event);
+  if (status != GRUB_EFI_SUCCESS)
+    {
+      grub_free (eio->aligned_buf);
+      grub_free (eio);
+      return grub_error (GRUB_ERR_OUT_OF_MEMORY, "couldn't create event");
+    }
+
+  grub_dprintf ("efidisk",
+		"submitting 0x%lx sectors at the sector 0x%llx from %s\n",
+		(unsigned long) io->size, (unsigned long long) io->sector,
+		disk->name);
+
+  status = efi_call_6 (bio2->read_blocks_ex, bio2, bio2->media->media_id,
+		       (grub_efi_uint64_t) io->sector, &eio->token,
+		       (grub_efi_uintn_t) num_bytes, buf);
+  if (status != GRUB_EFI_SUCCESS)
+    {
+      efi_call_1 (b->close_event, eio->token.event);
+      grub_free (eio->aligned_buf);
+      grub_free (eio);
+      return grub_error (GRUB_ERR_READ_ERROR,
+			 N_("failure reading sector 0x%llx from `%s'"),
+			 (unsigned long long) io->sector, disk->name);
+    }
+
+  io->data = eio;
+  return GRUB_ERR_NONE;
+}
+
+static int
+grub_efidisk_poll (struct grub_disk *disk, struct grub_disk_io *io, int wait)
+{
+  grub_efi_boot_services_t *b = grub_efi_system_table->boot_services;
+  struct grub_efidisk_io *eio = io->data;
+  grub_efi_status_t status;
+
+  /* Drivers make progress from their timer events while we spin.  */
+  do
+    {
+      status = efi_call_1 (b->check_event, eio->token.event);
+      if (status == GRUB_EFI_NOT_READY && ! wait)
+	return 0;
+    }
+  while (status == GRUB_EFI_NOT_READY);
+
+  /* Any other status from CheckEvent means the event, not the read,
+     failed, and TransactionStatus was never written.  */
+  if (status == GRUB_EFI_SUCCESS
+      && eio->token.transaction_status == GRUB_EFI_SUCCESS)
+    {
+      if (eio->aligned_buf)
+	grub_memcpy (io->buf, eio->aligned_buf,
+		     io->size << disk->log_sector_size);
+      io->err = GRUB_ERR_NONE;
+    }
+  else
+    io->err = grub_error (GRUB_ERR_READ_ERROR,
+			  N_("failure reading sector 0x%llx from `%s'"),
+			  (unsigned long long) io->sector, disk->name);
+
+  efi_call_1 (b->close_event, eio->token.event);
+  grub_free (eio->aligned_buf);
+  grub_free (eio);
+  io->data = 0;
+  return 1;
+}
+
 static struct grub_disk_dev grub_efidisk_dev =
   {
     .name = "efidisk",
@@ -632,6 +752,8 @@ static struct grub_disk_dev grub_efidisk_dev =
     .close = grub_efidisk_close,
     .read = grub_efidisk_read,
     .write = grub_efidisk_write,
+    .submit = grub_efidisk_submit,
+    .poll = grub_efidisk_poll,
     .next = 0
   };
 
@@ -66,6 +66,8 @@ delete_loopback (const char *name)
   /* Remove the device from the list.  */
   *prev = dev->next;
 
+  grub_disk_changed ();
+
   grub_free (dev->devname);
   grub_file_close (dev->file);
   grub_free (dev);
@@ -103,6 +105,7 @@ grub_cmd_loopback (grub_extcmd_context_t ctxt, int argc, char **args)
 
   if (newdev)
     {
+      grub_disk_changed ();
       grub_file_close (newdev->file);
       newdev->file = file;
 
@@ -127,6 +130,7 @@ grub_cmd_loopback (grub_extcmd_context_t ctxt, int argc, char **args)
   /* Add the new entry to the list.  */
   newdev->next = loopback_list;
   loopback_list = newdev;
+  grub_disk_changed ();
 
   return 0;
 
@@ -22,6 +22,7 @@
 #include <grub/usb.h>
 #include <grub/scsi.h>
 #include <grub/scsicmd.h>
+#include <grub/disk.h>
 #include <grub/misc.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
@@ -132,6 +133,7 @@ grub_usbms_detach (grub_usb_device_t usbdev, int config, int interface)
 	&& grub_usbms_devices[i]->interface == interface
 	&& grub_usbms_devices[i]->config == config)
       {
+	grub_disk_changed ();
 	grub_free (grub_usbms_devices[i]);
 	grub_usbms_devices[i] = 0;
       }
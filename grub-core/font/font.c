@@ -55,9 +55,21 @@ struct char_index_entry
 #define FONT_WEIGHT_BOLD 200
 #define ASCII_BITMAP_SIZE 16
 
+/* Size in bytes of the width, height, x and y offsets and device width
+   heading each glyph in the DATA section.  */
+#define FONT_GLYPH_HEADER_SIZE (2 + 2 + 2 + 2 + 2)
+
+/* Glyph data of at most this size is read and decoded in one pass when the
+   font is loaded, rather than glyph by glyph as the glyphs are used.  */
+#define FONT_ATLAS_MAX_SIZE (4 << 20)
+
 /* Definition of font registry.  */
 struct grub_font_node *grub_font_list;
 
+/* Changes whenever a font is added to or removed from the registry, so
+   that the fallback orders get rebuilt.  */
+static unsigned font_list_gen = 1;
+
 static int register_font (grub_font_t font);
 static void font_init (grub_font_t font);
 static void free_font (grub_font_t font);
@@ -206,6 +218,9 @@ font_init (grub_font_t font)
   font->num_chars = 0;
   font->char_index = 0;
   font->bmp_idx = 0;
+  font->atlas = 0;
+  font->fallback = 0;
+  font->fallback_gen = 0;
 }
 
 /* Open the next section in the file.
@@ -274,6 +289,7 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
 {
   unsigned i;
   grub_uint32_t last_code;
+  grub_uint8_t *raw, *ptr;
 
 #if FONT_DEBUG >= 2
   grub_dprintf ("font", "load_font_index(sect_length=%d)\n", sect_length);
@@ -302,6 +318,18 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
     return 1;
   grub_memset (font->bmp_idx, 0xff, 0x10000 * sizeof (grub_uint16_t));
 
+  /* Read the whole index at once rather than field by field.  */
+  raw = grub_malloc (sect_length);
+  if (!raw)
+    return 1;
+  if (grub_file_read (file, raw, sect_length) != (grub_ssize_t) sect_length)
+    {
+      grub_free (raw);
+      if (!grub_errno)
+	grub_error (GRUB_ERR_BAD_FONT, "font file format error: "
+		    "character index is truncated");
+      return 1;
+    }
 
 #if FONT_DEBUG >= 2
   grub_dprintf ("font", "num_chars=%d)\n", font->num_chars);
@@ -310,14 +338,13 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
   last_code = 0;
 
   /* Load the character index data from the file.  */
-  for (i = 0; i < font->num_chars; i++)
+  for (i = 0, ptr = raw; i < font->num_chars;
+       i++, ptr += FONT_CHAR_INDEX_ENTRY_SIZE)
     {
       struct char_index_entry *entry = &font->char_index[i];
 
       /* Read code point value; convert to native byte order.  */
-      if (grub_file_read (file, &entry->code, 4) != 4)
-	return 1;
-      entry->code = grub_be_to_cpu32 (entry->code);
+      entry->code = grub_be_to_cpu32 (grub_get_unaligned32 (ptr));
 
       /* Verify that characters are in ascending order.  */
       if (i != 0 && entry->code <= last_code)
@@ -325,6 +352,7 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
 	  grub_error (GRUB_ERR_BAD_FONT,
 		      "font characters not in ascending order: %u <= %u",
 		      entry->code, last_code);
+	  grub_free (raw);
 	  return 1;
 	}
 
@@ -334,13 +362,10 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
       last_code = entry->code;
 
       /* Read storage flags byte.  */
-      if (grub_file_read (file, &entry->storage_flags, 1) != 1)
-	return 1;
+      entry->storage_flags = ptr[4];
 
       /* Read glyph data offset; convert to native byte order.  */
-      if (grub_file_read (file, &entry->offset, 4) != 4)
-	return 1;
-      entry->offset = grub_be_to_cpu32 (entry->offset);
+      entry->offset = grub_be_to_cpu32 (grub_get_unaligned32 (ptr + 5));
 
       /* No glyph loaded.  Will be loaded on demand and cached thereafter.  */
       entry->glyph = 0;
@@ -352,9 +377,109 @@ load_font_index (grub_file_t file, grub_uint32_t sect_length, struct
 #endif
     }
 
+  grub_free (raw);
   return 0;
 }
 
+/* Fill GLYPH, which belongs to FONT, from the glyph header at RAW.  Return
+   the size of its bitmap in bytes.  */
+static grub_size_t
+decode_glyph_header (grub_font_t font, const grub_uint8_t *raw,
+		     struct grub_font_glyph *glyph)
+{
+  glyph->font = font;
+  glyph->width = grub_be_to_cpu16 (grub_get_unaligned16 (raw));
+  glyph->height = grub_be_to_cpu16 (grub_get_unaligned16 (raw + 2));
+  glyph->offset_x = grub_be_to_cpu16 (grub_get_unaligned16 (raw + 4));
+  glyph->offset_y = grub_be_to_cpu16 (grub_get_unaligned16 (raw + 6));
+  glyph->device_width = grub_be_to_cpu16 (grub_get_unaligned16 (raw + 8));
+
+  return ((grub_size_t) glyph->width * glyph->height + 7) / 8;
+}
+
+/* Read the glyph data, which starts at the current position of FILE, in one
+   pass and decode every glyph into a single atlas, so that using the font
+   needs no further reads.  This is only done when `font_preload' is 1, as
+   it costs a read and memory for the whole font.  Glyphs this fails for
+   are still read on demand, so errors are not fatal.  */
+static void
+load_font_atlas (grub_file_t file, grub_font_t font)
+{
+  grub_off_t data_start, data_size;
+  grub_uint8_t *data;
+  grub_uint8_t *atlas;
+  grub_size_t atlas_size = 0;
+  unsigned i;
+
+  data_start = grub_file_tell (file);
+  if (grub_file_size (file) == GRUB_FILE_SIZE_UNKNOWN
+      || grub_file_size (file) <= data_start)
+    return;
+  data_size = grub_file_size (file) - data_start;
+  if (data_size > FONT_ATLAS_MAX_SIZE)
+    return;
+
+  data = grub_malloc (data_size);
+  if (!data)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+  if (grub_file_read (file, data, data_size) != (grub_ssize_t) data_size)
+    {
+      grub_free (data);
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+
+  /* Size the atlas, skipping glyphs which are not within the data.  */
+  for (i = 0; i < font->num_chars; i++)
+    {
+      struct char_index_entry *entry = &font->char_index[i];
+      struct grub_font_glyph glyph;
+      grub_off_t off;
+      grub_size_t len;
+
+      if (entry->offset < data_start
+	  || entry->offset - data_start + FONT_GLYPH_HEADER_SIZE > data_size)
+	continue;
+      off = entry->offset - data_start;
+      len = decode_glyph_header (font, data + off, &glyph);
+      if (off + FONT_GLYPH_HEADER_SIZE + len > data_size)
+	continue;
+      atlas_size += ALIGN_UP (sizeof (glyph) + len, sizeof (grub_font_t));
+    }
+
+  font->atlas = atlas = grub_malloc (atlas_size);
+  if (!atlas)
+    {
+      grub_free (data);
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+
+  for (i = 0; i < font->num_chars; i++)
+    {
+      struct char_index_entry *entry = &font->char_index[i];
+      struct grub_font_glyph *glyph = (struct grub_font_glyph *) atlas;
+      grub_off_t off;
+      grub_size_t len;
+
+      if (entry->offset < data_start
+	  || entry->offset - data_start + FONT_GLYPH_HEADER_SIZE > data_size)
+	continue;
+      off = entry->offset - data_start;
+      len = decode_glyph_header (font, data + off, glyph);
+      if (off + FONT_GLYPH_HEADER_SIZE + len > data_size)
+	continue;
+      grub_memcpy (glyph->bitmap, data + off + FONT_GLYPH_HEADER_SIZE, len);
+      entry->glyph = glyph;
+      atlas += ALIGN_UP (sizeof (*glyph) + len, sizeof (grub_font_t));
+    }
+
+  grub_free (data);
+}
+
 /* Read the contents of the specified section as a string, which is
    allocated on the heap.  Returns 0 if there is an error.  */
 static char *
@@ -597,7 +722,11 @@ grub_font_load (const char *filename)
       else if (grub_memcmp (section.name, FONT_FORMAT_SECTION_NAMES_DATA,
 			    sizeof (FONT_FORMAT_SECTION_NAMES_DATA) - 1) == 0)
 	{
+	  const char *preload = grub_env_get ("font_preload");
+
 	  /* When the DATA section marker is reached, we stop reading.  */
+	  if (font->char_index && preload && grub_strcmp (preload, "1") == 0)
+	    load_font_atlas (file, font);
 	  break;
 	}
       else
@@ -652,25 +781,6 @@ fail:
   return 0;
 }
 
-/* Read a 16-bit big-endian integer from FILE, convert it to native byte
-   order, and store it in *VALUE.
-   Returns 0 on success, 1 on failure.  */
-static int
-read_be_uint16 (grub_file_t file, grub_uint16_t * value)
-{
-  if (grub_file_read (file, value, 2) != 2)
-    return 1;
-  *value = grub_be_to_cpu16 (*value);
-  return 0;
-}
-
-static int
-read_be_int16 (grub_file_t file, grub_int16_t * value)
-{
-  /* For the signed integer version, use the same code as for unsigned.  */
-  return read_be_uint16 (file, (grub_uint16_t *) value);
-}
-
 /* Return a pointer to the character index entry for the glyph corresponding to
    the codepoint CODE in the font FONT.  If not found, return zero.  */
 static inline struct char_index_entry *
@@ -724,12 +834,9 @@ grub_font_get_glyph_internal (grub_font_t font, grub_uint32_t code)
   if (index_entry)
     {
       struct grub_font_glyph *glyph = 0;
-      grub_uint16_t width;
-      grub_uint16_t height;
-      grub_int16_t xoff;
-      grub_int16_t yoff;
-      grub_int16_t dwidth;
-      int len;
+      struct grub_font_glyph header;
+      grub_uint8_t raw[FONT_GLYPH_HEADER_SIZE];
+      grub_size_t len;
 
       if (index_entry->glyph)
 	/* Return cached glyph.  */
@@ -746,35 +853,26 @@ grub_font_get_glyph_internal (grub_font_t font, grub_uint32_t code)
       grub_file_seek (font->file, index_entry->offset);
 
       /* Read the glyph width, height, and baseline.  */
-      if (read_be_uint16 (font->file, &width) != 0
-	  || read_be_uint16 (font->file, &height) != 0
-	  || read_be_int16 (font->file, &xoff) != 0
-	  || read_be_int16 (font->file, &yoff) != 0
-	  || read_be_int16 (font->file, &dwidth) != 0)
+      if (grub_file_read (font->file, raw, sizeof (raw)) != sizeof (raw))
 	{
 	  remove_font (font);
 	  return 0;
 	}
 
-      len = (width * height + 7) / 8;
+      len = decode_glyph_header (font, raw, &header);
       glyph = grub_malloc (sizeof (struct grub_font_glyph) + len);
       if (!glyph)
 	{
 	  remove_font (font);
 	  return 0;
 	}
-
-      glyph->font = font;
-      glyph->width = width;
-      glyph->height = height;
-      glyph->offset_x = xoff;
-      glyph->offset_y = yoff;
-      glyph->device_width = dwidth;
+      *glyph = header;
 
       /* Don't try to read empty bitmaps (e.g., space characters).  */
       if (len != 0)
 	{
-	  if (grub_file_read (font->file, glyph->bitmap, len) != len)
+	  if (grub_file_read (font->file, glyph->bitmap, len)
+	      != (grub_ssize_t) len)
 	    {
 	      remove_font (font);
 	      grub_free (glyph);
@@ -809,6 +907,8 @@ free_font (grub_font_t font)
       grub_free (font->family);
       grub_free (font->char_index);
       grub_free (font->bmp_idx);
+      grub_free (font->atlas);
+      grub_free (font->fallback);
       grub_free (font);
     }
 }
@@ -828,6 +928,7 @@ register_font (grub_font_t font)
   node->value = font;
   node->next = grub_font_list;
   grub_font_list = node;
+  font_list_gen++;
 
   return 0;
 }
@@ -848,6 +949,7 @@ remove_font (grub_font_t font)
 
 	  /* Free the node, but not the font itself.  */
 	  grub_free (cur);
+	  font_list_gen++;
 
 	  return;
 	}
@@ -974,6 +1076,54 @@ get_font_diversity (grub_font_t a, grub_font_t b)
   return d;
 }
 
+/* Fonts at least this diverse from the requested one are not used.  */
+#define FONT_MAX_DIVERSITY 10000
+
+/* Return the loaded fonts other than FONT which may stand in for it, most
+   similar first and in list order among equally similar ones, ending with
+   NULL.  The order is kept in FONT until the font list changes.  */
+static grub_font_t *
+get_fallback_order (grub_font_t font)
+{
+  struct grub_font_node *node;
+  grub_font_t *order;
+  grub_size_t count = 0, n = 0;
+
+  if (font->fallback && font->fallback_gen == font_list_gen)
+    return font->fallback;
+
+  grub_free (font->fallback);
+  font->fallback = 0;
+
+  for (node = grub_font_list; node; node = node->next)
+    count++;
+
+  order = grub_malloc ((count + 1) * sizeof (order[0]));
+  if (!order)
+    return 0;
+
+  for (node = grub_font_list; node; node = node->next)
+    {
+      grub_size_t i;
+      int d;
+
+      if (node->value == font)
+	continue;
+      d = get_font_diversity (node->value, font);
+      if (d >= FONT_MAX_DIVERSITY)
+	continue;
+      for (i = n; i > 0 && get_font_diversity (order[i - 1], font) > d; i--)
+	order[i] = order[i - 1];
+      order[i] = node->value;
+      n++;
+    }
+  order[n] = 0;
+
+  font->fallback = order;
+  font->fallback_gen = font_list_gen;
+  return order;
+}
+
 /* Get a glyph corresponding to the codepoint CODE.  If FONT contains the
    specified glyph, then it is returned.  Otherwise, all other loaded fonts
    are searched until one is found that contains a glyph for CODE.
@@ -990,10 +1140,7 @@ grub_font_get_glyph_with_fallback (grub_font_t font, grub_uint32_t code)
   /* Keep track of next node, in case there's an I/O error in
      grub_font_get_glyph_internal() and the font is removed from the list.  */
   struct grub_font_node *next;
-  /* Information on the best glyph found so far, to help find the glyph in
-     the best matching to the requested one.  */
-  int best_diversity;
-  struct grub_font_glyph *best_glyph;
+  grub_font_t *order;
 
   if (font)
     {
@@ -1001,37 +1148,36 @@ grub_font_get_glyph_with_fallback (grub_font_t font, grub_uint32_t code)
       glyph = grub_font_get_glyph_internal (font, code);
       if (glyph)
 	return glyph;
-    }
 
-  /* Otherwise, search all loaded fonts for the glyph and use the one from
-     the font that best matches the requested font.  */
-  best_diversity = 10000;
-  best_glyph = 0;
+      /* Otherwise, use the glyph from the font that best matches the
+	 requested font.  The order stays valid even if a font is removed
+	 meanwhile, as fonts are never freed.  */
+      order = get_fallback_order (font);
+      if (order)
+	{
+	  for (; *order; order++)
+	    {
+	      glyph = grub_font_get_glyph_internal (*order, code);
+	      if (glyph)
+		return glyph;
+	    }
+	  return 0;
+	}
+      grub_errno = GRUB_ERR_NONE;
+    }
 
+  /* Without a font to match, or without memory to sort the fonts, take
+     the first loaded font having the glyph.  */
   for (node = grub_font_list; node; node = next)
     {
-      grub_font_t curfont;
-
-      curfont = node->value;
       next = node->next;
 
-      glyph = grub_font_get_glyph_internal (curfont, code);
-      if (glyph && !font)
-	return glyph;
+      glyph = grub_font_get_glyph_internal (node->value, code);
       if (glyph)
-	{
-	  int d;
-
-	  d = get_font_diversity (curfont, font);
-	  if (d < best_diversity)
-	    {
-	      best_diversity = d;
-	      best_glyph = glyph;
-	    }
-	}
+	return glyph;
     }
 
-  return best_glyph;
+  return 0;
 }
 
 #if 0
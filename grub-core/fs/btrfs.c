@@ -27,6 +27,7 @@
 #include <grub/lib/crc.h>
 #include <grub/deflate.h>
 #include <minilzo.h>
+#include <zstd.h>
 #include <grub/i18n.h>
 #include <grub/btrfs.h>
 
@@ -45,6 +46,12 @@ GRUB_MOD_LICENSE ("GPLv3+");
 #define GRUB_BTRFS_LZO_BLOCK_MAX_CSIZE (GRUB_BTRFS_LZO_BLOCK_SIZE + \
 				     (GRUB_BTRFS_LZO_BLOCK_SIZE / 16) + 64 + 3)
 
+/* Linux never compresses more than this into one extent.  */
+#define GRUB_BTRFS_MAX_DECOMPRESSED (128 * 1024)
+
+/* How many decompressed extents a mount keeps.  */
+#define GRUB_BTRFS_DECOMPRESSED_CACHE 4
+
 typedef grub_uint8_t grub_btrfs_checksum_t[0x20];
 typedef grub_uint16_t grub_btrfs_uuid_t[8];
 
@@ -88,23 +95,74 @@ struct grub_btrfs_device_desc
   grub_uint64_t id;
 };
 
+/* A stripe of a mapped chunk.  The device id is kept as on disk, like
+   the ones of attached devices.  */
+struct grub_btrfs_mapped_stripe
+{
+  grub_uint64_t device_id;
+  grub_uint64_t offset;
+  /* The member device holding the stripe, once it was looked up.  */
+  grub_device_t dev;
+};
+
+/* A chunk item of the logical address space, in CPU byte order.  */
+struct grub_btrfs_mapped_chunk
+{
+  grub_uint64_t start;
+  grub_uint64_t size;
+  grub_uint64_t type;
+  grub_uint64_t stripe_length;
+  grub_uint16_t nstripes;
+  grub_uint16_t nsubstripes;
+  struct grub_btrfs_mapped_stripe *stripes;
+};
+
+/* A compressed extent decompressed in full, keyed by where it is stored.  */
+struct grub_btrfs_decompressed
+{
+  grub_uint64_t laddr;
+  grub_uint64_t zsize;
+  grub_uint8_t compression;
+  grub_size_t size;
+  char *buf;
+  unsigned long last_use;
+};
+
 struct grub_btrfs_data
 {
   struct grub_btrfs_superblock sblock;
-  grub_uint64_t tree;
-  grub_uint64_t inode;
 
   struct grub_btrfs_device_desc *devices_attached;
   unsigned n_devices_attached;
   unsigned n_devices_allocated;
 
-  /* Cached extent data.  */
+  /* The chunks known so far, sorted by start address.  */
+  struct grub_btrfs_mapped_chunk *chunks;
+  unsigned n_chunks;
+  unsigned n_chunks_allocated;
+
+  /* Cached extent data, shared by all files open on this mount.  */
   grub_uint64_t extstart;
   grub_uint64_t extend;
   grub_uint64_t extino;
   grub_uint64_t exttree;
   grub_size_t extsize;
   struct grub_btrfs_extent_data *extent;
+
+  /* Compressed extents decompressed so far, so that reads within one
+     extent decompress it only once.  */
+  struct grub_btrfs_decompressed decompressed[GRUB_BTRFS_DECOMPRESSED_CACHE];
+  unsigned long decompressed_clock;
+
+  /* Created on the first zstd extent and reused for the others.  */
+  ZSTD_DCtx *zstd_dctx;
+};
+
+struct grub_btrfs_file
+{
+  struct grub_btrfs_data *data;
+  grub_uint64_t tree;
+  grub_uint64_t inode;
 };
 
 struct grub_btrfs_chunk_item
@@ -212,6 +270,7 @@ struct grub_btrfs_extent_data
 #define GRUB_BTRFS_COMPRESSION_NONE 0
 #define GRUB_BTRFS_COMPRESSION_ZLIB 1
 #define GRUB_BTRFS_COMPRESSION_LZO  2
+#define GRUB_BTRFS_COMPRESSION_ZSTD 3
 
 #define GRUB_BTRFS_OBJECT_ID_CHUNK 0x100
 
@@ -606,114 +665,241 @@ find_device (struct grub_btrfs_data *data, grub_uint64_t id, int do_rescan)
   return ctx.dev_found;
 }
 
+/* Return the chunk ADDR lies in, or NULL if it isn't mapped yet.  */
+static struct grub_btrfs_mapped_chunk *
+chunk_map_find (struct grub_btrfs_data *data, grub_uint64_t addr)
+{
+  struct grub_btrfs_mapped_chunk *chunk;
+  unsigned lo = 0, hi = data->n_chunks;
+
+  while (lo < hi)
+    {
+      unsigned mid = lo + (hi - lo) / 2;
+      if (data->chunks[mid].start <= addr)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  if (lo == 0)
+    return NULL;
+  chunk = &data->chunks[lo - 1];
+  if (addr - chunk->start >= chunk->size)
+    return NULL;
+  return chunk;
+}
+
+/* Add the chunk item CHUNK of SIZE bytes starting at logical address
+   START to the map, unless it's there already.  */
+static grub_err_t
+chunk_map_insert (struct grub_btrfs_data *data, grub_uint64_t start,
+		  const struct grub_btrfs_chunk_item *chunk, grub_size_t size)
+{
+  const struct grub_btrfs_chunk_stripe *stripe;
+  struct grub_btrfs_mapped_stripe *stripes;
+  struct grub_btrfs_mapped_chunk *mapped;
+  unsigned lo = 0, hi = data->n_chunks, i;
+  grub_uint16_t nstripes;
+
+  if (size < sizeof (*chunk))
+    return grub_error (GRUB_ERR_BAD_FS, "invalid chunk descriptor");
+  nstripes = grub_le_to_cpu16 (chunk->nstripes);
+  if ((size - sizeof (*chunk)) / sizeof (*stripe) < nstripes)
+    return grub_error (GRUB_ERR_BAD_FS, "invalid chunk descriptor");
+
+  while (lo < hi)
+    {
+      unsigned mid = lo + (hi - lo) / 2;
+      if (data->chunks[mid].start < start)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  if (lo < data->n_chunks && data->chunks[lo].start == start)
+    return GRUB_ERR_NONE;
+
+  stripes = NULL;
+  if (nstripes)
+    {
+      stripes = grub_malloc (nstripes * sizeof (stripes[0]));
+      if (!stripes)
+	return grub_errno;
+    }
+  stripe = (const struct grub_btrfs_chunk_stripe *) (chunk + 1);
+  for (i = 0; i < nstripes; i++)
+    {
+      stripes[i].device_id = stripe[i].device_id;
+      stripes[i].offset = grub_le_to_cpu64 (stripe[i].offset);
+      stripes[i].dev = NULL;
+    }
+
+  if (data->n_chunks == data->n_chunks_allocated)
+    {
+      void *tmp;
+      unsigned n = data->n_chunks_allocated ? 2 * data->n_chunks_allocated
+	: 16;
+
+      tmp = grub_realloc (data->chunks, n * sizeof (data->chunks[0]));
+      if (!tmp)
+	{
+	  grub_free (stripes);
+	  return grub_errno;
+	}
+      data->chunks = tmp;
+      data->n_chunks_allocated = n;
+    }
+
+  mapped = &data->chunks[lo];
+  grub_memmove (mapped + 1, mapped,
+		(data->n_chunks - lo) * sizeof (data->chunks[0]));
+  data->n_chunks++;
+
+  mapped->start = start;
+  mapped->size = grub_le_to_cpu64 (chunk->size);
+  mapped->type = grub_le_to_cpu64 (chunk->type);
+  mapped->stripe_length = grub_le_to_cpu64 (chunk->stripe_length);
+  mapped->nstripes = nstripes;
+  mapped->nsubstripes = grub_le_to_cpu16 (chunk->nsubstripes);
+  mapped->stripes = stripes;
+
+  return GRUB_ERR_NONE;
+}
+
+/* Map the chunks of the superblock's system chunk array.  */
+static grub_err_t
+chunk_map_bootstrap (struct grub_btrfs_data *data)
+{
+  grub_uint8_t *ptr = data->sblock.bootstrap_mapping;
+  grub_uint8_t *end = ptr + sizeof (data->sblock.bootstrap_mapping);
+
+  while (ptr + sizeof (struct grub_btrfs_key)
+	 + sizeof (struct grub_btrfs_chunk_item) <= end)
+    {
+      struct grub_btrfs_key *key = (struct grub_btrfs_key *) ptr;
+      struct grub_btrfs_chunk_item *chunk;
+      grub_size_t size;
+      grub_err_t err;
+
+      if (key->type != GRUB_BTRFS_ITEM_TYPE_CHUNK)
+	break;
+      chunk = (struct grub_btrfs_chunk_item *) (key + 1);
+      size = sizeof (*chunk) + sizeof (struct grub_btrfs_chunk_stripe)
+	* grub_le_to_cpu16 (chunk->nstripes);
+      if ((grub_uint8_t *) chunk + size > end)
+	break;
+      grub_dprintf ("btrfs",
+		    "%" PRIxGRUB_UINT64_T " %" PRIxGRUB_UINT64_T " \n",
+		    grub_le_to_cpu64 (key->offset),
+		    grub_le_to_cpu64 (chunk->size));
+      err = chunk_map_insert (data, grub_le_to_cpu64 (key->offset),
+			      chunk, size);
+      if (err)
+	return err;
+      ptr = (grub_uint8_t *) chunk + size;
+    }
+  return GRUB_ERR_NONE;
+}
+
+/* Read the chunk item at ELEMADDR of ELEMSIZE bytes and map it.  */
+static grub_err_t
+chunk_map_read_item (struct grub_btrfs_data *data, grub_uint64_t start,
+		     grub_disk_addr_t elemaddr, grub_size_t elemsize,
+		     int recursion_depth)
+{
+  struct grub_btrfs_chunk_item *chunk;
+  grub_err_t err;
+
+  chunk = grub_malloc (elemsize);
+  if (!chunk)
+    return grub_errno;
+
+  err = grub_btrfs_read_logical (data, elemaddr, chunk, elemsize,
+				 recursion_depth);
+  if (!err)
+    err = chunk_map_insert (data, start, chunk, elemsize);
+  grub_free (chunk);
+  return err;
+}
+
+/* Look the chunk ADDR lies in up in the chunk tree and map it.  */
+static grub_err_t
+chunk_map_lookup (struct grub_btrfs_data *data, grub_uint64_t addr,
+		  int recursion_depth)
+{
+  struct grub_btrfs_key key_in, key_out;
+  grub_disk_addr_t chaddr;
+  grub_size_t chsize;
+  grub_err_t err;
+
+  key_in.object_id = grub_cpu_to_le64_compile_time (GRUB_BTRFS_OBJECT_ID_CHUNK);
+  key_in.type = GRUB_BTRFS_ITEM_TYPE_CHUNK;
+  key_in.offset = grub_cpu_to_le64 (addr);
+  err = lower_bound (data, &key_in, &key_out,
+		     data->sblock.chunk_tree,
+		     &chaddr, &chsize, NULL, recursion_depth);
+  if (err)
+    return err;
+  if (key_out.type != GRUB_BTRFS_ITEM_TYPE_CHUNK
+      || !(grub_le_to_cpu64 (key_out.offset) <= addr))
+    return grub_error (GRUB_ERR_BAD_FS,
+		       "couldn't find the chunk descriptor");
+
+  return chunk_map_read_item (data, grub_le_to_cpu64 (key_out.offset),
+			      chaddr, chsize, recursion_depth);
+}
+
 static grub_err_t
 grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 			 void *buf, grub_size_t size, int recursion_depth)
 {
   while (size > 0)
     {
-      grub_uint8_t *ptr;
-      struct grub_btrfs_key *key;
-      struct grub_btrfs_chunk_item *chunk;
+      struct grub_btrfs_mapped_chunk *chunk;
       grub_uint64_t csize;
       grub_err_t err = 0;
-      struct grub_btrfs_key key_out;
-      int challoc = 0;
       grub_device_t dev;
-      struct grub_btrfs_key key_in;
-      grub_size_t chsize;
-      grub_disk_addr_t chaddr;
 
       grub_dprintf ("btrfs", "searching for laddr %" PRIxGRUB_UINT64_T "\n",
 		    addr);
-      for (ptr = data->sblock.bootstrap_mapping;
-	   ptr < data->sblock.bootstrap_mapping
-	   + sizeof (data->sblock.bootstrap_mapping)
-	   - sizeof (struct grub_btrfs_key);)
-	{
-	  key = (struct grub_btrfs_key *) ptr;
-	  if (key->type != GRUB_BTRFS_ITEM_TYPE_CHUNK)
-	    break;
-	  chunk = (struct grub_btrfs_chunk_item *) (key + 1);
-	  grub_dprintf ("btrfs",
-			"%" PRIxGRUB_UINT64_T " %" PRIxGRUB_UINT64_T " \n",
-			grub_le_to_cpu64 (key->offset),
-			grub_le_to_cpu64 (chunk->size));
-	  if (grub_le_to_cpu64 (key->offset) <= addr
-	      && addr < grub_le_to_cpu64 (key->offset)
-	      + grub_le_to_cpu64 (chunk->size))
-	    goto chunk_found;
-	  ptr += sizeof (*key) + sizeof (*chunk)
-	    + sizeof (struct grub_btrfs_chunk_stripe)
-	    * grub_le_to_cpu16 (chunk->nstripes);
-	}
-
-      key_in.object_id = grub_cpu_to_le64_compile_time (GRUB_BTRFS_OBJECT_ID_CHUNK);
-      key_in.type = GRUB_BTRFS_ITEM_TYPE_CHUNK;
-      key_in.offset = grub_cpu_to_le64 (addr);
-      err = lower_bound (data, &key_in, &key_out,
-			 data->sblock.chunk_tree,
-			 &chaddr, &chsize, NULL, recursion_depth);
-      if (err)
-	return err;
-      key = &key_out;
-      if (key->type != GRUB_BTRFS_ITEM_TYPE_CHUNK
-	  || !(grub_le_to_cpu64 (key->offset) <= addr))
-	return grub_error (GRUB_ERR_BAD_FS,
-			   "couldn't find the chunk descriptor");
-
-      chunk = grub_malloc (chsize);
+      chunk = chunk_map_find (data, addr);
       if (!chunk)
-	return grub_errno;
-
-      challoc = 1;
-      err = grub_btrfs_read_logical (data, chaddr, chunk, chsize,
-				     recursion_depth);
-      if (err)
 	{
-	  grub_free (chunk);
-	  return err;
+	  err = chunk_map_lookup (data, addr, recursion_depth);
+	  if (err)
+	    return err;
+	  chunk = chunk_map_find (data, addr);
+	  if (!chunk)
+	    {
+	      grub_dprintf ("btrfs", "no chunk\n");
+	      return grub_error (GRUB_ERR_BAD_FS,
+				 "couldn't find the chunk descriptor");
+	    }
 	}
 
-    chunk_found:
       {
 	grub_uint64_t stripen;
 	grub_uint64_t stripe_offset;
-	grub_uint64_t off = addr - grub_le_to_cpu64 (key->offset);
+	grub_uint64_t off = addr - chunk->start;
 	grub_uint64_t chunk_stripe_length;
 	grub_uint16_t nstripes;
 	unsigned redundancy = 1;
 	unsigned i, j;
 
-	if (grub_le_to_cpu64 (chunk->size) <= off)
-	  {
-	    grub_dprintf ("btrfs", "no chunk\n");
-	    return grub_error (GRUB_ERR_BAD_FS,
-			       "couldn't find the chunk descriptor");
-	  }
-
-	nstripes = grub_le_to_cpu16 (chunk->nstripes) ? : 1;
-	chunk_stripe_length = grub_le_to_cpu64 (chunk->stripe_length) ? : 512;
+	nstripes = chunk->nstripes ? : 1;
+	chunk_stripe_length = chunk->stripe_length ? : 512;
 	grub_dprintf ("btrfs", "chunk 0x%" PRIxGRUB_UINT64_T
 		      "+0x%" PRIxGRUB_UINT64_T
 		      " (%d stripes (%d substripes) of %"
 		      PRIxGRUB_UINT64_T ")\n",
-		      grub_le_to_cpu64 (key->offset),
-		      grub_le_to_cpu64 (chunk->size),
-		      nstripes,
-		      grub_le_to_cpu16 (chunk->nsubstripes),
-		      chunk_stripe_length);
-
-	switch (grub_le_to_cpu64 (chunk->type)
-		& ~GRUB_BTRFS_CHUNK_TYPE_BITS_DONTCARE)
+		      chunk->start, chunk->size, nstripes,
+		      chunk->nsubstripes, chunk_stripe_length);
+
+	switch (chunk->type & ~GRUB_BTRFS_CHUNK_TYPE_BITS_DONTCARE)
 	  {
 	  case GRUB_BTRFS_CHUNK_TYPE_SINGLE:
 	    {
 	      grub_uint64_t stripe_length;
 	      grub_dprintf ("btrfs", "single\n");
-	      stripe_length = grub_divmod64 (grub_le_to_cpu64 (chunk->size),
-					     nstripes,
-					     NULL);
+	      stripe_length = grub_divmod64 (chunk->size, nstripes, NULL);
 	      if (stripe_length == 0)
 		stripe_length = 512;
 	      stripen = grub_divmod64 (off, stripe_length, &stripe_offset);
@@ -726,7 +912,7 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 	      grub_dprintf ("btrfs", "RAID1\n");
 	      stripen = 0;
 	      stripe_offset = off;
-	      csize = grub_le_to_cpu64 (chunk->size) - off;
+	      csize = chunk->size - off;
 	      redundancy = 2;
 	      break;
 	    }
@@ -751,7 +937,7 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 	      grub_uint64_t middle, high;
 	      grub_uint64_t low;
 	      grub_uint16_t nsubstripes;
-	      nsubstripes = grub_le_to_cpu16 (chunk->nsubstripes) ? : 1;
+	      nsubstripes = chunk->nsubstripes ? : 1;
 	      middle = grub_divmod64 (off,
 				      chunk_stripe_length,
 				      &low);
@@ -770,7 +956,7 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 	    grub_dprintf ("btrfs", "unsupported RAID\n");
 	    return grub_error (GRUB_ERR_NOT_IMPLEMENTED_YET,
 			       "unsupported RAID flags %" PRIxGRUB_UINT64_T,
-			       grub_le_to_cpu64 (chunk->type));
+			       chunk->type);
 	  }
 	if (csize == 0)
 	  return grub_error (GRUB_ERR_BUG,
@@ -782,32 +968,37 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
 	  {
 	    for (i = 0; i < redundancy; i++)
 	      {
-		struct grub_btrfs_chunk_stripe *stripe;
+		struct grub_btrfs_mapped_stripe *stripe;
 		grub_disk_addr_t paddr;
 
-		stripe = (struct grub_btrfs_chunk_stripe *) (chunk + 1);
 		/* Right now the redundancy handling is easy.
 		   With RAID5-like it will be more difficult.  */
-		stripe += stripen + i;
+		if (stripen + i >= chunk->nstripes)
+		  {
+		    err = grub_error (GRUB_ERR_BAD_FS,
+				      "couldn't find the chunk descriptor");
+		    grub_errno = GRUB_ERR_NONE;
+		    continue;
+		  }
+		stripe = &chunk->stripes[stripen + i];
 
-		paddr = grub_le_to_cpu64 (stripe->offset) + stripe_offset;
+		paddr = stripe->offset + stripe_offset;
 
 		grub_dprintf ("btrfs", "chunk 0x%" PRIxGRUB_UINT64_T
 			      "+0x%" PRIxGRUB_UINT64_T
 			      " (%d stripes (%d substripes) of %"
 			      PRIxGRUB_UINT64_T ") stripe %" PRIxGRUB_UINT64_T
 			      " maps to 0x%" PRIxGRUB_UINT64_T "\n",
-			      grub_le_to_cpu64 (key->offset),
-			      grub_le_to_cpu64 (chunk->size),
-			      grub_le_to_cpu16 (chunk->nstripes),
-			      grub_le_to_cpu16 (chunk->nsubstripes),
-			      grub_le_to_cpu64 (chunk->stripe_length),
+			      chunk->start, chunk->size, chunk->nstripes,
+			      chunk->nsubstripes, chunk->stripe_length,
 			      stripen, stripe->offset);
 		grub_dprintf ("btrfs", "reading paddr 0x%" PRIxGRUB_UINT64_T
 			      " for laddr 0x%" PRIxGRUB_UINT64_T "\n", paddr,
 			      addr);
 
-		dev = find_device (data, stripe->device_id, j);
+		dev = stripe->dev;
+		if (!dev)
+		  dev = stripe->dev = find_device (data, stripe->device_id, j);
 		if (!dev)
 		  {
 		    err = grub_errno;
@@ -831,33 +1022,90 @@ grub_btrfs_read_logical (struct grub_btrfs_data *data, grub_disk_addr_t addr,
       size -= csize;
       buf = (grub_uint8_t *) buf + csize;
       addr += csize;
-      if (challoc)
-	grub_free (chunk);
     }
   return GRUB_ERR_NONE;
 }
 
-static struct grub_btrfs_data *
-grub_btrfs_mount (grub_device_t dev)
+/* Map all the chunks of the chunk tree at once.  Chunks it fails to
+   load are looked up when they are first needed.  */
+static void
+chunk_map_load (struct grub_btrfs_data *data)
 {
-  struct grub_btrfs_data *data;
+  struct grub_btrfs_key key_in, key_out;
+  struct grub_btrfs_leaf_descriptor desc;
+  grub_disk_addr_t elemaddr;
+  grub_size_t elemsize;
   grub_err_t err;
+  int r = 1;
 
-  if (!dev->disk)
+  key_in.object_id = grub_cpu_to_le64_compile_time (GRUB_BTRFS_OBJECT_ID_CHUNK);
+  key_in.type = GRUB_BTRFS_ITEM_TYPE_CHUNK;
+  key_in.offset = 0;
+  err = lower_bound (data, &key_in, &key_out, data->sblock.chunk_tree,
+		     &elemaddr, &elemsize, &desc, 0);
+  if (err)
     {
-      grub_error (GRUB_ERR_BAD_FS, "not BtrFS");
-      return NULL;
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+
+  while (r > 0)
+    {
+      if (key_out.object_id == key_in.object_id
+	  && key_out.type == GRUB_BTRFS_ITEM_TYPE_CHUNK)
+	{
+	  err = chunk_map_read_item (data, grub_le_to_cpu64 (key_out.offset),
+				     elemaddr, elemsize, 0);
+	  if (err)
+	    break;
+	}
+      else if (key_cmp (&key_out, &key_in) > 0)
+	break;
+      r = next (data, &desc, &elemaddr, &elemsize, &key_out);
     }
 
+  grub_dprintf ("btrfs", "%u chunks mapped\n", data->n_chunks);
+  free_iterator (&desc);
+  grub_errno = GRUB_ERR_NONE;
+}
+
+static void
+grub_btrfs_unmount (void *mount_data)
+{
+  struct grub_btrfs_data *data = mount_data;
+  unsigned i;
+  /* The device 0 is closed one layer upper.  */
+  for (i = 1; i < data->n_devices_attached; i++)
+    grub_device_close (data->devices_attached[i].dev);
+  grub_free (data->devices_attached);
+  for (i = 0; i < data->n_chunks; i++)
+    grub_free (data->chunks[i].stripes);
+  grub_free (data->chunks);
+  grub_free (data->extent);
+  for (i = 0; i < ARRAY_SIZE (data->decompressed); i++)
+    grub_free (data->decompressed[i].buf);
+  ZSTD_freeDCtx (data->zstd_dctx);
+  grub_free (data);
+}
+
+static grub_err_t
+grub_btrfs_mount (grub_device_t dev, void **mount_data)
+{
+  struct grub_btrfs_data *data;
+  grub_err_t err;
+
+  if (!dev->disk)
+    return grub_error (GRUB_ERR_BAD_FS, "not BtrFS");
+
   data = grub_zalloc (sizeof (*data));
   if (!data)
-    return NULL;
+    return grub_errno;
 
   err = read_sblock (dev->disk, &data->sblock);
   if (err)
     {
       grub_free (data);
-      return NULL;
+      return err;
     }
 
   data->n_devices_allocated = 16;
@@ -866,25 +1114,40 @@ grub_btrfs_mount (grub_device_t dev)
   if (!data->devices_attached)
     {
       grub_free (data);
-      return NULL;
+      return grub_errno;
     }
   data->n_devices_attached = 1;
   data->devices_attached[0].dev = dev;
   data->devices_attached[0].id = data->sblock.this_device.device_id;
 
+  err = chunk_map_bootstrap (data);
+  if (err)
+    {
+      grub_btrfs_unmount (data);
+      return err;
+    }
+  chunk_map_load (data);
+
+  *mount_data = data;
+  return GRUB_ERR_NONE;
+}
+
+static struct grub_fs grub_btrfs_fs;
+
+static struct grub_btrfs_data *
+grub_btrfs_get (grub_device_t dev)
+{
+  void *data;
+
+  if (grub_fs_mount (&grub_btrfs_fs, dev, &data) != GRUB_ERR_NONE)
+    return NULL;
   return data;
 }
 
 static void
-grub_btrfs_unmount (struct grub_btrfs_data *data)
+grub_btrfs_put (struct grub_btrfs_data *data)
 {
-  unsigned i;
-  /* The device 0 is closed one layer upper.  */
-  for (i = 1; i < data->n_devices_attached; i++)
-    grub_device_close (data->devices_attached[i].dev);
-  grub_free (data->devices_attached);
-  grub_free (data->extent);
-  grub_free (data);
+  grub_fs_unmount (&grub_btrfs_fs, data);
 }
 
 static grub_err_t
@@ -919,6 +1182,7 @@ grub_btrfs_lzo_decompress(char *ibuf, grub_size_t isize, grub_off_t off,
   grub_uint32_t total_size, cblock_size;
   grub_size_t ret = 0;
   char *ibuf0 = ibuf;
+  grub_uint8_t *buf = NULL;
 
   total_size = grub_le_to_cpu32 (grub_get_unaligned32 (ibuf));
   ibuf += sizeof (total_size);
@@ -943,7 +1207,7 @@ grub_btrfs_lzo_decompress(char *ibuf, grub_size_t isize, grub_off_t off,
       ibuf += cblock_size;
     }
 
-  while (osize > 0)
+  while (osize > 0 && (grub_size_t) (ibuf - ibuf0) < total_size)
     {
       lzo_uint usize = GRUB_BTRFS_LZO_BLOCK_SIZE;
 
@@ -955,30 +1219,31 @@ grub_btrfs_lzo_decompress(char *ibuf, grub_size_t isize, grub_off_t off,
       ibuf += sizeof (cblock_size);
 
       if (cblock_size > GRUB_BTRFS_LZO_BLOCK_MAX_CSIZE)
-	return -1;
+	goto fail;
 
       /* Block partially filled with requested data.  */
       if (off > 0 || osize < GRUB_BTRFS_LZO_BLOCK_SIZE)
 	{
 	  grub_size_t to_copy = GRUB_BTRFS_LZO_BLOCK_SIZE - off;
-	  grub_uint8_t *buf;
 
 	  if (to_copy > osize)
 	    to_copy = osize;
 
-	  buf = grub_malloc (GRUB_BTRFS_LZO_BLOCK_SIZE);
+	  /* Only the first and the last block can be partial, so one page
+	     serves both.  */
 	  if (!buf)
-	    return -1;
-
-	  if (lzo1x_decompress_safe ((lzo_bytep)ibuf, cblock_size, buf, &usize,
-	      NULL) != LZO_E_OK)
 	    {
-	      grub_free (buf);
-	      return -1;
+	      buf = grub_malloc (GRUB_BTRFS_LZO_BLOCK_SIZE);
+	      if (!buf)
+		return -1;
 	    }
 
-	  if (to_copy > usize)
-	    to_copy = usize;
+	  if (lzo1x_decompress_safe ((lzo_bytep)ibuf, cblock_size, buf, &usize,
+	      NULL) != LZO_E_OK || usize <= off)
+	    goto fail;
+
+	  if (to_copy > usize - off)
+	    to_copy = usize - off;
 	  grub_memcpy(obuf, buf + off, to_copy);
 
 	  osize -= to_copy;
@@ -986,15 +1251,13 @@ grub_btrfs_lzo_decompress(char *ibuf, grub_size_t isize, grub_off_t off,
 	  obuf += to_copy;
 	  ibuf += cblock_size;
 	  off = 0;
-
-	  grub_free (buf);
 	  continue;
 	}
 
       /* Decompress whole block directly to output buffer.  */
       if (lzo1x_decompress_safe ((lzo_bytep)ibuf, cblock_size, (lzo_bytep)obuf,
 	  &usize, NULL) != LZO_E_OK)
-	return -1;
+	goto fail;
 
       osize -= usize;
       ret += usize;
@@ -1002,7 +1265,161 @@ grub_btrfs_lzo_decompress(char *ibuf, grub_size_t isize, grub_off_t off,
       ibuf += cblock_size;
     }
 
+  grub_free (buf);
   return ret;
+
+ fail:
+  grub_free (buf);
+  return -1;
+}
+
+static grub_ssize_t
+grub_btrfs_zstd_decompress (struct grub_btrfs_data *data, char *ibuf,
+			    grub_size_t isize, grub_off_t off, char *obuf,
+			    grub_size_t osize)
+{
+  grub_size_t zret;
+  char *tmp;
+
+  if (!data->zstd_dctx)
+    {
+      data->zstd_dctx = ZSTD_createDCtx ();
+      if (!data->zstd_dctx)
+	return -1;
+    }
+
+  /* The data may be padded past the end of the frame.  */
+  zret = ZSTD_findFrameCompressedSize (ibuf, isize);
+  if (ZSTD_isError (zret))
+    goto fail;
+  isize = zret;
+
+  /* A frame only decodes into a buffer that holds all of it, so try OBUF
+     first and fall back to one as big as any extent.  */
+  if (off == 0)
+    {
+      zret = ZSTD_decompressDCtx (data->zstd_dctx, obuf, osize, ibuf, isize);
+      if (!ZSTD_isError (zret))
+	return zret;
+      if (ZSTD_getErrorCode (zret) != ZSTD_error_dstSize_tooSmall)
+	goto fail;
+    }
+
+  tmp = grub_malloc (GRUB_BTRFS_MAX_DECOMPRESSED);
+  if (!tmp)
+    return -1;
+  zret = ZSTD_decompressDCtx (data->zstd_dctx, tmp,
+			      GRUB_BTRFS_MAX_DECOMPRESSED, ibuf, isize);
+  if (ZSTD_isError (zret))
+    {
+      grub_free (tmp);
+      goto fail;
+    }
+  if (off >= zret)
+    osize = 0;
+  else if (osize > zret - off)
+    osize = zret - off;
+  grub_memcpy (obuf, tmp + off, osize);
+  grub_free (tmp);
+  return osize;
+
+ fail:
+  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "zstd: %s",
+	      ZSTD_getErrorName (zret));
+  return -1;
+}
+
+static grub_ssize_t
+grub_btrfs_decompress (struct grub_btrfs_data *data, grub_uint8_t compression,
+		       char *ibuf, grub_size_t isize, grub_off_t off,
+		       char *obuf, grub_size_t osize)
+{
+  grub_ssize_t ret = -1;
+
+  switch (compression)
+    {
+    case GRUB_BTRFS_COMPRESSION_ZLIB:
+      ret = grub_zlib_decompress (ibuf, isize, off, obuf, osize);
+      break;
+    case GRUB_BTRFS_COMPRESSION_LZO:
+      ret = grub_btrfs_lzo_decompress (ibuf, isize, off, obuf, osize);
+      break;
+    case GRUB_BTRFS_COMPRESSION_ZSTD:
+      ret = grub_btrfs_zstd_decompress (data, ibuf, isize, off, obuf, osize);
+      break;
+    }
+  if (ret < 0 && !grub_errno)
+    grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "premature end of compressed");
+  return ret;
+}
+
+/* Return the regular extent DATA->extent decompressed in full, reusing the
+   result of an earlier read of the same extent if there is one.  */
+static struct grub_btrfs_decompressed *
+grub_btrfs_extent_decompress (struct grub_btrfs_data *data)
+{
+  struct grub_btrfs_extent_data *extent = data->extent;
+  struct grub_btrfs_decompressed *entry, *victim = NULL;
+  grub_uint64_t laddr = grub_le_to_cpu64 (extent->laddr);
+  grub_uint64_t zsize = grub_le_to_cpu64 (extent->compressed_size);
+  grub_uint64_t size = grub_le_to_cpu64 (extent->size);
+  grub_ssize_t ret;
+  char *tmp, *out;
+  unsigned i;
+
+  for (i = 0; i < ARRAY_SIZE (data->decompressed); i++)
+    {
+      entry = &data->decompressed[i];
+      if (entry->buf && entry->laddr == laddr && entry->zsize == zsize
+	  && entry->compression == extent->compression)
+	{
+	  entry->last_use = ++data->decompressed_clock;
+	  return entry;
+	}
+      if (!victim || (victim->buf && (!entry->buf
+				      || entry->last_use < victim->last_use)))
+	victim = entry;
+    }
+
+  if (size == 0 || size > GRUB_BTRFS_MAX_DECOMPRESSED
+      || zsize == 0 || zsize > GRUB_BTRFS_MAX_DECOMPRESSED)
+    {
+      grub_error (GRUB_ERR_BAD_FS, "invalid compressed extent size");
+      return NULL;
+    }
+
+  tmp = grub_malloc (zsize);
+  if (!tmp)
+    return NULL;
+  if (grub_btrfs_read_logical (data, laddr, tmp, zsize, 0))
+    {
+      grub_free (tmp);
+      return NULL;
+    }
+
+  out = grub_malloc (size);
+  if (!out)
+    {
+      grub_free (tmp);
+      return NULL;
+    }
+  ret = grub_btrfs_decompress (data, extent->compression, tmp, zsize, 0,
+			       out, size);
+  grub_free (tmp);
+  if (ret < 0)
+    {
+      grub_free (out);
+      return NULL;
+    }
+
+  grub_free (victim->buf);
+  victim->laddr = laddr;
+  victim->zsize = zsize;
+  victim->compression = extent->compression;
+  victim->size = ret;
+  victim->buf = out;
+  victim->last_use = ++data->decompressed_clock;
+  return victim;
 }
 
 static grub_ssize_t
@@ -1087,7 +1504,8 @@ grub_btrfs_extent_read (struct grub_btrfs_data *data,
 
       if (data->extent->compression != GRUB_BTRFS_COMPRESSION_NONE
 	  && data->extent->compression != GRUB_BTRFS_COMPRESSION_ZLIB
-	  && data->extent->compression != GRUB_BTRFS_COMPRESSION_LZO)
+	  && data->extent->compression != GRUB_BTRFS_COMPRESSION_LZO
+	  && data->extent->compression != GRUB_BTRFS_COMPRESSION_ZSTD)
 	{
 	  grub_error (GRUB_ERR_NOT_IMPLEMENTED_YET,
 		      "compression type 0x%x not supported",
@@ -1104,13 +1522,16 @@ grub_btrfs_extent_read (struct grub_btrfs_data *data,
       switch (data->extent->type)
 	{
 	case GRUB_BTRFS_EXTENT_INLINE:
-	  if (data->extent->compression == GRUB_BTRFS_COMPRESSION_ZLIB)
+	  if (data->extent->compression != GRUB_BTRFS_COMPRESSION_NONE)
 	    {
-	      if (grub_zlib_decompress (data->extent->inl, data->extsize -
-					((grub_uint8_t *) data->extent->inl
-					 - (grub_uint8_t *) data->extent),
-					extoff, buf, csize)
-		  != (grub_ssize_t) csize)
+	      grub_ssize_t ret;
+
+	      ret = grub_btrfs_decompress (data, data->extent->compression,
+					   data->extent->inl, data->extsize -
+					   ((grub_uint8_t *) data->extent->inl
+					    - (grub_uint8_t *) data->extent),
+					   extoff, buf, csize);
+	      if (ret != (grub_ssize_t) csize)
 		{
 		  if (!grub_errno)
 		    grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
@@ -1118,15 +1539,6 @@ grub_btrfs_extent_read (struct grub_btrfs_data *data,
 		  return -1;
 		}
 	    }
-	  else if (data->extent->compression == GRUB_BTRFS_COMPRESSION_LZO)
-	    {
-	      if (grub_btrfs_lzo_decompress(data->extent->inl, data->extsize -
-					   ((grub_uint8_t *) data->extent->inl
-					    - (grub_uint8_t *) data->extent),
-					   extoff, buf, csize)
-		  != (grub_ssize_t) csize)
-		return -1;
-	    }
 	  else
 	    grub_memcpy (buf, data->extent->inl + extoff, csize);
 	  break;
@@ -1139,44 +1551,21 @@ grub_btrfs_extent_read (struct grub_btrfs_data *data,
 
 	  if (data->extent->compression != GRUB_BTRFS_COMPRESSION_NONE)
 	    {
-	      char *tmp;
-	      grub_uint64_t zsize;
-	      grub_ssize_t ret;
+	      struct grub_btrfs_decompressed *dec;
+	      grub_uint64_t doff;
 
-	      zsize = grub_le_to_cpu64 (data->extent->compressed_size);
-	      tmp = grub_malloc (zsize);
-	      if (!tmp)
+	      dec = grub_btrfs_extent_decompress (data);
+	      if (!dec)
 		return -1;
-	      err = grub_btrfs_read_logical (data,
-					     grub_le_to_cpu64 (data->extent->laddr),
-					     tmp, zsize, 0);
-	      if (err)
-		{
-		  grub_free (tmp);
-		  return -1;
-		}
 
-	      if (data->extent->compression == GRUB_BTRFS_COMPRESSION_ZLIB)
-		ret = grub_zlib_decompress (tmp, zsize, extoff
-				    + grub_le_to_cpu64 (data->extent->offset),
-				    buf, csize);
-	      else if (data->extent->compression == GRUB_BTRFS_COMPRESSION_LZO)
-		ret = grub_btrfs_lzo_decompress (tmp, zsize, extoff
-				    + grub_le_to_cpu64 (data->extent->offset),
-				    buf, csize);
-	      else
-		ret = -1;
-
-	      grub_free (tmp);
-
-	      if (ret != (grub_ssize_t) csize)
+	      doff = grub_le_to_cpu64 (data->extent->offset) + extoff;
+	      if (doff > dec->size || dec->size - doff < csize)
 		{
-		  if (!grub_errno)
-		    grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
-				"premature end of compressed");
+		  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			      "premature end of compressed");
 		  return -1;
 		}
-
+	      grub_memcpy (buf, dec->buf + doff, csize);
 	      break;
 	    }
 	  err = grub_btrfs_read_logical (data,
@@ -1509,7 +1898,7 @@ static grub_err_t
 grub_btrfs_dir (grub_device_t device, const char *path,
 		grub_fs_dir_hook_t hook, void *hook_data)
 {
-  struct grub_btrfs_data *data = grub_btrfs_mount (device);
+  struct grub_btrfs_data *data = grub_btrfs_get (device);
   struct grub_btrfs_key key_in, key_out;
   grub_err_t err;
   grub_disk_addr_t elemaddr;
@@ -1527,12 +1916,12 @@ grub_btrfs_dir (grub_device_t device, const char *path,
   err = find_path (data, path, &key_in, &tree, &type);
   if (err)
     {
-      grub_btrfs_unmount (data);
+      grub_btrfs_put (data);
       return err;
     }
   if (type != GRUB_BTRFS_DIR_ITEM_TYPE_DIRECTORY)
     {
-      grub_btrfs_unmount (data);
+      grub_btrfs_put (data);
       return grub_error (GRUB_ERR_BAD_FILE_TYPE, N_("not a directory"));
     }
 
@@ -1540,7 +1929,7 @@ grub_btrfs_dir (grub_device_t device, const char *path,
 		     &elemaddr, &elemsize, &desc, 0);
   if (err)
     {
-      grub_btrfs_unmount (data);
+      grub_btrfs_put (data);
       return err;
     }
   if (key_out.type != GRUB_BTRFS_ITEM_TYPE_DIR_ITEM
@@ -1613,7 +2002,7 @@ out:
   grub_free (direl);
 
   free_iterator (&desc);
-  grub_btrfs_unmount (data);
+  grub_btrfs_put (data);
 
   return -r;
 }
@@ -1621,7 +2010,8 @@ out:
 static grub_err_t
 grub_btrfs_open (struct grub_file *file, const char *name)
 {
-  struct grub_btrfs_data *data = grub_btrfs_mount (file->device);
+  struct grub_btrfs_data *data = grub_btrfs_get (file->device);
+  struct grub_btrfs_file *f;
   grub_err_t err;
   struct grub_btrfs_inode inode;
   grub_uint8_t type;
@@ -1630,36 +2020,46 @@ grub_btrfs_open (struct grub_file *file, const char *name)
   if (!data)
     return grub_errno;
 
-  err = find_path (data, name, &key_in, &data->tree, &type);
-  if (err)
+  f = grub_malloc (sizeof (*f));
+  if (!f)
     {
-      grub_btrfs_unmount (data);
-      return err;
+      grub_btrfs_put (data);
+      return grub_errno;
     }
+  f->data = data;
+
+  err = find_path (data, name, &key_in, &f->tree, &type);
+  if (err)
+    goto fail;
   if (type != GRUB_BTRFS_DIR_ITEM_TYPE_REGULAR)
     {
-      grub_btrfs_unmount (data);
-      return grub_error (GRUB_ERR_BAD_FILE_TYPE, N_("not a regular file"));
+      err = grub_error (GRUB_ERR_BAD_FILE_TYPE, N_("not a regular file"));
+      goto fail;
     }
 
-  data->inode = key_in.object_id;
-  err = grub_btrfs_read_inode (data, &inode, data->inode, data->tree);
+  f->inode = key_in.object_id;
+  err = grub_btrfs_read_inode (data, &inode, f->inode, f->tree);
   if (err)
-    {
-      grub_btrfs_unmount (data);
-      return err;
-    }
+    goto fail;
 
-  file->data = data;
+  file->data = f;
   file->size = grub_le_to_cpu64 (inode.size);
 
   return err;
+
+ fail:
+  grub_free (f);
+  grub_btrfs_put (data);
+  return err;
 }
 
 static grub_err_t
 grub_btrfs_close (grub_file_t file)
 {
-  grub_btrfs_unmount (file->data);
+  struct grub_btrfs_file *f = file->data;
+
+  grub_btrfs_put (f->data);
+  grub_free (f);
 
   return GRUB_ERR_NONE;
 }
@@ -1667,10 +2067,10 @@ grub_btrfs_close (grub_file_t file)
 static grub_ssize_t
 grub_btrfs_read (grub_file_t file, char *buf, grub_size_t len)
 {
-  struct grub_btrfs_data *data = file->data;
+  struct grub_btrfs_file *f = file->data;
 
-  return grub_btrfs_extent_read (data, data->inode,
-				 data->tree, file->offset, buf, len);
+  return grub_btrfs_extent_read (f->data, f->inode,
+				 f->tree, file->offset, buf, len);
 }
 
 static grub_err_t
@@ -1680,7 +2080,7 @@ grub_btrfs_uuid (grub_device_t device, char **uuid)
 
   *uuid = NULL;
 
-  data = grub_btrfs_mount (device);
+  data = grub_btrfs_get (device);
   if (!data)
     return grub_errno;
 
@@ -1694,7 +2094,7 @@ grub_btrfs_uuid (grub_device_t device, char **uuid)
 			  grub_be_to_cpu16 (data->sblock.uuid[6]),
 			  grub_be_to_cpu16 (data->sblock.uuid[7]));
 
-  grub_btrfs_unmount (data);
+  grub_btrfs_put (data);
 
   return grub_errno;
 }
@@ -1706,13 +2106,13 @@ grub_btrfs_label (grub_device_t device, char **label)
 
   *label = NULL;
 
-  data = grub_btrfs_mount (device);
+  data = grub_btrfs_get (device);
   if (!data)
     return grub_errno;
 
   *label = grub_strndup (data->sblock.label, sizeof (data->sblock.label));
 
-  grub_btrfs_unmount (data);
+  grub_btrfs_put (data);
 
   return grub_errno;
 }
@@ -1749,6 +2149,14 @@ grub_btrfs_embed (grub_device_t device __attribute__ ((unused)),
 }
 #endif
 
+/* Only the primary superblock is required to be present.  */
+static const struct grub_fs_signature grub_btrfs_signatures[] =
+  {
+    { 64 * 2 * GRUB_DISK_SECTOR_SIZE + 64,
+      sizeof (GRUB_BTRFS_SIGNATURE) - 1, GRUB_BTRFS_SIGNATURE },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_btrfs_fs = {
   .name = "btrfs",
   .dir = grub_btrfs_dir,
@@ -1757,6 +2165,9 @@ static struct grub_fs grub_btrfs_fs = {
   .close = grub_btrfs_close,
   .uuid = grub_btrfs_uuid,
   .label = grub_btrfs_label,
+  .mount = grub_btrfs_mount,
+  .unmount = grub_btrfs_unmount,
+  .signatures = grub_btrfs_signatures,
 #ifdef GRUB_UTIL
   .embed = grub_btrfs_embed,
   .reserved_first_sector = 1,
@@ -451,8 +451,11 @@ grub_ext4_find_leaf (struct grub_ext2_data *data,
   return 0;
 }
 
+/* Return the disk block of FILEBLOCK, and the number of blocks stored
+   contiguously from there in COUNT.  */
 static grub_disk_addr_t
-grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
+grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock,
+		      grub_disk_addr_t *count)
 {
   struct grub_ext2_data *data = node->data;
   struct grub_ext2_inode *inode = &node->inode;
@@ -463,6 +466,8 @@ grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
   grub_uint32_t indir;
   int shift;
 
+  *count = 1;
+
   if (inode->flags & grub_cpu_to_le32_compile_time (EXT4_EXTENTS_FLAG))
     {
       struct grub_ext4_extent_header *leaf;
@@ -486,9 +491,16 @@ grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
 
       if (--i >= 0)
         {
-          fileblock -= grub_le_to_cpu32 (ext[i].block);
-          if (fileblock >= grub_le_to_cpu16 (ext[i].len))
-	    ret = 0;
+          grub_disk_addr_t extoff;
+
+          extoff = fileblock - grub_le_to_cpu32 (ext[i].block);
+          if (extoff >= grub_le_to_cpu16 (ext[i].len))
+	    {
+	      /* A hole, up to the next extent in this leaf.  */
+	      ret = 0;
+	      if (i + 1 < grub_le_to_cpu16 (leaf->entries))
+		*count = grub_le_to_cpu32 (ext[i + 1].block) - fileblock;
+	    }
           else
             {
               grub_disk_addr_t start;
@@ -496,7 +508,8 @@ grub_ext2_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
               start = grub_le_to_cpu16 (ext[i].start_hi);
               start = (start << 32) + grub_le_to_cpu32 (ext[i].start);
 
-              ret = fileblock + start;
+              ret = extoff + start;
+	      *count = grub_le_to_cpu16 (ext[i].len) - extoff;
             }
         }
       else
@@ -568,12 +581,12 @@ grub_ext2_read_file (grub_fshelp_node_t node,
 		     grub_disk_read_hook_t read_hook, void *read_hook_data,
 		     grub_off_t pos, grub_size_t len, char *buf)
 {
-  return grub_fshelp_read_file (node->data->disk, node,
-				read_hook, read_hook_data,
-				pos, len, buf, grub_ext2_read_block,
-				grub_cpu_to_le32 (node->inode.size)
-				| (((grub_off_t) grub_cpu_to_le32 (node->inode.size_high)) << 32),
-				LOG2_EXT2_BLOCK_SIZE (node->data), 0);
+  return grub_fshelp_read_file_extent (node->data->disk, node,
+				       read_hook, read_hook_data,
+				       pos, len, buf, grub_ext2_read_block,
+				       grub_cpu_to_le32 (node->inode.size)
+				       | (((grub_off_t) grub_cpu_to_le32 (node->inode.size_high)) << 32),
+				       LOG2_EXT2_BLOCK_SIZE (node->data), 0);
 
 }
 
@@ -620,14 +633,18 @@ grub_ext2_read_inode (struct grub_ext2_data *data,
   return 0;
 }
 
-static struct grub_ext2_data *
-grub_ext2_mount (grub_disk_t disk)
+static grub_err_t
+grub_ext2_mount (grub_device_t device, void **mount_data)
 {
   struct grub_ext2_data *data;
+  grub_disk_t disk = device->disk;
+
+  if (!disk)
+    return grub_error (GRUB_ERR_BAD_FS, "not an ext2 filesystem");
 
   data = grub_malloc (sizeof (struct grub_ext2_data));
   if (!data)
-    return 0;
+    return grub_errno;
 
   /* Read the superblock.  */
   grub_disk_read (disk, 1 * 2, 0, sizeof (struct grub_ext2_sblock),
@@ -685,14 +702,40 @@ grub_ext2_mount (grub_disk_t disk)
   if (grub_errno)
     goto fail;
 
-  return data;
+  *mount_data = data;
+  return GRUB_ERR_NONE;
 
  fail:
   if (grub_errno == GRUB_ERR_OUT_OF_RANGE)
     grub_error (GRUB_ERR_BAD_FS, "not an ext2 filesystem");
 
   grub_free (data);
-  return 0;
+  return grub_errno;
+}
+
+static void
+grub_ext2_unmount (void *mount_data)
+{
+  grub_free (mount_data);
+}
+
+static struct grub_fs grub_ext2_fs;
+
+static struct grub_ext2_data *
+grub_ext2_get (grub_device_t device)
+{
+  void *data;
+
+  if (grub_fs_mount (&grub_ext2_fs, device, &data) != GRUB_ERR_NONE)
+    return 0;
+  return data;
+}
+
+static void
+grub_ext2_put (struct grub_ext2_data *data)
+{
+  if (data)
+    grub_fs_unmount (&grub_ext2_fs, data);
 }
 
 static char *
@@ -839,7 +882,7 @@ grub_ext2_open (struct grub_file *file, const char *name)
 
   grub_dl_ref (my_mod);
 
-  data = grub_ext2_mount (file->device->disk);
+  data = grub_ext2_get (file->device);
   if (! data)
     {
       err = grub_errno;
@@ -859,20 +902,17 @@ grub_ext2_open (struct grub_file *file, const char *name)
 	goto fail;
     }
 
-  grub_memcpy (data->inode, &fdiro->inode, sizeof (struct grub_ext2_inode));
-  grub_free (fdiro);
-
-  file->size = grub_le_to_cpu32 (data->inode->size);
-  file->size |= ((grub_off_t) grub_le_to_cpu32 (data->inode->size_high)) << 32;
-  file->data = data;
+  file->size = grub_le_to_cpu32 (fdiro->inode.size);
+  file->size |= ((grub_off_t) grub_le_to_cpu32 (fdiro->inode.size_high)) << 32;
+  file->data = fdiro;
   file->offset = 0;
 
   return 0;
 
  fail:
-  if (fdiro != &data->diropen)
+  if (data && fdiro != &data->diropen)
     grub_free (fdiro);
-  grub_free (data);
+  grub_ext2_put (data);
 
   grub_dl_unref (my_mod);
 
@@ -882,7 +922,10 @@ grub_ext2_open (struct grub_file *file, const char *name)
 static grub_err_t
 grub_ext2_close (grub_file_t file)
 {
-  grub_free (file->data);
+  struct grub_fshelp_node *node = file->data;
+
+  grub_ext2_put (node->data);
+  grub_free (node);
 
   grub_dl_unref (my_mod);
 
@@ -893,9 +936,7 @@ grub_ext2_close (grub_file_t file)
 static grub_ssize_t
 grub_ext2_read (grub_file_t file, char *buf, grub_size_t len)
 {
-  struct grub_ext2_data *data = (struct grub_ext2_data *) file->data;
-
-  return grub_ext2_read_file (&data->diropen,
+  return grub_ext2_read_file (file->data,
 			      file->read_hook, file->read_hook_data,
 			      file->offset, len, buf);
 }
@@ -948,7 +989,7 @@ grub_ext2_dir (grub_device_t device, const char *path, grub_fs_dir_hook_t hook,
 
   grub_dl_ref (my_mod);
 
-  ctx.data = grub_ext2_mount (device->disk);
+  ctx.data = grub_ext2_get (device);
   if (! ctx.data)
     goto fail;
 
@@ -961,9 +1002,9 @@ grub_ext2_dir (grub_device_t device, const char *path, grub_fs_dir_hook_t hook,
   grub_ext2_iterate_dir (fdiro, grub_ext2_dir_iter, &ctx);
 
  fail:
-  if (fdiro != &ctx.data->diropen)
+  if (ctx.data && fdiro != &ctx.data->diropen)
     grub_free (fdiro);
-  grub_free (ctx.data);
+  grub_ext2_put (ctx.data);
 
   grub_dl_unref (my_mod);
 
@@ -974,11 +1015,10 @@ static grub_err_t
 grub_ext2_label (grub_device_t device, char **label)
 {
   struct grub_ext2_data *data;
-  grub_disk_t disk = device->disk;
 
   grub_dl_ref (my_mod);
 
-  data = grub_ext2_mount (disk);
+  data = grub_ext2_get (device);
   if (data)
     *label = grub_strndup (data->sblock.volume_name,
 			   sizeof (data->sblock.volume_name));
@@ -987,7 +1027,7 @@ grub_ext2_label (grub_device_t device, char **label)
 
   grub_dl_unref (my_mod);
 
-  grub_free (data);
+  grub_ext2_put (data);
 
   return grub_errno;
 }
@@ -996,11 +1036,10 @@ static grub_err_t
 grub_ext2_uuid (grub_device_t device, char **uuid)
 {
   struct grub_ext2_data *data;
-  grub_disk_t disk = device->disk;
 
   grub_dl_ref (my_mod);
 
-  data = grub_ext2_mount (disk);
+  data = grub_ext2_get (device);
   if (data)
     {
       *uuid = grub_xasprintf ("%04x%04x-%04x-%04x-%04x-%04x%04x%04x",
@@ -1018,7 +1057,7 @@ grub_ext2_uuid (grub_device_t device, char **uuid)
 
   grub_dl_unref (my_mod);
 
-  grub_free (data);
+  grub_ext2_put (data);
 
   return grub_errno;
 }
@@ -1028,11 +1067,10 @@ static grub_err_t
 grub_ext2_mtime (grub_device_t device, grub_int32_t *tm)
 {
   struct grub_ext2_data *data;
-  grub_disk_t disk = device->disk;
 
   grub_dl_ref (my_mod);
 
-  data = grub_ext2_mount (disk);
+  data = grub_ext2_get (device);
   if (!data)
     *tm = 0;
   else
@@ -1040,7 +1078,7 @@ grub_ext2_mtime (grub_device_t device, grub_int32_t *tm)
 
   grub_dl_unref (my_mod);
 
-  grub_free (data);
+  grub_ext2_put (data);
 
   return grub_errno;
 
@@ -1048,6 +1086,13 @@ grub_ext2_mtime (grub_device_t device, grub_int32_t *tm)
 
 
 
+/* s_magic, EXT2_MAGIC in little endian.  */
+static const struct grub_fs_signature grub_ext2_signatures[] =
+  {
+    { 2 * GRUB_DISK_SECTOR_SIZE + 56, 2, "\x53\xef" },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_ext2_fs =
   {
     .name = "ext2",
@@ -1058,6 +1103,9 @@ static struct grub_fs grub_ext2_fs =
     .label = grub_ext2_label,
     .uuid = grub_ext2_uuid,
     .mtime = grub_ext2_mtime,
+    .mount = grub_ext2_mount,
+    .unmount = grub_ext2_unmount,
+    .signatures = grub_ext2_signatures,
 #ifdef GRUB_UTIL
     .reserved_first_sector = 1,
     .blocklist_install = 1,
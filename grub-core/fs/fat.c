@@ -448,6 +448,67 @@ grub_fat_mount (grub_disk_t disk)
   return 0;
 }
 
+/* Advance NODE to the next cluster of the file.  Return 1 at the end of
+   the cluster chain and -1 on error.  */
+static int
+grub_fat_next_cluster (grub_disk_t disk, grub_fshelp_node_t node)
+{
+  grub_uint32_t next_cluster;
+  grub_uint32_t fat_offset;
+
+  switch (node->data->fat_size)
+    {
+    case 32:
+      fat_offset = node->cur_cluster << 2;
+      break;
+    case 16:
+      fat_offset = node->cur_cluster << 1;
+      break;
+    default:
+      /* case 12: */
+      fat_offset = node->cur_cluster + (node->cur_cluster >> 1);
+      break;
+    }
+
+  /* Read the FAT.  */
+  if (grub_disk_read (disk, node->data->fat_sector, fat_offset,
+		      (node->data->fat_size + 7) >> 3,
+		      (char *) &next_cluster))
+    return -1;
+
+  next_cluster = grub_le_to_cpu32 (next_cluster);
+  switch (node->data->fat_size)
+    {
+    case 16:
+      next_cluster &= 0xFFFF;
+      break;
+    case 12:
+      if (node->cur_cluster & 1)
+	next_cluster >>= 4;
+
+      next_cluster &= 0x0FFF;
+      break;
+    }
+
+  grub_dprintf ("fat", "fat_size=%d, next_cluster=%u\n",
+		node->data->fat_size, next_cluster);
+
+  /* Check the end.  */
+  if (next_cluster >= node->data->cluster_eof_mark)
+    return 1;
+
+  if (next_cluster < 2 || next_cluster >= node->data->num_clusters)
+    {
+      grub_error (GRUB_ERR_BAD_FS, "invalid cluster %u",
+		  next_cluster);
+      return -1;
+    }
+
+  node->cur_cluster = next_cluster;
+  node->cur_cluster_num++;
+  return 0;
+}
+
 static grub_ssize_t
 grub_fat_read_data (grub_disk_t disk, grub_fshelp_node_t node,
 		    grub_disk_read_hook_t read_hook, void *read_hook_data,
@@ -511,60 +572,14 @@ grub_fat_read_data (grub_disk_t disk, grub_fshelp_node_t node,
     {
       while (logical_cluster > node->cur_cluster_num)
 	{
-	  /* Find next cluster.  */
-	  grub_uint32_t next_cluster;
-	  grub_uint32_t fat_offset;
+	  int r;
 
-	  switch (node->data->fat_size)
-	    {
-	    case 32:
-	      fat_offset = node->cur_cluster << 2;
-	      break;
-	    case 16:
-	      fat_offset = node->cur_cluster << 1;
-	      break;
-	    default:
-	      /* case 12: */
-	      fat_offset = node->cur_cluster + (node->cur_cluster >> 1);
-	      break;
-	    }
-
-	  /* Read the FAT.  */
-	  if (grub_disk_read (disk, node->data->fat_sector, fat_offset,
-			      (node->data->fat_size + 7) >> 3,
-			      (char *) &next_cluster))
+	  r = grub_fat_next_cluster (disk, node);
+	  if (r < 0)
 	    return -1;
-
-	  next_cluster = grub_le_to_cpu32 (next_cluster);
-	  switch (node->data->fat_size)
-	    {
-	    case 16:
-	      next_cluster &= 0xFFFF;
-	      break;
-	    case 12:
-	      if (node->cur_cluster & 1)
-		next_cluster >>= 4;
-
-	      next_cluster &= 0x0FFF;
-	      break;
-	    }
-
-	  grub_dprintf ("fat", "fat_size=%d, next_cluster=%u\n",
-			node->data->fat_size, next_cluster);
-
 	  /* Check the end.  */
-	  if (next_cluster >= node->data->cluster_eof_mark)
+	  if (r > 0)
 	    return ret;
-
-	  if (next_cluster < 2 || next_cluster >= node->data->num_clusters)
-	    {
-	      grub_error (GRUB_ERR_BAD_FS, "invalid cluster %u",
-			  next_cluster);
-	      return -1;
-	    }
-
-	  node->cur_cluster = next_cluster;
-	  node->cur_cluster_num++;
 	}
 
       /* Read the data here.  */
@@ -572,6 +587,21 @@ grub_fat_read_data (grub_disk_t disk, grub_fshelp_node_t node,
 		+ ((node->cur_cluster - 2)
 		   << node->data->cluster_bits));
       size = (1 << logical_cluster_bits) - offset;
+
+      /* Read physically contiguous clusters at once.  */
+      while (size < len)
+	{
+	  grub_uint32_t prev_cluster = node->cur_cluster;
+	  int r;
+
+	  r = grub_fat_next_cluster (disk, node);
+	  if (r < 0)
+	    return -1;
+	  if (r > 0 || node->cur_cluster != prev_cluster + 1)
+	    break;
+	  logical_cluster++;
+	  size += 1 << logical_cluster_bits;
+	}
       if (size > len)
 	size = len;
 
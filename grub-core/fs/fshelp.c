@@ -344,23 +344,46 @@ grub_fshelp_find_file_lookup (const char *path, grub_fshelp_node_t rootnode,
 
 }
 
-/* Read LEN bytes from the file NODE on disk DISK into the buffer BUF,
-   beginning with the block POS.  READ_HOOK should be set before
-   reading a block from the file.  READ_HOOK_DATA is passed through as
-   the DATA argument to READ_HOOK.  GET_BLOCK is used to translate
-   file blocks to disk blocks.  The file is FILESIZE bytes big and the
-   blocks have a size of LOG2BLOCKSIZE (in log2).  */
-grub_ssize_t
-grub_fshelp_read_file (grub_disk_t disk, grub_fshelp_node_t node,
-		       grub_disk_read_hook_t read_hook, void *read_hook_data,
-		       grub_off_t pos, grub_size_t len, char *buf,
-		       grub_disk_addr_t (*get_block) (grub_fshelp_node_t node,
-                                                      grub_disk_addr_t block),
-		       grub_off_t filesize, int log2blocksize,
-		       grub_disk_addr_t blocks_start)
+typedef grub_disk_addr_t (*get_block_func) (grub_fshelp_node_t node,
+					     grub_disk_addr_t block);
+typedef grub_disk_addr_t (*get_extent_func) (grub_fshelp_node_t node,
+					      grub_disk_addr_t block,
+					      grub_disk_addr_t *count);
+
+/* Map the file block BLOCK of NODE using either GET_BLOCK or GET_EXTENT.
+   Store the number of blocks following it in the same extent in COUNT.  */
+static grub_disk_addr_t
+grub_fshelp_map_block (grub_fshelp_node_t node, grub_disk_addr_t block,
+		       grub_disk_addr_t *count, get_block_func get_block,
+		       get_extent_func get_extent)
+{
+  grub_disk_addr_t blknr;
+
+  *count = 1;
+  if (! get_extent)
+    return get_block (node, block);
+
+  blknr = get_extent (node, block, count);
+  if (*count == 0)
+    *count = 1;
+  return blknr;
+}
+
+static grub_ssize_t
+grub_fshelp_read_file_real (grub_disk_t disk, grub_fshelp_node_t node,
+			    grub_disk_read_hook_t read_hook,
+			    void *read_hook_data,
+			    grub_off_t pos, grub_size_t len, char *buf,
+			    get_block_func get_block,
+			    get_extent_func get_extent,
+			    grub_off_t filesize, int log2blocksize,
+			    grub_disk_addr_t blocks_start)
 {
   grub_disk_addr_t i, blockcnt;
-  int blocksize = 1 << (log2blocksize + GRUB_DISK_SECTOR_BITS);
+  grub_disk_addr_t next_blknr = 0, next_count = 0;
+  int have_next = 0;
+  int log2bytes = log2blocksize + GRUB_DISK_SECTOR_BITS;
+  grub_off_t end;
 
   if (pos > filesize)
     {
@@ -372,40 +395,58 @@ grub_fshelp_read_file (grub_disk_t disk, grub_fshelp_node_t node,
   /* Adjust LEN so it we can't read past the end of the file.  */
   if (pos + len > filesize)
     len = filesize - pos;
+  end = pos + len;
 
-  blockcnt = ((len + pos) + blocksize - 1) >> (log2blocksize + GRUB_DISK_SECTOR_BITS);
+  blockcnt = (end + (1 << log2bytes) - 1) >> log2bytes;
 
-  for (i = pos >> (log2blocksize + GRUB_DISK_SECTOR_BITS); i < blockcnt; i++)
+  i = pos >> log2bytes;
+  while (i < blockcnt)
     {
-      grub_disk_addr_t blknr;
-      int blockoff = pos & (blocksize - 1);
-      int blockend = blocksize;
-
-      int skipfirst = 0;
-
-      blknr = get_block (node, i);
-      if (grub_errno)
-	return -1;
-
-      blknr = blknr << log2blocksize;
+      grub_disk_addr_t blknr, count;
+      grub_off_t run_start, run_end;
 
-      /* Last block.  */
-      if (i == blockcnt - 1)
+      if (have_next)
 	{
-	  blockend = (len + pos) & (blocksize - 1);
-
-	  /* The last portion is exactly blocksize.  */
-	  if (! blockend)
-	    blockend = blocksize;
+	  blknr = next_blknr;
+	  count = next_count;
+	  have_next = 0;
+	}
+      else
+	{
+	  blknr = grub_fshelp_map_block (node, i, &count,
+					 get_block, get_extent);
+	  if (grub_errno)
+	    return -1;
 	}
 
-      /* First block.  */
-      if (i == (pos >> (log2blocksize + GRUB_DISK_SECTOR_BITS)))
+      if (count > blockcnt - i)
+	count = blockcnt - i;
+
+      /* Merge the following blocks into this run as long as they are
+	 physically contiguous, or are holes following a hole.  */
+      while (i + count < blockcnt)
 	{
-	  skipfirst = blockoff;
-	  blockend -= skipfirst;
+	  next_blknr = grub_fshelp_map_block (node, i + count, &next_count,
+					      get_block, get_extent);
+	  if (grub_errno)
+	    return -1;
+	  if (next_count > blockcnt - i - count)
+	    next_count = blockcnt - i - count;
+	  if (blknr ? (next_blknr != blknr + count) : (next_blknr != 0))
+	    {
+	      have_next = 1;
+	      break;
+	    }
+	  count += next_count;
 	}
 
+      run_start = (grub_off_t) i << log2bytes;
+      run_end = (grub_off_t) (i + count) << log2bytes;
+      if (run_start < pos)
+	run_start = pos;
+      if (run_end > end)
+	run_end = end;
+
       /* If the block number is 0 this block is not stored on disk but
 	 is zero filled instead.  */
       if (blknr)
@@ -413,17 +454,58 @@ grub_fshelp_read_file (grub_disk_t disk, grub_fshelp_node_t node,
 	  disk->read_hook = read_hook;
 	  disk->read_hook_data = read_hook_data;
 
-	  grub_disk_read (disk, blknr + blocks_start, skipfirst,
-			  blockend, buf);
+	  grub_disk_read (disk, (blknr << log2blocksize) + blocks_start,
+			  run_start - ((grub_off_t) i << log2bytes),
+			  run_end - run_start, buf);
 	  disk->read_hook = 0;
 	  if (grub_errno)
 	    return -1;
 	}
       else
-	grub_memset (buf, 0, blockend);
+	grub_memset (buf, 0, run_end - run_start);
 
-      buf += blocksize - skipfirst;
+      buf += run_end - run_start;
+      i += count;
     }
 
   return len;
 }
+
+/* Read LEN bytes from the file NODE on disk DISK into the buffer BUF,
+   beginning with the block POS.  READ_HOOK should be set before
+   reading a block from the file.  READ_HOOK_DATA is passed through as
+   the DATA argument to READ_HOOK.  GET_BLOCK is used to translate
+   file blocks to disk blocks.  The file is FILESIZE bytes big and the
+   blocks have a size of LOG2BLOCKSIZE (in log2).  */
+grub_ssize_t
+grub_fshelp_read_file (grub_disk_t disk, grub_fshelp_node_t node,
+		       grub_disk_read_hook_t read_hook, void *read_hook_data,
+		       grub_off_t pos, grub_size_t len, char *buf,
+		       grub_disk_addr_t (*get_block) (grub_fshelp_node_t node,
+                                                      grub_disk_addr_t block),
+		       grub_off_t filesize, int log2blocksize,
+		       grub_disk_addr_t blocks_start)
+{
+  return grub_fshelp_read_file_real (disk, node, read_hook, read_hook_data,
+				     pos, len, buf, get_block, NULL,
+				     filesize, log2blocksize, blocks_start);
+}
+
+/* Like grub_fshelp_read_file, but GET_EXTENT translates the file block
+   BLOCK to a disk block and stores in COUNT how many blocks starting at
+   BLOCK are stored contiguously (or are holes, if 0 is returned).  */
+grub_ssize_t
+grub_fshelp_read_file_extent (grub_disk_t disk, grub_fshelp_node_t node,
+			      grub_disk_read_hook_t read_hook,
+			      void *read_hook_data,
+			      grub_off_t pos, grub_size_t len, char *buf,
+			      grub_disk_addr_t (*get_extent) (grub_fshelp_node_t node,
+							      grub_disk_addr_t block,
+							      grub_disk_addr_t *count),
+			      grub_off_t filesize, int log2blocksize,
+			      grub_disk_addr_t blocks_start)
+{
+  return grub_fshelp_read_file_real (disk, node, read_hook, read_hook_data,
+				     pos, len, buf, NULL, get_extent,
+				     filesize, log2blocksize, blocks_start);
+}
@@ -1414,6 +1414,12 @@ grub_hfs_uuid (grub_device_t device, char **uuid)
 
 
 
+static const struct grub_fs_signature grub_hfs_signatures[] =
+  {
+    { GRUB_HFS_SBLOCK * GRUB_DISK_SECTOR_SIZE, 2, "BD" },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_hfs_fs =
   {
     .name = "hfs",
@@ -1424,6 +1430,7 @@ static struct grub_fs grub_hfs_fs =
     .label = grub_hfs_label,
     .uuid = grub_hfs_uuid,
     .mtime = grub_hfs_mtime,
+    .signatures = grub_hfs_signatures,
 #ifdef GRUB_UTIL
     .reserved_first_sector = 1,
     .blocklist_install = 1,
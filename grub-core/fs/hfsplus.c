@@ -118,7 +118,8 @@ grub_ssize_t (*grub_hfsplus_read_compressed) (struct grub_hfsplus_file *node,
    FILEBLOCK to the next block.  */
 static grub_disk_addr_t
 grub_hfsplus_find_block (struct grub_hfsplus_extent *extent,
-			 grub_disk_addr_t *fileblock)
+			 grub_disk_addr_t *fileblock,
+			 grub_disk_addr_t *count)
 {
   int i;
   grub_disk_addr_t blksleft = *fileblock;
@@ -127,7 +128,10 @@ grub_hfsplus_find_block (struct grub_hfsplus_extent *extent,
   for (i = 0; i < 8; i++)
     {
       if (blksleft < grub_be_to_cpu32 (extent[i].count))
-	return grub_be_to_cpu32 (extent[i].start) + blksleft;
+	{
+	  *count = grub_be_to_cpu32 (extent[i].count) - blksleft;
+	  return grub_be_to_cpu32 (extent[i].start) + blksleft;
+	}
       blksleft -= grub_be_to_cpu32 (extent[i].count);
     }
 
@@ -139,9 +143,11 @@ static int grub_hfsplus_cmp_extkey (struct grub_hfsplus_key *keya,
 				    struct grub_hfsplus_key_internal *keyb);
 
 /* Search for the block FILEBLOCK inside the file NODE.  Return the
-   blocknumber of this block on disk.  */
+   blocknumber of this block on disk and the number of blocks following
+   it in the same extent in COUNT.  */
 static grub_disk_addr_t
-grub_hfsplus_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
+grub_hfsplus_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock,
+			 grub_disk_addr_t *count)
 {
   struct grub_hfsplus_btnode *nnode = 0;
   grub_disk_addr_t blksleft = fileblock;
@@ -156,7 +162,7 @@ grub_hfsplus_read_block (grub_fshelp_node_t node, grub_disk_addr_t fileblock)
       grub_off_t ptr;
 
       /* Try to find this block in the current set of extents.  */
-      blk = grub_hfsplus_find_block (extents, &blksleft);
+      blk = grub_hfsplus_find_block (extents, &blksleft, count);
 
       /* The previous iteration of this loop allocated memory.  The
 	 code above used this memory, it can be freed now.  */
@@ -215,12 +221,13 @@ grub_hfsplus_read_file (grub_fshelp_node_t node,
 			grub_disk_read_hook_t read_hook, void *read_hook_data,
 			grub_off_t pos, grub_size_t len, char *buf)
 {
-  return grub_fshelp_read_file (node->data->disk, node,
-				read_hook, read_hook_data,
-				pos, len, buf, grub_hfsplus_read_block,
-				node->size,
-				node->data->log2blksize - GRUB_DISK_SECTOR_BITS,
-				node->data->embedded_offset);
+  return grub_fshelp_read_file_extent (node->data->disk, node,
+				       read_hook, read_hook_data,
+				       pos, len, buf, grub_hfsplus_read_block,
+				       node->size,
+				       node->data->log2blksize
+				       - GRUB_DISK_SECTOR_BITS,
+				       node->data->embedded_offset);
 }
 
 static struct grub_hfsplus_data *
@@ -1075,6 +1082,15 @@ grub_hfsplus_uuid (grub_device_t device, char **uuid)
 
 
 
+/* HFS+, HFSX or an HFS wrapper around HFS+.  */
+static const struct grub_fs_signature grub_hfsplus_signatures[] =
+  {
+    { GRUB_HFSPLUS_SBLOCK * GRUB_DISK_SECTOR_SIZE, 2, "H+" },
+    { GRUB_HFSPLUS_SBLOCK * GRUB_DISK_SECTOR_SIZE, 2, "HX" },
+    { GRUB_HFSPLUS_SBLOCK * GRUB_DISK_SECTOR_SIZE, 2, "BD" },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_hfsplus_fs =
   {
     .name = "hfsplus",
@@ -1085,6 +1101,7 @@ static struct grub_fs grub_hfsplus_fs =
     .label = grub_hfsplus_label,
     .mtime = grub_hfsplus_mtime,
     .uuid = grub_hfsplus_uuid,
+    .signatures = grub_hfsplus_signatures,
 #ifdef GRUB_UTIL
     .reserved_first_sector = 1,
     .blocklist_install = 1,
@@ -1096,6 +1096,14 @@ grub_iso9660_mtime (grub_device_t device, grub_int32_t *timebuf)
 
 
 
+/* The first volume descriptor.  */
+static const struct grub_fs_signature grub_iso9660_signatures[] =
+  {
+    { (16 << GRUB_ISO9660_LOG2_BLKSZ) * GRUB_DISK_SECTOR_SIZE + 1,
+      5, "CD001" },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_iso9660_fs =
   {
     .name = "iso9660",
@@ -1106,6 +1114,7 @@ static struct grub_fs grub_iso9660_fs =
     .label = grub_iso9660_label,
     .uuid = grub_iso9660_uuid,
     .mtime = grub_iso9660_mtime,
+    .signatures = grub_iso9660_signatures,
 #ifdef GRUB_UTIL
     .reserved_first_sector = 1,
     .blocklist_install = 1,
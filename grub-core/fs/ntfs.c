@@ -1209,6 +1209,12 @@ grub_ntfs_uuid (grub_device_t device, char **uuid)
   return grub_errno;
 }
 
+static const struct grub_fs_signature grub_ntfs_signatures[] =
+  {
+    { 3, 4, "NTFS" },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_ntfs_fs =
   {
     .name = "ntfs",
@@ -1218,6 +1224,7 @@ static struct grub_fs grub_ntfs_fs =
     .close = grub_ntfs_close,
     .label = grub_ntfs_label,
     .uuid = grub_ntfs_uuid,
+    .signatures = grub_ntfs_signatures,
 #ifdef GRUB_UTIL
     .reserved_first_sector = 1,
     .blocklist_install = 1,
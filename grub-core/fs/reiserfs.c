@@ -1399,6 +1399,14 @@ grub_reiserfs_uuid (grub_device_t device, char **uuid)
   return grub_errno;
 }
 
+/* A prefix of the ReIsErFs, ReIsEr2Fs and ReIsEr3Fs magics.  */
+static const struct grub_fs_signature grub_reiserfs_signatures[] =
+  {
+    { REISERFS_SUPER_BLOCK_OFFSET + 52, sizeof (REISERFS_MAGIC_STRING) - 1,
+      REISERFS_MAGIC_STRING },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_reiserfs_fs =
   {
     .name = "reiserfs",
@@ -1408,6 +1416,7 @@ static struct grub_fs grub_reiserfs_fs =
     .close = grub_reiserfs_close,
     .label = grub_reiserfs_label,
     .uuid = grub_reiserfs_uuid,
+    .signatures = grub_reiserfs_signatures,
 #ifdef GRUB_UTIL
     .reserved_first_sector = 1,
     .blocklist_install = 1,
@@ -458,6 +458,12 @@ grub_romfs_label (grub_device_t device, char **label)
 }
 
 
+static const struct grub_fs_signature grub_romfs_signatures[] =
+  {
+    { 0, sizeof (GRUB_ROMFS_MAGIC) - 1, GRUB_ROMFS_MAGIC },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_romfs_fs =
   {
     .name = "romfs",
@@ -466,6 +472,7 @@ static struct grub_fs grub_romfs_fs =
     .read = grub_romfs_read,
     .close = grub_romfs_close,
     .label = grub_romfs_label,
+    .signatures = grub_romfs_signatures,
 #ifdef GRUB_UTIL
     .reserved_first_sector = 0,
     .blocklist_install = 0,
@@ -22,6 +22,7 @@
 #include <grub/mm.h>
 #include <grub/misc.h>
 #include <grub/disk.h>
+#include <grub/partition.h>
 #include <grub/dl.h>
 #include <grub/types.h>
 #include <grub/fshelp.h>
@@ -189,6 +190,33 @@ enum
 #define SQUASH_CHUNK_SIZE 0x2000
 #define XZBUFSIZ 0x2000
 
+/* Decompressed metadata chunks, data blocks and fragment blocks are kept
+   in a small LRU cache shared by all mounts, so that path walks and
+   sequential reads decompress every block once.  Entries are keyed by the
+   disk offset of the compressed block and dropped when
+   grub_disk_generation moves on.  */
+#define SQUASH_CACHE_ENTRIES 64
+#define SQUASH_CACHE_MAX_BYTES (4 << 20)
+
+struct grub_squash_cache_entry
+{
+  char *buf;
+  /* Bytes allocated for BUF and bytes of it holding data.  */
+  grub_size_t alloc;
+  grub_size_t size;
+  enum grub_disk_dev_id dev_id;
+  unsigned long disk_id;
+  grub_disk_addr_t part_start;
+  grub_uint64_t start;
+  grub_size_t csize;
+  grub_uint32_t last_use;
+};
+
+static struct grub_squash_cache_entry squash_cache[SQUASH_CACHE_ENTRIES];
+static grub_size_t squash_cache_bytes;
+static grub_uint32_t squash_cache_clock;
+static grub_uint32_t squash_cache_generation;
+
 struct grub_squash_data
 {
   grub_disk_t disk;
@@ -216,6 +244,149 @@ struct grub_fshelp_node
   } stack[1];
 };
 
+static void
+squash_cache_drop (struct grub_squash_cache_entry *e)
+{
+  grub_free (e->buf);
+  squash_cache_bytes -= e->alloc;
+  e->buf = NULL;
+  e->alloc = 0;
+}
+
+static void
+squash_cache_flush (void)
+{
+  unsigned i;
+
+  for (i = 0; i < SQUASH_CACHE_ENTRIES; i++)
+    if (squash_cache[i].buf)
+      squash_cache_drop (&squash_cache[i]);
+}
+
+/* Return the contents of the compressed block of CSIZE bytes at disk
+   offset START, which decompresses to at most MAXSIZE bytes.  The block
+   stays valid until the next call; *SIZE receives its length.  */
+static const char *
+get_block (struct grub_squash_data *data, grub_uint64_t start,
+	   grub_size_t csize, grub_size_t maxsize, grub_size_t *size)
+{
+  struct grub_squash_cache_entry *e, *victim;
+  grub_disk_addr_t part_start;
+  grub_ssize_t ret;
+  char *tmp;
+  unsigned i;
+
+  part_start = grub_partition_get_start (data->disk->partition);
+
+  if (squash_cache_generation != grub_disk_generation)
+    {
+      squash_cache_flush ();
+      squash_cache_generation = grub_disk_generation;
+    }
+
+  for (i = 0; i < SQUASH_CACHE_ENTRIES; i++)
+    {
+      e = &squash_cache[i];
+      if (!e->buf || e->start != start || e->csize != csize
+	  || e->dev_id != data->disk->dev->id
+	  || e->disk_id != data->disk->id
+	  || e->part_start != part_start)
+	continue;
+      /* Read before with a smaller buffer: decompress it again.  */
+      if (e->alloc < maxsize)
+	{
+	  squash_cache_drop (e);
+	  break;
+	}
+      e->last_use = ++squash_cache_clock;
+      *size = e->size;
+      return e->buf;
+    }
+
+  /* Evict the least recently used blocks until there is a free slot and
+     room for MAXSIZE more bytes.  */
+  for (;;)
+    {
+      struct grub_squash_cache_entry *oldest = NULL;
+
+      victim = NULL;
+      for (i = 0; i < SQUASH_CACHE_ENTRIES; i++)
+	{
+	  e = &squash_cache[i];
+	  if (!e->buf)
+	    {
+	      if (!victim)
+		victim = e;
+	    }
+	  else if (!oldest || e->last_use < oldest->last_use)
+	    oldest = e;
+	}
+      if (!oldest
+	  || (victim && squash_cache_bytes + maxsize <= SQUASH_CACHE_MAX_BYTES))
+	break;
+      squash_cache_drop (oldest);
+    }
+
+  grub_dprintf ("squash4", "decompressing block at 0x%llx\n",
+		(unsigned long long) start);
+
+  tmp = grub_malloc (csize);
+  if (!tmp)
+    return NULL;
+  victim->buf = grub_malloc (maxsize);
+  if (!victim->buf)
+    {
+      grub_free (tmp);
+      return NULL;
+    }
+
+  if (grub_disk_read (data->disk, start >> GRUB_DISK_SECTOR_BITS,
+		      start & (GRUB_DISK_SECTOR_SIZE - 1), csize, tmp))
+    ret = -1;
+  else
+    ret = data->decompress (tmp, csize, 0, victim->buf, maxsize, data);
+  grub_free (tmp);
+  if (ret < 0)
+    {
+      grub_free (victim->buf);
+      victim->buf = NULL;
+      if (!grub_errno)
+	grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
+      return NULL;
+    }
+
+  victim->alloc = maxsize;
+  victim->size = ret;
+  victim->dev_id = data->disk->dev->id;
+  victim->disk_id = data->disk->id;
+  victim->part_start = part_start;
+  victim->start = start;
+  victim->csize = csize;
+  victim->last_use = ++squash_cache_clock;
+  squash_cache_bytes += maxsize;
+
+  *size = victim->size;
+  return victim->buf;
+}
+
+/* Copy LEN bytes at OFFSET of the compressed block at START.  */
+static grub_err_t
+read_block (struct grub_squash_data *data, grub_uint64_t start,
+	    grub_size_t csize, grub_size_t maxsize, grub_off_t offset,
+	    void *buf, grub_size_t len)
+{
+  const char *block;
+  grub_size_t size;
+
+  block = get_block (data, start, csize, maxsize, &size);
+  if (!block)
+    return grub_errno;
+  if (offset > size || len > size - offset)
+    return grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
+  grub_memcpy (buf, block + offset, len);
+  return GRUB_ERR_NONE;
+}
+
 static grub_err_t
 read_chunk (struct grub_squash_data *data, void *buf, grub_size_t len,
 	    grub_uint64_t chunk_start, grub_off_t offset)
@@ -254,29 +425,22 @@ read_chunk (struct grub_squash_data *data, void *buf, grub_size_t len,
 	}
       else
 	{
-	  char *tmp;
 	  grub_size_t bsize = grub_le_to_cpu16 (d) & ~SQUASH_CHUNK_FLAGS; 
-	  grub_disk_addr_t a = chunk_start + 2;
-	  tmp = grub_malloc (bsize);
-	  if (!tmp)
-	    return grub_errno;
-	  /* FIXME: buffer uncompressed data.  */
-	  err = grub_disk_read (data->disk, (a >> GRUB_DISK_SECTOR_BITS),
-				a & (GRUB_DISK_SECTOR_SIZE - 1),
-				bsize, tmp);
-	  if (err)
-	    {
-	      grub_free (tmp);
-	      return err;
-	    }
+	  const char *block;
+	  grub_size_t size, avail = 0;
 
-	  if (data->decompress (tmp, bsize, offset,
-				buf, csize, data) < 0)
-	    {
-	      grub_free (tmp);
-	      return grub_errno;
-	    }
-	  grub_free (tmp);
+	  block = get_block (data, chunk_start + 2, bsize, SQUASH_CHUNK_SIZE,
+			     &size);
+	  if (!block)
+	    return grub_errno;
+	  /* Fixed-size structures may be read across the end of the last
+	     chunk of a table.  */
+	  if (offset < size)
+	    avail = size - offset;
+	  if (avail > csize)
+	    avail = csize;
+	  grub_memcpy (buf, block + offset, avail);
+	  grub_memset ((char *) buf + avail, 0, csize - avail);
 	}
       len -= csize;
       offset += csize;
@@ -314,6 +478,10 @@ lzo_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
       grub_free (udata);
       return -1;
     }
+  if (off > usize)
+    len = 0;
+  else if (len > usize - off)
+    len = usize - off;
   grub_memcpy (outbuf, udata + off, len);
   grub_free (udata);
   return len;
@@ -831,32 +999,10 @@ direct_read (struct grub_squash_data *data,
       else if (!(ino->block_sizes[i]
 	    & grub_cpu_to_le32_compile_time (SQUASH_BLOCK_UNCOMPRESSED)))
 	{
-	  char *block;
 	  grub_size_t csize;
 	  csize = grub_le_to_cpu32 (ino->block_sizes[i]) & ~SQUASH_BLOCK_FLAGS;
-	  block = grub_malloc (csize);
-	  if (!block)
-	    return -1;
-	  err = grub_disk_read (data->disk,
-				(ino->cumulated_block_sizes[i] + a)
-				>> GRUB_DISK_SECTOR_BITS,
-				(ino->cumulated_block_sizes[i] + a)
-				& (GRUB_DISK_SECTOR_SIZE - 1),
-				csize, block);
-	  if (err)
-	    {
-	      grub_free (block);
-	      return -1;
-	    }
-	  if (data->decompress (block, csize, boff, buf, curread, data)
-	      != (grub_ssize_t) curread)
-	    {
-	      grub_free (block);
-	      if (!grub_errno)
-		grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
-	      return -1;
-	    }
-	  grub_free (block);
+	  err = read_block (data, ino->cumulated_block_sizes[i] + a, csize,
+			    data->blksz, boff, buf, curread);
 	}
       else
 	err = grub_disk_read (data->disk, 
@@ -935,32 +1081,12 @@ grub_squash_read (grub_file_t file, char *buf, grub_size_t len)
   else
     b = grub_le_to_cpu32 (ino->ino.file.offset) + off;
   
-  /* FIXME: cache uncompressed chunks.  */
   if (compressed)
     {
-      char *block;
-      block = grub_malloc (grub_le_to_cpu32 (frag.size));
-      if (!block)
-	return -1;
-      err = grub_disk_read (data->disk,
-			    a >> GRUB_DISK_SECTOR_BITS,
-			    a & (GRUB_DISK_SECTOR_SIZE - 1),
-			    grub_le_to_cpu32 (frag.size), block);
+      err = read_block (data, a, grub_le_to_cpu32 (frag.size), data->blksz,
+			b, buf, len);
       if (err)
-	{
-	  grub_free (block);
-	  return -1;
-	}
-      if (data->decompress (block, grub_le_to_cpu32 (frag.size),
-			    b, buf, len, data)
-	  != (grub_ssize_t) len)
-	{
-	  grub_free (block);
-	  if (!grub_errno)
-	    grub_error (GRUB_ERR_BAD_FS, "incorrect compressed chunk");
-	  return -1;
-	}
-      grub_free (block);
+	return -1;
     }
   else
     {
@@ -992,6 +1118,13 @@ grub_squash_mtime (grub_device_t dev, grub_int32_t *tm)
   return GRUB_ERR_NONE;
 } 
 
+/* SQUASH_MAGIC in little endian.  */
+static const struct grub_fs_signature grub_squash_signatures[] =
+  {
+    { 0, 4, "hsqs" },
+    { 0, 0, 0 }
+  };
+
 static struct grub_fs grub_squash_fs =
   {
     .name = "squash4",
@@ -1000,6 +1133,7 @@ static struct grub_fs grub_squash_fs =
     .read = grub_squash_read,
     .close = grub_squash_close,
     .mtime = grub_squash_mtime,
+    .signatures = grub_squash_signatures,
 #ifdef GRUB_UTIL
     .reserved_first_sector = 0,
     .blocklist_install = 0,
@@ -1015,5 +1149,6 @@ GRUB_MOD_INIT(squash4)
 GRUB_MOD_FINI(squash4)
 {
   grub_fs_unregister (&grub_squash_fs);
+  squash_cache_flush ();
 }
 
@@ -169,12 +169,6 @@ typedef struct decomp_entry
   zfs_decomp_func_t *decomp_func;
 } decomp_entry_t;
 
-/*
- * Signature for checksum functions.
- */
-typedef void zio_checksum_t(const void *data, grub_uint64_t size, 
-			    grub_zfs_endian_t endian, zio_cksum_t *zcp);
-
 /*
  * Information about each checksum function.
  */
@@ -1838,6 +1832,197 @@ decode_embedded_bp_compressed(const blkptr_t *bp, void *buf)
   return GRUB_ERR_NONE;
 }
 
+/*
+ * Verified and decompressed blocks, kept across mounts so that the MOS,
+ * dataset and directory objects every open walks through are read and
+ * checksummed only once.  Blocks are keyed by their pool, first DVA,
+ * birth, properties and checksum.  Indirect blocks and dnodes form their
+ * own class, which other blocks never evict.
+ */
+#define ZIO_CACHE_MAX_BYTES	(4 << 20)
+#define ZIO_CACHE_HASH_SIZE	64
+
+enum zio_cache_class
+  {
+    ZIO_CACHE_META,
+    ZIO_CACHE_DATA,
+    ZIO_CACHE_CLASSES
+  };
+
+struct zio_cache_entry
+{
+  struct zio_cache_entry *hash_next;
+  struct zio_cache_entry *lru_prev;
+  struct zio_cache_entry *lru_next;
+  enum zio_cache_class class;
+  grub_uint64_t guid;
+  dva_t dva;
+  grub_uint64_t prop;
+  grub_uint64_t birth;
+  zio_cksum_t cksum;
+  grub_size_t size;
+  char *buf;
+};
+
+static struct zio_cache_entry *zio_cache_hash[ZIO_CACHE_HASH_SIZE];
+/* Most recently used first.  */
+static struct zio_cache_entry *zio_cache_lru_head[ZIO_CACHE_CLASSES];
+static struct zio_cache_entry *zio_cache_lru_tail[ZIO_CACHE_CLASSES];
+static grub_size_t zio_cache_bytes;
+static grub_uint32_t zio_cache_generation;
+
+static inline unsigned
+zio_cache_index (const zio_cksum_t *cksum)
+{
+  return (cksum->zc_word[0] ^ cksum->zc_word[1]) & (ZIO_CACHE_HASH_SIZE - 1);
+}
+
+static void
+zio_cache_lru_unlink (struct zio_cache_entry *e)
+{
+  if (e->lru_prev)
+    e->lru_prev->lru_next = e->lru_next;
+  else
+    zio_cache_lru_head[e->class] = e->lru_next;
+  if (e->lru_next)
+    e->lru_next->lru_prev = e->lru_prev;
+  else
+    zio_cache_lru_tail[e->class] = e->lru_prev;
+}
+
+static void
+zio_cache_lru_push (struct zio_cache_entry *e)
+{
+  e->lru_prev = NULL;
+  e->lru_next = zio_cache_lru_head[e->class];
+  if (e->lru_next)
+    e->lru_next->lru_prev = e;
+  else
+    zio_cache_lru_tail[e->class] = e;
+  zio_cache_lru_head[e->class] = e;
+}
+
+static void
+zio_cache_remove (struct zio_cache_entry *e)
+{
+  struct zio_cache_entry **p;
+
+  for (p = &zio_cache_hash[zio_cache_index (&e->cksum)]; *p != e;
+       p = &(*p)->hash_next);
+  *p = e->hash_next;
+  zio_cache_lru_unlink (e);
+  zio_cache_bytes -= e->size;
+  grub_free (e->buf);
+  grub_free (e);
+}
+
+static void
+zio_cache_flush (void)
+{
+  int c;
+
+  for (c = 0; c < ZIO_CACHE_CLASSES; c++)
+    while (zio_cache_lru_tail[c])
+      zio_cache_remove (zio_cache_lru_tail[c]);
+}
+
+static struct zio_cache_entry *
+zio_cache_find (const blkptr_t *bp, grub_uint64_t guid)
+{
+  struct zio_cache_entry *e;
+
+  /* Disks changed, the same addresses may hold other pools.  */
+  if (zio_cache_generation != grub_disk_generation)
+    {
+      zio_cache_flush ();
+      zio_cache_generation = grub_disk_generation;
+    }
+
+  for (e = zio_cache_hash[zio_cache_index (&bp->blk_cksum)]; e;
+       e = e->hash_next)
+    if (e->guid == guid && e->prop == bp->blk_prop
+	&& e->birth == bp->blk_birth
+	&& grub_memcmp (&e->dva, &bp->blk_dva[0], sizeof (e->dva)) == 0
+	&& grub_memcmp (&e->cksum, &bp->blk_cksum, sizeof (e->cksum)) == 0)
+      return e;
+  return NULL;
+}
+
+/* Return a copy of the cached block BP points to, or NULL.  */
+static void *
+zio_cache_get (const blkptr_t *bp, grub_uint64_t guid, grub_size_t size)
+{
+  struct zio_cache_entry *e;
+  void *buf;
+
+  /* Allocate first: running out of memory flushes the cache.  */
+  buf = grub_malloc (size);
+  if (!buf)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return NULL;
+    }
+  e = zio_cache_find (bp, guid);
+  if (!e || e->size != size)
+    {
+      grub_free (buf);
+      return NULL;
+    }
+  grub_memcpy (buf, e->buf, size);
+  zio_cache_lru_unlink (e);
+  zio_cache_lru_push (e);
+  return buf;
+}
+
+static void
+zio_cache_put (const blkptr_t *bp, grub_uint64_t guid,
+	       enum zio_cache_class class, const void *buf, grub_size_t size)
+{
+  struct zio_cache_entry *e;
+  int c;
+
+  if (size > ZIO_CACHE_MAX_BYTES / 8 || zio_cache_find (bp, guid))
+    return;
+
+  /* Make room among the blocks of CLASS or less important ones, the
+     least important and least recently used first.  */
+  for (c = ZIO_CACHE_CLASSES - 1;
+       c >= (int) class && zio_cache_bytes + size > ZIO_CACHE_MAX_BYTES; )
+    if (zio_cache_lru_tail[c])
+      zio_cache_remove (zio_cache_lru_tail[c]);
+    else
+      c--;
+  if (zio_cache_bytes + size > ZIO_CACHE_MAX_BYTES)
+    return;
+
+  e = grub_malloc (sizeof (*e));
+  if (!e)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+  e->buf = grub_malloc (size);
+  if (!e->buf)
+    {
+      grub_free (e);
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+  grub_memcpy (e->buf, buf, size);
+  e->class = class;
+  e->guid = guid;
+  e->dva = bp->blk_dva[0];
+  e->prop = bp->blk_prop;
+  e->birth = bp->blk_birth;
+  e->cksum = bp->blk_cksum;
+  e->size = size;
+
+  e->hash_next = zio_cache_hash[zio_cache_index (&e->cksum)];
+  zio_cache_hash[zio_cache_index (&e->cksum)] = e;
+  zio_cache_lru_push (e);
+  zio_cache_bytes += size;
+}
+
 /*
  * Read in a block of data, verify its checksum, decompress if needed,
  * and put the uncompressed data in buf.
@@ -1852,6 +2037,7 @@ zio_read (blkptr_t *bp, grub_zfs_endian_t endian, void **buf,
   grub_err_t err;
   zio_cksum_t zc = bp->blk_cksum;
   grub_uint32_t checksum;
+  int cacheable;
 
   *buf = NULL;
 
@@ -1888,6 +2074,16 @@ zio_read (blkptr_t *bp, grub_zfs_endian_t endian, void **buf,
     return grub_error (GRUB_ERR_NOT_IMPLEMENTED_YET,
 		       "compression algorithm %s not supported\n", decomp_table[comp].name);
 
+  /* Decrypted blocks stay with the mount that has the key.  */
+  cacheable = (!BP_IS_EMBEDDED(bp) && !encrypted && lsize
+	       && checksum != ZIO_CHECKSUM_OFF);
+  if (cacheable)
+    {
+      *buf = zio_cache_get (bp, data->guid, lsize);
+      if (*buf)
+	return GRUB_ERR_NONE;
+    }
+
   if (comp != ZIO_COMPRESS_OFF)
     /* It's not really necessary to align to 16, just for safety.  */
     compbuf = grub_malloc (ALIGN_UP (psize, 16));
@@ -1992,6 +2188,20 @@ zio_read (blkptr_t *bp, grub_zfs_endian_t endian, void **buf,
 	}
     }
 
+  if (cacheable)
+    {
+      grub_uint64_t prop = grub_zfs_to_cpu64 (bp->blk_prop, endian);
+      enum zio_cache_class class;
+
+      if (((prop >> 56) & 0x1f) > 0
+	  || ((prop >> 48) & 0xff) == DMU_OT_DNODE
+	  || ((prop >> 48) & 0xff) == DMU_OT_OBJSET)
+	class = ZIO_CACHE_META;
+      else
+	class = ZIO_CACHE_DATA;
+      zio_cache_put (bp, data->guid, class, *buf, lsize);
+    }
+
   return GRUB_ERR_NONE;
 }
 
@@ -4355,6 +4565,7 @@ static struct grub_fs grub_zfs_fs = {
   .label = zfs_label,
   .uuid = zfs_uuid,
   .mtime = zfs_mtime,
+  .flush_caches = zio_cache_flush,
 #ifdef GRUB_UTIL
   .embed = grub_zfs_embed,
   .reserved_first_sector = 1,
@@ -4375,4 +4586,5 @@ GRUB_MOD_INIT (zfs)
 GRUB_MOD_FINI (zfs)
 {
   grub_fs_unregister (&grub_zfs_fs);
+  zio_cache_flush ();
 }
@@ -60,17 +60,69 @@ fletcher_2(const void *buf, grub_uint64_t size, grub_zfs_endian_t endian,
   zcp->zc_word[3] = grub_cpu_to_zfs64 (b1, endian);
 }
 
-void
-fletcher_4 (const void *buf, grub_uint64_t size, grub_zfs_endian_t endian, 
-	    zio_cksum_t *zcp)
+#if defined (ZIO_CHECKSUM_X86)
+#include <grub/i386/cpuid.h>
+#endif
+
+#ifdef GRUB_CPU_WORDS_BIGENDIAN
+#define ZIO_NATIVE_ENDIAN	GRUB_ZFS_BIG_ENDIAN
+#else
+#define ZIO_NATIVE_ENDIAN	GRUB_ZFS_LITTLE_ENDIAN
+#endif
+
+unsigned
+zio_checksum_cpu_features (void)
 {
-  const grub_uint32_t *ip = buf;
-  const grub_uint32_t *ipend = ip + (size / sizeof (grub_uint32_t));
-  grub_uint64_t a, b, c, d;
-  
-  for (a = b = c = d = 0; ip < ipend; ip++) 
+#ifdef ZIO_CHECKSUM_X86
+  static int features = -1;
+  grub_uint32_t eax, ebx, ecx, edx, xcr0_lo, xcr0_hi;
+  unsigned max_leaf;
+
+  if (features != -1)
+    return features;
+
+  features = 0;
+  grub_cpuid (0, max_leaf, ebx, ecx, edx);
+  if (max_leaf < 1)
+    return features;
+  grub_cpuid (1, eax, ebx, ecx, edx);
+  /* CPUID.01H:ECX.SSSE3[bit 9], SSE4_1[bit 19].  */
+  if (ecx & (1 << 9))
+    features |= ZIO_CPU_SSSE3;
+  if (ecx & (1 << 19))
+    features |= ZIO_CPU_SSE4_1;
+  if (max_leaf < 7)
+    return features;
+
+  /* YMM registers are only usable once whoever ran before us enabled
+     their state: CPUID.01H:ECX.OSXSAVE[bit 27] and XCR0 bits 1 and 2.  */
+  xcr0_lo = 0;
+  if (ecx & (1 << 27))
+    asm volatile ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+
+  /* CPUID.(EAX=07H,ECX=0):EBX.AVX2[bit 5], SHA[bit 29].  */
+  asm volatile ("cpuid"
+		: "=a" (eax), "=b" (ebx), "=c" (ecx), "=d" (edx)
+		: "0" (7), "2" (0));
+  if ((ebx & (1 << 5)) && (xcr0_lo & 6) == 6)
+    features |= ZIO_CPU_AVX2;
+  if (ebx & (1 << 29))
+    features |= ZIO_CPU_SHA;
+  grub_dprintf ("zfs", "checksum CPU features 0x%x\n", features);
+  return features;
+#else
+  return 0;
+#endif
+}
+
+static void
+fletcher_4_finish (const grub_uint32_t *ip, const grub_uint32_t *ipend,
+		   grub_zfs_endian_t endian, grub_uint64_t a, grub_uint64_t b,
+		   grub_uint64_t c, grub_uint64_t d, zio_cksum_t *zcp)
+{
+  for (; ip < ipend; ip++) 
     {
-      a += grub_zfs_to_cpu32 (ip[0], endian);;
+      a += grub_zfs_to_cpu32 (ip[0], endian);
       b += a;
       c += b;
       d += c;
@@ -82,3 +134,119 @@ fletcher_4 (const void *buf, grub_uint64_t size, grub_zfs_endian_t endian,
   zcp->zc_word[3] = grub_cpu_to_zfs64 (d, endian);
 }
 
+static void
+fletcher_4_scalar (const void *buf, grub_uint64_t size,
+		   grub_zfs_endian_t endian, zio_cksum_t *zcp)
+{
+  const grub_uint32_t *ip = buf;
+
+  fletcher_4_finish (ip, ip + (size / sizeof (grub_uint32_t)), endian,
+		     0, 0, 0, 0, zcp);
+}
+
+#ifdef ZIO_CHECKSUM_X86
+
+/*
+ * The vector versions run the sums over N interleaved streams, stream j
+ * taking words j, j + N, j + 2N...  The sums of the whole buffer are then
+ * linear combinations of the per-stream ones.  Byte-swapped pools go to
+ * the scalar loop.
+ */
+
+typedef grub_uint32_t zio_v2su __attribute__ ((vector_size (8), aligned (4),
+					       may_alias));
+typedef grub_uint32_t zio_v4su __attribute__ ((vector_size (16), aligned (4),
+					       may_alias));
+typedef grub_uint64_t zio_v2du __attribute__ ((vector_size (16)));
+typedef grub_uint64_t zio_v4du __attribute__ ((vector_size (32)));
+
+/* Two streams in the 64-bit lanes of an XMM register.  Every x86_64 CPU
+   has SSE2, but GRUB itself is built without it.  */
+static void __attribute__ ((target ("sse2")))
+fletcher_4_sse2 (const void *buf, grub_uint64_t size,
+		 grub_zfs_endian_t endian, zio_cksum_t *zcp)
+{
+  const grub_uint32_t *ip = buf;
+  const grub_uint32_t *ipend = ip + (size / sizeof (grub_uint32_t));
+  const grub_uint32_t *ipvend = ip + ((ipend - ip) & ~1);
+  zio_v2du A = { 0 }, B = { 0 }, C = { 0 }, D = { 0 };
+
+  if (endian != ZIO_NATIVE_ENDIAN)
+    {
+      fletcher_4_scalar (buf, size, endian, zcp);
+      return;
+    }
+
+  for (; ip < ipvend; ip += 2)
+    {
+      A += __builtin_convertvector (*(const zio_v2su *) ip, zio_v2du);
+      B += A;
+      C += B;
+      D += C;
+    }
+
+  fletcher_4_finish (ip, ipend, endian, A[0] + A[1],
+		     2 * (B[0] + B[1]) - A[1],
+		     4 * (C[0] + C[1]) - B[0] - 3 * B[1],
+		     8 * (D[0] + D[1]) - 4 * C[0] - 8 * C[1] + B[1], zcp);
+}
+
+/* Four streams in the lanes of a YMM register.  */
+static void __attribute__ ((target ("avx2")))
+fletcher_4_avx2 (const void *buf, grub_uint64_t size,
+		 grub_zfs_endian_t endian, zio_cksum_t *zcp)
+{
+  const grub_uint32_t *ip = buf;
+  const grub_uint32_t *ipend = ip + (size / sizeof (grub_uint32_t));
+  const grub_uint32_t *ipvend = ip + ((ipend - ip) & ~3);
+  zio_v4du A = { 0 }, B = { 0 }, C = { 0 }, D = { 0 };
+
+  if (endian != ZIO_NATIVE_ENDIAN)
+    {
+      fletcher_4_scalar (buf, size, endian, zcp);
+      return;
+    }
+
+  for (; ip < ipvend; ip += 4)
+    {
+      A += __builtin_convertvector (*(const zio_v4su *) ip, zio_v4du);
+      B += A;
+      C += B;
+      D += C;
+    }
+
+  fletcher_4_finish (ip, ipend, endian, A[0] + A[1] + A[2] + A[3],
+		     4 * (B[0] + B[1] + B[2] + B[3])
+		     - (A[1] + 2 * A[2] + 3 * A[3]),
+		     16 * (C[0] + C[1] + C[2] + C[3])
+		     - (6 * B[0] + 10 * B[1] + 14 * B[2] + 18 * B[3])
+		     + (A[2] + 3 * A[3]),
+		     64 * (D[0] + D[1] + D[2] + D[3])
+		     - (48 * C[0] + 64 * C[1] + 80 * C[2] + 96 * C[3])
+		     + (4 * B[0] + 10 * B[1] + 20 * B[2] + 34 * B[3])
+		     - A[3], zcp);
+}
+
+#endif
+
+const zio_checksum_impl_t fletcher_4_impls[] =
+  {
+    { "scalar", fletcher_4_scalar, 0 },
+#ifdef ZIO_CHECKSUM_X86
+    { "sse2", fletcher_4_sse2, 0 },
+    { "avx2", fletcher_4_avx2, ZIO_CPU_AVX2 },
+#endif
+  };
+
+const unsigned fletcher_4_nimpls = ARRAY_SIZE (fletcher_4_impls);
+
+void
+fletcher_4 (const void *buf, grub_uint64_t size, grub_zfs_endian_t endian, 
+	    zio_cksum_t *zcp)
+{
+  static zio_checksum_t *impl;
+
+  if (!impl)
+    impl = zio_checksum_impl_select (fletcher_4_impls, fletcher_4_nimpls);
+  impl (buf, size, endian, zcp);
+}
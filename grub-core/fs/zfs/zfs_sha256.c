@@ -107,9 +107,111 @@ SHA256Transform(grub_uint32_t *H, const grub_uint8_t *cp)
 	H[4] += e; H[5] += f; H[6] += g; H[7] += h;
 }
 
-void
-zio_checksum_SHA256(const void *buf, grub_uint64_t size,
-		    grub_zfs_endian_t endian, zio_cksum_t *zcp)
+/* Message schedule word T of the block whose last 16 words are in W.  */
+#define	SCHEDULE(W, t)	(W[(t) & 15] += sigma1(W[((t) - 2) & 15]) +	\
+			 W[((t) - 7) & 15] + sigma0(W[((t) - 15) & 15]))
+
+#define	ROUND(a, b, c, d, e, f, g, h, t, w)				\
+	do {								\
+		grub_uint32_t T1 = h + SIGMA1(e) + Ch(e, f, g) +	\
+		    SHA256_K[t] + (w);					\
+		d += T1;						\
+		h = T1 + SIGMA0(a) + Maj(a, b, c);			\
+	} while (0)
+
+#define	ROUNDS8(t, w)							\
+	do {								\
+		ROUND(a, b, c, d, e, f, g, h, (t) + 0, w((t) + 0));	\
+		ROUND(h, a, b, c, d, e, f, g, (t) + 1, w((t) + 1));	\
+		ROUND(g, h, a, b, c, d, e, f, (t) + 2, w((t) + 2));	\
+		ROUND(f, g, h, a, b, c, d, e, (t) + 3, w((t) + 3));	\
+		ROUND(e, f, g, h, a, b, c, d, (t) + 4, w((t) + 4));	\
+		ROUND(d, e, f, g, h, a, b, c, (t) + 5, w((t) + 5));	\
+		ROUND(c, d, e, f, g, h, a, b, (t) + 6, w((t) + 6));	\
+		ROUND(b, c, d, e, f, g, h, a, (t) + 7, w((t) + 7));	\
+	} while (0)
+
+#define	W_LOAD(t)	(W[t] = grub_be_to_cpu32 (grub_get_unaligned32 (cp + 4 * (t))))
+#define	W_NEXT(t)	SCHEDULE(W, t)
+
+/*
+ * The same rounds with the registers renamed instead of shifted and the
+ * schedule kept in a ring of 16 words.
+ */
+static void
+SHA256TransformUnrolled(grub_uint32_t *H, const grub_uint8_t *cp)
+{
+	grub_uint32_t a, b, c, d, e, f, g, h, W[16];
+	unsigned t;
+
+	a = H[0]; b = H[1]; c = H[2]; d = H[3];
+	e = H[4]; f = H[5]; g = H[6]; h = H[7];
+
+	ROUNDS8(0, W_LOAD);
+	ROUNDS8(8, W_LOAD);
+	for (t = 16; t < 64; t += 8)
+		ROUNDS8(t, W_NEXT);
+
+	H[0] += a; H[1] += b; H[2] += c; H[3] += d;
+	H[4] += e; H[5] += f; H[6] += g; H[7] += h;
+}
+
+#ifdef ZIO_CHECKSUM_X86
+
+typedef int zio_v4si __attribute__ ((vector_size (16)));
+typedef char zio_v16qi __attribute__ ((vector_size (16)));
+typedef grub_uint32_t zio_v4su_u __attribute__ ((vector_size (16),
+						 aligned (1), may_alias));
+
+/*
+ * SHA extensions.  The state lives in two registers, {H5, H4, H1, H0} and
+ * {H7, H6, H3, H2} from the low lane up, and sha256rnds2 runs two rounds
+ * with the two low lanes of its third operand as W + K.
+ */
+static void __attribute__ ((target ("sha,ssse3,sse4.1")))
+SHA256TransformSHANI(grub_uint32_t *H, const grub_uint8_t *cp)
+{
+	const zio_v16qi bswap = { 3, 2, 1, 0, 7, 6, 5, 4,
+				  11, 10, 9, 8, 15, 14, 13, 12 };
+	zio_v4si S0 = { H[5], H[4], H[1], H[0] };
+	zio_v4si S1 = { H[7], H[6], H[3], H[2] };
+	zio_v4si S0_saved = S0, S1_saved = S1;
+	zio_v4si m[4], k, p, q;
+	unsigned g;
+
+	for (g = 0; g < 4; g++)
+		m[g] = (zio_v4si) __builtin_ia32_pshufb128
+		    ((zio_v16qi) *(const zio_v4su_u *) (cp + 16 * g), bswap);
+
+	for (g = 0; g < 16; g++) {
+		if (g >= 4) {
+			/* W[t] = sigma1(W[t-2]) + W[t-7] + sigma0(W[t-15]) + W[t-16].  */
+			p = m[(g + 2) & 3];
+			q = m[(g + 3) & 3];
+			m[g & 3] = __builtin_ia32_sha256msg2
+			    (__builtin_ia32_sha256msg1 (m[g & 3], m[(g + 1) & 3])
+			     + (zio_v4si) { p[1], p[2], p[3], q[0] }, q);
+		}
+		k = m[g & 3]
+		    + (zio_v4si) *(const zio_v4su_u *) &SHA256_K[4 * g];
+		S1 = __builtin_ia32_sha256rnds2 (S1, S0, k);
+		S0 = __builtin_ia32_sha256rnds2 (S0, S1,
+		    __builtin_ia32_pshufd (k, 0x0e));
+	}
+
+	S0 += S0_saved;
+	S1 += S1_saved;
+	H[0] = S0[3]; H[1] = S0[2]; H[4] = S0[1]; H[5] = S0[0];
+	H[2] = S1[3]; H[3] = S1[2]; H[6] = S1[1]; H[7] = S1[0];
+}
+
+#endif
+
+static void
+zio_checksum_SHA256_with (void (*transform) (grub_uint32_t *,
+					     const grub_uint8_t *),
+			  const void *buf, grub_uint64_t size,
+			  grub_zfs_endian_t endian, zio_cksum_t *zcp)
 {
   grub_uint32_t H[8] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
 			 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
@@ -118,10 +220,10 @@ zio_checksum_SHA256(const void *buf, grub_uint64_t size,
   unsigned i;
   
   for (i = 0; i < size - padsize; i += 64)
-    SHA256Transform(H, (grub_uint8_t *)buf + i);
+    transform(H, (grub_uint8_t *)buf + i);
   
   for (i = 0; i < padsize; i++)
-    pad[i] = ((grub_uint8_t *)buf)[i];
+    pad[i] = ((grub_uint8_t *)buf)[size - padsize + i];
   
   for (pad[padsize++] = 0x80; (padsize & 63) != 56; padsize++)
     pad[padsize] = 0;
@@ -130,7 +232,7 @@ zio_checksum_SHA256(const void *buf, grub_uint64_t size,
     pad[padsize++] = (size << 3) >> (56 - 8 * i);
   
   for (i = 0; i < padsize && i <= 64; i += 64)
-    SHA256Transform(H, pad + i);
+    transform(H, pad + i);
   
   zcp->zc_word[0] = grub_cpu_to_zfs64 ((grub_uint64_t)H[0] << 32 | H[1], 
 				       endian);
@@ -141,3 +243,51 @@ zio_checksum_SHA256(const void *buf, grub_uint64_t size,
   zcp->zc_word[3] = grub_cpu_to_zfs64 ((grub_uint64_t)H[6] << 32 | H[7],
 				       endian);
 }
+
+static void
+zio_checksum_SHA256_reference(const void *buf, grub_uint64_t size,
+			      grub_zfs_endian_t endian, zio_cksum_t *zcp)
+{
+  zio_checksum_SHA256_with (SHA256Transform, buf, size, endian, zcp);
+}
+
+static void
+zio_checksum_SHA256_unrolled(const void *buf, grub_uint64_t size,
+			     grub_zfs_endian_t endian, zio_cksum_t *zcp)
+{
+  zio_checksum_SHA256_with (SHA256TransformUnrolled, buf, size, endian, zcp);
+}
+
+#ifdef ZIO_CHECKSUM_X86
+static void
+zio_checksum_SHA256_shani(const void *buf, grub_uint64_t size,
+			  grub_zfs_endian_t endian, zio_cksum_t *zcp)
+{
+  zio_checksum_SHA256_with (SHA256TransformSHANI, buf, size, endian, zcp);
+}
+#endif
+
+const zio_checksum_impl_t zio_checksum_SHA256_impls[] =
+  {
+    { "reference", zio_checksum_SHA256_reference, 0 },
+    { "unrolled", zio_checksum_SHA256_unrolled, 0 },
+#ifdef ZIO_CHECKSUM_X86
+    { "shani", zio_checksum_SHA256_shani,
+      ZIO_CPU_SHA | ZIO_CPU_SSSE3 | ZIO_CPU_SSE4_1 },
+#endif
+  };
+
+const unsigned zio_checksum_SHA256_nimpls
+  = ARRAY_SIZE (zio_checksum_SHA256_impls);
+
+void
+zio_checksum_SHA256(const void *buf, grub_uint64_t size,
+		    grub_zfs_endian_t endian, zio_cksum_t *zcp)
+{
+  static zio_checksum_t *impl;
+
+  if (!impl)
+    impl = zio_checksum_impl_select (zio_checksum_SHA256_impls,
+				     zio_checksum_SHA256_nimpls);
+  impl (buf, size, endian, zcp);
+}
@@ -22,6 +22,8 @@
  * by Mark Adler.  It has been very heavily modified.  In particular, the
  * original would run through the whole file at once, and this version can
  * be stopped and restarted on any boundary during the decompression process.
+ * The Huffman decoding has since been replaced with single-lookup tables
+ * and a 64-bit bit buffer refilled a word at a time.
  *
  * The license and header comments that file are included here.
  */
@@ -57,47 +59,62 @@ GRUB_MOD_LICENSE ("GPLv3+");
 
 #define INBUFSIZ  0x2000
 
+/* Root lookup bits of the decoding tables.  Codes longer than that are
+   resolved through a second-level table.  */
+#define LITLEN_TABLE_BITS	10
+#define DIST_TABLE_BITS		8
+#define PRECODE_TABLE_BITS	7
+
+/* Largest possible size of a decoding table including all second-level
+   tables, for 286 literal/length codes with 10 root bits and 30 distance
+   codes with 8 root bits (these are the figures zlib's "enough" gives).  */
+#define LITLEN_TABLE_ENOUGH	1334
+#define DIST_TABLE_ENOUGH	402
+#define PRECODE_TABLE_ENOUGH	(1 << PRECODE_TABLE_BITS)
+
 /* The state stored in filesystem-specific data.  */
 struct grub_gzio
 {
   /* The underlying file object.  */
   grub_file_t file;
   /* If input is in memory following fields are used instead of file.  */
-  grub_size_t mem_input_size, mem_input_off;
+  grub_size_t mem_input_size;
   grub_uint8_t *mem_input;
   /* The offset at which the data starts in the underlying file.  */
   grub_off_t data_offset;
   /* The type of current block.  */
   int block_type;
-  /* The length of current block.  */
-  int block_len;
+  /* The bytes left in a stored block, or non-zero inside a coded block.  */
+  unsigned block_len;
   /* The flag of the last block.  */
   int last_block;
-  /* The flag of codes.  */
-  int code_state;
-  /* The length of a copy.  */
-  unsigned inflate_n;
-  /* The index of a copy.  */
-  unsigned inflate_d;
+  /* The part of a match which did not fit into the previous window.  */
+  unsigned copy_len;
+  unsigned copy_dist;
   /* The input buffer.  */
   grub_uint8_t inbuf[INBUFSIZ];
-  int inbuf_d;
+  /* The unconsumed part of the input, in INBUF or in MEM_INPUT.  */
+  const grub_uint8_t *in_next;
+  const grub_uint8_t *in_end;
+  /* The number of zero bytes fed after the end of the input.  */
+  unsigned in_overrun;
   /* The bit buffer.  */
-  unsigned long bb;
+  grub_uint64_t bb;
   /* The bits in the bit buffer.  */
   unsigned bk;
   /* The sliding window in uncompressed data.  */
   grub_uint8_t slide[WSIZE];
   /* Current position in the slide.  */
   unsigned wp;
-  /* The literal/length code table.  */
-  struct huft *tl;
-  /* The distance code table.  */
-  struct huft *td;
-  /* The lookup bits for the literal/length code table. */
-  int bl;
-  /* The lookup bits for the distance code table.  */
-  int bd;
+  /* The decoding tables of the current block.  They point either to the
+     fixed tables or to the tables below.  */
+  const grub_uint32_t *litlen;
+  const grub_uint32_t *dist;
+  /* The root lookup bits of LITLEN and DIST.  */
+  unsigned litlen_bits;
+  unsigned dist_bits;
+  grub_uint32_t litlen_table[LITLEN_TABLE_ENOUGH];
+  grub_uint32_t dist_table[DIST_TABLE_ENOUGH];
   /* The original offset value.  */
   grub_off_t saved_offset;
 };
@@ -164,9 +181,6 @@ eat_field (grub_file_t file, int len)
 #define INFLATE_FIXED	1
 #define INFLATE_DYNAMIC	2
 
-typedef unsigned char uch;
-typedef unsigned short ush;
-typedef unsigned long ulg;
 
 static int
 test_gzip_header (grub_file_t file)
@@ -229,55 +243,30 @@ test_gzip_header (grub_file_t file)
 }
 
 
-/* Huffman code lookup table entry--this entry is four bytes for machines
-   that have 16-bit pointers (e.g. PC's in the small or medium model).
-   Valid extra bits are 0..13.  e == 15 is EOB (end of block), e == 16
-   means that v is a literal, 16 < e < 32 means that v is a pointer to
-   the next table, which codes e - 16 bits, and lastly e == 99 indicates
-   an unused code.  If a code with e == 99 is looked up, this implies an
-   error in the data. */
-struct huft
-{
-  uch e;			/* number of extra bits or operation */
-  uch b;			/* number of bits in this code or subcode */
-  union
-    {
-      ush n;			/* literal, length base, or distance base */
-      struct huft *t;		/* pointer to next level of table */
-    }
-  v;
-};
-
-
 /* The inflate algorithm uses a sliding 32K byte window on the uncompressed
    stream to find repeated byte strings.  This is implemented here as a
    circular buffer.  The index is updated simply by incrementing and then
    and'ing with 0x7fff (32K-1). */
-/* It is left to other modules to supply the 32K area.  It is assumed
-   to be usable as if it were declared "uch slide[32768];" or as just
-   "uch *slide;" and then malloc'ed in the latter case.  The definition
-   must be in unzip.h, included above. */
 
 
 /* Tables for deflate from PKZIP's appnote.txt. */
-static unsigned bitorder[] =
+static const grub_uint8_t bitorder[] =
 {				/* Order of the bit length code lengths */
   16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15};
-static ush cplens[] =
+static const grub_uint16_t cplens[] =
 {				/* Copy lengths for literal codes 257..285 */
   3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
-  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258, 0, 0};
-	/* note: see note #13 above about the 258 in this list. */
-static ush cplext[] =
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+static const grub_uint8_t cplext[] =
 {				/* Extra bits for literal codes 257..285 */
   0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
-  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0, 99, 99};	/* 99==invalid */
-static ush cpdist[] =
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+static const grub_uint16_t cpdist[] =
 {				/* Copy offsets for distance codes 0..29 */
   1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
   257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
   8193, 12289, 16385, 24577};
-static ush cpdext[] =
+static const grub_uint8_t cpdext[] =
 {				/* Extra bits for distance codes */
   0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
   7, 7, 8, 8, 9, 9, 10, 10, 11, 11,
@@ -285,106 +274,309 @@ static ush cpdext[] =
 
 
 /*
-   Huffman code decoding is performed using a multi-level table lookup.
-   The fastest way to decode is to simply build a lookup table whose
-   size is determined by the longest code.  However, the time it takes
-   to build this table can also be a factor if the data being decoded
-   is not very long.  The most common codes are necessarily the
-   shortest codes, so those codes dominate the decoding time, and hence
-   the speed.  The idea is you can have a shorter table that decodes the
-   shorter, more probable codes, and then point to subsidiary tables for
-   the longer codes.  The time it costs to decode the longer codes is
-   then traded against the time it takes to make longer tables.
-
-   This results of this trade are in the variables lbits and dbits
-   below.  lbits is the number of bits the first level table for literal/
-   length codes can decode in one step, and dbits is the same thing for
-   the distance codes.  Subsequent tables are also less than or equal to
-   those sizes.  These values may be adjusted either when all of the
-   codes are shorter than that, in which case the longest code length in
-   bits is used, or when the shortest code is *longer* than the requested
-   table size, in which case the length of the shortest code in bits is
-   used.
-
-   There are two different values for the two tables, since they code a
-   different number of possibilities each.  The literal/length table
-   codes 286 possible values, or in a flat code, a little over eight
-   bits.  The distance table codes 30 possible values, or a little less
-   than five bits, flat.  The optimum values for speed end up being
-   about one bit more than those, so lbits is 8+1 and dbits is 5+1.
-   The optimum values may differ though from machine to machine, and
-   possibly even between compilers.  Your mileage may vary.
+   Huffman codes are decoded with a single lookup in a table indexed by
+   the next ROOT bits of the stream, where ROOT is a little more than the
+   typical code length.  Codes longer than ROOT bits point to a second
+   level table indexed by the remaining bits, so every symbol takes at
+   most two lookups.
+
+   A table entry is 32 bits wide:
+
+     bits 0-7	the number of stream bits the entry consumes
+     bits 8-11	the number of extra bits following a length or distance
+		code, or the index bits of a second level table
+     bits 12-15	the entry kind (see E_* below)
+     bits 16-31	a literal byte, a length or distance base, or the offset
+		of a second level table
+
+   Entries not covered by a code are marked invalid, so corrupt and
+   incomplete codes are caught when they are looked up.
  */
 
+#define E_LITERAL	0x1000
+#define E_EOB		0x2000
+#define E_SUBTABLE	0x4000
+#define E_INVALID	0x8000
 
-static int lbits = 9;		/* bits in base literal/length lookup table */
-static int dbits = 6;		/* bits in base distance lookup table */
+#define ENTRY(bits, extra, kind, value) \
+  ((grub_uint32_t) (bits) | ((grub_uint32_t) (extra) << 8) | (kind) \
+   | ((grub_uint32_t) (value) << 16))
+#define E_BITS(e)	((e) & 0xff)
+#define E_EXTRA(e)	(((e) >> 8) & 0xf)
+#define E_VALUE(e)	((e) >> 16)
 
+enum table_kind
+  {
+    TABLE_PRECODE,
+    TABLE_LITLEN,
+    TABLE_DIST
+  };
 
-/* If BMAX needs to be larger than 16, then h and x[] should be ulg. */
-#define BMAX 16			/* maximum bit length of any code (16 for explode) */
-#define N_MAX 288		/* maximum number of codes in any set */
+/* The fixed Huffman codes are the same for all streams, so their tables
+   are built once.  9 and 5 bits are the longest fixed codes.  */
+static grub_uint32_t fixed_litlen[1 << 9];
+static grub_uint32_t fixed_dist[1 << 5];
+static unsigned fixed_litlen_bits, fixed_dist_bits;
+static int fixed_tables_built;
 
+static grub_uint32_t
+make_entry (enum table_kind kind, unsigned sym, unsigned bits)
+{
+  switch (kind)
+    {
+    case TABLE_PRECODE:
+      return ENTRY (bits, 0, E_LITERAL, sym);
+    case TABLE_LITLEN:
+      if (sym < 256)
+	return ENTRY (bits, 0, E_LITERAL, sym);
+      if (sym == 256)
+	return ENTRY (bits, 0, E_EOB, 0);
+      sym -= 257;
+      if (sym < ARRAY_SIZE (cplens))
+	return ENTRY (bits, cplext[sym], 0, cplens[sym]);
+      break;
+    case TABLE_DIST:
+      if (sym < ARRAY_SIZE (cpdist))
+	return ENTRY (bits, cpdext[sym], 0, cpdist[sym]);
+      break;
+    }
+  return ENTRY (bits, 0, E_INVALID, 0);
+}
 
-/* Macros for inflate() bit peeking and grabbing.
-   The usage is:
+/* Build the decoding table of the canonical Huffman code described by the
+   N code lengths in LENS into TABLE, which has ENOUGH entries.  *BITS is
+   the requested root size on entry and the one used on return.  Return
+   zero on success or -1 if the code is over-subscribed.  */
+static int
+build_table (const grub_uint8_t *lens, unsigned n, enum table_kind kind,
+	     grub_uint32_t *table, unsigned enough, unsigned *bits)
+{
+  grub_uint16_t count[16], offs[16], work[288];
+  unsigned len, sym, min, max, root, curr, drop;
+  unsigned used, huff, incr, fill, low, mask, i;
+  grub_uint32_t *next;
+  int left;
+
+  for (i = 0; i < enough; i++)
+    table[i] = E_INVALID;
+
+  for (len = 0; len < 16; len++)
+    count[len] = 0;
+  for (sym = 0; sym < n; sym++)
+    count[lens[sym]]++;
+
+  for (max = 15; max >= 1; max--)
+    if (count[max])
+      break;
+  if (max == 0)
+    {
+      /* No codes at all: every lookup hits an invalid entry.  */
+      *bits = 1;
+      return 0;
+    }
+  for (min = 1; min < max; min++)
+    if (count[min])
+      break;
 
-        NEEDBITS(j)
-        x = b & mask_bits[j];
-        DUMPBITS(j)
+  root = *bits;
+  if (root > max)
+    root = max;
+  if (root < min)
+    root = min;
 
-   where NEEDBITS makes sure that b has at least j bits in it, and
-   DUMPBITS removes the bits from b.  The macros use the variable k
-   for the number of bits in b.  Normally, b and k are register
-   variables for speed, and are initialized at the beginning of a
-   routine that uses these macros from a global bit buffer and count.
+  left = 1;
+  for (len = 1; len < 16; len++)
+    {
+      left <<= 1;
+      left -= count[len];
+      if (left < 0)
+	return -1;
+    }
 
-   If we assume that EOB will be the longest code, then we will never
-   ask for bits with NEEDBITS that are beyond the end of the stream.
-   So, NEEDBITS should not read any more bytes than are needed to
-   meet the request.  Then no bytes need to be "returned" to the buffer
-   at the end of the last block.
+  /* Sort the symbols by code length, then by value.  */
+  offs[1] = 0;
+  for (len = 1; len < 15; len++)
+    offs[len + 1] = offs[len] + count[len];
+  for (sym = 0; sym < n; sym++)
+    if (lens[sym])
+      work[offs[lens[sym]]++] = sym;
+
+  huff = 0;
+  sym = 0;
+  len = min;
+  next = table;
+  curr = root;
+  drop = 0;
+  low = (unsigned) -1;
+  used = 1U << root;
+  mask = used - 1;
+  if (used > enough)
+    return -1;
 
-   However, this assumption is not true for fixed blocks--the EOB code
-   is 7 bits, but the other literal/length codes can be 8 or 9 bits.
-   (The EOB code is shorter than other codes because fixed blocks are
-   generally short.  So, while a block always has an EOB, many other
-   literal/length codes have a significantly lower probability of
-   showing up at all.)  However, by making the first table have a
-   lookup of seven bits, the EOB code will be found in that first
-   lookup, and so will not require that too many bits be pulled from
-   the stream.
- */
+  for (;;)
+    {
+      grub_uint32_t here = make_entry (kind, work[sym], len - drop);
+
+      /* Replicate the entry for all indexes sharing the code prefix.  */
+      incr = 1U << (len - drop);
+      fill = 1U << curr;
+      do
+	{
+	  fill -= incr;
+	  next[(huff >> drop) + fill] = here;
+	}
+      while (fill != 0);
 
-static ush mask_bits[] =
+      /* Increment the bit-reversed code.  */
+      incr = 1U << (len - 1);
+      while (huff & incr)
+	incr >>= 1;
+      if (incr != 0)
+	{
+	  huff &= incr - 1;
+	  huff += incr;
+	}
+      else
+	huff = 0;
+
+      sym++;
+      if (--count[len] == 0)
+	{
+	  if (len == max)
+	    break;
+	  len = lens[work[sym]];
+	}
+
+      /* Start a new second level table when the root prefix changes.  */
+      if (len > root && (huff & mask) != low)
+	{
+	  if (drop == 0)
+	    drop = root;
+	  next += 1U << curr;
+
+	  curr = len - drop;
+	  left = 1 << curr;
+	  while (curr + drop < max)
+	    {
+	      left -= count[curr + drop];
+	      if (left <= 0)
+		break;
+	      curr++;
+	      left <<= 1;
+	    }
+
+	  used += 1U << curr;
+	  if (used > enough)
+	    return -1;
+
+	  low = huff & mask;
+	  table[low] = ENTRY (root, curr, E_SUBTABLE, next - table);
+	}
+    }
+
+  *bits = root;
+  return 0;
+}
+
+static void
+build_fixed_tables (void)
 {
-  0x0000,
-  0x0001, 0x0003, 0x0007, 0x000f, 0x001f, 0x003f, 0x007f, 0x00ff,
-  0x01ff, 0x03ff, 0x07ff, 0x0fff, 0x1fff, 0x3fff, 0x7fff, 0xffff
-};
+  grub_uint8_t l[288];
+  unsigned i;
+
+  for (i = 0; i < 144; i++)
+    l[i] = 8;
+  for (; i < 256; i++)
+    l[i] = 9;
+  for (; i < 280; i++)
+    l[i] = 7;
+  for (; i < 288; i++)		/* make a complete, but wrong code set */
+    l[i] = 8;
+  fixed_litlen_bits = LITLEN_TABLE_BITS;
+  build_table (l, 288, TABLE_LITLEN, fixed_litlen,
+	       ARRAY_SIZE (fixed_litlen), &fixed_litlen_bits);
 
-#define NEEDBITS(n) do {while(k<(n)){b|=((ulg)get_byte(gzio))<<k;k+=8;}} while (0)
-#define DUMPBITS(n) do {b>>=(n);k-=(n);} while (0)
+  for (i = 0; i < 32; i++)	/* 30 and 31 decode as invalid */
+    l[i] = 5;
+  fixed_dist_bits = DIST_TABLE_BITS;
+  build_table (l, 32, TABLE_DIST, fixed_dist,
+	       ARRAY_SIZE (fixed_dist), &fixed_dist_bits);
 
-static int
-get_byte (grub_gzio_t gzio)
+  fixed_tables_built = 1;
+}
+
+
+/* The bit buffer holds up to 64 bits of input, least significant bit
+   first.  Only the low BK bits are valid; the bits above them may hold a
+   copy of the partially loaded next input byte, which is why refilling
+   ORs the new bytes in.
+
+   REFILL_FAST loads 8 bytes at once and leaves at least 56 valid bits,
+   which covers the longest length/distance pair (15 + 5 + 15 + 13 bits).
+   It needs 8 readable bytes at IN_NEXT.  refill_slow takes bytes one at a
+   time and feeds zeros past the end of the input; consuming them is
+   reported as a premature end when the window is finished.  */
+
+#define REFILL_FAST() \
+  do \
+    { \
+      bb |= grub_le_to_cpu64 (grub_get_unaligned64 (in_next)) << bk; \
+      in_next += (63 - bk) >> 3; \
+      bk |= 56; \
+    } \
+  while (0)
+
+#define DUMPBITS(n) do {bb >>= (n); bk -= (n);} while (0)
+
+#define GETBITS(n) ((unsigned) bb & ((1U << (n)) - 1))
+
+/* Look up the next symbol of TABLE with ROOT_MASK and consume it.  */
+#define DECODE(e, table, root_mask) \
+  do \
+    { \
+      e = table[(unsigned) bb & (root_mask)]; \
+      if (e & E_SUBTABLE) \
+	{ \
+	  DUMPBITS (E_BITS (e)); \
+	  e = table[E_VALUE (e) + GETBITS (E_EXTRA (e))]; \
+	} \
+      DUMPBITS (E_BITS (e)); \
+    } \
+  while (0)
+
+static void
+fill_input (grub_gzio_t gzio)
 {
+  grub_ssize_t n;
+
   if (gzio->mem_input)
-    {
-      if (gzio->mem_input_off < gzio->mem_input_size)
-	return gzio->mem_input[gzio->mem_input_off++];
-      return 0;
-    }
+    return;
 
-  if (gzio->file && (grub_file_tell (gzio->file)
-		     == (grub_off_t) gzio->data_offset
-		     || gzio->inbuf_d == INBUFSIZ))
+  n = grub_file_read (gzio->file, gzio->inbuf, INBUFSIZ);
+  if (n < 0)
+    n = 0;
+  gzio->in_next = gzio->inbuf;
+  gzio->in_end = gzio->inbuf + n;
+}
+
+static void
+refill_slow (grub_gzio_t gzio)
+{
+  while (gzio->bk <= 56)
     {
-      gzio->inbuf_d = 0;
-      grub_file_read (gzio->file, gzio->inbuf, INBUFSIZ);
-    }
+      grub_uint8_t c = 0;
+
+      if (gzio->in_next == gzio->in_end)
+	fill_input (gzio);
+
+      if (gzio->in_next != gzio->in_end)
+	c = *gzio->in_next++;
+      else
+	gzio->in_overrun++;
 
-  return gzio->inbuf[gzio->inbuf_d++];
+      gzio->bb |= (grub_uint64_t) c << gzio->bk;
+      gzio->bk += 8;
+    }
 }
 
 static void
@@ -396,373 +588,231 @@ gzio_seek (grub_gzio_t gzio, grub_off_t off)
 	grub_error (GRUB_ERR_OUT_OF_RANGE,
 		    N_("attempt to seek outside of the file"));
       else
-	gzio->mem_input_off = off;
+	{
+	  gzio->in_next = gzio->mem_input + off;
+	  gzio->in_end = gzio->mem_input + gzio->mem_input_size;
+	}
     }
   else
-    grub_file_seek (gzio->file, off);
+    {
+      grub_file_seek (gzio->file, off);
+      gzio->in_next = gzio->in_end = gzio->inbuf;
+    }
 }
 
-/* more function prototypes */
-static int huft_build (unsigned *, unsigned, unsigned, ush *, ush *,
-		       struct huft **, int *);
-static int huft_free (struct huft *);
-static int inflate_codes_in_window (grub_gzio_t);
-
 
-/* Given a list of code lengths and a maximum table size, make a set of
-   tables to decode that set of codes.  Return zero on success, one if
-   the given code set is incomplete (the tables are still built in this
-   case), two if the input is invalid (all zero length codes or an
-   oversubscribed set of lengths), and three if not enough memory. */
-
-static int
-huft_build (unsigned *b,	/* code lengths in bits (all assumed <= BMAX) */
-	    unsigned n,		/* number of codes (assumed <= N_MAX) */
-	    unsigned s,		/* number of simple-valued codes (0..s-1) */
-	    ush * d,		/* list of base values for non-simple codes */
-	    ush * e,		/* list of extra bits for non-simple codes */
-	    struct huft **t,	/* result: starting table */
-	    int *m)		/* maximum lookup bits, returns actual */
+/* Copy LEN bytes from DIST bytes back to W in the circular window.  */
+static inline void
+copy_match (grub_uint8_t *slide, unsigned w, unsigned dist, unsigned len)
 {
-  unsigned a;			/* counter for codes of length k */
-  unsigned c[BMAX + 1];		/* bit length count table */
-  unsigned f;			/* i repeats in table every f entries */
-  int g;			/* maximum code length */
-  int h;			/* table level */
-  register unsigned i;		/* counter, current code */
-  register unsigned j;		/* counter */
-  register int k;		/* number of bits in current code */
-  int l;			/* bits per table (returned in m) */
-  register unsigned *p;		/* pointer into c[], b[], or v[] */
-  register struct huft *q;	/* points to current table */
-  struct huft r;		/* table entry for structure assignment */
-  struct huft *u[BMAX];		/* table stack */
-  unsigned v[N_MAX];		/* values in order of bit length */
-  register int w;		/* bits before this table == (l * h) */
-  unsigned x[BMAX + 1];		/* bit offsets, then code stack */
-  unsigned *xp;			/* pointer into x */
-  int y;			/* number of dummy codes added */
-  unsigned z;			/* number of entries in current table */
-
-  /* Generate counts for each bit length */
-  grub_memset ((char *) c, 0, sizeof (c));
-  p = b;
-  i = n;
-  do
-    {
-      c[*p]++;			/* assume all entries <= BMAX */
-      p++;			/* Can't combine with above line (Solaris bug) */
-    }
-  while (--i);
-  if (c[0] == n)		/* null input--all zero length codes */
+  unsigned src = (w - dist) & (WSIZE - 1);
+
+  while (len)
     {
-      *t = (struct huft *) NULL;
-      *m = 0;
-      return 0;
+      grub_uint8_t *d = slide + w;
+      const grub_uint8_t *s = slide + src;
+      unsigned n = len;
+
+      if (n > WSIZE - src)
+	n = WSIZE - src;
+      w += n;
+      src = (src + n) & (WSIZE - 1);
+      len -= n;
+
+      if (dist == 1)
+	grub_memset (d, *s, n);
+      else if (dist >= 8 || s > d)
+	{
+	  /* Eight bytes at a time never read a byte written by the same
+	     step, so the copy repeats the pattern like a byte loop.  */
+	  for (; n >= 8; n -= 8, d += 8, s += 8)
+	    grub_set_unaligned64 (d, grub_get_unaligned64 (s));
+	  while (n--)
+	    *d++ = *s++;
+	}
+      else
+	while (n--)
+	  *d++ = *s++;
     }
+}
 
-  /* Find minimum and maximum length, bound *m by those */
-  l = *m;
-  for (j = 1; j <= BMAX; j++)
-    if (c[j])
-      break;
-  k = j;			/* minimum code length */
-  if ((unsigned) l < j)
-    l = j;
-  for (i = BMAX; i; i--)
-    if (c[i])
-      break;
-  g = i;			/* maximum code length */
-  if ((unsigned) l > i)
-    l = i;
-  *m = l;
-
-  /* Adjust last length count to fill out codes, if needed */
-  for (y = 1 << j; j < i; j++, y <<= 1)
-    if ((y -= c[j]) < 0)
-      return 2;			/* bad input: more codes than bits */
-  if ((y -= c[i]) < 0)
-    return 2;
-  c[i] += y;
-
-  /* Generate starting offsets into the value table for each length */
-  x[1] = j = 0;
-  p = c + 1;
-  xp = x + 2;
-  while (--i)
-    {				/* note that i == g from above */
-      *xp++ = (j += *p++);
-    }
 
-  /* Make a table of values in order of bit lengths */
-  p = b;
-  i = 0;
-  do
-    {
-      if ((j = *p++) != 0)
-	v[x[j]++] = i;
-    }
-  while (++i < n);
-
-  /* Generate the Huffman codes and for each, make the table entries */
-  x[0] = i = 0;			/* first Huffman code is zero */
-  p = v;			/* grab values in bit order */
-  h = -1;			/* no tables yet--level -1 */
-  w = -l;			/* bits decoded == (l * h) */
-  u[0] = (struct huft *) NULL;	/* just to keep compilers happy */
-  q = (struct huft *) NULL;	/* ditto */
-  z = 0;			/* ditto */
-
-  /* go through the bit lengths (k already is bits in shortest code) */
-  for (; k <= g; k++)
+/*
+ *  inflate (decompress) the codes in a deflated (compressed) block
+ *  until the end of the block or of the window.
+ */
+
+static void
+inflate_codes (grub_gzio_t gzio)
+{
+  grub_uint8_t *slide = gzio->slide;
+  const grub_uint32_t *litlen = gzio->litlen;
+  const grub_uint32_t *dist = gzio->dist;
+  unsigned lmask = (1U << gzio->litlen_bits) - 1;
+  unsigned dmask = (1U << gzio->dist_bits) - 1;
+  grub_uint64_t bb = gzio->bb;
+  unsigned bk = gzio->bk;
+  const grub_uint8_t *in_next = gzio->in_next;
+  const grub_uint8_t *in_end = gzio->in_end;
+  unsigned w = gzio->wp;
+  grub_uint32_t e;
+  unsigned len, d;
+
+  while (w < WSIZE)
     {
-      a = c[k];
-      while (a--)
+      /* Fast loop: there is input for a whole symbol pair and room for
+	 the longest match, so neither needs checking per symbol.  */
+      while (w <= WSIZE - 258 && in_end - in_next >= 8)
 	{
-	  /* here i is the Huffman code of length k bits for value *p */
-	  /* make tables up to required level */
-	  while (k > w + l)
+	  REFILL_FAST ();
+	  DECODE (e, litlen, lmask);
+	  if (e & E_LITERAL)
 	    {
-	      h++;
-	      w += l;		/* previous table always l bits */
-
-	      /* compute minimum size table less than or equal to l bits */
-	      z = (z = (unsigned) (g - w)) > (unsigned) l ? (unsigned) l : z;	/* upper limit on table size */
-	      if ((f = 1 << (j = k - w)) > a + 1)	/* try a k-w bit table */
-		{		/* too few codes for k-w bit table */
-		  f -= a + 1;	/* deduct codes from patterns left */
-		  xp = c + k;
-		  while (++j < z)	/* try smaller tables up to z bits */
-		    {
-		      if ((f <<= 1) <= *++xp)
-			break;	/* enough codes to use up j bits */
-		      f -= *xp;	/* else deduct codes from patterns */
-		    }
-		}
-	      z = 1 << j;	/* table entries for j-bit table */
-
-	      /* allocate and link in new table */
-	      q = (struct huft *) grub_zalloc ((z + 1) * sizeof (struct huft));
-	      if (! q)
-		{
-		  if (h)
-		    huft_free (u[0]);
-		  return 3;
-		}
-
-	      *t = q + 1;	/* link to list for huft_free() */
-	      *(t = &(q->v.t)) = (struct huft *) NULL;
-	      u[h] = ++q;	/* table starts after link */
-
-	      /* connect to last table, if there is one */
-	      if (h)
+	      slide[w++] = E_VALUE (e);
+	      /* A second literal still fits in the refilled bits.  */
+	      e = litlen[(unsigned) bb & lmask];
+	      if (e & E_LITERAL)
 		{
-		  x[h] = i;	/* save pattern for backing up */
-		  r.b = (uch) l;	/* bits to dump before this table */
-		  r.e = (uch) (16 + j);		/* bits in this table */
-		  r.v.t = q;	/* pointer to this table */
-		  j = i >> (w - l);	/* (get around Turbo C bug) */
-		  u[h - 1][j] = r;	/* connect to last table */
+		  DUMPBITS (E_BITS (e));
+		  slide[w++] = E_VALUE (e);
 		}
+	      continue;
 	    }
+	  if (e & (E_EOB | E_INVALID))
+	    goto end_of_codes;
+
+	  len = E_VALUE (e) + GETBITS (E_EXTRA (e));
+	  DUMPBITS (E_EXTRA (e));
+
+	  DECODE (e, dist, dmask);
+	  if (e & E_INVALID)
+	    goto bad_distance;
+	  d = E_VALUE (e) + GETBITS (E_EXTRA (e));
+	  DUMPBITS (E_EXTRA (e));
+	  if (d > w && d > gzio->saved_offset + w)
+	    goto bad_distance;
+
+	  copy_match (slide, w, d, len);
+	  w += len;
+	}
 
-	  /* set up table entry in r */
-	  r.b = (uch) (k - w);
-	  if (p >= v + n)
-	    r.e = 99;		/* out of values--invalid code */
-	  else if (*p < s)
-	    {
-	      r.e = (uch) (*p < 256 ? 16 : 15);		/* 256 is end-of-block code */
-	      r.v.n = (ush) (*p);	/* simple code is just the value */
-	      p++;		/* one compiler does not like *p++ */
-	    }
-	  else
-	    {
-	      r.e = (uch) e[*p - s];	/* non-simple--look up in lists */
-	      r.v.n = d[*p++ - s];
-	    }
-
-	  /* fill code-like entries with r */
-	  f = 1 << (k - w);
-	  for (j = i >> w; j < z; j += f)
-	    q[j] = r;
+      if (w >= WSIZE)
+	break;
 
-	  /* backwards increment the k-bit code i */
-	  for (j = 1 << (k - 1); i & j; j >>= 1)
-	    i ^= j;
-	  i ^= j;
+      /* Slow path: one symbol near the end of the input or the window.  */
+      if (in_end - in_next >= 8)
+	REFILL_FAST ();
+      else
+	{
+	  gzio->bb = bb;
+	  gzio->bk = bk;
+	  gzio->in_next = in_next;
+	  refill_slow (gzio);
+	  bb = gzio->bb;
+	  bk = gzio->bk;
+	  in_next = gzio->in_next;
+	  in_end = gzio->in_end;
+	}
 
-	  /* backup over finished tables */
-	  while ((i & ((1 << w) - 1)) != x[h])
-	    {
-	      h--;		/* don't need to update q */
-	      w -= l;
-	    }
+      DECODE (e, litlen, lmask);
+      if (e & E_LITERAL)
+	{
+	  slide[w++] = E_VALUE (e);
+	  continue;
+	}
+      if (e & (E_EOB | E_INVALID))
+	goto end_of_codes;
+
+      len = E_VALUE (e) + GETBITS (E_EXTRA (e));
+      DUMPBITS (E_EXTRA (e));
+
+      DECODE (e, dist, dmask);
+      if (e & E_INVALID)
+	goto bad_distance;
+      d = E_VALUE (e) + GETBITS (E_EXTRA (e));
+      DUMPBITS (E_EXTRA (e));
+      if (d > w && d > gzio->saved_offset + w)
+	goto bad_distance;
+
+      /* Keep the part of the match beyond the window for the next one.  */
+      if (len > WSIZE - w)
+	{
+	  gzio->copy_len = len - (WSIZE - w);
+	  gzio->copy_dist = d;
+	  len = WSIZE - w;
 	}
+      copy_match (slide, w, d, len);
+      w += len;
     }
+  goto out;
 
-  /* Return true (1) if we were given an incomplete table */
-  return y != 0 && g != 1;
-}
-
-
-/* Free the malloc'ed tables built by huft_build(), which makes a linked
-   list of the tables it made, with the links in a dummy first entry of
-   each table.  */
-static int
-huft_free (struct huft *t)
-{
-  register struct huft *p, *q;
+ end_of_codes:
+  if (e & E_INVALID)
+    grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		"an unused code found");
+  else
+    gzio->block_len = 0;
+  goto out;
 
+ bad_distance:
+  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "invalid distance");
 
-  /* Go through linked list, freeing from the malloced (t[-1]) address. */
-  p = t;
-  while (p != (struct huft *) NULL)
-    {
-      q = (--p)->v.t;
-      grub_free ((char *) p);
-      p = q;
-    }
-  return 0;
+ out:
+  gzio->bb = bb;
+  gzio->bk = bk;
+  gzio->in_next = in_next;
+  gzio->in_end = in_end;
+  gzio->wp = w;
 }
 
 
-/*
- *  inflate (decompress) the codes in a deflated (compressed) block.
- *  Return an error code or zero if it all goes ok.
- */
+/* Expand a type 0 (stored) block until its end or the end of the window.  */
 
-static int
-inflate_codes_in_window (grub_gzio_t gzio)
+static void
+inflate_stored (grub_gzio_t gzio)
 {
-  register unsigned e;		/* table entry flag/number of extra bits */
-  unsigned n, d;		/* length and index for copy */
-  unsigned w;			/* current window position */
-  struct huft *t;		/* pointer to table entry */
-  unsigned ml, md;		/* masks for bl and bd bits */
-  register ulg b;		/* bit buffer */
-  register unsigned k;		/* number of bits in bit buffer */
-
-  /* make local copies of globals */
-  d = gzio->inflate_d;
-  n = gzio->inflate_n;
-  b = gzio->bb;			/* initialize bit buffer */
-  k = gzio->bk;
-  w = gzio->wp;			/* initialize window position */
-
-  /* inflate the coded data */
-  ml = mask_bits[gzio->bl];		/* precompute masks for speed */
-  md = mask_bits[gzio->bd];
-  for (;;)			/* do until end of block */
-    {
-      if (! gzio->code_state)
-	{
-	  NEEDBITS ((unsigned) gzio->bl);
-	  if ((e = (t = gzio->tl + ((unsigned) b & ml))->e) > 16)
-	    do
-	      {
-		if (e == 99)
-		  {
-		    grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
-				"an unused code found");
-		    return 1;
-		  }
-		DUMPBITS (t->b);
-		e -= 16;
-		NEEDBITS (e);
-	      }
-	    while ((e = (t = t->v.t + ((unsigned) b & mask_bits[e]))->e) > 16);
-	  DUMPBITS (t->b);
-
-	  if (e == 16)		/* then it's a literal */
-	    {
-	      gzio->slide[w++] = (uch) t->v.n;
-	      if (w == WSIZE)
-		break;
-	    }
-	  else
-	    /* it's an EOB or a length */
-	    {
-	      /* exit if end of block */
-	      if (e == 15)
-		{
-		  gzio->block_len = 0;
-		  break;
-		}
+  unsigned w = gzio->wp;
 
-	      /* get length of block to copy */
-	      NEEDBITS (e);
-	      n = t->v.n + ((unsigned) b & mask_bits[e]);
-	      DUMPBITS (e);
-
-	      /* decode distance of block to copy */
-	      NEEDBITS ((unsigned) gzio->bd);
-	      if ((e = (t = gzio->td + ((unsigned) b & md))->e) > 16)
-		do
-		  {
-		    if (e == 99)
-		      {
-			grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
-				    "an unused code found");
-			return 1;
-		      }
-		    DUMPBITS (t->b);
-		    e -= 16;
-		    NEEDBITS (e);
-		  }
-		while ((e = (t = t->v.t + ((unsigned) b & mask_bits[e]))->e)
-		       > 16);
-	      DUMPBITS (t->b);
-	      NEEDBITS (e);
-	      d = w - t->v.n - ((unsigned) b & mask_bits[e]);
-	      DUMPBITS (e);
-	      gzio->code_state++;
-	    }
-	}
+  while (gzio->block_len && w < WSIZE)
+    {
+      grub_size_t n;
 
-      if (gzio->code_state)
+      /* Bytes already in the bit buffer come first.  */
+      if (gzio->bk >= 8)
 	{
-	  /* do the copy */
-	  do
-	    {
-	      n -= (e = (e = WSIZE - ((d &= WSIZE - 1) > w ? d : w)) > n ? n
-		    : e);
+	  gzio->slide[w++] = gzio->bb & 0xff;
+	  gzio->bb >>= 8;
+	  gzio->bk -= 8;
+	  gzio->block_len--;
+	  continue;
+	}
 
-	      if (w - d >= e)
-		{
-		  grub_memmove (gzio->slide + w, gzio->slide + d, e);
-		  w += e;
-		  d += e;
-		}
-	      else
-		/* purposefully use the overlap for extra copies here!! */
-		{
-		  while (e--)
-		    gzio->slide[w++] = gzio->slide[d++];
-		}
+      /* The buffer is empty and the input is read directly, so drop
+	 the copy of the next byte it may hold.  */
+      gzio->bb = 0;
 
-	      if (w == WSIZE)
-		break;
-	    }
-	  while (n);
+      if (gzio->in_next == gzio->in_end)
+	fill_input (gzio);
+      if (gzio->in_next == gzio->in_end)
+	{
+	  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		      "premature end of compressed data");
+	  break;
+	}
 
-	  if (! n)
-	    gzio->code_state--;
+      n = gzio->in_end - gzio->in_next;
+      if (n > gzio->block_len)
+	n = gzio->block_len;
+      if (n > WSIZE - w)
+	n = WSIZE - w;
 
-	  /* did we break from the loop too soon? */
-	  if (w == WSIZE)
-	    break;
-	}
+      grub_memcpy (gzio->slide + w, gzio->in_next, n);
+      gzio->in_next += n;
+      w += n;
+      gzio->block_len -= n;
     }
 
-  /* restore the globals from the locals */
-  gzio->inflate_d = d;
-  gzio->inflate_n = n;
-  gzio->wp = w;			/* restore global window pointer */
-  gzio->bb = b;			/* restore global bit buffer */
-  gzio->bk = k;
-
-  return ! gzio->block_len;
+  gzio->wp = w;
 }
 
 
@@ -771,77 +821,40 @@ inflate_codes_in_window (grub_gzio_t gzio)
 static void
 init_stored_block (grub_gzio_t gzio)
 {
-  register ulg b;		/* bit buffer */
-  register unsigned k;		/* number of bits in bit buffer */
-
-  /* make local copies of globals */
-  b = gzio->bb;			/* initialize bit buffer */
-  k = gzio->bk;
+  unsigned nlen;
 
   /* go to byte boundary */
-  DUMPBITS (k & 7);
+  gzio->bb >>= gzio->bk & 7;
+  gzio->bk -= gzio->bk & 7;
 
   /* get the length and its complement */
-  NEEDBITS (16);
-  gzio->block_len = ((unsigned) b & 0xffff);
-  DUMPBITS (16);
-  NEEDBITS (16);
-  if (gzio->block_len != (int) ((~b) & 0xffff))
+  refill_slow (gzio);
+  gzio->block_len = gzio->bb & 0xffff;
+  nlen = (gzio->bb >> 16) & 0xffff;
+  gzio->bb >>= 32;
+  gzio->bk -= 32;
+
+  if (gzio->block_len != (~nlen & 0xffff))
     grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
 		"the length of a stored block does not match");
-  DUMPBITS (16);
-
-  /* restore global variables */
-  gzio->bb = b;
-  gzio->bk = k;
 }
 
 
-/* get header for an inflated type 1 (fixed Huffman codes) block.  We should
-   either replace this with a custom decoder, or at least precompute the
-   Huffman tables. */
+/* get header for an inflated type 1 (fixed Huffman codes) block. */
 
 static void
 init_fixed_block (grub_gzio_t gzio)
 {
-  int i;			/* temporary variable */
-  unsigned l[288];		/* length list for huft_build */
-
-  /* set up literal table */
-  for (i = 0; i < 144; i++)
-    l[i] = 8;
-  for (; i < 256; i++)
-    l[i] = 9;
-  for (; i < 280; i++)
-    l[i] = 7;
-  for (; i < 288; i++)		/* make a complete, but wrong code set */
-    l[i] = 8;
-  gzio->bl = 7;
-  if (huft_build (l, 288, 257, cplens, cplext, &gzio->tl, &gzio->bl) != 0)
-    {
-      if (grub_errno == GRUB_ERR_NONE)
-	grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
-		    "failed in building a Huffman code table");
-      return;
-    }
+  if (! fixed_tables_built)
+    build_fixed_tables ();
 
-  /* set up distance table */
-  for (i = 0; i < 30; i++)	/* make an incomplete code set */
-    l[i] = 5;
-  gzio->bd = 5;
-  if (huft_build (l, 30, 0, cpdist, cpdext, &gzio->td, &gzio->bd) > 1)
-    {
-      if (grub_errno == GRUB_ERR_NONE)
-	grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
-		    "failed in building a Huffman code table");
-      huft_free (gzio->tl);
-      gzio->tl = 0;
-      return;
-    }
+  gzio->litlen = fixed_litlen;
+  gzio->litlen_bits = fixed_litlen_bits;
+  gzio->dist = fixed_dist;
+  gzio->dist_bits = fixed_dist_bits;
 
   /* indicate we're now working on a block */
-  gzio->code_state = 0;
-  gzio->block_len++;
+  gzio->block_len = 1;
 }
 
 
@@ -850,169 +863,151 @@ init_fixed_block (grub_gzio_t gzio)
 static void
 init_dynamic_block (grub_gzio_t gzio)
 {
-  int i;			/* temporary variables */
-  unsigned j;
-  unsigned l;			/* last length */
-  unsigned m;			/* mask for bit lengths table */
+  unsigned i, j;
   unsigned n;			/* number of lengths to get */
   unsigned nb;			/* number of bit length codes */
   unsigned nl;			/* number of literal/length codes */
   unsigned nd;			/* number of distance codes */
-  unsigned ll[286 + 30];	/* literal/length and distance code lengths */
-  register ulg b;		/* bit buffer */
-  register unsigned k;		/* number of bits in bit buffer */
-
-  /* make local bit buffer */
-  b = gzio->bb;
-  k = gzio->bk;
+  unsigned pbits, pmask;
+  grub_uint8_t ll[286 + 30];	/* literal/length and distance code lengths */
+  grub_uint32_t precode[PRECODE_TABLE_ENOUGH];
 
   /* read in table lengths */
-  NEEDBITS (5);
-  nl = 257 + ((unsigned) b & 0x1f);	/* number of literal/length codes */
-  DUMPBITS (5);
-  NEEDBITS (5);
-  nd = 1 + ((unsigned) b & 0x1f);	/* number of distance codes */
-  DUMPBITS (5);
-  NEEDBITS (4);
-  nb = 4 + ((unsigned) b & 0xf);	/* number of bit length codes */
-  DUMPBITS (4);
+  refill_slow (gzio);
+  nl = 257 + (gzio->bb & 0x1f);	/* number of literal/length codes */
+  nd = 1 + ((gzio->bb >> 5) & 0x1f);	/* number of distance codes */
+  nb = 4 + ((gzio->bb >> 10) & 0xf);	/* number of bit length codes */
+  gzio->bb >>= 14;
+  gzio->bk -= 14;
   if (nl > 286 || nd > 30)
     {
       grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "too much data");
       return;
     }
 
-  /* read in bit-length-code lengths */
+  /* read in bit-length-code lengths; 19 * 3 bits fit in one refill */
+  refill_slow (gzio);
   for (j = 0; j < nb; j++)
     {
-      NEEDBITS (3);
-      ll[bitorder[j]] = (unsigned) b & 7;
-      DUMPBITS (3);
+      ll[bitorder[j]] = gzio->bb & 7;
+      gzio->bb >>= 3;
+      gzio->bk -= 3;
     }
   for (; j < 19; j++)
     ll[bitorder[j]] = 0;
 
   /* build decoding table for trees--single level, 7 bit lookup */
-  gzio->bl = 7;
-  if (huft_build (ll, 19, 19, NULL, NULL, &gzio->tl, &gzio->bl) != 0)
+  pbits = PRECODE_TABLE_BITS;
+  if (build_table (ll, 19, TABLE_PRECODE, precode,
+		   ARRAY_SIZE (precode), &pbits) != 0)
     {
       grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
 		  "failed in building a Huffman code table");
       return;
     }
+  pmask = (1U << pbits) - 1;
 
   /* read in literal and distance code lengths */
   n = nl + nd;
-  m = mask_bits[gzio->bl];
-  i = l = 0;
-  while ((unsigned) i < n)
+  i = 0;
+  while (i < n)
     {
-      NEEDBITS ((unsigned) gzio->bl);
-      j = (gzio->td = gzio->tl + ((unsigned) b & m))->b;
-      DUMPBITS (j);
-      j = gzio->td->v.n;
+      grub_uint32_t e;
+      unsigned rep;
+      grub_uint8_t val = 0;
+
+      refill_slow (gzio);
+      e = precode[gzio->bb & pmask];
+      if (e & E_INVALID)
+	{
+	  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "an unused code found");
+	  return;
+	}
+      gzio->bb >>= E_BITS (e);
+      gzio->bk -= E_BITS (e);
+
+      j = E_VALUE (e);
       if (j < 16)		/* length of code in bits (0..15) */
-	ll[i++] = l = j;	/* save last length in l */
-      else if (j == 16)		/* repeat last length 3 to 6 times */
 	{
-	  NEEDBITS (2);
-	  j = 3 + ((unsigned) b & 3);
-	  DUMPBITS (2);
-	  if ((unsigned) i + j > n)
+	  ll[i++] = j;
+	  continue;
+	}
+
+      if (j == 16)		/* repeat last length 3 to 6 times */
+	{
+	  if (i == 0)
 	    {
-	      grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "too many codes found");
+	      grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+			  "repeated code length without a previous one");
 	      return;
 	    }
-	  while (j--)
-	    ll[i++] = l;
+	  val = ll[i - 1];
+	  rep = 3 + (gzio->bb & 3);
+	  gzio->bb >>= 2;
+	  gzio->bk -= 2;
 	}
       else if (j == 17)		/* 3 to 10 zero length codes */
 	{
-	  NEEDBITS (3);
-	  j = 3 + ((unsigned) b & 7);
-	  DUMPBITS (3);
-	  if ((unsigned) i + j > n)
-	    {
-	      grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "too many codes found");
-	      return;
-	    }
-	  while (j--)
-	    ll[i++] = 0;
-	  l = 0;
+	  rep = 3 + (gzio->bb & 7);
+	  gzio->bb >>= 3;
+	  gzio->bk -= 3;
 	}
-      else
-	/* j == 18: 11 to 138 zero length codes */
+      else			/* j == 18: 11 to 138 zero length codes */
 	{
-	  NEEDBITS (7);
-	  j = 11 + ((unsigned) b & 0x7f);
-	  DUMPBITS (7);
-	  if ((unsigned) i + j > n)
-	    {
-	      grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "too many codes found");
-	      return;
-	    }
-	  while (j--)
-	    ll[i++] = 0;
-	  l = 0;
+	  rep = 11 + (gzio->bb & 0x7f);
+	  gzio->bb >>= 7;
+	  gzio->bk -= 7;
 	}
-    }
-
-  /* free decoding table for trees */
-  huft_free (gzio->tl);
-  gzio->td = 0;
-  gzio->tl = 0;
 
-  /* restore the global bit buffer */
-  gzio->bb = b;
-  gzio->bk = k;
+      if (i + rep > n)
+	{
+	  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA, "too many codes found");
+	  return;
+	}
+      while (rep--)
+	ll[i++] = val;
+    }
 
-  /* build the decoding tables for literal/length and distance codes */
-  gzio->bl = lbits;
-  if (huft_build (ll, nl, 257, cplens, cplext, &gzio->tl, &gzio->bl) != 0)
+  if (ll[256] == 0)
     {
       grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
-		  "failed in building a Huffman code table");
+		  "no end-of-block code in a Huffman block");
       return;
     }
-  gzio->bd = dbits;
-  if (huft_build (ll + nl, nd, 0, cpdist, cpdext, &gzio->td, &gzio->bd) != 0)
+
+  /* build the decoding tables for literal/length and distance codes */
+  gzio->litlen_bits = LITLEN_TABLE_BITS;
+  gzio->dist_bits = DIST_TABLE_BITS;
+  if (build_table (ll, nl, TABLE_LITLEN, gzio->litlen_table,
+		   ARRAY_SIZE (gzio->litlen_table), &gzio->litlen_bits) != 0
+      || build_table (ll + nl, nd, TABLE_DIST, gzio->dist_table,
+		      ARRAY_SIZE (gzio->dist_table), &gzio->dist_bits) != 0)
     {
-      huft_free (gzio->tl);
-      gzio->tl = 0;
       grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
 		  "failed in building a Huffman code table");
       return;
     }
+  gzio->litlen = gzio->litlen_table;
+  gzio->dist = gzio->dist_table;
 
   /* indicate we're now working on a block */
-  gzio->code_state = 0;
-  gzio->block_len++;
+  gzio->block_len = 1;
 }
 
 
 static void
 get_new_block (grub_gzio_t gzio)
 {
-  register ulg b;		/* bit buffer */
-  register unsigned k;		/* number of bits in bit buffer */
-
-  /* make local bit buffer */
-  b = gzio->bb;
-  k = gzio->bk;
+  refill_slow (gzio);
 
   /* read in last block bit */
-  NEEDBITS (1);
-  gzio->last_block = (int) b & 1;
-  DUMPBITS (1);
+  gzio->last_block = gzio->bb & 1;
 
   /* read in block type */
-  NEEDBITS (2);
-  gzio->block_type = (unsigned) b & 3;
-  DUMPBITS (2);
+  gzio->block_type = (gzio->bb >> 1) & 3;
 
-  /* restore the global bit buffer */
-  gzio->bb = b;
-  gzio->bk = k;
+  gzio->bb >>= 3;
+  gzio->bk -= 3;
 
   switch (gzio->block_type)
     {
@@ -1026,6 +1021,8 @@ get_new_block (grub_gzio_t gzio)
       init_dynamic_block (gzio);
       break;
     default:
+      grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		  "unknown block type %d", gzio->block_type);
       break;
     }
 }
@@ -1037,6 +1034,14 @@ inflate_window (grub_gzio_t gzio)
   /* initialize window */
   gzio->wp = 0;
 
+  /* finish the match that crossed the end of the previous window */
+  if (gzio->copy_len)
+    {
+      copy_match (gzio->slide, 0, gzio->copy_dist, gzio->copy_len);
+      gzio->wp = gzio->copy_len;
+      gzio->copy_len = 0;
+    }
+
   /*
    *  Main decompression loop.
    */
@@ -1049,50 +1054,20 @@ inflate_window (grub_gzio_t gzio)
 	    break;
 
 	  get_new_block (gzio);
-	}
-
-      if (gzio->block_type > INFLATE_DYNAMIC)
-	grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
-		    "unknown block type %d", gzio->block_type);
-
-      if (grub_errno != GRUB_ERR_NONE)
-	return;
-
-      /*
-       *  Expand stored block here.
-       */
-      if (gzio->block_type == INFLATE_STORED)
-	{
-	  int w = gzio->wp;
-
-	  /*
-	   *  This is basically a glorified pass-through
-	   */
-
-	  while (gzio->block_len && w < WSIZE && grub_errno == GRUB_ERR_NONE)
-	    {
-	      gzio->slide[w++] = get_byte (gzio);
-	      gzio->block_len--;
-	    }
-
-	  gzio->wp = w;
-
 	  continue;
 	}
 
-      /*
-       *  Expand other kind of block.
-       */
-
-      if (inflate_codes_in_window (gzio))
-	{
-	  huft_free (gzio->tl);
-	  huft_free (gzio->td);
-	  gzio->tl = 0;
-	  gzio->td = 0;
-	}
+      if (gzio->block_type == INFLATE_STORED)
+	inflate_stored (gzio);
+      else
+	inflate_codes (gzio);
     }
 
+  /* The zeros fed past the end of the input must not have been used.  */
+  if (grub_errno == GRUB_ERR_NONE && gzio->bk < gzio->in_overrun * 8)
+    grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		"premature end of compressed data");
+
   gzio->saved_offset += gzio->wp;
 
   /* XXX do CRC calculation here! */
@@ -1108,16 +1083,12 @@ initialize_tables (grub_gzio_t gzio)
   /* Initialize the bit buffer.  */
   gzio->bk = 0;
   gzio->bb = 0;
+  gzio->in_overrun = 0;
 
   /* Reset partial decompression code.  */
   gzio->last_block = 0;
   gzio->block_len = 0;
-
-  /* Reset memory allocation stuff.  */
-  huft_free (gzio->tl);
-  huft_free (gzio->td);
-  gzio->tl = NULL;
-  gzio->td = NULL;
+  gzio->copy_len = 0;
 }
 
 
@@ -1178,9 +1149,16 @@ static int
 test_zlib_header (grub_gzio_t gzio)
 {
   grub_uint8_t cmf, flg;
-  
-  cmf = get_byte (gzio);
-  flg = get_byte (gzio);
+
+  if (gzio->mem_input_size < 2)
+    {
+      grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
+		  "premature end of compressed data");
+      return 0;
+    }
+
+  cmf = gzio->mem_input[0];
+  flg = gzio->mem_input[1];
 
   /* Check that compression method is DEFLATE.  */
   if ((cmf & 0xf) != DEFLATED)
@@ -1248,6 +1226,9 @@ grub_gzio_read_real (grub_gzio_t gzio, grub_off_t offset,
       size = gzio->saved_offset - offset;
       if (size > len)
 	size = len;
+      /* Data before the current window wraps around the slide.  */
+      if (size > WSIZE - (offset & (WSIZE - 1)))
+	size = WSIZE - (offset & (WSIZE - 1));
 
       grub_memmove (buf, srcaddr, size);
 
@@ -1285,8 +1266,6 @@ grub_gzio_close (grub_file_t file)
   grub_gzio_t gzio = file->data;
 
   grub_file_close (gzio->file);
-  huft_free (gzio->tl);
-  huft_free (gzio->td);
   grub_free (gzio);
 
   /* No need to close the same device twice.  */
@@ -1308,7 +1287,6 @@ grub_zlib_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
     return -1;
   gzio->mem_input = (grub_uint8_t *) inbuf;
   gzio->mem_input_size = insize;
-  gzio->mem_input_off = 0;
 
   if (!test_zlib_header (gzio))
     {
@@ -1335,7 +1313,6 @@ grub_deflate_decompress (char *inbuf, grub_size_t insize, grub_off_t off,
     return -1;
   gzio->mem_input = (grub_uint8_t *) inbuf;
   gzio->mem_input_size = insize;
-  gzio->mem_input_off = 0;
 
   initialize_tables (gzio);
 
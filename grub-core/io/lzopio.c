@@ -59,6 +59,13 @@ struct block_header
   unsigned char *udata;
 };
 
+/* Where a block starts, in the file and in the uncompressed data.  */
+struct block_index
+{
+  grub_off_t header_off;
+  grub_off_t uoffset;
+};
+
 struct grub_lzopio
 {
   grub_file_t file;
@@ -69,6 +76,10 @@ struct grub_lzopio
   grub_off_t saved_off;		/* Rounded down to block boundary.  */
   grub_off_t start_block_off;
   struct block_header block;
+  /* All blocks, recorded while computing the uncompressed size.  */
+  struct block_index *index;
+  grub_size_t nblocks;
+  grub_size_t alloc_blocks;
 };
 
 typedef struct grub_lzopio *grub_lzopio_t;
@@ -253,11 +264,36 @@ jump_block (struct grub_lzopio *lzopio)
   return read_block_header (lzopio);
 }
 
+/* Record that the block with header at HEADER_OFF holds data from
+   UOFFSET on.  */
+static int
+add_block_index (struct grub_lzopio *lzopio, grub_off_t header_off,
+		 grub_off_t uoffset)
+{
+  if (lzopio->nblocks == lzopio->alloc_blocks)
+    {
+      struct block_index *n;
+      grub_size_t alloc = lzopio->alloc_blocks ? 2 * lzopio->alloc_blocks : 16;
+
+      n = grub_realloc (lzopio->index, alloc * sizeof (n[0]));
+      if (!n)
+	return -1;
+      lzopio->index = n;
+      lzopio->alloc_blocks = alloc;
+    }
+
+  lzopio->index[lzopio->nblocks].header_off = header_off;
+  lzopio->index[lzopio->nblocks].uoffset = uoffset;
+  lzopio->nblocks++;
+  return 0;
+}
+
 static int
 calculate_uncompressed_size (grub_file_t file)
 {
   grub_lzopio_t lzopio = file->data;
   grub_off_t usize_total = 0;
+  grub_off_t header_off = grub_file_tell (lzopio->file);
 
   if (read_block_header (lzopio) < 0)
     return -1;
@@ -265,8 +301,12 @@ calculate_uncompressed_size (grub_file_t file)
   /* FIXME: Don't do this for not easily seekable files.  */
   while (lzopio->block.usize != 0)
     {
+      if (add_block_index (lzopio, header_off, usize_total) < 0)
+	return -1;
+
       usize_total += lzopio->block.usize;
 
+      header_off = grub_file_tell (lzopio->file) + lzopio->block.csize;
       if (jump_block (lzopio) < 0)
 	return -1;
     }
@@ -403,6 +443,7 @@ test_header (grub_file_t file)
   return 1;
 
 CORRUPTED:
+  grub_free (lzopio->index);
   return 0;
 }
 
@@ -455,6 +496,33 @@ grub_lzopio_read (grub_file_t file, char *buf, grub_size_t len)
   grub_ssize_t ret = 0;
   grub_off_t off;
 
+  /* Jump straight to the block holding the data, unless it is the current
+     one which may already be decompressed.  */
+  if (lzopio->nblocks && grub_file_tell (file) < file->size)
+    {
+      grub_size_t lo = 0, hi = lzopio->nblocks;
+
+      while (hi - lo > 1)
+	{
+	  grub_size_t mid = (lo + hi) / 2;
+	  if (lzopio->index[mid].uoffset <= grub_file_tell (file))
+	    lo = mid;
+	  else
+	    hi = mid;
+	}
+
+      if (lzopio->saved_off != lzopio->index[lo].uoffset
+	  || lzopio->block.usize == 0)
+	{
+	  grub_file_seek (lzopio->file, lzopio->index[lo].header_off);
+	  lzopio->block.usize = 0;
+	  lzopio->saved_off = lzopio->index[lo].uoffset;
+
+	  if (read_block_header (lzopio) < 0)
+	    goto CORRUPTED;
+	}
+    }
+
   /* Backward seek before last read block.  */
   if (lzopio->saved_off > grub_file_tell (file))
     {
@@ -519,6 +587,7 @@ grub_lzopio_close (grub_file_t file)
   grub_file_close (lzopio->file);
   grub_free (lzopio->block.cdata);
   grub_free (lzopio->block.udata);
+  grub_free (lzopio->index);
   grub_free (lzopio);
 
   /* Device must not be closed twice.  */
@@ -33,6 +33,15 @@ GRUB_MOD_LICENSE ("GPLv3+");
 #define VLI_MAX_DIGITS 9
 #define XZ_STREAM_FOOTER_SIZE 12
 
+/* A block of the stream, as listed in the index.  */
+struct grub_xzio_block
+{
+  /* Offset of the block header in the compressed file.  */
+  grub_off_t coffset;
+  /* Offset of the first byte of the block in the uncompressed data.  */
+  grub_off_t uoffset;
+};
+
 struct grub_xzio
 {
   grub_file_t file;
@@ -41,6 +50,17 @@ struct grub_xzio
   grub_uint8_t inbuf[XZBUFSIZ];
   grub_uint8_t outbuf[XZBUFSIZ];
   grub_off_t saved_offset;
+  /* The stream header, fed again when decoding restarts at a block.  */
+  grub_uint8_t header[STREAM_HEADER_SIZE];
+  /* The blocks from the index and the offset of the index, which the
+     decoder is never fed: it would not match the blocks it has seen
+     after a restart.  */
+  struct grub_xzio_block *blocks;
+  grub_size_t nblocks;
+  grub_off_t index_offset;
+  /* The uncompressed range still held by OUTBUF.  */
+  grub_off_t out_offset;
+  grub_size_t out_len;
 };
 
 typedef struct grub_xzio *grub_xzio_t;
@@ -70,22 +90,6 @@ decode_vli (const grub_uint8_t buf[], grub_size_t size_max,
   return i;
 }
 
-static grub_ssize_t
-read_vli (grub_file_t file, grub_uint64_t *num)
-{
-  grub_uint8_t buf[VLI_MAX_DIGITS];
-  grub_ssize_t read_bytes;
-  grub_size_t dec;
-
-  read_bytes = grub_file_read (file, buf, VLI_MAX_DIGITS);
-  if (read_bytes < 0)
-    return -1;
-
-  dec = decode_vli (buf, read_bytes, num);
-  grub_file_seek (file, file->offset - (read_bytes - dec));
-  return dec;
-}
-
 /* Function xz_dec_run() should consume header and ask for more (XZ_OK)
  * else file is corrupted (or options not supported) or not xz.  */
 static int
@@ -100,6 +104,8 @@ test_header (grub_file_t file)
   if (xzio->buf.in_size != STREAM_HEADER_SIZE)
     return 0;
 
+  grub_memcpy (xzio->header, xzio->inbuf, STREAM_HEADER_SIZE);
+
   ret = xz_dec_run (xzio->dec, &xzio->buf);
 
   if (ret == XZ_FORMAT_ERROR)
@@ -111,18 +117,21 @@ test_header (grub_file_t file)
   return 1;
 }
 
-/* Try to find out size of uncompressed data,
- * also do some footer sanity checks.  */
+/* Read the index to find out size of uncompressed data and where the
+ * blocks start, also do some footer sanity checks.  */
 static int
 test_footer (grub_file_t file)
 {
   grub_xzio_t xzio = file->data;
   grub_uint8_t footer[FOOTER_MAGIC_SIZE];
   grub_uint32_t backsize;
-  grub_uint8_t imarker;
+  grub_uint8_t *index = NULL;
+  grub_size_t pos, dec;
   grub_uint64_t uncompressed_size_total = 0;
-  grub_uint64_t uncompressed_size;
+  grub_uint64_t unpadded_size, uncompressed_size;
   grub_uint64_t records;
+  grub_off_t coffset = STREAM_HEADER_SIZE;
+  grub_size_t i;
 
   grub_file_seek (xzio->file, xzio->file->size - FOOTER_MAGIC_SIZE);
   if (grub_file_read (xzio->file, footer, FOOTER_MAGIC_SIZE)
@@ -137,34 +146,69 @@ test_footer (grub_file_t file)
 
   /* Calculate real backward size.  */
   backsize = (grub_le_to_cpu32 (backsize) + 1) * 4;
+  if (backsize > xzio->file->size - XZ_STREAM_FOOTER_SIZE - STREAM_HEADER_SIZE)
+    goto ERROR;
 
-  /* Set file to the beginning of stream index.  */
-  grub_file_seek (xzio->file,
-		  xzio->file->size - XZ_STREAM_FOOTER_SIZE - backsize);
+  /* Read the whole stream index.  */
+  xzio->index_offset = xzio->file->size - XZ_STREAM_FOOTER_SIZE - backsize;
+  index = grub_malloc (backsize);
+  if (!index)
+    goto ERROR;
+  grub_file_seek (xzio->file, xzio->index_offset);
+  if (grub_file_read (xzio->file, index, backsize) != (grub_ssize_t) backsize)
+    goto ERROR;
 
   /* Test index marker.  */
-  if (grub_file_read (xzio->file, &imarker, sizeof (imarker))
-      != sizeof (imarker) && imarker != 0x00)
+  if (index[0] != 0x00)
+    goto ERROR;
+  pos = 1;
+
+  dec = decode_vli (index + pos, backsize - pos, &records);
+  if (dec == 0)
     goto ERROR;
+  pos += dec;
 
-  if (read_vli (xzio->file, &records) <= 0)
+  /* Every record takes at least two bytes.  */
+  if (records > (backsize - pos) / 2)
+    goto ERROR;
+  xzio->blocks = grub_malloc (records * sizeof (xzio->blocks[0]));
+  if (records && !xzio->blocks)
     goto ERROR;
 
-  for (; records != 0; records--)
+  for (i = 0; i < records; i++)
     {
-      if (read_vli (xzio->file, &uncompressed_size) <= 0)	/* Ignore unpadded.  */
+      dec = decode_vli (index + pos, backsize - pos, &unpadded_size);
+      if (dec == 0)
 	goto ERROR;
-      if (read_vli (xzio->file, &uncompressed_size) <= 0)	/* Uncompressed.  */
+      pos += dec;
+      dec = decode_vli (index + pos, backsize - pos, &uncompressed_size);
+      if (dec == 0)
 	goto ERROR;
+      pos += dec;
 
+      xzio->blocks[i].coffset = coffset;
+      xzio->blocks[i].uoffset = uncompressed_size_total;
+      coffset += ALIGN_UP (unpadded_size, 4);
       uncompressed_size_total += uncompressed_size;
     }
+  xzio->nblocks = records;
 
+  /* The blocks must end where the index starts, otherwise the offsets
+     cannot be trusted and reads only ever decode forward from the start
+     of the stream.  */
+  if (coffset != xzio->index_offset)
+    {
+      xzio->nblocks = 0;
+      xzio->index_offset = xzio->file->size;
+    }
+
+  grub_free (index);
   file->size = uncompressed_size_total;
   grub_file_seek (xzio->file, STREAM_HEADER_SIZE);
   return 1;
 
 ERROR:
+  grub_free (index);
   return 0;
 }
 
@@ -217,6 +261,7 @@ grub_xzio_open (grub_file_t io,
       grub_errno = GRUB_ERR_NONE;
       grub_file_seek (io, 0);
       xz_dec_end (xzio->dec);
+      grub_free (xzio->blocks);
       grub_free (xzio);
       grub_free (file);
 
@@ -226,6 +271,58 @@ grub_xzio_open (grub_file_t io,
   return file;
 }
 
+/* Restart decoding at the beginning of the block holding OFFSET.  */
+static void
+seek_block (grub_xzio_t xzio, grub_off_t offset)
+{
+  grub_size_t lo = 0, hi = xzio->nblocks;
+
+  while (hi - lo > 1)
+    {
+      grub_size_t mid = (lo + hi) / 2;
+      if (xzio->blocks[mid].uoffset <= offset)
+	lo = mid;
+      else
+	hi = mid;
+    }
+
+  xz_dec_reset (xzio->dec);
+  grub_memcpy (xzio->inbuf, xzio->header, STREAM_HEADER_SIZE);
+  xzio->buf.in_pos = 0;
+  xzio->buf.in_size = STREAM_HEADER_SIZE;
+  xzio->buf.out_pos = 0;
+  if (xzio->nblocks)
+    {
+      xzio->saved_offset = xzio->blocks[lo].uoffset;
+      grub_file_seek (xzio->file, xzio->blocks[lo].coffset);
+    }
+  else
+    {
+      xzio->saved_offset = 0;
+      grub_file_seek (xzio->file, STREAM_HEADER_SIZE);
+    }
+}
+
+/* Return non-zero if OFFSET is past the start of the block after the one
+   the decoder is in, so restarting there is cheaper than decoding on.  */
+static int
+beyond_next_block (grub_xzio_t xzio, grub_off_t offset)
+{
+  grub_size_t lo = 0, hi = xzio->nblocks;
+
+  /* Find the first block starting after SAVED_OFFSET.  */
+  while (lo < hi)
+    {
+      grub_size_t mid = (lo + hi) / 2;
+      if (xzio->blocks[mid].uoffset <= xzio->saved_offset)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  return lo < xzio->nblocks && xzio->blocks[lo].uoffset <= offset;
+}
+
 static grub_ssize_t
 grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
 {
@@ -235,18 +332,29 @@ grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
   grub_xzio_t xzio = file->data;
   grub_off_t current_offset;
 
-  /* If seek backward need to reset decoder and start from beginning of file.
-     TODO Possible improvement by jumping blocks.  */
-  if (file->offset < xzio->saved_offset)
+  /* Serve what the last decoded chunk still holds, typically a header
+     read again after probing.  */
+  if (file->offset >= xzio->out_offset
+      && file->offset < xzio->out_offset + xzio->out_len)
     {
-      xz_dec_reset (xzio->dec);
-      xzio->saved_offset = 0;
-      xzio->buf.out_pos = 0;
-      xzio->buf.in_pos = 0;
-      xzio->buf.in_size = 0;
-      grub_file_seek (xzio->file, 0);
+      grub_size_t n = xzio->out_offset + xzio->out_len - file->offset;
+
+      if (n > len)
+	n = len;
+      grub_memcpy (buf, xzio->outbuf + (file->offset - xzio->out_offset), n);
+      buf += n;
+      len -= n;
+      ret += n;
+      if (len == 0)
+	return ret;
     }
 
+  /* Jump to the block holding the data when seeking backward or past the
+     next block, so a random access costs at most one block.  */
+  if (file->offset + ret < xzio->saved_offset
+      || beyond_next_block (xzio, file->offset + ret))
+    seek_block (xzio, file->offset + ret);
+
   current_offset = xzio->saved_offset;
 
   while (len > 0)
@@ -254,10 +362,14 @@ grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
       xzio->buf.out_size = file->offset + ret + len - current_offset;
       if (xzio->buf.out_size > XZBUFSIZ)
 	xzio->buf.out_size = XZBUFSIZ;
-      /* Feed input.  */
+      /* Feed input, up to the index.  */
       if (xzio->buf.in_pos == xzio->buf.in_size)
 	{
-	  readret = grub_file_read (xzio->file, xzio->inbuf, XZBUFSIZ);
+	  grub_size_t toread = XZBUFSIZ;
+
+	  if (xzio->index_offset - grub_file_tell (xzio->file) < toread)
+	    toread = xzio->index_offset - grub_file_tell (xzio->file);
+	  readret = grub_file_read (xzio->file, xzio->inbuf, toread);
 	  if (readret < 0)
 	    return -1;
 	  xzio->buf.in_size = readret;
@@ -272,6 +384,7 @@ grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
 	case XZ_OPTIONS_ERROR:
 	case XZ_DATA_ERROR:
 	case XZ_BUF_ERROR:
+	  xzio->out_len = 0;
 	  grub_error (GRUB_ERR_BAD_COMPRESSED_DATA,
 		      N_("xz file corrupted or unsupported block options"));
 	  return -1;
@@ -282,7 +395,7 @@ grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
       {
 	grub_off_t new_offset = current_offset + xzio->buf.out_pos;
 	
-	if (file->offset <= new_offset)
+	if (file->offset + ret <= new_offset)
 	  /* Store first chunk of data in buffer.  */
 	  {
 	    grub_size_t delta = new_offset - (file->offset + ret);
@@ -292,6 +405,8 @@ grub_xzio_read (grub_file_t file, char *buf, grub_size_t len)
 	    buf += delta;
 	    ret += delta;
 	  }
+	xzio->out_offset = current_offset;
+	xzio->out_len = xzio->buf.out_pos;
 	current_offset = new_offset;
       }
       xzio->buf.out_pos = 0;
@@ -315,6 +430,7 @@ grub_xzio_close (grub_file_t file)
   xz_dec_end (xzio->dec);
 
   grub_file_close (xzio->file);
+  grub_free (xzio->blocks);
   grub_free (xzio);
 
   /* Device must not be closed twice.  */
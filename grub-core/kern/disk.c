@@ -24,10 +24,18 @@
 #include <grub/misc.h>
 #include <grub/time.h>
 #include <grub/file.h>
+#include <grub/fs.h>
 #include <grub/i18n.h>
+#include <grub/env.h>
 
 #define	GRUB_CACHE_TIMEOUT	2
 
+/* Default readahead window in streaming mode, in bytes.  */
+#define GRUB_DISK_READAHEAD_DEFAULT	(256 * 1024)
+
+/* Sequential reads past this many bytes put the disk in streaming mode.  */
+#define GRUB_DISK_STREAM_MIN		(128 * 1024)
+
 /* The last time the disk was used.  */
 static grub_uint64_t grub_last_time = 0;
 
@@ -36,17 +44,80 @@ struct grub_disk_cache grub_disk_cache_table[GRUB_DISK_CACHE_NUM];
 void (*grub_disk_firmware_fini) (void);
 int grub_disk_firmware_is_tainted;
 
-#if DISK_CACHE_STATS
+grub_uint32_t grub_disk_generation;
+
+#define GRUB_DISK_CACHE_UNIT	(GRUB_DISK_SECTOR_SIZE << GRUB_DISK_CACHE_BITS)
+
+/* Slabs the cache buffers are carved from.  */
+struct grub_disk_cache_slab
+{
+  struct grub_disk_cache_slab *next;
+  /* Number of buffers already handed out from this slab.  */
+  unsigned used;
+  /* Keep the buffers aligned.  */
+  grub_uint64_t data[0];
+};
+
+static struct grub_disk_cache_slab *grub_disk_cache_slabs;
+
+/* Number of buffers allocated in slabs and the maximum number of them.  */
+static unsigned grub_disk_cache_allocated;
+static unsigned grub_disk_cache_budget = GRUB_DISK_CACHE_NUM;
+
+/* Pseudo-time used for LRU replacement.  */
+static grub_uint32_t grub_disk_cache_clock;
+
+/* Number of devices statistics are kept for.  */
+#define GRUB_DISK_CACHE_STATS_NUM	32
+
+static struct grub_disk_cache_stats grub_disk_cache_stats[GRUB_DISK_CACHE_STATS_NUM];
+static unsigned grub_disk_cache_stats_num;
 static unsigned long grub_disk_cache_hits;
 static unsigned long grub_disk_cache_misses;
 
+static struct grub_disk_cache_stats *
+grub_disk_cache_get_stats (unsigned long dev_id, unsigned long disk_id)
+{
+  struct grub_disk_cache_stats *stats;
+  static struct grub_disk_cache_stats *last;
+
+  if (last && last->dev_id == dev_id && last->disk_id == disk_id)
+    return last;
+
+  for (stats = grub_disk_cache_stats;
+       stats < grub_disk_cache_stats + grub_disk_cache_stats_num; stats++)
+    if (stats->dev_id == dev_id && stats->disk_id == disk_id)
+      return last = stats;
+
+  /* Account the devices past the end of the table to the global counters
+     only.  */
+  if (grub_disk_cache_stats_num == GRUB_DISK_CACHE_STATS_NUM)
+    return 0;
+
+  stats = &grub_disk_cache_stats[grub_disk_cache_stats_num++];
+  stats->dev_id = dev_id;
+  stats->disk_id = disk_id;
+  return last = stats;
+}
+
 void
 grub_disk_cache_get_performance (unsigned long *hits, unsigned long *misses)
 {
   *hits = grub_disk_cache_hits;
   *misses = grub_disk_cache_misses;
 }
-#endif
+
+int
+grub_disk_cache_stats_iterate (grub_disk_cache_stats_hook_t hook,
+			       void *hook_data)
+{
+  unsigned i;
+
+  for (i = 0; i < grub_disk_cache_stats_num; i++)
+    if (hook (&grub_disk_cache_stats[i], hook_data))
+      return 1;
+  return 0;
+}
 
 grub_err_t (*grub_disk_write_weak) (grub_disk_t disk,
 				    grub_disk_addr_t sector,
@@ -55,46 +126,135 @@ grub_err_t (*grub_disk_write_weak) (grub_disk_t disk,
 				    const void *buf);
 #include "disk_common.c"
 
-void
-grub_disk_cache_invalidate_all (void)
+/* Drop all cache entries.  If RELEASE is set, return the buffers to the
+   memory manager as well.  */
+static void
+grub_disk_cache_flush (int release)
 {
+  struct grub_disk_cache_slab *slab, *next;
   unsigned i;
 
+  for (i = 0; i < GRUB_DISK_CACHE_NUM; i++)
+    if (grub_disk_cache_table[i].lock)
+      release = 0;
+
   for (i = 0; i < GRUB_DISK_CACHE_NUM; i++)
     {
       struct grub_disk_cache *cache = grub_disk_cache_table + i;
 
-      if (cache->data && ! cache->lock)
+      if (cache->lock)
+	continue;
+      cache->flags = 0;
+      if (release)
+	cache->data = 0;
+    }
+
+  if (! release)
+    return;
+
+  for (slab = grub_disk_cache_slabs; slab; slab = next)
+    {
+      next = slab->next;
+      grub_free (slab);
+    }
+  grub_disk_cache_slabs = 0;
+  grub_disk_cache_allocated = 0;
+}
+
+void
+grub_disk_cache_invalidate_all (void)
+{
+  grub_disk_cache_flush (1);
+  grub_disk_generation++;
+}
+
+void
+grub_disk_changed (void)
+{
+  grub_disk_cache_flush (0);
+  grub_disk_generation++;
+  grub_fs_mount_cache_flush (0);
+}
+
+grub_size_t
+grub_disk_cache_get_budget (void)
+{
+  return (grub_size_t) grub_disk_cache_budget * GRUB_DISK_CACHE_UNIT;
+}
+
+void
+grub_disk_cache_set_budget (grub_size_t size)
+{
+  unsigned budget;
+
+  if (size / GRUB_DISK_CACHE_UNIT > GRUB_DISK_CACHE_NUM)
+    budget = GRUB_DISK_CACHE_NUM;
+  else
+    budget = ALIGN_UP (size / GRUB_DISK_CACHE_UNIT, GRUB_DISK_CACHE_SLAB_NUM);
+
+  /* Shrinking the cache needs the slabs to be given back.  */
+  if (budget < grub_disk_cache_allocated)
+    grub_disk_cache_flush (1);
+  grub_disk_cache_budget = budget;
+}
+
+/* Get a free buffer from the slabs, allocating a new slab if the budget
+   allows.  */
+static char *
+grub_disk_cache_get_buffer (void)
+{
+  struct grub_disk_cache_slab *slab;
+
+  slab = grub_disk_cache_slabs;
+  if (! slab || slab->used == GRUB_DISK_CACHE_SLAB_NUM)
+    {
+      if (grub_disk_cache_allocated + GRUB_DISK_CACHE_SLAB_NUM
+	  > grub_disk_cache_budget)
+	return 0;
+
+      slab = grub_malloc (sizeof (*slab)
+			  + GRUB_DISK_CACHE_SLAB_NUM * GRUB_DISK_CACHE_UNIT);
+      if (! slab)
 	{
-	  grub_free (cache->data);
-	  cache->data = 0;
+	  grub_errno = GRUB_ERR_NONE;
+	  return 0;
 	}
+      /* The allocation may have flushed the cache, so update the list only
+	 now.  */
+      slab->used = 0;
+      slab->next = grub_disk_cache_slabs;
+      grub_disk_cache_slabs = slab;
+      grub_disk_cache_allocated += GRUB_DISK_CACHE_SLAB_NUM;
     }
+
+  return (char *) slab->data + (slab->used++) * GRUB_DISK_CACHE_UNIT;
 }
 
 static char *
 grub_disk_cache_fetch (unsigned long dev_id, unsigned long disk_id,
-		       grub_disk_addr_t sector)
+		       grub_disk_addr_t sector, int metadata)
 {
   struct grub_disk_cache *cache;
-  unsigned cache_index;
+  struct grub_disk_cache_stats *stats;
 
-  cache_index = grub_disk_cache_get_index (dev_id, disk_id, sector);
-  cache = grub_disk_cache_table + cache_index;
-
-  if (cache->dev_id == dev_id && cache->disk_id == disk_id
-      && cache->sector == sector)
+  stats = grub_disk_cache_get_stats (dev_id, disk_id);
+  cache = grub_disk_cache_lookup (dev_id, disk_id, sector);
+  if (cache)
     {
       cache->lock = 1;
-#if DISK_CACHE_STATS
+      cache->last_use = ++grub_disk_cache_clock;
+      /* Blocks read again through small reads are worth keeping.  */
+      if (metadata)
+	cache->flags |= GRUB_DISK_CACHE_METADATA;
       grub_disk_cache_hits++;
-#endif
+      if (stats)
+	stats->hits++;
       return cache->data;
     }
 
-#if DISK_CACHE_STATS
   grub_disk_cache_misses++;
-#endif
+  if (stats)
+    stats->misses++;
 
   return 0;
 }
@@ -104,45 +264,86 @@ grub_disk_cache_unlock (unsigned long dev_id, unsigned long disk_id,
 			grub_disk_addr_t sector)
 {
   struct grub_disk_cache *cache;
-  unsigned cache_index;
-
-  cache_index = grub_disk_cache_get_index (dev_id, disk_id, sector);
-  cache = grub_disk_cache_table + cache_index;
 
-  if (cache->dev_id == dev_id && cache->disk_id == disk_id
-      && cache->sector == sector)
+  cache = grub_disk_cache_lookup (dev_id, disk_id, sector);
+  if (cache)
     cache->lock = 0;
 }
 
-static grub_err_t
-grub_disk_cache_store (unsigned long dev_id, unsigned long disk_id,
-		       grub_disk_addr_t sector, const char *data)
+/* Choose the entry of the set starting at SET to store a new block in.
+   Unused entries are taken first, then the least recently used bulk data
+   entry.  Metadata entries are only replaced by metadata.  */
+static struct grub_disk_cache *
+grub_disk_cache_get_victim (struct grub_disk_cache *set, int metadata)
 {
-  unsigned cache_index;
-  struct grub_disk_cache *cache;
+  struct grub_disk_cache *cache, *empty = 0, *stream = 0, *meta = 0;
 
-  cache_index = grub_disk_cache_get_index (dev_id, disk_id, sector);
-  cache = grub_disk_cache_table + cache_index;
+  for (cache = set; cache < set + GRUB_DISK_CACHE_WAYS; cache++)
+    {
+      if (cache->lock)
+	continue;
+      if (! (cache->flags & GRUB_DISK_CACHE_VALID))
+	{
+	  if (cache->data)
+	    return cache;
+	  if (! empty)
+	    empty = cache;
+	}
+      else if (cache->flags & GRUB_DISK_CACHE_METADATA)
+	{
+	  if (! meta
+	      || (grub_int32_t) (cache->last_use - meta->last_use) < 0)
+	    meta = cache;
+	}
+      else if (! stream
+	       || (grub_int32_t) (cache->last_use - stream->last_use) < 0)
+	stream = cache;
+    }
 
-  cache->lock = 1;
-  grub_free (cache->data);
-  cache->data = 0;
-  cache->lock = 0;
+  if (empty)
+    {
+      empty->data = grub_disk_cache_get_buffer ();
+      if (empty->data)
+	return empty;
+    }
 
-  cache->data = grub_malloc (GRUB_DISK_SECTOR_SIZE << GRUB_DISK_CACHE_BITS);
-  if (! cache->data)
-    return grub_errno;
+  /* Allocating the buffer may have flushed the cache.  */
+  if (stream && stream->data)
+    return stream;
+  if (metadata && meta && meta->data)
+    return meta;
+  return 0;
+}
+
+static void
+grub_disk_cache_store (unsigned long dev_id, unsigned long disk_id,
+		       grub_disk_addr_t sector, const char *data,
+		       int metadata)
+{
+  struct grub_disk_cache *cache;
 
-  grub_memcpy (cache->data, data,
-	       GRUB_DISK_SECTOR_SIZE << GRUB_DISK_CACHE_BITS);
+  cache = grub_disk_cache_lookup (dev_id, disk_id, sector);
+  if (cache && cache->lock)
+    return;
+  if (! cache)
+    cache = grub_disk_cache_get_victim (grub_disk_cache_get_set (dev_id,
+								  disk_id,
+								  sector),
+					metadata);
+  if (! cache)
+    return;
+
+  grub_memcpy (cache->data, data, GRUB_DISK_CACHE_UNIT);
   cache->dev_id = dev_id;
   cache->disk_id = disk_id;
   cache->sector = sector;
-
-  return GRUB_ERR_NONE;
+  cache->last_use = ++grub_disk_cache_clock;
+  cache->flags = GRUB_DISK_CACHE_VALID;
+  if (metadata)
+    cache->flags |= GRUB_DISK_CACHE_METADATA;
 }
 
-
+
 
 grub_disk_dev_t grub_disk_dev_list;
 
@@ -158,6 +359,9 @@ grub_disk_dev_unregister (grub_disk_dev_t dev)
 {
   grub_disk_dev_t *p, q;
 
+  /* Don't keep filesystems mounted on its disks.  */
+  grub_fs_mount_cache_flush (0);
+
   for (p = &grub_disk_dev_list, q = *p; q; p = &(q->next), q = q->next)
     if (q == dev)
       {
@@ -184,6 +388,27 @@ find_part_sep (const char *name)
   return NULL;
 }
 
+/* Set the readahead window of DISK from the variable `disk_readahead',
+   in KiB.  */
+static void
+grub_disk_setup_readahead (grub_disk_t disk)
+{
+  const char *val;
+  grub_size_t size = GRUB_DISK_READAHEAD_DEFAULT;
+
+  val = grub_env_get ("disk_readahead");
+  if (val)
+    {
+      size = grub_strtoul (val, 0, 0) << 10;
+      grub_errno = GRUB_ERR_NONE;
+    }
+
+  size >>= GRUB_DISK_SECTOR_BITS + GRUB_DISK_CACHE_BITS;
+  if (size > disk->max_agglomerate)
+    size = disk->max_agglomerate;
+  disk->readahead_size = size << (GRUB_DISK_SECTOR_BITS + GRUB_DISK_CACHE_BITS);
+}
+
 grub_disk_t
 grub_disk_open (const char *name)
 {
@@ -199,6 +424,7 @@ grub_disk_open (const char *name)
   if (! disk)
     return 0;
   disk->log_sector_size = GRUB_DISK_SECTOR_BITS;
+  disk->queue_depth = 1;
   /* Default 1MiB of maximum agglomerate.  */
   disk->max_agglomerate = 1048576 >> (GRUB_DISK_SECTOR_BITS
 				      + GRUB_DISK_CACHE_BITS);
@@ -248,6 +474,8 @@ grub_disk_open (const char *name)
 
   disk->dev = dev;
 
+  grub_disk_setup_readahead (disk);
+
   if (p)
     {
       disk->partition = grub_partition_probe (disk, p + 1);
@@ -266,7 +494,7 @@ grub_disk_open (const char *name)
 
   if (current_time > (grub_last_time
 		      + GRUB_CACHE_TIMEOUT * 1000))
-    grub_disk_cache_invalidate_all ();
+    grub_disk_cache_flush (0);
 
   grub_last_time = current_time;
 
@@ -306,6 +534,7 @@ grub_disk_close (grub_disk_t disk)
       grub_free (disk->partition);
       disk->partition = part;
     }
+  grub_free (disk->readahead);
   grub_free ((void *) disk->name);
   grub_free (disk);
 }
@@ -321,7 +550,7 @@ grub_disk_read_small_real (grub_disk_t disk, grub_disk_addr_t sector,
   char *tmp_buf;
 
   /* Fetch the cache.  */
-  data = grub_disk_cache_fetch (disk->dev->id, disk->id, sector);
+  data = grub_disk_cache_fetch (disk->dev->id, disk->id, sector, 1);
   if (data)
     {
       /* Just copy it!  */
@@ -350,7 +579,7 @@ grub_disk_read_small_real (grub_disk_t disk, grub_disk_addr_t sector,
 	  /* Copy it and store it in the disk cache.  */
 	  grub_memcpy (buf, tmp_buf + offset, size);
 	  grub_disk_cache_store (disk->dev->id, disk->id,
-				 sector, tmp_buf);
+				 sector, tmp_buf, 1);
 	  grub_free (tmp_buf);
 	  return GRUB_ERR_NONE;
 	}
@@ -408,21 +637,11 @@ grub_disk_read_small (grub_disk_t disk, grub_disk_addr_t sector,
   return GRUB_ERR_NONE;
 }
 
-/* Read data from the disk.  */
-grub_err_t
-grub_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
-		grub_off_t offset, grub_size_t size, void *buf)
+/* Read through the disk cache.  SECTOR is already adjusted.  */
+static grub_err_t
+grub_disk_read_cached (grub_disk_t disk, grub_disk_addr_t sector,
+		       grub_off_t offset, grub_size_t size, void *buf)
 {
-  /* First of all, check if the region is within the disk.  */
-  if (grub_disk_adjust_range (disk, &sector, &offset, size) != GRUB_ERR_NONE)
-    {
-      grub_error_push ();
-      grub_dprintf ("disk", "Read out of range: sector 0x%llx (%s).\n",
-		    (unsigned long long) sector, grub_errmsg);
-      grub_error_pop ();
-      return grub_errno;
-    }
-
   /* First read until first cache boundary.   */
   if (offset || (sector & (GRUB_DISK_CACHE_SIZE - 1)))
     {
@@ -463,7 +682,7 @@ grub_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
 	{
 	  data = grub_disk_cache_fetch (disk->dev->id, disk->id,
 					sector + (agglomerate
-						  << GRUB_DISK_CACHE_BITS));
+						  << GRUB_DISK_CACHE_BITS), 0);
 	  if (data)
 	    break;
 	}
@@ -496,7 +715,7 @@ grub_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
 				   sector + (i << GRUB_DISK_CACHE_BITS),
 				   (char *) buf
 				   + (i << (GRUB_DISK_CACHE_BITS
-					    + GRUB_DISK_SECTOR_BITS)));
+					    + GRUB_DISK_SECTOR_BITS)), 0);
 
 
 	  if (disk->read_hook)
@@ -532,6 +751,383 @@ grub_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
   return grub_errno;
 }
 
+/* Track sequential access on DISK and return whether the read of SIZE
+   bytes at SECTOR and OFFSET should go through the streaming path.  */
+static int
+grub_disk_stream_check (grub_disk_t disk, grub_disk_addr_t sector,
+			grub_off_t offset, grub_size_t size)
+{
+  grub_uint64_t pos = (sector << GRUB_DISK_SECTOR_BITS) + offset;
+
+  if (pos == disk->stream_pos)
+    disk->stream_len += size;
+  else
+    disk->stream_len = size;
+  disk->stream_pos = pos + size;
+
+  return disk->stream_len >= GRUB_DISK_STREAM_MIN;
+}
+
+/* Fill the readahead buffer of DISK with the window starting at the cache
+   unit aligned SECTOR.  */
+static grub_err_t
+grub_disk_readahead_fill (grub_disk_t disk, grub_disk_addr_t sector)
+{
+  grub_size_t len = disk->readahead_size;
+  grub_disk_addr_t total;
+
+  total = disk->total_sectors << (disk->log_sector_size
+				  - GRUB_DISK_SECTOR_BITS);
+  if (disk->total_sectors != GRUB_DISK_SIZE_UNKNOWN)
+    {
+      if (sector + GRUB_DISK_CACHE_SIZE > total)
+	return grub_error (GRUB_ERR_OUT_OF_RANGE, "readahead past disk end");
+      if (sector + (len >> GRUB_DISK_SECTOR_BITS) > total)
+	len = ((total - sector) & ~((grub_disk_addr_t) GRUB_DISK_CACHE_SIZE - 1))
+	  << GRUB_DISK_SECTOR_BITS;
+    }
+
+  if (! disk->readahead)
+    {
+      disk->readahead = grub_malloc (disk->readahead_size);
+      if (! disk->readahead)
+	return grub_errno;
+    }
+
+  disk->readahead_len = 0;
+  if ((disk->dev->read) (disk, transform_sector (disk, sector),
+			 len >> disk->log_sector_size, disk->readahead))
+    return grub_errno;
+
+  disk->readahead_sector = sector;
+  disk->readahead_len = len;
+  disk->readahead_generation = grub_disk_generation;
+  return GRUB_ERR_NONE;
+}
+
+/* Read sequentially accessed data, bypassing the disk cache.  Large
+   aligned parts are read straight into BUF, the rest is served from a
+   readahead window.  SECTOR is already adjusted.  */
+static grub_err_t
+grub_disk_read_stream (grub_disk_t disk, grub_disk_addr_t sector,
+		       grub_off_t offset, grub_size_t size, void *buf)
+{
+  const grub_size_t unit = GRUB_DISK_CACHE_SIZE << GRUB_DISK_SECTOR_BITS;
+
+  /* A write through any handle may have covered the window.  */
+  if (disk->readahead_generation != grub_disk_generation)
+    disk->readahead_len = 0;
+
+  while (size)
+    {
+      grub_uint64_t pos = (sector << GRUB_DISK_SECTOR_BITS) + offset;
+      grub_uint64_t ra_start = (disk->readahead_sector
+				<< GRUB_DISK_SECTOR_BITS);
+      grub_size_t len;
+
+      if (disk->readahead_len && pos >= ra_start
+	  && pos < ra_start + disk->readahead_len)
+	{
+	  /* Serve from the readahead window.  */
+	  len = ra_start + disk->readahead_len - pos;
+	  if (len > size)
+	    len = size;
+	  grub_memcpy (buf, disk->readahead + (pos - ra_start), len);
+	}
+      else if (! offset && ! (sector & (GRUB_DISK_CACHE_SIZE - 1))
+	       && size >= unit)
+	{
+	  /* ATA disks with small buffers have a zero max_agglomerate, the
+	     cached path still reads one unit at a time for them.  */
+	  grub_size_t max = ((grub_size_t) (disk->max_agglomerate ? : 1)
+			     * unit);
+
+	  /* Read whole cache units directly into the caller's buffer.  */
+	  len = size & ~(unit - 1);
+	  if (len > max)
+	    len = max;
+	  if ((disk->dev->read) (disk, transform_sector (disk, sector),
+				 len >> disk->log_sector_size, buf))
+	    return grub_errno;
+	}
+      else if (! disk->readahead_size
+	       || grub_disk_readahead_fill (disk, sector
+					    & ~((grub_disk_addr_t)
+						GRUB_DISK_CACHE_SIZE - 1)))
+	{
+	  /* No readahead possible here, e.g. at the end of the disk.  */
+	  grub_errno = GRUB_ERR_NONE;
+	  return grub_disk_read_cached (disk, sector, offset, size, buf);
+	}
+      else
+	continue;
+
+      if (disk->read_hook)
+	(disk->read_hook) (sector, offset, len, disk->read_hook_data);
+
+      offset += len;
+      sector += offset >> GRUB_DISK_SECTOR_BITS;
+      offset &= GRUB_DISK_SECTOR_SIZE - 1;
+      buf = (char *) buf + len;
+      size -= len;
+    }
+
+  return GRUB_ERR_NONE;
+}
+
+/* Read data from the disk.  */
+grub_err_t
+grub_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
+		grub_off_t offset, grub_size_t size, void *buf)
+{
+  /* First of all, check if the region is within the disk.  */
+  if (grub_disk_adjust_range (disk, &sector, &offset, size) != GRUB_ERR_NONE)
+    {
+      grub_error_push ();
+      grub_dprintf ("disk", "Read out of range: sector 0x%llx (%s).\n",
+		    (unsigned long long) sector, grub_errmsg);
+      grub_error_pop ();
+      return grub_errno;
+    }
+
+  if (grub_disk_stream_check (disk, sector, offset, size))
+    return grub_disk_read_stream (disk, sector, offset, size, buf);
+
+  return grub_disk_read_cached (disk, sector, offset, size, buf);
+}
+
+/* Requests of grub_disk_read_batch spanning more cache units than this
+   are simply read synchronously.  */
+#define GRUB_DISK_BATCH_MAX_UNITS	8
+
+enum
+  {
+    GRUB_DISK_IO_QUEUED,
+    GRUB_DISK_IO_INFLIGHT,
+    GRUB_DISK_IO_DONE
+  };
+
+struct grub_disk_batch_io
+{
+  struct grub_disk_io io;
+  /* The cache unit being read, as an adjusted 512B sector.  */
+  grub_disk_addr_t unit;
+  int state;
+};
+
+static int
+grub_disk_can_submit (grub_disk_t disk)
+{
+  return disk->dev->submit && disk->queue_depth > 1;
+}
+
+/* Add the missing cache units of REQ to IOS.  */
+static grub_size_t
+grub_disk_batch_add (struct grub_disk_batch_io *ios, grub_size_t nios,
+		     const struct grub_disk_read_request *req)
+{
+  grub_disk_t disk = req->disk;
+  grub_disk_addr_t sector = req->sector, start, end, unit;
+  grub_off_t offset = req->offset;
+  grub_size_t i;
+
+  if (grub_disk_adjust_range (disk, &sector, &offset, req->size)
+      != GRUB_ERR_NONE)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return nios;
+    }
+
+  start = (sector + (offset >> GRUB_DISK_SECTOR_BITS))
+    & ~((grub_disk_addr_t) GRUB_DISK_CACHE_SIZE - 1);
+  end = sector + ((offset + req->size + GRUB_DISK_SECTOR_SIZE - 1)
+		  >> GRUB_DISK_SECTOR_BITS);
+  if (((end - start + GRUB_DISK_CACHE_SIZE - 1) >> GRUB_DISK_CACHE_BITS)
+      > GRUB_DISK_BATCH_MAX_UNITS)
+    return nios;
+
+  for (unit = start; unit < end; unit += GRUB_DISK_CACHE_SIZE)
+    {
+      /* Units at the end of the disk are read sector by sector.  */
+      if (disk->total_sectors != GRUB_DISK_SIZE_UNKNOWN
+	  && unit + GRUB_DISK_CACHE_SIZE
+	  >= (disk->total_sectors << (disk->log_sector_size
+				      - GRUB_DISK_SECTOR_BITS)))
+	break;
+      if (grub_disk_cache_lookup (disk->dev->id, disk->id, unit))
+	continue;
+      for (i = 0; i < nios; i++)
+	if (ios[i].unit == unit && ios[i].io.disk->dev->id == disk->dev->id
+	    && ios[i].io.disk->id == disk->id)
+	  break;
+      if (i < nios)
+	continue;
+
+      ios[nios].io.buf = grub_malloc (GRUB_DISK_SECTOR_SIZE
+				      << GRUB_DISK_CACHE_BITS);
+      if (! ios[nios].io.buf)
+	{
+	  grub_errno = GRUB_ERR_NONE;
+	  break;
+	}
+      ios[nios].io.disk = disk;
+      ios[nios].io.sector = transform_sector (disk, unit);
+      ios[nios].io.size = 1U << (GRUB_DISK_CACHE_BITS + GRUB_DISK_SECTOR_BITS
+				 - disk->log_sector_size);
+      ios[nios].io.err = GRUB_ERR_NONE;
+      ios[nios].io.data = 0;
+      ios[nios].unit = unit;
+      ios[nios].state = GRUB_DISK_IO_QUEUED;
+      nios++;
+    }
+
+  return nios;
+}
+
+static unsigned
+grub_disk_batch_inflight (struct grub_disk_batch_io *ios, grub_size_t nios,
+			  grub_disk_t disk)
+{
+  unsigned n = 0;
+  grub_size_t i;
+
+  for (i = 0; i < nios; i++)
+    if (ios[i].state == GRUB_DISK_IO_INFLIGHT && ios[i].io.disk == disk)
+      n++;
+  return n;
+}
+
+static void
+grub_disk_batch_complete (struct grub_disk_batch_io *bio)
+{
+  grub_disk_t disk = bio->io.disk;
+
+  bio->state = GRUB_DISK_IO_DONE;
+  if (bio->io.err == GRUB_ERR_NONE)
+    grub_disk_cache_store (disk->dev->id, disk->id, bio->unit,
+			   bio->io.buf, 1);
+  else
+    grub_dprintf ("disk", "%s: asynchronous read failed\n", disk->name);
+  grub_errno = GRUB_ERR_NONE;
+}
+
+/* Read the cache units missing for REQS through the devices' submit and
+   poll functions, keeping up to the queue depth of each disk in
+   flight.  */
+static void
+grub_disk_batch_prefetch (struct grub_disk_read_request *reqs,
+			  grub_size_t nreqs)
+{
+  struct grub_disk_batch_io *ios;
+  grub_size_t nios = 0, nunits = 0, remaining, i;
+
+  for (i = 0; i < nreqs; i++)
+    if (grub_disk_can_submit (reqs[i].disk))
+      nunits += GRUB_DISK_BATCH_MAX_UNITS;
+  if (! nunits)
+    return;
+
+  ios = grub_malloc (nunits * sizeof (ios[0]));
+  if (! ios)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+
+  for (i = 0; i < nreqs; i++)
+    if (grub_disk_can_submit (reqs[i].disk))
+      nios = grub_disk_batch_add (ios, nios, &reqs[i]);
+
+  remaining = nios;
+  while (remaining)
+    {
+      int progress = 0;
+      struct grub_disk_batch_io *wait = 0;
+
+      for (i = 0; i < nios; i++)
+	{
+	  grub_disk_t disk = ios[i].io.disk;
+
+	  if (ios[i].state != GRUB_DISK_IO_QUEUED
+	      || grub_disk_batch_inflight (ios, nios, disk)
+	      >= disk->queue_depth)
+	    continue;
+	  if ((disk->dev->submit) (disk, &ios[i].io) == GRUB_ERR_NONE)
+	    ios[i].state = GRUB_DISK_IO_INFLIGHT;
+	  else
+	    {
+	      ios[i].io.err = grub_errno;
+	      grub_disk_batch_complete (&ios[i]);
+	      remaining--;
+	      progress = 1;
+	    }
+	}
+
+      for (i = 0; i < nios; i++)
+	{
+	  grub_disk_t disk = ios[i].io.disk;
+
+	  if (ios[i].state != GRUB_DISK_IO_INFLIGHT)
+	    continue;
+	  if ((disk->dev->poll) (disk, &ios[i].io, 0))
+	    {
+	      grub_disk_batch_complete (&ios[i]);
+	      remaining--;
+	      progress = 1;
+	    }
+	  else if (! wait)
+	    wait = &ios[i];
+	}
+
+      if (! progress && wait)
+	{
+	  (wait->io.disk->dev->poll) (wait->io.disk, &wait->io, 1);
+	  grub_disk_batch_complete (wait);
+	  remaining--;
+	}
+    }
+
+  for (i = 0; i < nios; i++)
+    grub_free (ios[i].io.buf);
+  grub_free (ios);
+}
+
+grub_err_t
+grub_disk_read_batch (struct grub_disk_read_request *reqs, grub_size_t nreqs)
+{
+  grub_err_t ret = GRUB_ERR_NONE;
+  grub_size_t i;
+
+  grub_disk_batch_prefetch (reqs, nreqs);
+
+  /* Everything that could be read asynchronously is in the cache now, the
+     rest is read the usual way.  */
+  for (i = 0; i < nreqs; i++)
+    {
+      if (! reqs[i].buf)
+	{
+	  reqs[i].err = GRUB_ERR_NONE;
+	  continue;
+	}
+      reqs[i].err = grub_disk_read (reqs[i].disk, reqs[i].sector,
+				    reqs[i].offset, reqs[i].size,
+				    reqs[i].buf);
+      if (reqs[i].err == GRUB_ERR_NONE)
+	continue;
+      if (ret == GRUB_ERR_NONE)
+	{
+	  ret = reqs[i].err;
+	  grub_error_push ();
+	}
+      else
+	grub_errno = GRUB_ERR_NONE;
+    }
+
+  if (ret != GRUB_ERR_NONE)
+    grub_error_pop ();
+  return ret;
+}
+
 grub_uint64_t
 grub_disk_get_size (grub_disk_t disk)
 {
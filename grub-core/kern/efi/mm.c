@@ -38,10 +38,17 @@
    a multiplier of 4KB.  */
 #define MEMORY_MAP_SIZE	0x3000
 
-/* The minimum and maximum heap size for GRUB itself.  */
+/* The minimum and maximum heap size for GRUB itself.  GRUB starts with
+   at most INIT_HEAP_SIZE and adds at least HEAP_GROW_SIZE whenever it runs
+   out.  */
 #define MIN_HEAP_SIZE	0x100000
+#define INIT_HEAP_SIZE	0x1000000
+#define HEAP_GROW_SIZE	0x1000000
 #define MAX_HEAP_SIZE	(1600 * 0x100000)
 
+/* The pages handed to the heap so far.  */
+static grub_efi_uint64_t heap_pages;
+
 static void *finish_mmap_buf = 0;
 static grub_efi_uintn_t finish_mmap_size = 0;
 static grub_efi_uintn_t finish_key = 0;
@@ -409,12 +416,14 @@ get_total_pages (grub_efi_memory_descriptor_t *memory_map,
   return total;
 }
 
-/* Add memory regions.  */
-static void
+/* Add memory regions of REQUIRED_PAGES in all.  If CONSECUTIVE, take them
+   in one piece.  */
+static grub_err_t
 add_memory_regions (grub_efi_memory_descriptor_t *memory_map,
 		    grub_efi_uintn_t desc_size,
 		    grub_efi_memory_descriptor_t *memory_map_end,
-		    grub_efi_uint64_t required_pages)
+		    grub_efi_uint64_t required_pages,
+		    int consecutive)
 {
   grub_efi_memory_descriptor_t *desc;
 
@@ -428,6 +437,8 @@ add_memory_regions (grub_efi_memory_descriptor_t *memory_map,
 
       start = desc->physical_start;
       pages = desc->num_pages;
+      if (consecutive && pages < required_pages)
+	continue;
       if (pages > required_pages)
 	{
 	  start += PAGES_TO_BYTES (pages - required_pages);
@@ -436,11 +447,10 @@ add_memory_regions (grub_efi_memory_descriptor_t *memory_map,
 
       addr = grub_efi_allocate_pages (start, pages);
       if (! addr)
-	grub_fatal ("cannot allocate conventional memory %p with %u pages",
-		    (void *) ((grub_addr_t) start),
-		    (unsigned) pages);
+	continue;
 
       grub_mm_init_region (addr, PAGES_TO_BYTES (pages));
+      heap_pages += pages;
 
       required_pages -= pages;
       if (required_pages == 0)
@@ -448,7 +458,106 @@ add_memory_regions (grub_efi_memory_descriptor_t *memory_map,
     }
 
   if (required_pages > 0)
-    grub_fatal ("too little memory");
+    return GRUB_ERR_OUT_OF_MEMORY;
+  return GRUB_ERR_NONE;
+}
+
+/* Get the memory map into pages of its own, with room behind it for a
+   filtered copy, and return it, or NULL if that fails.  */
+static grub_efi_memory_descriptor_t *
+get_heap_memory_map (grub_efi_uintn_t *map_pages, grub_efi_uintn_t *map_size,
+		     grub_efi_uintn_t *desc_size)
+{
+  grub_efi_memory_descriptor_t *memory_map;
+  int mm_status;
+
+  /* Prepare a memory region to store two memory maps.  */
+  *map_pages = 2 * BYTES_TO_PAGES (MEMORY_MAP_SIZE);
+  memory_map = grub_efi_allocate_pages (0, *map_pages);
+  if (! memory_map)
+    return NULL;
+
+  /* Obtain descriptors for available memory.  */
+  *map_size = MEMORY_MAP_SIZE;
+
+  mm_status = grub_efi_get_memory_map (map_size, memory_map, 0, desc_size, 0);
+
+  if (mm_status == 0)
+    {
+      grub_efi_free_pages
+	((grub_efi_physical_address_t) ((grub_addr_t) memory_map),
+	 *map_pages);
+
+      /* Freeing/allocating operations may increase memory map size.  */
+      *map_size += *desc_size * 32;
+
+      *map_pages = 2 * BYTES_TO_PAGES (*map_size);
+      memory_map = grub_efi_allocate_pages (0, *map_pages);
+      if (! memory_map)
+	return NULL;
+
+      mm_status = grub_efi_get_memory_map (map_size, memory_map, 0,
+					   desc_size, 0);
+    }
+
+  if (mm_status < 0)
+    {
+      grub_efi_free_pages
+	((grub_efi_physical_address_t) ((grub_addr_t) memory_map),
+	 *map_pages);
+      return NULL;
+    }
+
+  return memory_map;
+}
+
+/* Called by the heap when it runs out, to add a region of at least BYTES
+   in one piece.  */
+static grub_err_t
+grub_efi_mm_add_regions (grub_size_t bytes)
+{
+  grub_efi_memory_descriptor_t *memory_map;
+  grub_efi_memory_descriptor_t *memory_map_end;
+  grub_efi_memory_descriptor_t *filtered_memory_map;
+  grub_efi_memory_descriptor_t *filtered_memory_map_end;
+  grub_efi_uintn_t map_pages;
+  grub_efi_uintn_t map_size;
+  grub_efi_uintn_t desc_size;
+  grub_efi_uint64_t required_pages;
+  grub_err_t err;
+
+  if (grub_efi_is_finished)
+    return GRUB_ERR_OUT_OF_MEMORY;
+
+  required_pages = BYTES_TO_PAGES ((grub_efi_uint64_t) bytes);
+  if (heap_pages + required_pages > BYTES_TO_PAGES (MAX_HEAP_SIZE))
+    return GRUB_ERR_OUT_OF_MEMORY;
+
+  memory_map = get_heap_memory_map (&map_pages, &map_size, &desc_size);
+  if (! memory_map)
+    return GRUB_ERR_OUT_OF_MEMORY;
+
+  memory_map_end = NEXT_MEMORY_DESCRIPTOR (memory_map, map_size);
+  filtered_memory_map = memory_map_end;
+  filtered_memory_map_end = filter_memory_map (memory_map, filtered_memory_map,
+					       desc_size, memory_map_end);
+  sort_memory_map (filtered_memory_map, desc_size, filtered_memory_map_end);
+
+  /* Grow by a good step so that this does not happen on every other
+     allocation, but settle for what was asked if that is too much.  */
+  err = GRUB_ERR_OUT_OF_MEMORY;
+  if (required_pages < BYTES_TO_PAGES (HEAP_GROW_SIZE)
+      && heap_pages + BYTES_TO_PAGES (HEAP_GROW_SIZE)
+	 <= BYTES_TO_PAGES (MAX_HEAP_SIZE))
+    err = add_memory_regions (filtered_memory_map, desc_size,
+			      filtered_memory_map_end,
+			      BYTES_TO_PAGES (HEAP_GROW_SIZE), 1);
+  if (err)
+    err = add_memory_regions (filtered_memory_map, desc_size,
+			      filtered_memory_map_end, required_pages, 1);
+
+  grub_efi_free_pages ((grub_addr_t) memory_map, map_pages);
+  return err;
 }
 
 #if 0
@@ -479,41 +588,14 @@ grub_efi_mm_init (void)
   grub_efi_memory_descriptor_t *memory_map_end;
   grub_efi_memory_descriptor_t *filtered_memory_map;
   grub_efi_memory_descriptor_t *filtered_memory_map_end;
+  grub_efi_uintn_t map_pages;
   grub_efi_uintn_t map_size;
   grub_efi_uintn_t desc_size;
   grub_efi_uint64_t total_pages;
   grub_efi_uint64_t required_pages;
-  int mm_status;
 
-  /* Prepare a memory region to store two memory maps.  */
-  memory_map = grub_efi_allocate_pages (0,
-					2 * BYTES_TO_PAGES (MEMORY_MAP_SIZE));
+  memory_map = get_heap_memory_map (&map_pages, &map_size, &desc_size);
   if (! memory_map)
-    grub_fatal ("cannot allocate memory");
-
-  /* Obtain descriptors for available memory.  */
-  map_size = MEMORY_MAP_SIZE;
-
-  mm_status = grub_efi_get_memory_map (&map_size, memory_map, 0, &desc_size, 0);
-
-  if (mm_status == 0)
-    {
-      grub_efi_free_pages
-	((grub_efi_physical_address_t) ((grub_addr_t) memory_map),
-	 2 * BYTES_TO_PAGES (MEMORY_MAP_SIZE));
-
-      /* Freeing/allocating operations may increase memory map size.  */
-      map_size += desc_size * 32;
-
-      memory_map = grub_efi_allocate_pages (0, 2 * BYTES_TO_PAGES (map_size));
-      if (! memory_map)
-	grub_fatal ("cannot allocate memory");
-
-      mm_status = grub_efi_get_memory_map (&map_size, memory_map, 0,
-					   &desc_size, 0);
-    }
-
-  if (mm_status < 0)
     grub_fatal ("cannot get memory map");
 
   memory_map_end = NEXT_MEMORY_DESCRIPTOR (memory_map, map_size);
@@ -523,22 +605,24 @@ grub_efi_mm_init (void)
   filtered_memory_map_end = filter_memory_map (memory_map, filtered_memory_map,
 					       desc_size, memory_map_end);
 
-  /* By default, request a quarter of the available memory.  */
+  /* By default, request a quarter of the available memory, but no more
+     than INIT_HEAP_SIZE: the rest is added when needed.  */
   total_pages = get_total_pages (filtered_memory_map, desc_size,
 				 filtered_memory_map_end);
   required_pages = (total_pages >> 2);
   if (required_pages < BYTES_TO_PAGES (MIN_HEAP_SIZE))
     required_pages = BYTES_TO_PAGES (MIN_HEAP_SIZE);
-  else if (required_pages > BYTES_TO_PAGES (MAX_HEAP_SIZE))
-    required_pages = BYTES_TO_PAGES (MAX_HEAP_SIZE);
+  else if (required_pages > BYTES_TO_PAGES (INIT_HEAP_SIZE))
+    required_pages = BYTES_TO_PAGES (INIT_HEAP_SIZE);
 
   /* Sort the filtered descriptors, so that GRUB can allocate pages
      from smaller regions.  */
   sort_memory_map (filtered_memory_map, desc_size, filtered_memory_map_end);
 
   /* Allocate memory regions for GRUB's memory management.  */
-  add_memory_regions (filtered_memory_map, desc_size,
-		      filtered_memory_map_end, required_pages);
+  if (add_memory_regions (filtered_memory_map, desc_size,
+			  filtered_memory_map_end, required_pages, 0))
+    grub_fatal ("too little memory");
 
 #if 0
   /* For debug.  */
@@ -554,6 +638,7 @@ grub_efi_mm_init (void)
 #endif
 
   /* Release the memory maps.  */
-  grub_efi_free_pages ((grub_addr_t) memory_map,
-		       2 * BYTES_TO_PAGES (MEMORY_MAP_SIZE));
+  grub_efi_free_pages ((grub_addr_t) memory_map, map_pages);
+
+  grub_mm_add_region_fn = grub_efi_mm_add_regions;
 }
@@ -43,6 +43,11 @@
 #include <errno.h>
 #include <limits.h>
 
+#if defined (__linux__) && defined (HAVE_LIBPTHREAD)
+# define HOSTDISK_ASYNC	1
+# include <pthread.h>
+#endif
+
 #ifdef __linux__
 # include <sys/ioctl.h>         /* ioctl */
 # include <sys/mount.h>
@@ -58,6 +63,34 @@ static struct
   int device_map;
 } map[256];
 
+#ifdef HOSTDISK_ASYNC
+/* Asynchronous reads are served by a few worker threads.  Each request
+   carries a duplicate of the descriptor grub_util_fd_open_device picked
+   for it, which the worker reads with pread and closes.  */
+#define HOSTDISK_THREADS	4
+#define HOSTDISK_QUEUE_DEPTH	8
+
+struct hostdisk_io
+{
+  struct hostdisk_io *next;
+  char *device;
+  int fd;
+  grub_uint64_t offset;
+  size_t len;
+  char *buf;
+  int done;
+  /* The errno of the failure, or 0.  */
+  int error;
+};
+
+static pthread_mutex_t hostdisk_io_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t hostdisk_io_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t hostdisk_io_done = PTHREAD_COND_INITIALIZER;
+static struct hostdisk_io *hostdisk_io_queue;
+static struct hostdisk_io **hostdisk_io_tail = &hostdisk_io_queue;
+static int hostdisk_io_nthreads;
+#endif
+
 static int
 unescape_cmp (const char *a, const char *b_escaped)
 {
@@ -141,6 +174,9 @@ grub_util_biosdisk_open (const char *name, grub_disk_t disk)
   data->fd = GRUB_UTIL_FD_INVALID;
   data->is_disk = 0;
   data->device_map = map[drive].device_map;
+#ifdef HOSTDISK_ASYNC
+  disk->queue_depth = HOSTDISK_QUEUE_DEPTH;
+#endif
 
   /* Get the size.  */
   {
@@ -347,6 +383,146 @@ grub_util_biosdisk_write (grub_disk_t disk, grub_disk_addr_t sector,
   return GRUB_ERR_NONE;
 }
 
+#ifdef HOSTDISK_ASYNC
+static void *
+hostdisk_io_worker (void *arg __attribute__ ((unused)))
+{
+  for (;;)
+    {
+      struct hostdisk_io *hio;
+      size_t pos = 0;
+      int error = 0;
+
+      pthread_mutex_lock (&hostdisk_io_lock);
+      while (! hostdisk_io_queue)
+	pthread_cond_wait (&hostdisk_io_queued, &hostdisk_io_lock);
+      hio = hostdisk_io_queue;
+      hostdisk_io_queue = hio->next;
+      if (! hostdisk_io_queue)
+	hostdisk_io_tail = &hostdisk_io_queue;
+      pthread_mutex_unlock (&hostdisk_io_lock);
+
+      while (pos < hio->len)
+	{
+	  ssize_t r = pread (hio->fd, hio->buf + pos, hio->len - pos,
+			     hio->offset + pos);
+	  if (r < 0 && errno == EINTR)
+	    continue;
+	  if (r <= 0)
+	    {
+	      error = r < 0 ? errno : EIO;
+	      break;
+	    }
+	  pos += r;
+	}
+      close (hio->fd);
+
+      pthread_mutex_lock (&hostdisk_io_lock);
+      hio->error = error;
+      hio->done = 1;
+      pthread_cond_broadcast (&hostdisk_io_done);
+      pthread_mutex_unlock (&hostdisk_io_lock);
+    }
+
+  return NULL;
+}
+
+static grub_err_t
+grub_util_biosdisk_submit (grub_disk_t disk, struct grub_disk_io *io)
+{
+  struct hostdisk_io *hio;
+  grub_disk_addr_t max = ~0ULL;
+  grub_util_fd_t fd;
+  off_t offset;
+  int dupfd;
+
+  /* Open the device the way grub_util_biosdisk_read does, so that reads
+     of partitions go through the partition device and see the same
+     data.  */
+  fd = grub_util_fd_open_device (disk, io->sector, GRUB_UTIL_FD_O_RDONLY,
+				 &max);
+  if (! GRUB_UTIL_FD_IS_VALID (fd))
+    return grub_errno;
+
+  /* The MBR and reads crossing the end of a partition device are split by
+     grub_util_biosdisk_read, leave them to it.  */
+  if (io->sector == 0 || max < io->size)
+    return grub_error (GRUB_ERR_NOT_IMPLEMENTED_YET,
+		       "read needs to be split");
+
+  /* The descriptor may be closed or replaced by the next open_device
+     while the worker uses it, so the worker gets its own.  */
+  offset = lseek (fd, 0, SEEK_CUR);
+  if (offset < 0 || (dupfd = dup (fd)) < 0)
+    return grub_error (GRUB_ERR_READ_ERROR, N_("cannot read `%s': %s"),
+		       map[disk->id].device, strerror (errno));
+
+  pthread_mutex_lock (&hostdisk_io_lock);
+  while (hostdisk_io_nthreads < HOSTDISK_THREADS)
+    {
+      pthread_t thread;
+
+      if (pthread_create (&thread, NULL, hostdisk_io_worker, NULL) != 0)
+	break;
+      pthread_detach (thread);
+      hostdisk_io_nthreads++;
+    }
+  if (! hostdisk_io_nthreads)
+    {
+      pthread_mutex_unlock (&hostdisk_io_lock);
+      close (dupfd);
+      return grub_error (GRUB_ERR_NOT_IMPLEMENTED_YET,
+			 "cannot start I/O threads");
+    }
+
+  hio = xmalloc (sizeof (*hio));
+  hio->next = NULL;
+  hio->device = xstrdup (map[disk->id].device);
+  hio->fd = dupfd;
+  hio->offset = offset;
+  hio->len = io->size << disk->log_sector_size;
+  hio->buf = io->buf;
+  hio->done = 0;
+  hio->error = 0;
+
+  *hostdisk_io_tail = hio;
+  hostdisk_io_tail = &hio->next;
+  pthread_cond_signal (&hostdisk_io_queued);
+  pthread_mutex_unlock (&hostdisk_io_lock);
+
+  io->data = hio;
+  return GRUB_ERR_NONE;
+}
+
+static int
+grub_util_biosdisk_poll (grub_disk_t disk __attribute__ ((unused)),
+			 struct grub_disk_io *io, int wait)
+{
+  struct hostdisk_io *hio = io->data;
+  int done, error;
+
+  pthread_mutex_lock (&hostdisk_io_lock);
+  while (wait && ! hio->done)
+    pthread_cond_wait (&hostdisk_io_done, &hostdisk_io_lock);
+  done = hio->done;
+  error = hio->error;
+  pthread_mutex_unlock (&hostdisk_io_lock);
+
+  if (! done)
+    return 0;
+
+  if (error)
+    io->err = grub_error (GRUB_ERR_READ_ERROR, N_("cannot read `%s': %s"),
+			  hio->device, strerror (error));
+  else
+    io->err = GRUB_ERR_NONE;
+  free (hio->device);
+  free (hio);
+  io->data = 0;
+  return 1;
+}
+#endif
+
 grub_err_t
 grub_util_biosdisk_flush (struct grub_disk *disk)
 {
@@ -393,6 +569,10 @@ static struct grub_disk_dev grub_util_biosdisk_dev =
     .close = grub_util_biosdisk_close,
     .read = grub_util_biosdisk_read,
     .write = grub_util_biosdisk_write,
+#ifdef HOSTDISK_ASYNC
+    .submit = grub_util_biosdisk_submit,
+    .poll = grub_util_biosdisk_poll,
+#endif
     .next = 0
   };
 
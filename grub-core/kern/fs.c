@@ -27,6 +27,8 @@
 #include <grub/mm.h>
 #include <grub/term.h>
 #include <grub/i18n.h>
+#include <grub/partition.h>
+#include <grub/time.h>
 
 grub_fs_t grub_fs_list = 0;
 
@@ -41,78 +43,364 @@ probe_dummy_iter (const char *filename __attribute__ ((unused)),
   return 1;
 }
 
-grub_fs_t
-grub_fs_probe (grub_device_t device)
+/* Signatures of all drivers are matched against a few windows read once
+   per probe, so that only the drivers which may recognize the device
+   have to mount it.  */
+#define PROBE_WINDOW_SIZE	4096
+#define PROBE_NWINDOWS		4
+
+struct probe_window
 {
-  grub_fs_t p;
+  grub_disk_addr_t base;
+  char *buf;
+  grub_err_t err;
+};
 
-  if (device->disk)
-    {
-      /* Make it sure not to have an infinite recursive calls.  */
-      static int count = 0;
+struct probe_ctx
+{
+  grub_disk_t disk;
+  struct probe_window windows[PROBE_NWINDOWS];
+  unsigned next_window;
+};
+
+static struct probe_window *
+probe_get_window (struct probe_ctx *ctx, grub_disk_addr_t base)
+{
+  struct probe_window *w;
+  unsigned i;
 
-      for (p = grub_fs_list; p; p = p->next)
+  for (i = 0; i < PROBE_NWINDOWS; i++)
+    if (ctx->windows[i].buf && ctx->windows[i].base == base)
+      return &ctx->windows[i];
+
+  w = &ctx->windows[ctx->next_window];
+  ctx->next_window = (ctx->next_window + 1) % PROBE_NWINDOWS;
+  if (! w->buf)
+    {
+      w->buf = grub_malloc (PROBE_WINDOW_SIZE);
+      if (! w->buf)
 	{
-	  grub_dprintf ("fs", "Detecting %s...\n", p->name);
+	  grub_errno = GRUB_ERR_NONE;
+	  return 0;
+	}
+    }
+  w->base = base;
+  w->err = grub_disk_read (ctx->disk, base >> GRUB_DISK_SECTOR_BITS, 0,
+			   PROBE_WINDOW_SIZE, w->buf);
+  grub_errno = GRUB_ERR_NONE;
+  return w;
+}
 
-	  /* This is evil: newly-created just mounted BtrFS after copying all
-	     GRUB files has a very peculiar unrecoverable corruption which
-	     will be fixed at sync but we'd rather not do a global sync and
-	     syncing just files doesn't seem to help. Relax the check for
-	     this time.  */
+/* Return 0 if SIG is certainly absent, 1 otherwise.  Read errors other
+   than reading past the end leave the decision to the driver.  */
+static int
+probe_signature (struct probe_ctx *ctx, const struct grub_fs_signature *sig)
+{
+  grub_disk_addr_t base = sig->offset & ~(grub_disk_addr_t)
+    (PROBE_WINDOW_SIZE - 1);
+  grub_size_t off = sig->offset - base;
+  struct probe_window *w;
+  char tmp[16];
+  grub_err_t err;
+
+  if (off + sig->len <= PROBE_WINDOW_SIZE)
+    {
+      w = probe_get_window (ctx, base);
+      if (! w)
+	return 1;
+      if (w->err == GRUB_ERR_NONE)
+	return grub_memcmp (w->buf + off, sig->magic, sig->len) == 0;
+    }
+
+  /* The window may extend past the end of a small device; fetch just the
+     magic.  */
+  if (sig->len > sizeof (tmp))
+    return 1;
+  err = grub_disk_read (ctx->disk, 0, sig->offset, sig->len, tmp);
+  grub_errno = GRUB_ERR_NONE;
+  if (err == GRUB_ERR_OUT_OF_RANGE)
+    return 0;
+  if (err != GRUB_ERR_NONE)
+    return 1;
+  return grub_memcmp (tmp, sig->magic, sig->len) == 0;
+}
+
+static int
+probe_candidate (struct probe_ctx *ctx, grub_fs_t fs)
+{
+  const struct grub_fs_signature *sig;
+
+  if (! fs->signatures)
+    return 1;
+
+  for (sig = fs->signatures; sig->len; sig++)
+    if (probe_signature (ctx, sig))
+      return 1;
+
+  grub_dprintf ("fs", "Skipping %s, no signature found.\n", fs->name);
+  return 0;
+}
+
+/* Try to mount DEVICE with P.  Return 1 on success, 0 if P doesn't
+   recognize DEVICE and -1 on any other error.  */
+static int
+probe_fs (grub_device_t device, grub_fs_t p)
+{
+  grub_dprintf ("fs", "Detecting %s...\n", p->name);
+
+  /* This is evil: newly-created just mounted BtrFS after copying all
+     GRUB files has a very peculiar unrecoverable corruption which
+     will be fixed at sync but we'd rather not do a global sync and
+     syncing just files doesn't seem to help. Relax the check for
+     this time.  */
 #ifdef GRUB_UTIL
-	  if (grub_strcmp (p->name, "btrfs") == 0)
-	    {
-	      char *label = 0;
-	      p->uuid (device, &label);
-	      if (label)
-		grub_free (label);
-	    }
-	  else
+  if (grub_strcmp (p->name, "btrfs") == 0)
+    {
+      char *label = 0;
+      p->uuid (device, &label);
+      if (label)
+	grub_free (label);
+    }
+  else
 #endif
-	    (p->dir) (device, "/", probe_dummy_iter, NULL);
-	  if (grub_errno == GRUB_ERR_NONE)
-	    return p;
+    (p->dir) (device, "/", probe_dummy_iter, NULL);
+  if (grub_errno == GRUB_ERR_NONE)
+    return 1;
 
-	  grub_error_push ();
-	  grub_dprintf ("fs", "%s detection failed.\n", p->name);
-	  grub_error_pop ();
+  grub_error_push ();
+  grub_dprintf ("fs", "%s detection failed.\n", p->name);
+  grub_error_pop ();
 
-	  if (grub_errno != GRUB_ERR_BAD_FS
-	      && grub_errno != GRUB_ERR_OUT_OF_RANGE)
-	    return 0;
+  if (grub_errno != GRUB_ERR_BAD_FS
+      && grub_errno != GRUB_ERR_OUT_OF_RANGE)
+    return -1;
 
-	  grub_errno = GRUB_ERR_NONE;
-	}
+  grub_errno = GRUB_ERR_NONE;
+  return 0;
+}
+
+/* What tells devices apart for the caches below.  */
+struct device_key
+{
+  enum grub_disk_dev_id dev_id;
+  unsigned long disk_id;
+  grub_disk_addr_t start;
+  grub_uint64_t size;
+};
+
+static void
+device_key (grub_disk_t disk, struct device_key *key)
+{
+  key->dev_id = disk->dev->id;
+  key->disk_id = disk->id;
+  key->start = disk->partition ? grub_partition_get_start (disk->partition)
+    : 0;
+  key->size = grub_disk_get_size (disk);
+}
+
+static int
+device_key_equal (const struct device_key *a, const struct device_key *b)
+{
+  return (a->dev_id == b->dev_id && a->disk_id == b->disk_id
+	  && a->start == b->start && a->size == b->size);
+}
+
+/* Devices recently found to hold no known filesystem.  An entry is valid
+   as long as neither the filesystem list nor the disk contents changed
+   and, if it was recorded before autoloading was possible, autoloading
+   is still unavailable.  */
+#define NEGATIVE_CACHE_SIZE	16
+
+struct negative_entry
+{
+  struct device_key key;
+  grub_fs_t fs_list;
+  grub_uint32_t generation;
+  int autoloaded;
+  int valid;
+};
+
+static struct negative_entry negative_cache[NEGATIVE_CACHE_SIZE];
+static unsigned negative_next;
+
+static struct negative_entry *
+negative_find (const struct device_key *key)
+{
+  unsigned i;
+
+  for (i = 0; i < NEGATIVE_CACHE_SIZE; i++)
+    if (negative_cache[i].valid
+	&& device_key_equal (&negative_cache[i].key, key))
+      return &negative_cache[i];
+  return 0;
+}
+
+static int
+negative_lookup (grub_disk_t disk)
+{
+  struct device_key key;
+  struct negative_entry *e;
+
+  device_key (disk, &key);
+  e = negative_find (&key);
+  if (! e)
+    return 0;
+  if (e->fs_list != grub_fs_list || e->generation != grub_disk_generation
+      || (! e->autoloaded && grub_fs_autoload_hook))
+    {
+      e->valid = 0;
+      return 0;
+    }
+  return 1;
+}
+
+static void
+negative_insert (grub_disk_t disk, int autoloaded)
+{
+  struct device_key key;
+  struct negative_entry *e;
+
+  device_key (disk, &key);
+  e = negative_find (&key);
+  if (! e)
+    {
+      e = &negative_cache[negative_next];
+      negative_next = (negative_next + 1) % NEGATIVE_CACHE_SIZE;
+    }
+  e->key = key;
+  e->fs_list = grub_fs_list;
+  e->generation = grub_disk_generation;
+  e->autoloaded = autoloaded;
+  e->valid = 1;
+}
+
+static grub_fs_t
+probe_disk (grub_device_t device, struct probe_ctx *ctx)
+{
+  /* Make it sure not to have an infinite recursive calls.  */
+  static int count = 0;
+  grub_fs_t p;
+  int r;
+
+  if (negative_lookup (device->disk))
+    {
+      grub_dprintf ("fs", "No filesystem found earlier, skipping.\n");
+      return 0;
+    }
+
+  for (p = grub_fs_list; p; p = p->next)
+    {
+      if (! probe_candidate (ctx, p))
+	continue;
+      r = probe_fs (device, p);
+      if (r > 0)
+	return p;
+      if (r < 0)
+	return 0;
+    }
+
+  if (! grub_fs_autoload_hook)
+    {
+      negative_insert (device->disk, 0);
+      return 0;
+    }
+
+  /* Let's load modules automatically.  */
+  if (count == 0)
+    {
+      count++;
 
-      /* Let's load modules automatically.  */
-      if (grub_fs_autoload_hook && count == 0)
+      while (grub_fs_autoload_hook ())
 	{
-	  count++;
+	  p = grub_fs_list;
 
-	  while (grub_fs_autoload_hook ())
+	  if (! probe_candidate (ctx, p))
+	    continue;
+	  r = probe_fs (device, p);
+	  if (r != 0)
 	    {
-	      p = grub_fs_list;
-
-	      (p->dir) (device, "/", probe_dummy_iter, NULL);
-	      if (grub_errno == GRUB_ERR_NONE)
-		{
-		  count--;
-		  return p;
-		}
-
-	      if (grub_errno != GRUB_ERR_BAD_FS
-		  && grub_errno != GRUB_ERR_OUT_OF_RANGE)
-		{
-		  count--;
-		  return 0;
-		}
-
-	      grub_errno = GRUB_ERR_NONE;
+	      count--;
+	      return r > 0 ? p : 0;
 	    }
-
-	  count--;
 	}
+
+      count--;
+      negative_insert (device->disk, 1);
+    }
+
+  return 0;
+}
+
+/* Bring the windows the signatures of the registered filesystems lie in
+   into the disk cache for all of DISKS at once.  */
+#define PREFETCH_MAX_WINDOWS	8
+
+void
+grub_fs_probe_prefetch (grub_disk_t *disks, grub_size_t ndisks)
+{
+  grub_disk_addr_t bases[PREFETCH_MAX_WINDOWS];
+  struct grub_disk_read_request *reqs;
+  const struct grub_fs_signature *sig;
+  unsigned nbases = 0, i;
+  grub_size_t n = 0, d;
+  grub_fs_t p;
+
+  FOR_FILESYSTEMS (p)
+    for (sig = p->signatures; sig && sig->len; sig++)
+      {
+	grub_disk_addr_t base = sig->offset & ~(grub_disk_addr_t)
+	  (PROBE_WINDOW_SIZE - 1);
+
+	for (i = 0; i < nbases; i++)
+	  if (bases[i] == base)
+	    break;
+	if (i == nbases && nbases < PREFETCH_MAX_WINDOWS)
+	  bases[nbases++] = base;
+      }
+
+  if (! nbases || ! ndisks)
+    return;
+
+  reqs = grub_malloc (ndisks * nbases * sizeof (reqs[0]));
+  if (! reqs)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+
+  for (d = 0; d < ndisks; d++)
+    for (i = 0; i < nbases; i++)
+      {
+	reqs[n].disk = disks[d];
+	reqs[n].sector = bases[i] >> GRUB_DISK_SECTOR_BITS;
+	reqs[n].offset = 0;
+	reqs[n].size = PROBE_WINDOW_SIZE;
+	reqs[n].buf = 0;
+	n++;
+      }
+
+  grub_disk_read_batch (reqs, n);
+  grub_errno = GRUB_ERR_NONE;
+  grub_free (reqs);
+}
+
+grub_fs_t
+grub_fs_probe (grub_device_t device)
+{
+  if (device->disk)
+    {
+      struct probe_ctx ctx;
+      grub_fs_t p;
+      unsigned i;
+
+      grub_memset (&ctx, 0, sizeof (ctx));
+      ctx.disk = device->disk;
+      p = probe_disk (device, &ctx);
+      for (i = 0; i < PROBE_NWINDOWS; i++)
+	grub_free (ctx.windows[i].buf);
+
+      if (p || grub_errno != GRUB_ERR_NONE)
+	return p;
     }
   else if (device->net && device->net->fs)
     return device->net->fs;
@@ -121,7 +409,207 @@ grub_fs_probe (grub_device_t device)
   return 0;
 }
 
-
+
+/* Instances of the drivers providing mount and unmount, kept mounted on
+   a device of their own across opens.  An entry is handed out as long as
+   the disk contents didn't change and, if nobody used it for a while,
+   until removable media could have been swapped, like the disk cache.
+   Entries which can't be handed out any more are unmounted as soon as
+   their last user is gone.  */
+#define MOUNT_CACHE_SIZE	8
+#define MOUNT_CACHE_TIMEOUT	2000
+
+struct mount_entry
+{
+  grub_fs_t fs;
+  struct device_key key;
+  grub_device_t device;
+  void *data;
+  unsigned refcnt;
+  int stale;
+  grub_uint32_t generation;
+  grub_uint64_t last_use;
+};
+
+static struct mount_entry mount_cache[MOUNT_CACHE_SIZE];
+
+static void
+mount_drop (struct mount_entry *e)
+{
+  grub_fs_t fs = e->fs;
+  grub_device_t device = e->device;
+  void *data = e->data;
+
+  /* Free the slot first, unmounting may get back here.  */
+  e->fs = 0;
+  fs->unmount (data);
+  grub_device_close (device);
+}
+
+static void
+mount_invalidate (struct mount_entry *e)
+{
+  if (e->refcnt)
+    e->stale = 1;
+  else
+    mount_drop (e);
+}
+
+void
+grub_fs_mount_cache_flush (grub_fs_t fs)
+{
+  unsigned i;
+
+  for (i = 0; i < MOUNT_CACHE_SIZE; i++)
+    if (mount_cache[i].fs && (! fs || mount_cache[i].fs == fs))
+      mount_invalidate (&mount_cache[i]);
+}
+
+void
+grub_fs_flush_caches (void)
+{
+  grub_fs_t p;
+
+  FOR_FILESYSTEMS (p)
+    if (p->flush_caches)
+      p->flush_caches ();
+}
+
+/* Return a slot for a new entry, evicting the least recently used unused
+   entry if needed, or NULL if all are in use.  */
+static struct mount_entry *
+mount_free_slot (void)
+{
+  struct mount_entry *victim = 0;
+  unsigned i;
+
+  for (i = 0; i < MOUNT_CACHE_SIZE; i++)
+    {
+      struct mount_entry *e = &mount_cache[i];
+
+      if (! e->fs)
+	return e;
+      if (! e->refcnt && (! victim || e->last_use < victim->last_use))
+	victim = e;
+    }
+  if (victim)
+    mount_drop (victim);
+  return victim;
+}
+
+/* Open DISK once more, for a cached instance to keep.  */
+static grub_device_t
+mount_open_device (grub_disk_t disk)
+{
+  grub_device_t device;
+  char *partname, *name;
+
+  if (! disk->partition)
+    return grub_device_open (disk->name);
+
+  partname = grub_partition_get_name (disk->partition);
+  if (! partname)
+    return 0;
+  name = grub_xasprintf ("%s,%s", disk->name, partname);
+  grub_free (partname);
+  if (! name)
+    return 0;
+  device = grub_device_open (name);
+  grub_free (name);
+  return device;
+}
+
+grub_err_t
+grub_fs_mount (grub_fs_t fs, grub_device_t device, void **data)
+{
+  struct device_key key;
+  struct mount_entry *e;
+  grub_device_t own;
+  grub_uint64_t now;
+  unsigned i;
+
+  /* Instances on anything but disks are not shared.  */
+  if (! device->disk)
+    return fs->mount (device, data);
+
+  device_key (device->disk, &key);
+  now = grub_get_time_ms ();
+
+  for (i = 0; i < MOUNT_CACHE_SIZE; i++)
+    {
+      e = &mount_cache[i];
+      if (! e->fs || e->stale)
+	continue;
+      if (e->generation != grub_disk_generation
+	  || (! e->refcnt && now - e->last_use > MOUNT_CACHE_TIMEOUT))
+	{
+	  mount_invalidate (e);
+	  continue;
+	}
+      if (e->fs == fs && device_key_equal (&e->key, &key))
+	{
+	  e->refcnt++;
+	  e->last_use = now;
+	  *data = e->data;
+	  return GRUB_ERR_NONE;
+	}
+    }
+
+  own = mount_open_device (device->disk);
+  if (! own)
+    return grub_errno;
+
+  if (fs->mount (own, data) != GRUB_ERR_NONE)
+    {
+      grub_device_close (own);
+      return grub_errno;
+    }
+
+  /* Mounting may have taken slots for other devices.  */
+  e = mount_free_slot ();
+  if (! e)
+    {
+      grub_dprintf ("fs", "Mount cache full, not keeping %s.\n", fs->name);
+      fs->unmount (*data);
+      grub_device_close (own);
+      return fs->mount (device, data);
+    }
+
+  e->fs = fs;
+  e->key = key;
+  e->device = own;
+  e->data = *data;
+  e->refcnt = 1;
+  e->stale = 0;
+  e->generation = grub_disk_generation;
+  e->last_use = now;
+
+  return GRUB_ERR_NONE;
+}
+
+void
+grub_fs_unmount (grub_fs_t fs, void *data)
+{
+  unsigned i;
+
+  for (i = 0; i < MOUNT_CACHE_SIZE; i++)
+    {
+      struct mount_entry *e = &mount_cache[i];
+
+      if (e->fs != fs || e->data != data)
+	continue;
+      e->refcnt--;
+      e->last_use = grub_get_time_ms ();
+      if (! e->refcnt && e->stale)
+	mount_drop (e);
+      return;
+    }
+
+  /* Not kept, it refers to its user's device.  */
+  fs->unmount (data);
+}
+
+
 
 /* Block list support routines.  */
 
@@ -53,6 +53,23 @@
   a typical optimization against defragmentation, and makes the
   implementation a bit easier.
 
+  Allocations of at least GRUB_MM_LARGE_CELLS go to the smallest free
+  block they fit in rather than to the first one, so that big (and often
+  aligned) buffers do not carve up the free blocks later big allocations
+  would need.
+
+  Small blocks, up to GRUB_MM_CACHE_CELLS, are not returned to the ring
+  when freed.  They go to a free list per size instead, up to
+  GRUB_MM_CACHE_MAX_CELLS in all, from which allocations of that size are
+  served without walking the ring; when such a list is empty a slab of
+  several blocks is carved at once.  These blocks stay allocated as far as
+  the ring is concerned.  They are given back, and coalesced, when an
+  allocation fails or when the ring they fragment has grown long.
+
+  When no region can satisfy an allocation, the platform may add one
+  through grub_mm_add_region_fn, so that it need not reserve all the
+  memory GRUB might use up front.
+
   For safety, both allocated blocks and free ones are marked by magic
   numbers. Whenever anything unexpected is detected, GRUB aborts the
   operation.
@@ -64,6 +81,7 @@
 #include <grub/err.h>
 #include <grub/types.h>
 #include <grub/disk.h>
+#include <grub/fs.h>
 #include <grub/dl.h>
 #include <grub/i18n.h>
 #include <grub/mm_private.h>
@@ -78,7 +96,48 @@
 
 
 
+/* Blocks of up to this many cells, header included, are kept on the size
+   class lists.  */
+#define GRUB_MM_CACHE_CELLS	16
+/* The most cells the size class lists hold.  */
+#define GRUB_MM_CACHE_MAX_CELLS	(0x40000 >> GRUB_MM_ALIGN_LOG2)
+/* The size of a slab carved for an empty size class.  */
+#define GRUB_MM_SLAB_CELLS	(0x800 >> GRUB_MM_ALIGN_LOG2)
+/* Allocations of this many cells or more are placed best-fit.  */
+#define GRUB_MM_LARGE_CELLS	(0x8000 >> GRUB_MM_ALIGN_LOG2)
+/* A ring this long is worth flushing the size class lists for, as the
+   blocks on them keep their neighbours from coalescing.  */
+#define GRUB_MM_LONG_SCAN	256
+
 grub_mm_region_t grub_mm_base;
+grub_mm_add_region_func_t grub_mm_add_region_fn;
+
+/* Free small blocks by their size in cells, minus one.  */
+static grub_mm_header_t mm_cache[GRUB_MM_CACHE_CELLS];
+static grub_size_t mm_cached_cells;
+/* Set when a best-fit search had to look at GRUB_MM_LONG_SCAN blocks.  */
+static int mm_ring_long;
+
+#ifdef MM_DEBUG
+static struct
+{
+  grub_uint64_t allocs;
+  grub_uint64_t cache_allocs;
+  grub_uint64_t slabs;
+  grub_uint64_t frees;
+  grub_uint64_t cache_frees;
+  grub_uint64_t flushes;
+  /* Regions the platform added on demand.  */
+  grub_uint64_t grown;
+  /* Free blocks looked at when allocating and when freeing, which is
+     where the time goes.  */
+  grub_uint64_t alloc_steps;
+  grub_uint64_t free_steps;
+} mm_stats;
+# define MM_STAT(x)	(mm_stats.x++)
+#else
+# define MM_STAT(x)
+#endif
 
 /* Get a header from the pointer PTR, and set *P and *R to a pointer
    to the header and a pointer to its region, respectively. PTR must
@@ -98,13 +157,17 @@ get_header_from_pointer (void *ptr, grub_mm_header_t *p, grub_mm_region_t *r)
     grub_fatal ("out of range pointer %p", ptr);
 
   *p = (grub_mm_header_t) ptr - 1;
-  if ((*p)->magic == GRUB_MM_FREE_MAGIC)
+  if ((*p)->magic == GRUB_MM_FREE_MAGIC
+      || (*p)->magic == GRUB_MM_CACHE_MAGIC)
     grub_fatal ("double free at %p", *p);
   if ((*p)->magic != GRUB_MM_ALLOC_MAGIC)
     grub_fatal ("alloc magic is broken at %p: %lx", *p,
 		(unsigned long) (*p)->magic);
 }
 
+static void
+free_block (grub_mm_header_t p, grub_mm_region_t r);
+
 /* Initialize a region starting from ADDR and whose size is SIZE,
    to use it as free space.  */
 void
@@ -141,7 +204,7 @@ grub_mm_init_region (void *addr, grub_size_t size)
 	    r->size += h->size << GRUB_MM_ALIGN_LOG2;
 	    r->pre_size &= (GRUB_MM_ALIGN - 1);
 	    *p = r;
-	    grub_free (h + 1);
+	    free_block (h, r);
 	  }
 	*p = r;
 	return;
@@ -183,17 +246,58 @@ static void *
 grub_real_malloc (grub_mm_header_t *first, grub_size_t n, grub_size_t align)
 {
   grub_mm_header_t p, q;
+  grub_mm_header_t start = *first;
 
   /* When everything is allocated side effect is that *first will have alloc
-     magic marked, meaning that there is no room in this region.  */
-  if ((*first)->magic == GRUB_MM_ALLOC_MAGIC)
+     magic marked, meaning that there is no room in this region.  The block
+     may since have moved to a size class list.  */
+  if ((*first)->magic != GRUB_MM_FREE_MAGIC)
     return 0;
 
+  /* Find the smallest free block that fits and start the search below
+     right before it.  */
+  if (n >= GRUB_MM_LARGE_CELLS)
+    {
+      grub_size_t best_size = ~(grub_size_t) 0;
+      unsigned steps = 0;
+
+      start = 0;
+      for (q = *first, p = q->next; ; q = p, p = p->next)
+	{
+	  grub_off_t extra;
+
+	  MM_STAT (alloc_steps);
+	  if (p->magic != GRUB_MM_FREE_MAGIC)
+	    grub_fatal ("free magic is broken at %p: 0x%x", p, p->magic);
+
+	  extra = ((grub_addr_t) (p + 1) >> GRUB_MM_ALIGN_LOG2) & (align - 1);
+	  if (extra)
+	    extra = align - extra;
+
+	  if (p->size >= n + extra && p->size < best_size)
+	    {
+	      start = q;
+	      best_size = p->size;
+	      if (p->size == n + extra)
+		break;
+	    }
+
+	  if (++steps == GRUB_MM_LONG_SCAN)
+	    mm_ring_long = 1;
+	  if (p == *first)
+	    break;
+	}
+      if (!start)
+	return 0;
+    }
+
   /* Try to search free slot for allocation in this memory region.  */
-  for (q = *first, p = q->next; ; q = p, p = p->next)
+  for (q = start, p = q->next; ; q = p, p = p->next)
     {
       grub_off_t extra;
 
+      MM_STAT (alloc_steps);
+
       extra = ((grub_addr_t) (p + 1) >> GRUB_MM_ALIGN_LOG2) & (align - 1);
       if (extra)
 	extra = align - extra;
@@ -299,7 +403,7 @@ grub_real_malloc (grub_mm_header_t *first, grub_size_t n, grub_size_t align)
 	     This will have side effect of fragmenting memory as small
 	     pieces before this will be un-used.  */
 	  /* So do it only for chunks under 64K.  */
-	  if (n < (0x8000 >> GRUB_MM_ALIGN_LOG2)
+	  if (n < GRUB_MM_LARGE_CELLS
 	      || *first == p)
 	    *first = q;
 
@@ -314,6 +418,75 @@ grub_real_malloc (grub_mm_header_t *first, grub_size_t n, grub_size_t align)
   return 0;
 }
 
+/* Take a block of N cells off its size class list, carving a slab of them
+   if the list is empty.  */
+static void *
+cache_alloc (grub_size_t n)
+{
+  grub_mm_region_t r;
+  grub_mm_header_t p, h;
+  grub_size_t i, k;
+
+  p = mm_cache[n - 1];
+  if (p)
+    {
+      mm_cache[n - 1] = p->next;
+      mm_cached_cells -= n;
+      p->magic = GRUB_MM_ALLOC_MAGIC;
+      MM_STAT (cache_allocs);
+      return p + 1;
+    }
+
+  k = GRUB_MM_SLAB_CELLS / n;
+  if (k < 2 || mm_cached_cells + (k - 1) * n > GRUB_MM_CACHE_MAX_CELLS)
+    return 0;
+
+  for (r = grub_mm_base; r; r = r->next)
+    {
+      p = grub_real_malloc (&(r->first), k * n, 1);
+      if (p)
+	break;
+    }
+  if (!p)
+    return 0;
+
+  /* Split the slab into K blocks of N cells and keep all but the first.  */
+  p--;
+  p->size = n;
+  for (i = 1; i < k; i++)
+    {
+      h = p + i * n;
+      h->size = n;
+      h->magic = GRUB_MM_CACHE_MAGIC;
+      h->next = mm_cache[n - 1];
+      mm_cache[n - 1] = h;
+    }
+  mm_cached_cells += (k - 1) * n;
+  MM_STAT (slabs);
+  return p + 1;
+}
+
+void
+grub_mm_flush_caches (void)
+{
+  grub_mm_header_t p;
+  grub_mm_region_t r;
+  unsigned i;
+
+  MM_STAT (flushes);
+  for (i = 0; i < GRUB_MM_CACHE_CELLS; i++)
+    while (mm_cache[i])
+      {
+	p = mm_cache[i];
+	mm_cache[i] = p->next;
+	p->magic = GRUB_MM_ALLOC_MAGIC;
+	get_header_from_pointer (p + 1, &p, &r);
+	free_block (p, r);
+      }
+  mm_cached_cells = 0;
+  mm_ring_long = 0;
+}
+
 /* Allocate SIZE bytes with the alignment ALIGN and return the pointer.  */
 void *
 grub_memalign (grub_size_t align, grub_size_t size)
@@ -322,6 +495,8 @@ grub_memalign (grub_size_t align, grub_size_t size)
   grub_size_t n = ((size + GRUB_MM_ALIGN - 1) >> GRUB_MM_ALIGN_LOG2) + 1;
   int count = 0;
 
+  MM_STAT (allocs);
+
   if (!grub_mm_base)
     goto fail;
 
@@ -338,6 +513,18 @@ grub_memalign (grub_size_t align, grub_size_t size)
   if (align == 0)
     align = 1;
 
+  if (align == 1 && n <= GRUB_MM_CACHE_CELLS)
+    {
+      void *p;
+
+      p = cache_alloc (n);
+      if (p)
+	return p;
+    }
+  else if (n >= GRUB_MM_LARGE_CELLS && mm_ring_long
+	   && mm_cached_cells >= GRUB_MM_CACHE_MAX_CELLS / 2)
+    grub_mm_flush_caches ();
+
  again:
 
   for (r = grub_mm_base; r; r = r->next)
@@ -353,13 +540,36 @@ grub_memalign (grub_size_t align, grub_size_t size)
   switch (count)
     {
     case 0:
-      /* Invalidate disk caches.  */
+      /* Give the free small blocks back so that they coalesce.  */
+      grub_mm_flush_caches ();
+      count++;
+      goto again;
+
+    case 1:
+      /* Ask the platform for more memory, with room for the alignment
+	 and the region header.  */
+      count++;
+      if (grub_mm_add_region_fn
+	  && grub_mm_add_region_fn (((n + align) << GRUB_MM_ALIGN_LOG2)
+				    + sizeof (struct grub_mm_region)
+				    + GRUB_MM_ALIGN) == GRUB_ERR_NONE)
+	{
+	  MM_STAT (grown);
+	  goto again;
+	}
+      /* Fall through.  */
+
+    case 2:
+      /* Invalidate disk caches, unmount unused filesystems and drop
+	 what the drivers cache across mounts.  */
       grub_disk_cache_invalidate_all ();
+      grub_fs_mount_cache_flush (0);
+      grub_fs_flush_caches ();
       count++;
       goto again;
 
 #if 0
-    case 1:
+    case 3:
       /* Unload unneeded modules.  */
       grub_dl_unload_unneeded ();
       count++;
@@ -407,7 +617,27 @@ grub_free (void *ptr)
 
   get_header_from_pointer (ptr, &p, &r);
 
-  if (r->first->magic == GRUB_MM_ALLOC_MAGIC)
+  MM_STAT (frees);
+  if (p->size <= GRUB_MM_CACHE_CELLS
+      && mm_cached_cells + p->size <= GRUB_MM_CACHE_MAX_CELLS)
+    {
+      p->magic = GRUB_MM_CACHE_MAGIC;
+      p->next = mm_cache[p->size - 1];
+      mm_cache[p->size - 1] = p;
+      mm_cached_cells += p->size;
+      MM_STAT (cache_frees);
+      return;
+    }
+
+  free_block (p, r);
+}
+
+/* Return the allocated block P of region R to the ring of free blocks,
+   merging it with its neighbours.  */
+static void
+free_block (grub_mm_header_t p, grub_mm_region_t r)
+{
+  if (r->first->magic != GRUB_MM_FREE_MAGIC)
     {
       p->magic = GRUB_MM_FREE_MAGIC;
       r->first = p->next = p;
@@ -429,6 +659,7 @@ grub_free (void *ptr)
 
       for (s = r->first, q = s->next; q <= p || q->next >= p; s = q, q = s->next)
 	{
+	  MM_STAT (free_steps);
 	  if (q->magic != GRUB_MM_FREE_MAGIC)
 	    grub_fatal ("free magic is broken at %p: 0x%x", q, q->magic);
 
@@ -504,6 +735,70 @@ grub_realloc (void *ptr, grub_size_t size)
 #ifdef MM_DEBUG
 int grub_mm_debug = 0;
 
+static void
+mm_dump_stats (void)
+{
+  grub_mm_region_t r;
+  grub_size_t total = 0, largest = 0, blocks = 0;
+  unsigned long regions = 0;
+
+  /* Fragmentation is the share of free memory outside the largest free
+     block, of each region and of the whole heap.  */
+  for (r = grub_mm_base; r; r = r->next)
+    {
+      grub_mm_header_t p;
+      grub_size_t r_total = 0, r_largest = 0, r_blocks = 0;
+
+      regions++;
+      p = r->first;
+      if (p->magic == GRUB_MM_FREE_MAGIC)
+	do
+	  {
+	    r_blocks++;
+	    r_total += p->size;
+	    if (p->size > r_largest)
+	      r_largest = p->size;
+	    p = p->next;
+	  }
+	while (p != r->first);
+
+      grub_printf ("region %p: %lu bytes, %lu free in %lu blocks, "
+		   "largest %lu, fragmentation %lu%%\n", r,
+		   (unsigned long) r->size,
+		   (unsigned long) r_total << GRUB_MM_ALIGN_LOG2,
+		   (unsigned long) r_blocks,
+		   (unsigned long) r_largest << GRUB_MM_ALIGN_LOG2,
+		   r_total ? (unsigned long) ((r_total - r_largest) * 100
+					      / r_total) : 0);
+      blocks += r_blocks;
+      total += r_total;
+      if (r_largest > largest)
+	largest = r_largest;
+    }
+
+  grub_printf ("free: %lu bytes in %lu blocks, largest %lu, "
+	       "fragmentation %lu%%, cached %lu bytes\n",
+	       (unsigned long) total << GRUB_MM_ALIGN_LOG2,
+	       (unsigned long) blocks,
+	       (unsigned long) largest << GRUB_MM_ALIGN_LOG2,
+	       total ? (unsigned long) ((total - largest) * 100 / total) : 0,
+	       (unsigned long) mm_cached_cells << GRUB_MM_ALIGN_LOG2);
+  grub_printf ("regions: %lu, %llu added on demand\n", regions,
+	       (unsigned long long) mm_stats.grown);
+  grub_printf ("allocs: %llu, %llu from size classes, %llu slabs, "
+	       "%llu blocks searched\n",
+	       (unsigned long long) mm_stats.allocs,
+	       (unsigned long long) mm_stats.cache_allocs,
+	       (unsigned long long) mm_stats.slabs,
+	       (unsigned long long) mm_stats.alloc_steps);
+  grub_printf ("frees: %llu, %llu to size classes, %llu flushes, "
+	       "%llu blocks searched\n",
+	       (unsigned long long) mm_stats.frees,
+	       (unsigned long long) mm_stats.cache_frees,
+	       (unsigned long long) mm_stats.flushes,
+	       (unsigned long long) mm_stats.free_steps);
+}
+
 void
 grub_mm_dump_free (void)
 {
@@ -515,6 +810,8 @@ grub_mm_dump_free (void)
 
       /* Follow the free list.  */
       p = r->first;
+      if (p->magic != GRUB_MM_FREE_MAGIC)
+	continue;
       do
 	{
 	  if (p->magic != GRUB_MM_FREE_MAGIC)
@@ -527,6 +824,7 @@ grub_mm_dump_free (void)
       while (p != r->first);
     }
 
+  mm_dump_stats ();
   grub_printf ("\n");
 }
 
@@ -554,10 +852,14 @@ grub_mm_dump (unsigned lineno)
 	    case GRUB_MM_ALLOC_MAGIC:
 	      grub_printf ("A:%p:%u\n", p, (unsigned int) p->size << GRUB_MM_ALIGN_LOG2);
 	      break;
+	    case GRUB_MM_CACHE_MAGIC:
+	      grub_printf ("C:%p:%u\n", p, (unsigned int) p->size << GRUB_MM_ALIGN_LOG2);
+	      break;
 	    }
 	}
     }
 
+  mm_dump_stats ();
   grub_printf ("\n");
 }
 
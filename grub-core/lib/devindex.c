@@ -0,0 +1,294 @@
+/* devindex.c - memo of device identities for the search commands.  */
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/devindex.h>
+#include <grub/device.h>
+#include <grub/disk.h>
+#include <grub/partition.h>
+#include <grub/fs.h>
+#include <grub/mm.h>
+#include <grub/misc.h>
+#include <grub/dl.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+struct grub_devindex_entry
+{
+  struct grub_devindex_entry *next;
+  char *name;
+  /* Bit N is set once key N has been probed.  */
+  unsigned probed;
+  /* Whether the filesystem keys were probed with autoloading enabled.  */
+  int fs_autoload;
+  char *values[GRUB_DEVINDEX_NKEYS];
+};
+
+/* Entries in the order grub_device_iterate found them.  */
+static struct grub_devindex_entry *entries, **entries_tail = &entries;
+
+/* What the index was built against.  Device names depend on the disk
+   drivers and partition maps, the values additionally on the disk
+   contents and the available filesystems.  */
+static grub_disk_dev_t names_disk_devs;
+static grub_partition_map_t names_partmaps;
+static grub_fs_t values_fs;
+static grub_uint32_t values_generation;
+
+static int
+is_fs_key (grub_devindex_key_t key)
+{
+  return key == GRUB_DEVINDEX_FS_UUID || key == GRUB_DEVINDEX_FS_LABEL;
+}
+
+static void
+clear_values (struct grub_devindex_entry *e)
+{
+  unsigned i;
+
+  for (i = 0; i < GRUB_DEVINDEX_NKEYS; i++)
+    {
+      grub_free (e->values[i]);
+      e->values[i] = NULL;
+    }
+  e->probed = 0;
+}
+
+void
+grub_devindex_invalidate (void)
+{
+  struct grub_devindex_entry *e, *next;
+
+  for (e = entries; e; e = next)
+    {
+      next = e->next;
+      clear_values (e);
+      grub_free (e->name);
+      grub_free (e);
+    }
+  entries = NULL;
+  entries_tail = &entries;
+  names_disk_devs = grub_disk_dev_list;
+  names_partmaps = grub_partition_map_list;
+  values_fs = grub_fs_list;
+  values_generation = grub_disk_generation;
+}
+
+/* Entries are never freed here, only their values, so that it is safe
+   to call from within grub_devindex_iterate.  */
+static void
+check_values (void)
+{
+  struct grub_devindex_entry *e;
+
+  if (values_fs == grub_fs_list && values_generation == grub_disk_generation)
+    return;
+
+  grub_dprintf ("devindex", "disk contents or filesystems changed\n");
+  for (e = entries; e; e = e->next)
+    clear_values (e);
+  values_fs = grub_fs_list;
+  values_generation = grub_disk_generation;
+}
+
+static struct grub_devindex_entry *
+find_entry (const char *name)
+{
+  struct grub_devindex_entry *e;
+
+  for (e = entries; e; e = e->next)
+    if (grub_strcmp (e->name, name) == 0)
+      return e;
+
+  return NULL;
+}
+
+static struct grub_devindex_entry *
+add_entry (const char *name)
+{
+  struct grub_devindex_entry *e;
+
+  e = grub_zalloc (sizeof (*e));
+  if (!e)
+    return NULL;
+  e->name = grub_strdup (name);
+  if (!e->name)
+    {
+      grub_free (e);
+      return NULL;
+    }
+  *entries_tail = e;
+  entries_tail = &e->next;
+
+  return e;
+}
+
+const char *
+grub_devindex_get (const char *name, grub_devindex_key_t key,
+		   grub_devindex_probe_t probe)
+{
+  struct grub_devindex_entry *e;
+  grub_device_t dev;
+
+  check_values ();
+
+  e = find_entry (name);
+  if (!e)
+    {
+      e = add_entry (name);
+      if (!e)
+	{
+	  grub_errno = GRUB_ERR_NONE;
+	  return NULL;
+	}
+    }
+
+  /* A filesystem that was not found while autoloading was disabled
+     may well be found now.  */
+  if ((e->probed & (1U << key)) && is_fs_key (key) && !e->values[key]
+      && !e->fs_autoload && grub_fs_autoload_hook)
+    e->probed &= ~(1U << key);
+
+  if (e->probed & (1U << key))
+    return e->values[key];
+
+  dev = grub_device_open (name);
+  if (dev)
+    {
+      e->values[key] = probe (dev);
+      grub_device_close (dev);
+    }
+  grub_errno = GRUB_ERR_NONE;
+
+  e->probed |= 1U << key;
+  if (is_fs_key (key))
+    e->fs_autoload = !!grub_fs_autoload_hook;
+
+  return e->values[key];
+}
+
+/* Bring the blocks filesystems are recognized by into the disk cache for
+   the entries from FROM on whose filesystem wasn't probed yet, reading
+   them from all disks at once where the disk driver allows it.  */
+#define PREFETCH_DISKS 32
+
+static void
+prefetch_entries (struct grub_devindex_entry *from)
+{
+  grub_disk_t disks[PREFETCH_DISKS];
+  struct grub_devindex_entry *e;
+  unsigned n = 0, i;
+
+  check_values ();
+
+  for (e = from; e; e = e->next)
+    {
+      grub_disk_t disk;
+
+      if (e->probed & ((1U << GRUB_DEVINDEX_FS_UUID)
+		       | (1U << GRUB_DEVINDEX_FS_LABEL)))
+	continue;
+      disk = grub_disk_open (e->name);
+      if (!disk)
+	{
+	  grub_errno = GRUB_ERR_NONE;
+	  continue;
+	}
+      if (disk->queue_depth < 2)
+	{
+	  grub_disk_close (disk);
+	  continue;
+	}
+      disks[n++] = disk;
+      if (n < PREFETCH_DISKS && e->next)
+	continue;
+
+      grub_fs_probe_prefetch (disks, n);
+      for (i = 0; i < n; i++)
+	grub_disk_close (disks[i]);
+      n = 0;
+    }
+
+  if (n)
+    {
+      grub_fs_probe_prefetch (disks, n);
+      for (i = 0; i < n; i++)
+	grub_disk_close (disks[i]);
+    }
+}
+
+/* Context for grub_devindex_iterate.  */
+struct devindex_iterate_ctx
+{
+  grub_device_iterate_hook_t hook;
+  void *hook_data;
+};
+
+/* Helper for grub_devindex_iterate.  */
+static int
+devindex_discover (const char *name, void *data)
+{
+  struct devindex_iterate_ctx *ctx = data;
+
+  if (find_entry (name) || add_entry (name))
+    return 0;
+
+  grub_errno = GRUB_ERR_NONE;
+  return ctx->hook (name, ctx->hook_data);
+}
+
+int
+grub_devindex_iterate (grub_device_iterate_hook_t hook, void *hook_data)
+{
+  struct devindex_iterate_ctx ctx = {
+    .hook = hook,
+    .hook_data = hook_data
+  };
+  struct grub_devindex_entry *e, **known_tail;
+
+  if (names_disk_devs != grub_disk_dev_list
+      || names_partmaps != grub_partition_map_list)
+    {
+      grub_dprintf ("devindex", "device set changed\n");
+      grub_devindex_invalidate ();
+    }
+
+  prefetch_entries (entries);
+
+  for (e = entries; e; e = e->next)
+    if (hook (e->name, hook_data))
+      return 1;
+
+  /* Pick up devices that were not known yet, e.g. after a hotplug.  They
+     are all discovered first so that they can be prefetched together.  */
+  known_tail = entries_tail;
+  if (grub_device_iterate (devindex_discover, &ctx))
+    return 1;
+
+  prefetch_entries (*known_tail);
+  for (e = *known_tail; e; e = e->next)
+    if (hook (e->name, hook_data))
+      return 1;
+
+  return 0;
+}
+
+GRUB_MOD_FINI(devindex)
+{
+  grub_devindex_invalidate ();
+}
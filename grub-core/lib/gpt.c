@@ -19,12 +19,12 @@
  */
 
 #include <grub/charset.h>
-#include <grub/crypto.h>
 #include <grub/device.h>
 #include <grub/disk.h>
 #include <grub/misc.h>
 #include <grub/mm.h>
 #include <grub/dl.h>
+#include <grub/partition.h>
 #include <grub/msdos_partition.h>
 #include <grub/gpt_partition.h>
 
@@ -32,12 +32,37 @@ GRUB_MOD_LICENSE ("GPLv3+");
 
 static grub_uint8_t grub_gpt_magic[] = GRUB_GPT_HEADER_MAGIC;
 
+/* Parsed and verified tables of recently read disks.  gptprio, gptrepair
+ * and the search_part_* commands all look at the same few tables many
+ * times during boot, so only the first lookup reads and checks them.
+ * An entry is dropped as soon as grub_disk_generation moves on.  */
+#define GRUB_GPT_CACHE_SIZE	8
+
+struct grub_gpt_cache
+{
+  grub_gpt_t gpt;
+  enum grub_disk_dev_id dev_id;
+  unsigned long disk_id;
+  grub_disk_addr_t start;
+  grub_uint64_t total_sectors;
+  grub_uint32_t generation;
+  grub_uint32_t last_use;
+};
+
+static struct grub_gpt_cache grub_gpt_cache[GRUB_GPT_CACHE_SIZE];
+static grub_uint32_t grub_gpt_cache_clock;
+
+/* Slice-by-8 tables for the CRC32 used by GPT, built on first use.  */
+static grub_uint32_t grub_gpt_crc32_table[8][256];
+
 static grub_err_t
 grub_gpt_read_entries (grub_disk_t disk, grub_gpt_t gpt,
 		       struct grub_gpt_header *header,
 		       void **ret_entries,
 		       grub_size_t *ret_entries_size);
 
+static grub_gpt_t grub_gpt_read_cached (grub_disk_t disk);
+
 char *
 grub_gpt_guid_to_str (grub_gpt_guid_t *guid)
 {
@@ -56,7 +81,9 @@ grub_gpt_device_partentry (grub_device_t device,
 			   struct grub_gpt_partentry *entry)
 {
   grub_disk_t disk = device->disk;
+  struct grub_gpt_partentry *cached;
   grub_partition_t p;
+  grub_gpt_t gpt;
   grub_err_t err;
 
   if (!disk || !disk->partition)
@@ -67,7 +94,19 @@ grub_gpt_device_partentry (grub_device_t device,
 
   p = disk->partition;
   disk->partition = p->parent;
-  err = grub_disk_read (disk, p->offset, p->index, sizeof (*entry), entry);
+  gpt = grub_gpt_read_cached (disk);
+  if (gpt && (cached = grub_gpt_get_partentry (gpt, p->number)))
+    {
+      grub_memcpy (entry, cached, sizeof (*entry));
+      err = GRUB_ERR_NONE;
+    }
+  else
+    {
+      /* The partition map does not verify checksums, so fall back to
+	 reading the entry it found even if the table did not check out.  */
+      grub_errno = GRUB_ERR_NONE;
+      err = grub_disk_read (disk, p->offset, p->index, sizeof (*entry), entry);
+    }
   disk->partition = p;
 
   return err;
@@ -130,18 +169,16 @@ grub_gpt_disk_uuid (grub_device_t device, char **uuid)
 {
   struct grub_gpt_header *header;
 
-  grub_gpt_t gpt = grub_gpt_read (device->disk);
+  grub_gpt_t gpt = grub_gpt_read_cached (device->disk);
   if (!gpt)
-    goto done;
+    return grub_errno;
 
   header = grub_gpt_get_header (gpt);
   if (!header)
-    goto done;
+    return grub_errno;
 
   *uuid = grub_gpt_guid_to_str (&header->guid);
 
-done:
-  grub_gpt_free (gpt);
   return grub_errno;
 }
 
@@ -182,14 +219,63 @@ grub_gpt_disk_size_valid (grub_disk_t disk)
 }
 
 static void
-grub_gpt_lecrc32 (grub_uint32_t *crc, const void *data, grub_size_t len)
+grub_gpt_init_crc32_table (void)
+{
+  grub_uint32_t c;
+  unsigned i, j;
+
+  for (i = 0; i < 256; i++)
+    {
+      c = i;
+      for (j = 0; j < 8; j++)
+	c = (c >> 1) ^ ((c & 1) ? 0xedb88320 : 0);
+      grub_gpt_crc32_table[0][i] = c;
+    }
+
+  for (i = 0; i < 256; i++)
+    for (j = 1; j < 8; j++)
+      {
+	c = grub_gpt_crc32_table[j - 1][i];
+	grub_gpt_crc32_table[j][i] = (c >> 8) ^ grub_gpt_crc32_table[0][c & 0xff];
+      }
+}
+
+/* Standard (ISO-HDLC) CRC32, eight bytes per step.  */
+static grub_uint32_t
+grub_gpt_crc32 (const void *data, grub_size_t len)
 {
-  grub_uint32_t crc32_val;
+  grub_uint32_t (*t)[256] = grub_gpt_crc32_table;
+  const grub_uint8_t *p = data;
+  grub_uint32_t crc = 0xffffffff;
+
+  if (!t[0][1])
+    grub_gpt_init_crc32_table ();
+
+  for (; len && ((grub_addr_t) p & 3); len--)
+    crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xff];
+
+  for (; len >= 8; len -= 8, p += 8)
+    {
+      grub_uint32_t one, two;
+
+      one = grub_le_to_cpu32 (*(const grub_uint32_t *) p) ^ crc;
+      two = grub_le_to_cpu32 (*(const grub_uint32_t *) (p + 4));
+      crc = (t[7][one & 0xff] ^ t[6][(one >> 8) & 0xff]
+	     ^ t[5][(one >> 16) & 0xff] ^ t[4][one >> 24]
+	     ^ t[3][two & 0xff] ^ t[2][(two >> 8) & 0xff]
+	     ^ t[1][(two >> 16) & 0xff] ^ t[0][two >> 24]);
+    }
 
-  grub_crypto_hash (GRUB_MD_CRC32, &crc32_val, data, len);
+  for (; len; len--)
+    crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xff];
 
-  /* GRUB_MD_CRC32 always uses big endian, gpt is always little.  */
-  *crc = grub_swap_bytes32 (crc32_val);
+  return crc ^ 0xffffffff;
+}
+
+static void
+grub_gpt_lecrc32 (grub_uint32_t *crc, const void *data, grub_size_t len)
+{
+  *crc = grub_cpu_to_le32 (grub_gpt_crc32 (data, len));
 }
 
 static void
@@ -535,8 +621,8 @@ fail:
   return grub_errno;
 }
 
-grub_gpt_t
-grub_gpt_read (grub_disk_t disk)
+static grub_gpt_t
+grub_gpt_read_real (grub_disk_t disk)
 {
   grub_gpt_t gpt;
 
@@ -578,6 +664,114 @@ fail:
   return NULL;
 }
 
+static grub_gpt_t
+grub_gpt_copy (grub_gpt_t gpt)
+{
+  grub_gpt_t copy;
+
+  copy = grub_malloc (sizeof (*copy));
+  if (!copy)
+    return NULL;
+
+  grub_memcpy (copy, gpt, sizeof (*copy));
+  copy->entries = grub_malloc (gpt->entries_size);
+  if (!copy->entries)
+    {
+      grub_free (copy);
+      return NULL;
+    }
+  grub_memcpy (copy->entries, gpt->entries, gpt->entries_size);
+
+  return copy;
+}
+
+static struct grub_gpt_cache *
+grub_gpt_cache_find (grub_disk_t disk)
+{
+  grub_disk_addr_t start = grub_partition_get_start (disk->partition);
+  unsigned i;
+
+  for (i = 0; i < GRUB_GPT_CACHE_SIZE; i++)
+    {
+      struct grub_gpt_cache *c = &grub_gpt_cache[i];
+
+      if (c->gpt && c->dev_id == disk->dev->id && c->disk_id == disk->id
+	  && c->start == start && c->total_sectors == disk->total_sectors)
+	return c;
+    }
+
+  return NULL;
+}
+
+static void
+grub_gpt_cache_drop (struct grub_gpt_cache *c)
+{
+  grub_gpt_free (c->gpt);
+  c->gpt = NULL;
+}
+
+/* Return the table of DISK, owned by the cache.  */
+static grub_gpt_t
+grub_gpt_read_cached (grub_disk_t disk)
+{
+  struct grub_gpt_cache *c, *victim;
+  grub_gpt_t gpt;
+  unsigned i;
+
+  for (i = 0; i < GRUB_GPT_CACHE_SIZE; i++)
+    if (grub_gpt_cache[i].gpt
+	&& grub_gpt_cache[i].generation != grub_disk_generation)
+      grub_gpt_cache_drop (&grub_gpt_cache[i]);
+
+  c = grub_gpt_cache_find (disk);
+  if (c)
+    {
+      grub_dprintf ("gpt", "using cached GPT for %s\n", disk->name);
+      c->last_use = ++grub_gpt_cache_clock;
+      return c->gpt;
+    }
+
+  gpt = grub_gpt_read_real (disk);
+  if (!gpt)
+    return NULL;
+
+  victim = &grub_gpt_cache[0];
+  for (i = 0; i < GRUB_GPT_CACHE_SIZE; i++)
+    {
+      if (!grub_gpt_cache[i].gpt)
+	{
+	  victim = &grub_gpt_cache[i];
+	  break;
+	}
+      if (grub_gpt_cache[i].last_use < victim->last_use)
+	victim = &grub_gpt_cache[i];
+    }
+  if (victim->gpt)
+    grub_gpt_cache_drop (victim);
+
+  victim->gpt = gpt;
+  victim->dev_id = disk->dev->id;
+  victim->disk_id = disk->id;
+  victim->start = grub_partition_get_start (disk->partition);
+  victim->total_sectors = disk->total_sectors;
+  victim->generation = grub_disk_generation;
+  victim->last_use = ++grub_gpt_cache_clock;
+
+  return gpt;
+}
+
+grub_gpt_t
+grub_gpt_read (grub_disk_t disk)
+{
+  grub_gpt_t gpt;
+
+  gpt = grub_gpt_read_cached (disk);
+  if (!gpt)
+    return NULL;
+
+  return grub_gpt_copy (gpt);
+}
+
 struct grub_gpt_partentry *
 grub_gpt_get_partentry (grub_gpt_t gpt, grub_uint32_t n)
 {
@@ -731,12 +925,17 @@ grub_err_t
 grub_gpt_write (grub_disk_t disk, grub_gpt_t gpt)
 {
   grub_uint64_t backup_header;
+  struct grub_gpt_cache *c;
 
   /* TODO: update/repair protective MBRs too.  */
 
   if (!grub_gpt_both_valid (gpt))
     return grub_error (GRUB_ERR_BAD_PART_TABLE, "Invalid GPT data");
 
+  c = grub_gpt_cache_find (disk);
+  if (c)
+    grub_gpt_cache_drop (c);
+
   /* Write the backup GPT first so if writing fails the update is aborted
    * and the primary is left intact.  However if the backup location is
    * inaccessible we have to just skip and hope for the best, the backup
@@ -775,3 +974,11 @@ grub_gpt_free (grub_gpt_t gpt)
   grub_free (gpt->entries);
   grub_free (gpt);
 }
+
+GRUB_MOD_FINI (gpt)
+{
+  unsigned i;
+
+  for (i = 0; i < GRUB_GPT_CACHE_SIZE; i++)
+    grub_gpt_cache_drop (&grub_gpt_cache[i]);
+}
@@ -32,6 +32,91 @@ GRUB_MOD_LICENSE ("GPLv2+");
    must have room for at least DKLEN octets.  The output buffer will
    be filled with the derived data.  */
 
+/* HMAC with the key pads already absorbed.  Hashing the padded key is
+   half of the work of an HMAC on short messages, and PBKDF2 uses the
+   same key for every iteration, so it is done once up front and the
+   resulting digest states are copied for every PRF call.  */
+struct pbkdf2_prf
+{
+  const struct gcry_md_spec *md;
+  grub_size_t ctxsize;
+  void *ictx;
+  void *octx;
+  void *ctx;
+};
+
+static gcry_err_code_t
+pbkdf2_prf_init (struct pbkdf2_prf *prf, const struct gcry_md_spec *md,
+		 const grub_uint8_t *P, grub_size_t Plen)
+{
+  grub_uint8_t *pad;
+  grub_uint8_t *mem;
+  grub_size_t i;
+
+  if (md->mdlen > md->blocksize)
+    return GPG_ERR_INV_ARG;
+
+  /* Keep each context suitably aligned for the digest's state words.  */
+  prf->ctxsize = ALIGN_UP (md->contextsize, sizeof (grub_uint64_t));
+  mem = grub_zalloc (3 * prf->ctxsize + md->blocksize);
+  if (!mem)
+    return GPG_ERR_OUT_OF_MEMORY;
+
+  prf->md = md;
+  prf->ictx = mem;
+  prf->octx = mem + prf->ctxsize;
+  prf->ctx = mem + 2 * prf->ctxsize;
+  pad = mem + 3 * prf->ctxsize;
+
+  if (Plen > md->blocksize)
+    {
+      grub_crypto_hash (md, pad, P, Plen);
+      Plen = md->mdlen;
+    }
+  else
+    grub_memcpy (pad, P, Plen);
+
+  for (i = 0; i < md->blocksize; i++)
+    pad[i] ^= 0x36;
+  md->init (prf->ictx);
+  md->write (prf->ictx, pad, md->blocksize);
+
+  for (i = 0; i < md->blocksize; i++)
+    pad[i] ^= 0x36 ^ 0x5c;
+  md->init (prf->octx);
+  md->write (prf->octx, pad, md->blocksize);
+
+  grub_memset (pad, 0, md->blocksize);
+  return GPG_ERR_NO_ERROR;
+}
+
+/* OUT = HMAC (P, DATA1 || DATA2).  OUT may alias DATA1.  */
+static void
+pbkdf2_prf (struct pbkdf2_prf *prf, const void *data1, grub_size_t len1,
+	    const void *data2, grub_size_t len2, grub_uint8_t *out)
+{
+  const struct gcry_md_spec *md = prf->md;
+
+  grub_memcpy (prf->ctx, prf->ictx, md->contextsize);
+  md->write (prf->ctx, data1, len1);
+  if (len2)
+    md->write (prf->ctx, data2, len2);
+  md->final (prf->ctx);
+  grub_memcpy (out, md->read (prf->ctx), md->mdlen);
+
+  grub_memcpy (prf->ctx, prf->octx, md->contextsize);
+  md->write (prf->ctx, out, md->mdlen);
+  md->final (prf->ctx);
+  grub_memcpy (out, md->read (prf->ctx), md->mdlen);
+}
+
+static void
+pbkdf2_prf_fini (struct pbkdf2_prf *prf)
+{
+  grub_memset (prf->ictx, 0, 3 * prf->ctxsize);
+  grub_free (prf->ictx);
+}
+
 gcry_err_code_t
 grub_crypto_pbkdf2 (const struct gcry_md_spec *md,
 		    const grub_uint8_t *P, grub_size_t Plen,
@@ -42,14 +127,13 @@ grub_crypto_pbkdf2 (const struct gcry_md_spec *md,
   unsigned int hLen = md->mdlen;
   grub_uint8_t U[GRUB_CRYPTO_MAX_MDLEN];
   grub_uint8_t T[GRUB_CRYPTO_MAX_MDLEN];
+  grub_uint8_t idx[4];
+  struct pbkdf2_prf prf;
   unsigned int u;
   unsigned int l;
   unsigned int r;
   unsigned int i;
-  unsigned int k;
   gcry_err_code_t rc;
-  grub_uint8_t *tmp;
-  grub_size_t tmplen = Slen + 4;
 
   if (md->mdlen > GRUB_CRYPTO_MAX_MDLEN || md->mdlen == 0)
     return GPG_ERR_INV_ARG;
@@ -66,44 +150,32 @@ grub_crypto_pbkdf2 (const struct gcry_md_spec *md,
   l = ((dkLen - 1) / hLen) + 1;
   r = dkLen - (l - 1) * hLen;
 
-  tmp = grub_malloc (tmplen);
-  if (tmp == NULL)
-    return GPG_ERR_OUT_OF_MEMORY;
-
-  grub_memcpy (tmp, S, Slen);
+  rc = pbkdf2_prf_init (&prf, md, P, Plen);
+  if (rc != GPG_ERR_NO_ERROR)
+    return rc;
 
   for (i = 1; i - 1 < l; i++)
     {
-      grub_memset (T, 0, hLen);
+      idx[0] = (i & 0xff000000) >> 24;
+      idx[1] = (i & 0x00ff0000) >> 16;
+      idx[2] = (i & 0x0000ff00) >> 8;
+      idx[3] = (i & 0x000000ff) >> 0;
+
+      pbkdf2_prf (&prf, S, Slen, idx, sizeof (idx), U);
+      grub_memcpy (T, U, hLen);
 
-      for (u = 0; u < c; u++)
+      for (u = 1; u < c; u++)
 	{
-	  if (u == 0)
-	    {
-	      tmp[Slen + 0] = (i & 0xff000000) >> 24;
-	      tmp[Slen + 1] = (i & 0x00ff0000) >> 16;
-	      tmp[Slen + 2] = (i & 0x0000ff00) >> 8;
-	      tmp[Slen + 3] = (i & 0x000000ff) >> 0;
-
-	      rc = grub_crypto_hmac_buffer (md, P, Plen, tmp, tmplen, U);
-	    }
-	  else
-	    rc = grub_crypto_hmac_buffer (md, P, Plen, U, hLen, U);
-
-	  if (rc != GPG_ERR_NO_ERROR)
-	    {
-	      grub_free (tmp);
-	      return rc;
-	    }
-
-	  for (k = 0; k < hLen; k++)
-	    T[k] ^= U[k];
+	  pbkdf2_prf (&prf, U, hLen, NULL, 0, U);
+	  grub_crypto_xor (T, T, U, hLen);
 	}
 
       grub_memcpy (DK + (i - 1) * hLen, T, i == l ? r : hLen);
     }
 
-  grub_free (tmp);
+  pbkdf2_prf_fini (&prf);
+  grub_memset (U, 0, sizeof (U));
+  grub_memset (T, 0, sizeof (T));
 
   return GPG_ERR_NO_ERROR;
 }
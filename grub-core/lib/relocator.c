@@ -439,6 +439,9 @@ malloc_in_range (struct grub_relocator *rel,
   if (end < start + size)
     return 0;
 
+  /* Memory on the size class lists is not in the free rings.  */
+  grub_mm_flush_caches ();
+
   /* We have to avoid any allocations when filling scanline events. 
      Hence 2-stages.
    */
@@ -1638,9 +1641,9 @@ grub_mm_check_real (const char *file, int line)
   for (r = grub_mm_base; r; r = r->next)
     {
       pa = r->first;
-      p = pa->next;
-      if (p->magic == GRUB_MM_ALLOC_MAGIC)
+      if (pa->magic != GRUB_MM_FREE_MAGIC)
 	continue;
+      p = pa->next;
       do 
 	{
 	  if ((grub_addr_t) p < (grub_addr_t) (r + 1)
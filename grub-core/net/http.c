@@ -24,6 +24,7 @@
 #include <grub/net.h>
 #include <grub/mm.h>
 #include <grub/dl.h>
+#include <grub/env.h>
 #include <grub/file.h>
 #include <grub/i18n.h>
 
@@ -31,26 +32,93 @@ GRUB_MOD_LICENSE ("GPLv3+");
 
 enum
   {
-    HTTP_PORT = 80
+    HTTP_PORT = 80,
+    /* Connections one file may fetch ranges on, see `http_connections'.  */
+    HTTP_MAX_CONNECTIONS = 8,
+    /* Idle keep-alive connections kept for later requests.  */
+    HTTP_MAX_IDLE = HTTP_MAX_CONNECTIONS,
+    /* Times a request is sent before the transfer is given up.  */
+    HTTP_MAX_TRIES = 3
   };
 
+/* Size of the ranges a file is split into when it is fetched over
+   several connections.  */
+#define HTTP_RANGE_SIZE (1024 * 1024)
+/* Size of the first range asked for after a seek.  An aborted response
+   with no more than this left is read to its end rather than closing
+   the connection.  */
+#define HTTP_SEEK_RANGE (64 * 1024)
 
-typedef struct http_data
+struct http_req;
+
+/* A connection to a server.  Once a response has been received in full
+   and the server agrees to keep the connection open it goes to the idle
+   pool, where the next request to the same server picks it up.  */
+struct http_conn
+{
+  struct http_conn *next;
+  char *server;
+  int port;
+  grub_net_tcp_socket_t sock;
+  /* The request the incoming response belongs to, NULL when idle.  */
+  struct http_req *req;
+  /* Bytes left of an abandoned response.  */
+  grub_off_t drain;
+};
+
+/* A GET for the bytes of a file from POS up to END.  */
+struct http_req
 {
+  struct http_req *next;
+  grub_file_t file;
+  struct http_conn *conn;
+  /* The next file offset expected from the response, and the offset it
+     stops at, GRUB_FILE_SIZE_UNKNOWN for the end of the file.  */
+  grub_off_t pos;
+  grub_off_t end;
+  /* The response body length and the part of it received so far.  */
+  grub_off_t length;
+  grub_off_t received;
+  /* Body bytes in front of POS, when the server ignored the range.  */
+  grub_off_t skip;
   char *current_line;
   grub_size_t current_line_len;
   int headers_recv;
   int first_line_recv;
-  int size_recv;
-  grub_net_tcp_socket_t sock;
-  char *filename;
-  grub_err_t err;
-  char *errmsg;
+  int status;
+  int keep_alive;
   int chunked;
   grub_size_t chunk_rem;
   int in_chunk_len;
+  int tries;
+  /* The response has been received.  */
+  int complete;
+  /* The response carries no file data, or the transfer was given up.  */
+  int failed;
+  /* Body received while the requests in front of this one are still
+     being received.  */
+  grub_net_packets_t packs;
+};
+
+typedef struct http_data
+{
+  char *filename;
+  /* Outstanding requests in file order.  The body of the first one goes
+     straight to the packets of the file.  */
+  struct http_req *reqs;
+  /* Where the next range to request starts.  */
+  grub_off_t next_start;
+  int connections;
+  /* A connection is being opened, the receive path must not send
+     requests meanwhile.  */
+  int opening;
+  int headers_recv;
+  grub_err_t err;
+  char *errmsg;
 } *http_data_t;
 
+static struct http_conn *idle_conns;
+
 static grub_off_t
 have_ahead (struct grub_file *file)
 {
@@ -62,121 +130,470 @@ have_ahead (struct grub_file *file)
   return ret;
 }
 
+static void
+free_packets (grub_net_packets_t *packs)
+{
+  while (packs->first)
+    {
+      grub_netbuff_free (packs->first->nb);
+      grub_net_remove_packet (packs->first);
+    }
+}
+
+static void
+http_conn_close (struct http_conn *conn, int discard_received)
+{
+  struct http_conn **prev;
+
+  for (prev = &idle_conns; *prev; prev = &(*prev)->next)
+    if (*prev == conn)
+      {
+	*prev = conn->next;
+	break;
+      }
+  grub_net_tcp_close (conn->sock, discard_received);
+  grub_free (conn->server);
+  grub_free (conn);
+}
+
+/* Give CONN back once its response is complete.  */
+static void
+http_conn_release (struct http_conn *conn, int keep_alive)
+{
+  struct http_conn *c;
+  int idle = 0;
+
+  conn->req = NULL;
+  for (c = idle_conns; c; c = c->next)
+    idle++;
+  if (!keep_alive || idle >= HTTP_MAX_IDLE)
+    {
+      http_conn_close (conn, GRUB_NET_TCP_DISCARD);
+      return;
+    }
+  grub_net_tcp_unstall (conn->sock);
+  conn->next = idle_conns;
+  idle_conns = conn;
+}
+
+static int
+http_port (grub_file_t file)
+{
+  if (file->device->net->port)
+    return file->device->net->port;
+  return HTTP_PORT;
+}
+
+/* Take an idle connection to the server of FILE out of the pool.  */
+static struct http_conn *
+http_conn_get (grub_file_t file)
+{
+  struct http_conn **prev, *conn;
+
+  for (prev = &idle_conns; *prev; prev = &(*prev)->next)
+    {
+      conn = *prev;
+      if (conn->port == http_port (file)
+	  && grub_strcmp (conn->server, file->device->net->server) == 0)
+	{
+	  *prev = conn->next;
+	  conn->next = NULL;
+	  return conn;
+	}
+    }
+  return NULL;
+}
+
+static void
+http_advance (grub_file_t file);
+
+static void
+http_fill (grub_file_t file, int may_open);
+
+/* Stop waiting for REQ: the file ends where the data received so far
+   ends.  */
+static void
+http_req_fail (struct http_req *req)
+{
+  grub_file_t file = req->file;
+
+  req->complete = 1;
+  req->failed = 1;
+  file->device->net->eof = 1;
+  file->device->net->stall = 1;
+  if (file->size == GRUB_FILE_SIZE_UNKNOWN)
+    file->size = have_ahead (file);
+}
+
+static void
+http_req_finish (struct http_req *req)
+{
+  grub_file_t file = req->file;
+  struct http_conn *conn = req->conn;
+
+  req->complete = 1;
+  req->conn = NULL;
+  if (conn)
+    http_conn_release (conn, req->keep_alive);
+  if (req->failed)
+    {
+      http_req_fail (req);
+      return;
+    }
+  if (req->end == GRUB_FILE_SIZE_UNKNOWN
+      && file->size == GRUB_FILE_SIZE_UNKNOWN)
+    file->size = req->pos;
+  http_advance (file);
+  http_fill (file, 0);
+}
+
+static void
+http_req_free (struct http_req *req)
+{
+  struct http_conn *conn = req->conn;
+
+  if (conn && req->headers_recv && !req->chunked && req->keep_alive
+      && req->length != GRUB_FILE_SIZE_UNKNOWN
+      && req->length - req->received <= HTTP_SEEK_RANGE)
+    {
+      conn->drain = req->length - req->received;
+      http_conn_release (conn, 1);
+    }
+  else if (conn)
+    {
+      conn->req = NULL;
+      http_conn_close (conn, GRUB_NET_TCP_ABORT);
+    }
+  free_packets (&req->packs);
+  grub_free (req->current_line);
+  grub_free (req);
+}
+
+/* Drop the completed requests at the head of the queue, passing the
+   body the next one has buffered on to the file.  */
+static void
+http_advance (grub_file_t file)
+{
+  http_data_t data = file->data;
+  grub_net_t net = file->device->net;
+  struct http_req *req;
+
+  while (data->reqs && data->reqs->complete && !data->reqs->failed)
+    {
+      req = data->reqs;
+      data->reqs = req->next;
+      http_req_free (req);
+
+      req = data->reqs;
+      if (!req)
+	break;
+      while (req->packs.first)
+	{
+	  grub_net_put_file_data (file, req->packs.first->nb);
+	  grub_net_remove_packet (req->packs.first);
+	}
+      if (net->packs.count >= 20)
+	net->stall = 1;
+    }
+
+  if (!data->reqs && data->next_start >= file->size)
+    {
+      net->eof = 1;
+      net->stall = 1;
+    }
+}
+
+static int
+header_is (char **ptr, const char *name)
+{
+  grub_size_t len = grub_strlen (name);
+
+  if (grub_strncasecmp (*ptr, name, len) != 0 || (*ptr)[len] != ':')
+    return 0;
+  *ptr += len + 1;
+  while (**ptr == ' ' || **ptr == '\t')
+    (*ptr)++;
+  return 1;
+}
+
 static grub_err_t
-parse_line (grub_file_t file, http_data_t data, char *ptr, grub_size_t len)
+parse_line (struct http_req *req, char *ptr, grub_size_t len)
 {
+  grub_file_t file = req->file;
+  http_data_t data = file->data;
   char *end = ptr + len;
   while (end > ptr && *(end - 1) == '\r')
     end--;
   *end = 0;
   /* Trailing CRLF.  */
-  if (data->in_chunk_len == 1)
+  if (req->in_chunk_len == 1)
     {
-      data->in_chunk_len = 2;
+      req->in_chunk_len = 2;
       return GRUB_ERR_NONE;
     }
-  if (data->in_chunk_len == 2)
+  if (req->in_chunk_len == 2)
     {
-      data->chunk_rem = grub_strtoul (ptr, 0, 16);
+      req->chunk_rem = grub_strtoul (ptr, 0, 16);
       grub_errno = GRUB_ERR_NONE;
-      if (data->chunk_rem == 0)
-	{
-	  file->device->net->eof = 1;
-	  file->device->net->stall = 1;
-	  if (file->size == GRUB_FILE_SIZE_UNKNOWN)
-	    file->size = have_ahead (file);
-	}
-      data->in_chunk_len = 0;
+      if (req->chunk_rem == 0)
+	req->in_chunk_len = 3;
+      else
+	req->in_chunk_len = 0;
+      return GRUB_ERR_NONE;
+    }
+  /* Trailer after the last chunk.  */
+  if (req->in_chunk_len == 3)
+    {
+      if (ptr == end)
+	req->complete = 1;
       return GRUB_ERR_NONE;
     }
   if (ptr == end)
     {
+      req->headers_recv = 1;
       data->headers_recv = 1;
-      if (data->chunked)
-	data->in_chunk_len = 2;
+      if (req->chunked)
+	req->in_chunk_len = 2;
+      else if (req->length == req->received)
+	req->complete = 1;
       return GRUB_ERR_NONE;
     }
 
-  if (!data->first_line_recv)
+  if (!req->first_line_recv)
     {
       int code;
-      if (grub_memcmp (ptr, "HTTP/1.1 ", sizeof ("HTTP/1.1 ") - 1) != 0)
-	{
-	  data->errmsg = grub_strdup (_("unsupported HTTP response"));
-	  data->first_line_recv = 1;
-	  return GRUB_ERR_NONE;
-	}
+      req->first_line_recv = 1;
+      if (grub_memcmp (ptr, "HTTP/1.1 ", sizeof ("HTTP/1.1 ") - 1) == 0)
+	req->keep_alive = 1;
+      else if (grub_memcmp (ptr, "HTTP/1.0 ", sizeof ("HTTP/1.0 ") - 1) != 0)
+	return GRUB_ERR_NONE;
       ptr += sizeof ("HTTP/1.1 ") - 1;
       code = grub_strtoul (ptr, &ptr, 10);
       if (grub_errno)
 	return grub_errno;
+      req->status = code;
       switch (code)
 	{
 	case 200:
+	  /* The whole file, whatever range was asked for.  When nothing
+	     else is outstanding take the rest of the file from here.  */
+	  req->skip = req->pos;
+	  if (req == data->reqs && !req->next)
+	    {
+	      req->end = GRUB_FILE_SIZE_UNKNOWN;
+	      data->next_start = GRUB_FILE_SIZE_UNKNOWN;
+	    }
+	  break;
 	case 206:
 	  break;
+	case 416:
+	  /* Nothing left at this offset.  */
+	  req->end = req->pos;
+	  if (file->size == GRUB_FILE_SIZE_UNKNOWN)
+	    file->size = req->pos;
+	  break;
 	case 404:
+	  req->failed = 1;
 	  data->err = GRUB_ERR_FILE_NOT_FOUND;
-	  data->errmsg = grub_xasprintf (_("file `%s' not found"), data->filename);
+	  grub_free (data->errmsg);
+	  data->errmsg = grub_xasprintf (_("file `%s' not found"),
+					 data->filename);
 	  return GRUB_ERR_NONE;
 	default:
+	  req->failed = 1;
 	  data->err = GRUB_ERR_NET_UNKNOWN_ERROR;
+	  grub_free (data->errmsg);
 	  /* TRANSLATORS: GRUB HTTP code is pretty young. So even perfectly
 	     valid answers like 403 will trigger this very generic message.  */
 	  data->errmsg = grub_xasprintf (_("unsupported HTTP error %d: %s"),
 					 code, ptr);
 	  return GRUB_ERR_NONE;
 	}
-      data->first_line_recv = 1;
       return GRUB_ERR_NONE;
     }
-  if (grub_memcmp (ptr, "Content-Length: ", sizeof ("Content-Length: ") - 1)
-      == 0 && !data->size_recv)
+  if (header_is (&ptr, "Content-Length"))
+    {
+      req->length = grub_strtoull (ptr, &ptr, 10);
+      if (grub_errno)
+	{
+	  req->length = GRUB_FILE_SIZE_UNKNOWN;
+	  grub_errno = GRUB_ERR_NONE;
+	}
+      else if (req->status == 200 && file->size == GRUB_FILE_SIZE_UNKNOWN)
+	file->size = req->length;
+      return GRUB_ERR_NONE;
+    }
+  if (header_is (&ptr, "Content-Range"))
     {
-      ptr += sizeof ("Content-Length: ") - 1;
-      file->size = grub_strtoull (ptr, &ptr, 10);
-      data->size_recv = 1;
+      grub_off_t first;
+
+      if (grub_strncasecmp (ptr, "bytes ", sizeof ("bytes ") - 1) != 0)
+	return GRUB_ERR_NONE;
+      ptr += sizeof ("bytes ") - 1;
+      if (*ptr != '*' && req->status == 206)
+	{
+	  first = grub_strtoull (ptr, &ptr, 10);
+	  if (grub_errno || first > req->pos)
+	    {
+	      grub_errno = GRUB_ERR_NONE;
+	      req->failed = 1;
+	      return GRUB_ERR_NONE;
+	    }
+	  req->skip = req->pos - first;
+	}
+      ptr = grub_strchr (ptr, '/');
+      if (ptr && ptr[1] != '*')
+	{
+	  grub_off_t total = grub_strtoull (ptr + 1, 0, 10);
+	  if (grub_errno)
+	    grub_errno = GRUB_ERR_NONE;
+	  else if (file->size == GRUB_FILE_SIZE_UNKNOWN)
+	    file->size = total;
+	}
       return GRUB_ERR_NONE;
     }
-  if (grub_memcmp (ptr, "Transfer-Encoding: chunked",
-		   sizeof ("Transfer-Encoding: chunked") - 1) == 0)
+  if (header_is (&ptr, "Transfer-Encoding"))
     {
-      data->chunked = 1;
+      if (grub_strncasecmp (ptr, "chunked", sizeof ("chunked") - 1) == 0)
+	req->chunked = 1;
+      return GRUB_ERR_NONE;
+    }
+  if (header_is (&ptr, "Connection"))
+    {
+      if (grub_strncasecmp (ptr, "close", sizeof ("close") - 1) == 0)
+	req->keep_alive = 0;
+      else if (grub_strncasecmp (ptr, "keep-alive",
+				 sizeof ("keep-alive") - 1) == 0)
+	req->keep_alive = 1;
       return GRUB_ERR_NONE;
     }
 
   return GRUB_ERR_NONE;  
 }
 
+/* The connection of CONN went away.  With FIN set the server closed it,
+   which ends a response without length.  */
+static void
+http_conn_lost (struct http_conn *conn, int fin)
+{
+  struct http_req *req = conn->req;
+
+  conn->req = NULL;
+  http_conn_close (conn, fin ? GRUB_NET_TCP_DISCARD : GRUB_NET_TCP_ABORT);
+  if (!req)
+    return;
+  req->conn = NULL;
+  if (fin && req->headers_recv && !req->chunked
+      && req->length == GRUB_FILE_SIZE_UNKNOWN)
+    {
+      req->keep_alive = 0;
+      http_req_finish (req);
+      return;
+    }
+  /* Otherwise the request is sent again for what is missing.  */
+  if (req->tries >= HTTP_MAX_TRIES || req->failed)
+    http_req_fail (req);
+}
+
 static void
 http_err (grub_net_tcp_socket_t sock __attribute__ ((unused)),
-	  void *f)
+	  void *c)
+{
+  http_conn_lost (c, 0);
+}
+
+static void
+http_fin (grub_net_tcp_socket_t sock __attribute__ ((unused)),
+	  void *c)
+{
+  http_conn_lost (c, 1);
+}
+
+/* Pass the body bytes in NB on to the file, dropping those outside the
+   range of REQ.  */
+static void
+http_deliver (struct http_req *req, struct grub_net_buff *nb)
 {
-  grub_file_t file = f;
+  grub_file_t file = req->file;
   http_data_t data = file->data;
+  grub_net_t net = file->device->net;
+  grub_size_t len = nb->tail - nb->data;
 
-  if (data->sock)
-    grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
-  data->sock = 0;
-  if (data->current_line)
-    grub_free (data->current_line);
-  data->current_line = 0;
-  file->device->net->eof = 1;
-  file->device->net->stall = 1;
-  if (file->size == GRUB_FILE_SIZE_UNKNOWN)
-    file->size = have_ahead (file);
+  if (req->skip)
+    {
+      grub_size_t n = len;
+      if (n > req->skip)
+	n = req->skip;
+      grub_netbuff_pull (nb, n);
+      req->skip -= n;
+      len -= n;
+    }
+  if (req->end != GRUB_FILE_SIZE_UNKNOWN && len > req->end - req->pos)
+    {
+      grub_netbuff_unput (nb, len - (req->end - req->pos));
+      len = req->end - req->pos;
+    }
+  if (!len || req->failed)
+    {
+      grub_netbuff_free (nb);
+      return;
+    }
+  req->pos += len;
+
+  if (req != data->reqs)
+    {
+      if (grub_net_put_packet (&req->packs, nb))
+	grub_netbuff_free (nb);
+      return;
+    }
+
+  grub_net_put_file_data (file, nb);
+  if (net->packs.count >= 20)
+    net->stall = 1;
+
+  if (net->packs.count >= 100 && req->conn)
+    grub_net_tcp_stall (req->conn->sock);
+}
+
+/* Once REQ has got its range the rest of a whole file response is not
+   worth waiting for.  */
+static int
+http_cut_short (struct http_req *req)
+{
+  struct http_conn *conn = req->conn;
+
+  if (req->status != 200 || req->end == GRUB_FILE_SIZE_UNKNOWN
+      || req->pos < req->end)
+    return 0;
+  req->conn = NULL;
+  if (conn)
+    {
+      conn->req = NULL;
+      http_conn_close (conn, GRUB_NET_TCP_ABORT);
+    }
+  http_req_finish (req);
+  return 1;
 }
 
 static grub_err_t
 http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
 	      struct grub_net_buff *nb,
-	      void *f)
+	      void *c)
 {
-  grub_file_t file = f;
-  http_data_t data = file->data;
+  struct http_conn *conn = c;
+  struct http_req *req = conn->req;
   grub_err_t err;
 
-  if (!data->sock)
+  if (conn->drain)
+    {
+      grub_size_t n = nb->tail - nb->data;
+      if (n > conn->drain)
+	n = conn->drain;
+      grub_netbuff_pull (nb, n);
+      conn->drain -= n;
+    }
+
+  if (!req || req->complete || nb->tail == nb->data)
     {
       grub_netbuff_free (nb);
       return GRUB_ERR_NONE;
@@ -185,7 +602,7 @@ http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
   while (1)
     {
       char *ptr = (char *) nb->data;
-      if ((!data->headers_recv || data->in_chunk_len) && data->current_line)
+      if ((!req->headers_recv || req->in_chunk_len) && req->current_line)
 	{
 	  int have_line = 1;
 	  char *t;
@@ -197,119 +614,185 @@ http_receive (grub_net_tcp_socket_t sock __attribute__ ((unused)),
 	      have_line = 0;
 	      ptr = (char *) nb->tail;
 	    }
-	  t = grub_realloc (data->current_line,
-			    data->current_line_len + (ptr - (char *) nb->data));
+	  t = grub_realloc (req->current_line,
+			    req->current_line_len + (ptr - (char *) nb->data));
 	  if (!t)
 	    {
 	      grub_netbuff_free (nb);
-	      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+	      http_conn_lost (conn, 0);
 	      return grub_errno;
 	    }
 	      
-	  data->current_line = t;
-	  grub_memcpy (data->current_line + data->current_line_len,
+	  req->current_line = t;
+	  grub_memcpy (req->current_line + req->current_line_len,
 		       nb->data, ptr - (char *) nb->data);
-	  data->current_line_len += ptr - (char *) nb->data;
+	  req->current_line_len += ptr - (char *) nb->data;
 	  if (!have_line)
 	    {
 	      grub_netbuff_free (nb);
 	      return GRUB_ERR_NONE;
 	    }
-	  err = parse_line (file, data, data->current_line,
-			    data->current_line_len);
-	  grub_free (data->current_line);
-	  data->current_line = 0;
-	  data->current_line_len = 0;
+	  err = parse_line (req, req->current_line, req->current_line_len);
+	  grub_free (req->current_line);
+	  req->current_line = 0;
+	  req->current_line_len = 0;
 	  if (err)
 	    {
-	      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
 	      grub_netbuff_free (nb);
+	      http_conn_lost (conn, 0);
 	      return err;
 	    }
 	}
 
-      while (ptr < (char *) nb->tail && (!data->headers_recv
-					 || data->in_chunk_len))
+      while (ptr < (char *) nb->tail && !req->complete
+	     && (!req->headers_recv || req->in_chunk_len))
 	{
 	  char *ptr2;
 	  ptr2 = grub_memchr (ptr, '\n', (char *) nb->tail - ptr);
 	  if (!ptr2)
 	    {
-	      data->current_line = grub_malloc ((char *) nb->tail - ptr);
-	      if (!data->current_line)
+	      req->current_line = grub_malloc ((char *) nb->tail - ptr);
+	      if (!req->current_line)
 		{
 		  grub_netbuff_free (nb);
-		  grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+		  http_conn_lost (conn, 0);
 		  return grub_errno;
 		}
-	      data->current_line_len = (char *) nb->tail - ptr;
-	      grub_memcpy (data->current_line, ptr, data->current_line_len);
+	      req->current_line_len = (char *) nb->tail - ptr;
+	      grub_memcpy (req->current_line, ptr, req->current_line_len);
 	      grub_netbuff_free (nb);
 	      return GRUB_ERR_NONE;
 	    }
-	  err = parse_line (file, data, ptr, ptr2 - ptr);
+	  err = parse_line (req, ptr, ptr2 - ptr);
 	  if (err)
 	    {
-	      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
 	      grub_netbuff_free (nb);
+	      http_conn_lost (conn, 0);
 	      return err;
 	    }
 	  ptr = ptr2 + 1;
 	}
 
-      if (((char *) nb->tail - ptr) <= 0)
+      if (req->complete || ((char *) nb->tail - ptr) <= 0)
 	{
 	  grub_netbuff_free (nb);
+	  if (req->complete)
+	    http_req_finish (req);
 	  return GRUB_ERR_NONE;
 	} 
       err = grub_netbuff_pull (nb, ptr - (char *) nb->data);
       if (err)
 	{
-	  grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
 	  grub_netbuff_free (nb);
+	  http_conn_lost (conn, 0);
 	  return err;
 	}
-      if (!(data->chunked && (grub_ssize_t) data->chunk_rem
-	    < nb->tail - nb->data))
+      if (!req->chunked)
 	{
-	  grub_net_put_packet (&file->device->net->packs, nb);
-	  if (file->device->net->packs.count >= 20)
-	    file->device->net->stall = 1;
-
-	  if (file->device->net->packs.count >= 100)
-	    grub_net_tcp_stall (data->sock);
+	  grub_size_t len = nb->tail - nb->data;
 
-	  if (data->chunked)
-	    data->chunk_rem -= nb->tail - nb->data;
+	  if (req->length != GRUB_FILE_SIZE_UNKNOWN
+	      && len > req->length - req->received)
+	    {
+	      grub_netbuff_unput (nb, len - (req->length - req->received));
+	      len = req->length - req->received;
+	    }
+	  req->received += len;
+	  http_deliver (req, nb);
+	  if (req->received == req->length)
+	    http_req_finish (req);
+	  else
+	    http_cut_short (req);
+	  return GRUB_ERR_NONE;
+	}
+      if (req->chunk_rem >= (grub_size_t) (nb->tail - nb->data))
+	{
+	  req->chunk_rem -= nb->tail - nb->data;
+	  http_deliver (req, nb);
+	  http_cut_short (req);
 	  return GRUB_ERR_NONE;
 	}
-      if (data->chunk_rem)
+      if (req->chunk_rem)
 	{
 	  struct grub_net_buff *nb2;
-	  nb2 = grub_netbuff_alloc (data->chunk_rem);
-	  if (!nb2)
-	    return grub_errno;
-	  grub_netbuff_put (nb2, data->chunk_rem);
-	  grub_memcpy (nb2->data, nb->data, data->chunk_rem);
-	  if (file->device->net->packs.count >= 20)
+	  grub_size_t rest = (nb->tail - nb->data) - req->chunk_rem;
+
+	  /* Copy whichever side of the chunk end is smaller, the other one
+	     keeps the packet.  */
+	  if (rest <= req->chunk_rem)
 	    {
-	      file->device->net->stall = 1;
-	      grub_net_tcp_stall (data->sock);
+	      nb2 = grub_netbuff_alloc (rest);
+	      if (!nb2)
+		{
+		  grub_netbuff_free (nb);
+		  http_conn_lost (conn, 0);
+		  return grub_errno;
+		}
+	      grub_netbuff_put (nb2, rest);
+	      grub_memcpy (nb2->data, nb->data + req->chunk_rem, rest);
+	      grub_netbuff_unput (nb, rest);
+	      http_deliver (req, nb);
+	      nb = nb2;
+	    }
+	  else
+	    {
+	      nb2 = grub_netbuff_alloc (req->chunk_rem);
+	      if (!nb2)
+		{
+		  grub_netbuff_free (nb);
+		  http_conn_lost (conn, 0);
+		  return grub_errno;
+		}
+	      grub_netbuff_put (nb2, req->chunk_rem);
+	      grub_memcpy (nb2->data, nb->data, req->chunk_rem);
+	      grub_netbuff_pull (nb, req->chunk_rem);
+	      http_deliver (req, nb2);
+	    }
+	  req->chunk_rem = 0;
+	  if (http_cut_short (req))
+	    {
+	      grub_netbuff_free (nb);
+	      return GRUB_ERR_NONE;
 	    }
-
-	  grub_net_put_packet (&file->device->net->packs, nb2);
-	  grub_netbuff_pull (nb, data->chunk_rem);
 	}
-      data->in_chunk_len = 1;
+      req->in_chunk_len = 1;
     }
 }
 
+static struct http_conn *
+http_conn_open (grub_file_t file)
+{
+  struct http_conn *conn;
+
+  conn = grub_zalloc (sizeof (*conn));
+  if (!conn)
+    return NULL;
+  conn->server = grub_strdup (file->device->net->server);
+  if (!conn->server)
+    {
+      grub_free (conn);
+      return NULL;
+    }
+  conn->port = http_port (file);
+  conn->sock = grub_net_tcp_open (file->device->net->server,
+				  conn->port, http_receive,
+				  http_err, http_fin,
+				  conn);
+  if (!conn->sock)
+    {
+      grub_free (conn->server);
+      grub_free (conn);
+      return NULL;
+    }
+  return conn;
+}
+
 static grub_err_t
-http_establish (struct grub_file *file, grub_off_t offset, int initial)
+http_send_request (struct http_req *req, struct http_conn *conn)
 {
+  grub_file_t file = req->file;
   http_data_t data = file->data;
   grub_uint8_t *ptr;
-  int i, port;
   struct grub_net_buff *nb;
   grub_err_t err;
 
@@ -321,7 +804,7 @@ http_establish (struct grub_file *file, grub_off_t offset, int initial)
 			   + sizeof ("\r\nUser-Agent: " PACKAGE_STRING
 				     "\r\n") - 1
 			   + sizeof ("Range: bytes=XXXXXXXXXXXXXXXXXXXX"
-				     "-\r\n\r\n"));
+				     "-XXXXXXXXXXXXXXXXXXXX\r\n\r\n"));
   if (!nb)
     return grub_errno;
 
@@ -376,123 +859,256 @@ http_establish (struct grub_file *file, grub_off_t offset, int initial)
     }
   grub_memcpy (ptr, "\r\nUser-Agent: " PACKAGE_STRING "\r\n",
 	       sizeof ("\r\nUser-Agent: " PACKAGE_STRING "\r\n") - 1);
-  if (!initial)
+  if (req->end != GRUB_FILE_SIZE_UNKNOWN)
+    {
+      ptr = nb->tail;
+      grub_snprintf ((char *) ptr,
+		     sizeof ("Range: bytes=XXXXXXXXXXXXXXXXXXXX-"
+			     "XXXXXXXXXXXXXXXXXXXX\r\n"),
+		     "Range: bytes=%" PRIuGRUB_UINT64_T "-%"
+		     PRIuGRUB_UINT64_T "\r\n", req->pos, req->end - 1);
+      grub_netbuff_put (nb, grub_strlen ((char *) ptr));
+    }
+  else if (req->pos)
     {
       ptr = nb->tail;
       grub_snprintf ((char *) ptr,
 		     sizeof ("Range: bytes=XXXXXXXXXXXXXXXXXXXX-"
 			     "\r\n"),
 		     "Range: bytes=%" PRIuGRUB_UINT64_T "-\r\n",
-		     offset);
+		     req->pos);
       grub_netbuff_put (nb, grub_strlen ((char *) ptr));
     }
   ptr = nb->tail;
   grub_netbuff_put (nb, 2);
   grub_memcpy (ptr, "\r\n", 2);
 
-  if (file->device->net->port)
-    port = file->device->net->port;
-  else
-    port = HTTP_PORT;
-  data->sock = grub_net_tcp_open (file->device->net->server,
-				  port, http_receive,
-				  http_err, http_err,
-				  file);
-  if (!data->sock)
-    {
-      grub_netbuff_free (nb);
-      return grub_errno;
-    }
-
-  //  grub_net_poll_cards (5000);
+  grub_free (req->current_line);
+  req->current_line = 0;
+  req->current_line_len = 0;
+  req->headers_recv = 0;
+  req->first_line_recv = 0;
+  req->status = 0;
+  req->keep_alive = 0;
+  req->chunked = 0;
+  req->chunk_rem = 0;
+  req->in_chunk_len = 0;
+  req->length = GRUB_FILE_SIZE_UNKNOWN;
+  req->received = 0;
+  req->skip = 0;
 
-  err = grub_net_send_tcp_packet (data->sock, nb, 1);
+  req->conn = conn;
+  conn->req = req;
+  err = grub_net_send_tcp_packet (conn->sock, nb, 1);
   if (err)
     {
-      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
+      req->conn = NULL;
+      conn->req = NULL;
+      http_conn_close (conn, GRUB_NET_TCP_ABORT);
       return err;
     }
+  return GRUB_ERR_NONE;
+}
 
-  for (i = 0; !data->headers_recv && i < 100; i++)
+/* Send REQ on an idle connection to its server, or on a new one if
+   MAY_OPEN is set.  Opening waits for the handshake, so it is not done
+   from the receive path.  Returns whether the request went out.  */
+static int
+http_issue (struct http_req *req, int may_open)
+{
+  http_data_t data = req->file->data;
+  struct http_conn *conn;
+
+  conn = http_conn_get (req->file);
+  if (!conn && !may_open)
+    return 0;
+  if (req->tries++ >= HTTP_MAX_TRIES)
     {
-      grub_net_tcp_retransmit ();
-      grub_net_poll_cards (300, &data->headers_recv);
+      if (conn)
+	http_conn_release (conn, 1);
+      http_req_fail (req);
+      return 0;
     }
+  if (!conn)
+    {
+      data->opening = 1;
+      conn = http_conn_open (req->file);
+      data->opening = 0;
+    }
+  if (!conn)
+    return 0;
+  return http_send_request (req, conn) == GRUB_ERR_NONE;
+}
 
-  if (!data->headers_recv)
+/* Resend the requests which lost their connection and, while fewer than
+   `http_connections' requests are outstanding, ask for the next range.  */
+static void
+http_fill (grub_file_t file, int may_open)
+{
+  http_data_t data = file->data;
+  struct http_req *req, **last;
+  int count;
+
+  if (data->opening)
+    return;
+  while (1)
     {
-      grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
-      if (data->err)
+      count = 0;
+      for (last = &data->reqs; *last; last = &(*last)->next)
+	count++;
+      for (req = data->reqs; req; req = req->next)
+	if (!req->conn && !req->complete)
+	  break;
+      if (!req && count < data->connections
+	  && file->size != GRUB_FILE_SIZE_UNKNOWN
+	  && data->next_start < file->size)
 	{
-	  char *str = data->errmsg;
-	  err = grub_error (data->err, "%s", str);
-	  grub_free (str);
-	  data->errmsg = 0;
-	  return data->err;
+	  req = grub_zalloc (sizeof (*req));
+	  if (!req)
+	    {
+	      grub_errno = GRUB_ERR_NONE;
+	      return;
+	    }
+	  req->file = file;
+	  req->pos = data->next_start;
+	  req->end = file->size;
+	  if (data->connections > 1 && req->pos + HTTP_RANGE_SIZE < req->end)
+	    req->end = req->pos + HTTP_RANGE_SIZE;
+	  data->next_start = req->end;
+	  *last = req;
+	}
+      if (!req)
+	return;
+      if (!http_issue (req, may_open))
+	{
+	  grub_errno = GRUB_ERR_NONE;
+	  return;
 	}
-      return grub_error (GRUB_ERR_TIMEOUT, N_("time out opening `%s'"), data->filename);
     }
-  return GRUB_ERR_NONE;
 }
 
+static void
+http_abort (http_data_t data)
+{
+  struct http_req *req;
+
+  while (data->reqs)
+    {
+      req = data->reqs;
+      data->reqs = req->next;
+      http_req_free (req);
+    }
+}
+
+/* Ask for FILE from OFF on and wait for the response headers.  */
 static grub_err_t
-http_seek (struct grub_file *file, grub_off_t off)
+http_establish (struct grub_file *file, grub_off_t off)
 {
-  struct http_data *old_data, *data;
+  http_data_t data = file->data;
+  struct http_req *req;
   grub_err_t err;
-  old_data = file->data;
-  /* FIXME: Reuse socket?  */
-  if (old_data->sock)
-    grub_net_tcp_close (old_data->sock, GRUB_NET_TCP_ABORT);
-  old_data->sock = 0;
+  int i;
 
-  while (file->device->net->packs.first)
+  http_abort (data);
+  data->next_start = GRUB_FILE_SIZE_UNKNOWN;
+  if (file->size != GRUB_FILE_SIZE_UNKNOWN && off >= file->size)
     {
-      grub_netbuff_free (file->device->net->packs.first->nb);
-      grub_net_remove_packet (file->device->net->packs.first);
+      file->device->net->eof = 1;
+      file->device->net->stall = 1;
+      return GRUB_ERR_NONE;
     }
 
-  file->device->net->stall = 0;
-  file->device->net->eof = 0;
-  file->device->net->offset = off;
-
-  data = grub_zalloc (sizeof (*data));
-  if (!data)
+  req = grub_zalloc (sizeof (*req));
+  if (!req)
     return grub_errno;
+  req->file = file;
+  req->pos = off;
+  req->end = GRUB_FILE_SIZE_UNKNOWN;
+  /* After a seek a short range comes first, so that the connection is
+     soon free for the next seek, and the rest of the file follows in
+     other requests.  With several connections the file is fetched in
+     ranges, the size comes with the first one.  */
+  if (off && file->size != GRUB_FILE_SIZE_UNKNOWN)
+    req->end = off + HTTP_SEEK_RANGE;
+  else if (data->connections > 1)
+    req->end = off + HTTP_RANGE_SIZE;
+  if (req->end != GRUB_FILE_SIZE_UNKNOWN)
+    {
+      if (req->end > file->size)
+	req->end = file->size;
+      data->next_start = req->end;
+    }
+  data->reqs = req;
 
-  data->size_recv = 1;
-  data->filename = old_data->filename;
-  if (!data->filename)
+  data->headers_recv = 0;
+  data->err = GRUB_ERR_NONE;
+  for (i = 0; !data->headers_recv && !data->err && i < 100; i++)
     {
-      grub_free (data);
-      file->data = 0;
-      return grub_errno;
+      if (!req->conn)
+	{
+	  if (req->complete)
+	    break;
+	  if (!http_issue (req, 1))
+	    {
+	      if (grub_errno)
+		return grub_errno;
+	      break;
+	    }
+	}
+      grub_net_tcp_retransmit ();
+      grub_net_poll_cards (300, &data->headers_recv);
     }
-  grub_free (old_data);
 
-  file->data = data;
-  err = http_establish (file, off, 0);
-  if (err)
+  if (data->err)
     {
-      grub_free (data->filename);
-      grub_free (data);
-      file->data = 0;
+      char *str = data->errmsg;
+      err = grub_error (data->err, "%s", str);
+      grub_free (str);
+      data->errmsg = 0;
       return err;
     }
+  if (!data->headers_recv)
+    return grub_error (GRUB_ERR_TIMEOUT, N_("time out opening `%s'"),
+		       data->filename);
   return GRUB_ERR_NONE;
 }
 
+static grub_err_t
+http_seek (struct grub_file *file, grub_off_t off)
+{
+  free_packets (&file->device->net->packs);
+
+  file->device->net->stall = 0;
+  file->device->net->eof = 0;
+  file->device->net->offset = off;
+
+  return http_establish (file, off);
+}
+
 static grub_err_t
 http_open (struct grub_file *file, const char *filename)
 {
   grub_err_t err;
   struct http_data *data;
+  const char *val;
 
   data = grub_zalloc (sizeof (*data));
   if (!data)
     return grub_errno;
   file->size = GRUB_FILE_SIZE_UNKNOWN;
 
+  data->connections = 1;
+  val = grub_env_get ("http_connections");
+  if (val)
+    {
+      data->connections = grub_strtoul (val, 0, 0);
+      grub_errno = GRUB_ERR_NONE;
+      if (data->connections < 1)
+	data->connections = 1;
+      if (data->connections > HTTP_MAX_CONNECTIONS)
+	data->connections = HTTP_MAX_CONNECTIONS;
+    }
+
   data->filename = grub_strdup (filename);
   if (!data->filename)
     {
@@ -503,9 +1119,10 @@ http_open (struct grub_file *file, const char *filename)
   file->not_easily_seekable = 0;
   file->data = data;
 
-  err = http_establish (file, 0, 1);
+  err = http_establish (file, 0);
   if (err)
     {
+      http_abort (data);
       grub_free (data->filename);
       grub_free (data);
       return err;
@@ -522,10 +1139,8 @@ http_close (struct grub_file *file)
   if (!data)
     return GRUB_ERR_NONE;
 
-  if (data->sock)
-    grub_net_tcp_close (data->sock, GRUB_NET_TCP_ABORT);
-  if (data->current_line)
-    grub_free (data->current_line);
+  http_abort (data);
+  grub_free (data->errmsg);
   grub_free (data->filename);
   grub_free (data);
   return GRUB_ERR_NONE;
@@ -541,8 +1156,10 @@ http_packets_pulled (struct grub_file *file)
 
   if (!file->device->net->eof)
     file->device->net->stall = 0;
-  if (data && data->sock)
-    grub_net_tcp_unstall (data->sock);
+  if (data && data->reqs && data->reqs->conn)
+    grub_net_tcp_unstall (data->reqs->conn->sock);
+  if (data)
+    http_fill (file, 1);
   return 0;
 }
 
@@ -563,4 +1180,6 @@ GRUB_MOD_INIT (http)
 GRUB_MOD_FINI (http)
 {
   grub_net_app_level_unregister (&grub_http_protocol);
+  while (idle_conns)
+    http_conn_close (idle_conns, GRUB_NET_TCP_DISCARD);
 }
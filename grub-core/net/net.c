@@ -43,6 +43,11 @@ struct grub_net_card *grub_net_cards = NULL;
 struct grub_net_network_level_protocol *grub_net_network_level_protocols = NULL;
 static struct grub_fs grub_net_fs;
 
+/* Bytes of file data copied straight into the reader's buffer, and
+   copied from the packets list.  */
+static grub_uint64_t net_direct_bytes;
+static grub_uint64_t net_queued_bytes;
+
 struct grub_net_link_layer_entry {
   int avail;
   grub_net_network_level_address_t nl_address;
@@ -1235,6 +1240,25 @@ grub_cmd_listcards (struct grub_command *cmd __attribute__ ((unused)),
   return GRUB_ERR_NONE;
 }
 
+static grub_err_t
+grub_cmd_netstats (struct grub_command *cmd __attribute__ ((unused)),
+		   int argc __attribute__ ((unused)),
+		   char **args __attribute__ ((unused)))
+{
+  grub_printf ("netbuff: %llu heap allocations, %llu from pool, "
+	       "%llu heap frees, %llu to pool, %u pooled\n",
+	       (unsigned long long) grub_netbuff_stats.heap_allocs,
+	       (unsigned long long) grub_netbuff_stats.pool_allocs,
+	       (unsigned long long) grub_netbuff_stats.heap_frees,
+	       (unsigned long long) grub_netbuff_stats.pool_frees,
+	       grub_netbuff_stats.pooled);
+  grub_printf ("file data: %llu bytes received into reads, "
+	       "%llu bytes copied from queue\n",
+	       (unsigned long long) net_direct_bytes,
+	       (unsigned long long) net_queued_bytes);
+  return GRUB_ERR_NONE;
+}
+
 static grub_err_t
 grub_cmd_listaddrs (struct grub_command *cmd __attribute__ ((unused)),
 		    int argc __attribute__ ((unused)),
@@ -1521,6 +1545,8 @@ receive_packets (struct grub_net_card *card, int *stop_condition)
 	  grub_errno = GRUB_ERR_NONE;
 	}
     }
+  /* ACK the whole burst at once.  */
+  grub_net_tcp_flush_acks ();
   grub_print_error ();
 }
 
@@ -1590,6 +1616,48 @@ grub_net_poll_cards_idle_real (void)
   grub_net_tcp_retransmit ();
 }
 
+/* Hand the payload of NB to FILE: as much as the read in progress still
+   wants goes straight into its buffer, the rest is queued.  Takes NB.  */
+grub_err_t
+grub_net_put_file_data (grub_file_t file, struct grub_net_buff *nb)
+{
+  grub_net_t net = file->device->net;
+  grub_size_t amount;
+  grub_err_t err;
+
+  if (net->read_len && !net->packs.first)
+    {
+      amount = nb->tail - nb->data;
+      if (amount > net->read_len)
+	amount = net->read_len;
+      if (net->read_buf)
+	{
+	  grub_memcpy (net->read_buf, nb->data, amount);
+	  net->read_buf += amount;
+	}
+      net->read_len -= amount;
+      net->offset += amount;
+      net_direct_bytes += amount;
+      if (grub_file_progress_hook)
+	grub_file_progress_hook (0, 0, amount, file);
+      nb->data += amount;
+      /* Stop polling, the read is done.  */
+      if (!net->read_len)
+	net->stall = 1;
+    }
+
+  if (nb->tail == nb->data)
+    {
+      grub_netbuff_free (nb);
+      return GRUB_ERR_NONE;
+    }
+
+  err = grub_net_put_packet (&net->packs, nb);
+  if (err)
+    grub_netbuff_free (nb);
+  return err;
+}
+
 /*  Read from the packets list*/
 static grub_ssize_t
 grub_net_fs_read_real (grub_file_t file, char *buf, grub_size_t len)
@@ -1600,6 +1668,7 @@ grub_net_fs_read_real (grub_file_t file, char *buf, grub_size_t len)
   grub_size_t amount, total = 0;
   int try = 0;
 
+  net->read_start = grub_get_time_ms ();
   while (try <= GRUB_NET_TRIES)
     {
       while (net->packs.first)
@@ -1611,6 +1680,7 @@ grub_net_fs_read_real (grub_file_t file, char *buf, grub_size_t len)
 	    amount = len;
 	  len -= amount;
 	  total += amount;
+	  net_queued_bytes += amount;
 	  file->device->net->offset += amount;
 	  if (grub_file_progress_hook)
 	    grub_file_progress_hook (0, 0, amount, file);
@@ -1640,8 +1710,27 @@ grub_net_fs_read_real (grub_file_t file, char *buf, grub_size_t len)
       if (!net->eof)
 	{
 	  try++;
+	  net->read_buf = ptr;
+	  net->read_len = len;
 	  grub_net_poll_cards (GRUB_NET_INTERVAL +
                                (try * GRUB_NET_INTERVAL_ADDITION), &net->stall);
+	  amount = len - net->read_len;
+	  net->read_buf = NULL;
+	  net->read_len = 0;
+	  if (amount)
+	    {
+	      try = 0;
+	      len -= amount;
+	      total += amount;
+	      if (buf)
+		ptr += amount;
+	      if (!len)
+		{
+		  if (net->protocol->packets_pulled)
+		    net->protocol->packets_pulled (file);
+		  return total;
+		}
+	    }
         }
       else
 	return total;
@@ -1738,6 +1827,7 @@ grub_net_fini_hw (int noreturn __attribute__ ((unused)))
 	  card->driver->close (card);
 	card->opened = 0;
       }
+  grub_netbuff_free_pool ();
   return GRUB_ERR_NONE;
 }
 
@@ -1751,7 +1841,7 @@ static struct grub_preboot *fini_hnd;
 
 static grub_command_t cmd_addaddr, cmd_deladdr, cmd_addroute, cmd_delroute;
 static grub_command_t cmd_lsroutes, cmd_lscards;
-static grub_command_t cmd_lsaddr, cmd_slaac;
+static grub_command_t cmd_lsaddr, cmd_slaac, cmd_stats;
 
 GRUB_MOD_INIT(net)
 {
@@ -1794,6 +1884,8 @@ GRUB_MOD_INIT(net)
 				       "", N_("list network cards"));
   cmd_lsaddr = grub_register_command ("net_ls_addr", grub_cmd_listaddrs,
 				       "", N_("list network addresses"));
+  cmd_stats = grub_register_command ("net_stats", grub_cmd_netstats,
+				     "", N_("Show network buffer statistics."));
   grub_bootp_init ();
   grub_dns_init ();
 
@@ -1819,6 +1911,7 @@ GRUB_MOD_FINI(net)
   grub_unregister_command (cmd_lscards);
   grub_unregister_command (cmd_lsaddr);
   grub_unregister_command (cmd_slaac);
+  grub_unregister_command (cmd_stats);
   grub_fs_unregister (&grub_net_fs);
   grub_net_open = NULL;
   grub_net_fini_hw (0);
@@ -21,6 +21,11 @@
 #include <grub/mm.h>
 #include <grub/net/netbuff.h>
 
+struct grub_netbuff_stats grub_netbuff_stats;
+
+/* Free buffers of NETBUFF_ALIGN bytes, linked through their data.  */
+static struct grub_net_buff *pool;
+
 grub_err_t
 grub_netbuff_put (struct grub_net_buff *nb, grub_size_t len)
 {
@@ -83,6 +88,15 @@ grub_netbuff_alloc (grub_size_t len)
     len = NETBUFFMINLEN;
 
   len = ALIGN_UP (len, NETBUFF_ALIGN);
+  if (len == NETBUFF_ALIGN && pool)
+    {
+      nb = pool;
+      pool = *(struct grub_net_buff **) nb->head;
+      grub_netbuff_stats.pooled--;
+      grub_netbuff_stats.pool_allocs++;
+      nb->data = nb->tail = nb->head;
+      return nb;
+    }
 #ifdef GRUB_MACHINE_EMU
   data = grub_malloc (len + sizeof (*nb));
 #else
@@ -90,6 +104,7 @@ grub_netbuff_alloc (grub_size_t len)
 #endif
   if (!data)
     return NULL;
+  grub_netbuff_stats.heap_allocs++;
   nb = (struct grub_net_buff *) ((grub_properly_aligned_t *) data
 				 + len / sizeof (grub_properly_aligned_t));
   nb->head = nb->data = nb->tail = data;
@@ -122,9 +137,34 @@ grub_netbuff_free (struct grub_net_buff *nb)
 {
   if (!nb)
     return;
+  if (nb->end - nb->head == NETBUFF_ALIGN
+      && grub_netbuff_stats.pooled < NETBUFF_POOL_SIZE)
+    {
+      *(struct grub_net_buff **) nb->head = pool;
+      pool = nb;
+      grub_netbuff_stats.pooled++;
+      grub_netbuff_stats.pool_frees++;
+      return;
+    }
+  grub_netbuff_stats.heap_frees++;
   grub_free (nb->head);
 }
 
+void
+grub_netbuff_free_pool (void)
+{
+  struct grub_net_buff *nb;
+
+  while (pool)
+    {
+      nb = pool;
+      pool = *(struct grub_net_buff **) nb->head;
+      grub_netbuff_stats.pooled--;
+      grub_netbuff_stats.heap_frees++;
+      grub_free (nb->head);
+    }
+}
+
 grub_err_t
 grub_netbuff_clear (struct grub_net_buff *nb)
 {
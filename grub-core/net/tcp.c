@@ -21,6 +21,7 @@
 #include <grub/net/tcp.h>
 #include <grub/net/netbuff.h>
 #include <grub/time.h>
+#include <grub/env.h>
 #include <grub/priority_queue.h>
 
 #define TCP_SYN_RETRANSMISSION_TIMEOUT GRUB_NET_INTERVAL
@@ -28,6 +29,20 @@
 #define TCP_RETRANSMISSION_TIMEOUT GRUB_NET_INTERVAL
 #define TCP_RETRANSMISSION_COUNT GRUB_NET_TRIES
 
+/* Receive buffer, which is the window we advertise.  It can be changed
+   with the variable `tcp_rcvbuf', in KiB.  */
+#define TCP_DEFAULT_RCVBUF (1 << 20)
+#define TCP_MIN_RCVBUF 8192
+#define TCP_MAX_RCVBUF (16 << 20)
+/* Largest window scale allowed by RFC 7323.  */
+#define TCP_MAX_WSCALE 14
+/* Out-of-order ranges reported in an ACK.  Four blocks fill the option
+   space when no timestamps are used.  */
+#define TCP_MAX_SACK_BLOCKS 4
+/* In-order segments received before an ACK is sent without waiting for
+   the end of the receive burst.  */
+#define TCP_DELAYED_ACK_SEGMENTS 8
+
 struct unacked
 {
   struct unacked *next;
@@ -47,6 +62,22 @@ enum
     TCP_URG = 0x20,
   };
 
+enum
+  {
+    TCP_OPT_EOL = 0,
+    TCP_OPT_NOP = 1,
+    TCP_OPT_MSS = 2,
+    TCP_OPT_WSCALE = 3,
+    TCP_OPT_SACK_PERMITTED = 4,
+    TCP_OPT_SACK = 5
+  };
+
+struct sack_block
+{
+  grub_uint32_t start;
+  grub_uint32_t end;
+};
+
 struct grub_net_tcp_socket
 {
   struct grub_net_tcp_socket *next;
@@ -65,7 +96,19 @@ struct grub_net_tcp_socket
   grub_uint32_t my_cur_seq;
   grub_uint32_t their_start_seq;
   grub_uint32_t their_cur_seq;
-  grub_uint16_t my_window;
+  /* The receive buffer, unscaled.  */
+  grub_uint32_t my_window;
+  /* The shift applied to the window we advertise, 0 unless both sides
+     sent the window scale option.  */
+  int my_wscale;
+  /* The peer sent SACK-permitted and window scale.  With SACK, ACKs
+     carry the out-of-order ranges, most recently received first.  */
+  int sack_ok;
+  int wscale_ok;
+  struct sack_block sack[TCP_MAX_SACK_BLOCKS];
+  int num_sack;
+  /* In-order segments received and not acked yet.  */
+  int ack_pending;
   struct unacked *unack_first;
   struct unacked *unack_last;
   grub_err_t (*recv_hook) (grub_net_tcp_socket_t sock, struct grub_net_buff *nb,
@@ -130,6 +173,180 @@ static struct grub_net_tcp_listen *tcp_listens;
 #define FOR_TCP_SOCKETS(var) FOR_LIST_ELEMENTS (var, tcp_sockets)
 #define FOR_TCP_LISTENS(var) FOR_LIST_ELEMENTS (var, tcp_listens)
 
+static inline int
+seq_before (grub_uint32_t a, grub_uint32_t b)
+{
+  return (grub_int32_t) (a - b) < 0;
+}
+
+/* Size the receive buffer of SOCK and the window scale it needs.  */
+static void
+init_window (grub_net_tcp_socket_t sock)
+{
+  const char *val;
+  unsigned long size = TCP_DEFAULT_RCVBUF;
+
+  val = grub_env_get ("tcp_rcvbuf");
+  if (val)
+    {
+      size = grub_strtoul (val, 0, 0) << 10;
+      grub_errno = GRUB_ERR_NONE;
+    }
+  if (size < TCP_MIN_RCVBUF)
+    size = TCP_MIN_RCVBUF;
+  if (size > TCP_MAX_RCVBUF)
+    size = TCP_MAX_RCVBUF;
+
+  sock->my_window = size;
+  sock->my_wscale = 0;
+  while ((size >> sock->my_wscale) > 0xffff
+	 && sock->my_wscale < TCP_MAX_WSCALE)
+    sock->my_wscale++;
+}
+
+/* The window field of a segment other than SYN.  */
+static grub_uint16_t
+window_field (grub_net_tcp_socket_t sock)
+{
+  grub_uint32_t window = sock->my_window >> sock->my_wscale;
+
+  if (sock->i_stall)
+    return 0;
+  if (window > 0xffff)
+    window = 0xffff;
+  return grub_cpu_to_be16 (window);
+}
+
+/* The window field of a SYN, which is never scaled.  */
+static grub_uint16_t
+syn_window_field (grub_net_tcp_socket_t sock)
+{
+  if (sock->my_window > 0xffff)
+    return grub_cpu_to_be16_compile_time (0xffff);
+  return grub_cpu_to_be16 (sock->my_window);
+}
+
+/* Write the options of our SYN or SYN-ACK to OPT, padded to a multiple
+   of 4 bytes, and return their size.  */
+static grub_size_t
+put_syn_options (grub_net_tcp_socket_t sock, grub_uint8_t *opt)
+{
+  grub_size_t len = 0;
+  grub_ssize_t mss;
+
+  if (sock->out_nla.type == GRUB_NET_NETWORK_LEVEL_PROTOCOL_IPV4)
+    mss = sock->inf->card->mtu - GRUB_NET_OUR_IPV4_HEADER_SIZE
+      - GRUB_NET_TCP_HEADER_SIZE;
+  else
+    mss = sock->inf->card->mtu - GRUB_NET_OUR_IPV6_HEADER_SIZE
+      - GRUB_NET_TCP_HEADER_SIZE;
+  if (mss > 0 && mss <= 0xffff)
+    {
+      opt[len++] = TCP_OPT_MSS;
+      opt[len++] = 4;
+      grub_set_unaligned16 (opt + len, grub_cpu_to_be16 (mss));
+      len += 2;
+    }
+
+  if (sock->wscale_ok)
+    {
+      opt[len++] = TCP_OPT_NOP;
+      opt[len++] = TCP_OPT_WSCALE;
+      opt[len++] = 3;
+      opt[len++] = sock->my_wscale;
+    }
+
+  if (sock->sack_ok)
+    {
+      opt[len++] = TCP_OPT_NOP;
+      opt[len++] = TCP_OPT_NOP;
+      opt[len++] = TCP_OPT_SACK_PERMITTED;
+      opt[len++] = 2;
+    }
+
+  return len;
+}
+
+/* Look at the options of the SYN or SYN-ACK TCPH.  Window scaling and
+   SACK are only used if the peer asked for them too.  */
+static void
+parse_syn_options (grub_net_tcp_socket_t sock, const struct tcphdr *tcph)
+{
+  const grub_uint8_t *ptr = (const grub_uint8_t *) (tcph + 1);
+  const grub_uint8_t *end = (const grub_uint8_t *) tcph
+    + (grub_be_to_cpu16 (tcph->flags) >> 12) * sizeof (grub_uint32_t);
+  sock->sack_ok = 0;
+  sock->wscale_ok = 0;
+  while (ptr < end && *ptr != TCP_OPT_EOL)
+    {
+      if (*ptr == TCP_OPT_NOP)
+	{
+	  ptr++;
+	  continue;
+	}
+      if (end - ptr < 2 || ptr[1] < 2 || end - ptr < ptr[1])
+	break;
+      if (ptr[0] == TCP_OPT_WSCALE && ptr[1] == 3)
+	sock->wscale_ok = 1;
+      if (ptr[0] == TCP_OPT_SACK_PERMITTED && ptr[1] == 2)
+	sock->sack_ok = 1;
+      ptr += ptr[1];
+    }
+
+  if (!sock->wscale_ok)
+    sock->my_wscale = 0;
+}
+
+/* Record that [START, END) was received out of order.  */
+static void
+sack_add (grub_net_tcp_socket_t sock, grub_uint32_t start, grub_uint32_t end)
+{
+  int i, j;
+
+  if (!sock->sack_ok || start == end)
+    return;
+
+  /* Merge the ranges this one touches.  */
+  for (i = 0, j = 0; i < sock->num_sack; i++)
+    {
+      if (!seq_before (end, sock->sack[i].start)
+	  && !seq_before (sock->sack[i].end, start))
+	{
+	  if (seq_before (sock->sack[i].start, start))
+	    start = sock->sack[i].start;
+	  if (seq_before (end, sock->sack[i].end))
+	    end = sock->sack[i].end;
+	  continue;
+	}
+      sock->sack[j++] = sock->sack[i];
+    }
+
+  /* The most recent range comes first.  */
+  if (j == TCP_MAX_SACK_BLOCKS)
+    j--;
+  grub_memmove (&sock->sack[1], &sock->sack[0], j * sizeof (sock->sack[0]));
+  sock->sack[0].start = start;
+  sock->sack[0].end = end;
+  sock->num_sack = j + 1;
+}
+
+/* Drop the ranges which were received in order by now.  */
+static void
+sack_trim (grub_net_tcp_socket_t sock)
+{
+  int i, j;
+
+  for (i = 0, j = 0; i < sock->num_sack; i++)
+    {
+      if (!seq_before (sock->their_cur_seq, sock->sack[i].end))
+	continue;
+      if (seq_before (sock->sack[i].start, sock->their_cur_seq))
+	sock->sack[i].start = sock->their_cur_seq;
+      sock->sack[j++] = sock->sack[i];
+    }
+  sock->num_sack = j;
+}
+
 grub_net_tcp_listen_t
 grub_net_tcp_listen (grub_uint16_t port,
 		     const struct grub_net_network_level_interface *inf,
@@ -300,8 +517,13 @@ ack_real (grub_net_tcp_socket_t sock, int res)
   struct grub_net_buff *nb_ack;
   struct tcphdr *tcph_ack;
   grub_err_t err;
+  grub_size_t optlen = 0;
+  int i;
+
+  if (!res && sock->sack_ok && sock->num_sack)
+    optlen = 4 + sock->num_sack * 8;
 
-  nb_ack = grub_netbuff_alloc (sizeof (*tcph_ack) + 128);
+  nb_ack = grub_netbuff_alloc (sizeof (*tcph_ack) + optlen + 128);
   if (!nb_ack)
     return;
   err = grub_netbuff_reserve (nb_ack, 128);
@@ -313,7 +535,7 @@ ack_real (grub_net_tcp_socket_t sock, int res)
       return;
     }
 
-  err = grub_netbuff_put (nb_ack, sizeof (*tcph_ack));
+  err = grub_netbuff_put (nb_ack, sizeof (*tcph_ack) + optlen);
   if (err)
     {
       grub_netbuff_free (nb_ack);
@@ -330,10 +552,27 @@ ack_real (grub_net_tcp_socket_t sock, int res)
     }
   else
     {
+      grub_uint8_t *opt = (grub_uint8_t *) (tcph_ack + 1);
+
       tcph_ack->ack = grub_cpu_to_be32 (sock->their_cur_seq);
-      tcph_ack->flags = grub_cpu_to_be16_compile_time ((5 << 12) | TCP_ACK);
-      tcph_ack->window = !sock->i_stall ? grub_cpu_to_be16 (sock->my_window)
-	: 0;
+      tcph_ack->flags = grub_cpu_to_be16 (((5 + optlen / 4) << 12) | TCP_ACK);
+      tcph_ack->window = window_field (sock);
+      sock->ack_pending = 0;
+
+      if (optlen)
+	{
+	  opt[0] = TCP_OPT_NOP;
+	  opt[1] = TCP_OPT_NOP;
+	  opt[2] = TCP_OPT_SACK;
+	  opt[3] = optlen - 2;
+	  for (i = 0; i < sock->num_sack; i++)
+	    {
+	      grub_set_unaligned32 (opt + 4 + 8 * i,
+				    grub_cpu_to_be32 (sock->sack[i].start));
+	      grub_set_unaligned32 (opt + 8 + 8 * i,
+				    grub_cpu_to_be32 (sock->sack[i].end));
+	    }
+	}
     }
   tcph_ack->urgent = 0;
   tcph_ack->src = grub_cpu_to_be16 (sock->in_port);
@@ -358,6 +597,17 @@ reset (grub_net_tcp_socket_t sock)
   ack_real (sock, 1);
 }
 
+/* Send the ACKs held back while receiving a burst of segments.  */
+void
+grub_net_tcp_flush_acks (void)
+{
+  grub_net_tcp_socket_t sock;
+
+  FOR_TCP_SOCKETS (sock)
+    if (sock->ack_pending)
+      ack (sock);
+}
+
 void
 grub_net_tcp_retransmit (void)
 {
@@ -365,6 +615,8 @@ grub_net_tcp_retransmit (void)
   grub_uint64_t ctime = grub_get_time_ms ();
   grub_uint64_t limit_time = ctime - TCP_RETRANSMISSION_TIMEOUT;
 
+  grub_net_tcp_flush_acks ();
+
   FOR_TCP_SOCKETS (sock)
   {
     struct unacked *unack;
@@ -500,6 +752,8 @@ grub_net_tcp_accept (grub_net_tcp_socket_t sock,
   grub_err_t err;
   grub_net_network_level_address_t gateway;
   struct grub_net_network_level_interface *inf;
+  grub_uint8_t opts[40];
+  grub_size_t optlen;
 
   sock->recv_hook = recv_hook;
   sock->error_hook = error_hook;
@@ -514,7 +768,7 @@ grub_net_tcp_accept (grub_net_tcp_socket_t sock,
   if (err)
     return err;
 
-  nb_ack = grub_netbuff_alloc (sizeof (*tcph)
+  nb_ack = grub_netbuff_alloc (sizeof (*tcph) + 40
 			       + GRUB_NET_OUR_MAX_IP_HEADER_SIZE
 			       + GRUB_NET_MAX_LINK_HEADER_SIZE);
   if (!nb_ack)
@@ -534,9 +788,18 @@ grub_net_tcp_accept (grub_net_tcp_socket_t sock,
       return err;
     }
   tcph = (void *) nb_ack->data;
+  optlen = put_syn_options (sock, opts);
+  err = grub_netbuff_put (nb_ack, optlen);
+  if (err)
+    {
+      grub_netbuff_free (nb_ack);
+      return err;
+    }
+  grub_memcpy (tcph + 1, opts, optlen);
   tcph->ack = grub_cpu_to_be32 (sock->their_cur_seq);
-  tcph->flags = grub_cpu_to_be16_compile_time ((5 << 12) | TCP_SYN | TCP_ACK);
-  tcph->window = grub_cpu_to_be16 (sock->my_window);
+  tcph->flags = grub_cpu_to_be16 (((5 + optlen / 4) << 12)
+				  | TCP_SYN | TCP_ACK);
+  tcph->window = syn_window_field (sock);
   tcph->urgent = 0;
   sock->established = 1;
   tcp_socket_register (sock);
@@ -570,6 +833,8 @@ grub_net_tcp_open (char *server,
   int i;
   grub_uint8_t *nbd;
   grub_net_link_level_address_t ll_target_addr;
+  grub_uint8_t opts[40];
+  grub_size_t optlen;
 
   err = grub_net_resolve_address (server, &addr);
   if (err)
@@ -604,7 +869,7 @@ grub_net_tcp_open (char *server,
   socket->fin_hook = fin_hook;
   socket->hook_data = hook_data;
 
-  nb = grub_netbuff_alloc (sizeof (*tcph) + 128);
+  nb = grub_netbuff_alloc (sizeof (*tcph) + 40 + 128);
   if (!nb)
     {
       grub_free (socket);
@@ -637,11 +902,24 @@ grub_net_tcp_open (char *server,
   tcph = (void *) nb->data;
   socket->my_start_seq = grub_get_time_ms ();
   socket->my_cur_seq = socket->my_start_seq + 1;
-  socket->my_window = 8192;
+  init_window (socket);
+  /* Offer both; the SYN-ACK tells whether the server agrees.  */
+  socket->sack_ok = 1;
+  socket->wscale_ok = 1;
+  optlen = put_syn_options (socket, opts);
+  err = grub_netbuff_put (nb, optlen);
+  if (err)
+    {
+      destroy_pq (socket);
+      grub_free (socket);
+      grub_netbuff_free (nb);
+      return NULL;
+    }
+  grub_memcpy (tcph + 1, opts, optlen);
   tcph->seqnr = grub_cpu_to_be32 (socket->my_start_seq);
   tcph->ack = grub_cpu_to_be32_compile_time (0);
-  tcph->flags = grub_cpu_to_be16_compile_time ((5 << 12) | TCP_SYN);
-  tcph->window = grub_cpu_to_be16 (socket->my_window);
+  tcph->flags = grub_cpu_to_be16 (((5 + optlen / 4) << 12) | TCP_SYN);
+  tcph->window = syn_window_field (socket);
   tcph->urgent = 0;
   tcph->src = grub_cpu_to_be16 (socket->in_port);
   tcph->dst = grub_cpu_to_be16 (socket->out_port);
@@ -727,8 +1005,7 @@ grub_net_send_tcp_packet (const grub_net_tcp_socket_t socket,
       tcph = (struct tcphdr *) nb2->data;
       tcph->ack = grub_cpu_to_be32 (socket->their_cur_seq);
       tcph->flags = grub_cpu_to_be16_compile_time ((5 << 12) | TCP_ACK);
-      tcph->window = !socket->i_stall ? grub_cpu_to_be16 (socket->my_window)
-	: 0;
+      tcph->window = window_field (socket);
       tcph->urgent = 0;
       err = grub_netbuff_put (nb2, fraglen);
       if (err)
@@ -751,7 +1028,7 @@ grub_net_send_tcp_packet (const grub_net_tcp_socket_t socket,
   tcph->ack = grub_cpu_to_be32 (socket->their_cur_seq);
   tcph->flags = (grub_cpu_to_be16_compile_time ((5 << 12) | TCP_ACK)
 		 | (push ? grub_cpu_to_be16_compile_time (TCP_PUSH) : 0));
-  tcph->window = !socket->i_stall ? grub_cpu_to_be16 (socket->my_window) : 0;
+  tcph->window = window_field (socket);
   tcph->urgent = 0;
   return tcp_send (nb, socket);
 }
@@ -764,6 +1041,7 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
   struct tcphdr *tcph;
   grub_net_tcp_socket_t sock;
   grub_err_t err;
+  grub_uint32_t seg_start, seg_end;
 
   /* Ignore broadcast.  */
   if (!inf)
@@ -822,6 +1100,7 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
       {
 	sock->their_start_seq = grub_be_to_cpu32 (tcph->seqnr);
 	sock->their_cur_seq = sock->their_start_seq + 1;
+	parse_syn_options (sock, tcph);
 	sock->established = 1;
       }
 
@@ -876,6 +1155,10 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	reset (sock);
       }
 
+    seg_start = grub_be_to_cpu32 (tcph->seqnr);
+    seg_end = seg_start + (nb->tail - nb->data)
+      - (grub_be_to_cpu16 (tcph->flags) >> 12) * sizeof (grub_uint32_t);
+
     err = grub_priority_queue_push (sock->pq, &nb);
     if (err)
       {
@@ -887,6 +1170,7 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
       struct grub_net_buff **nb_top_p, *nb_top;
       int do_ack = 0;
       int just_closed = 0;
+      int had_sack = sock->num_sack;
       while (1)
 	{
 	  nb_top_p = grub_priority_queue_top (sock->pq);
@@ -901,6 +1185,9 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	}
       if (grub_be_to_cpu32 (tcph->seqnr) != sock->their_cur_seq)
 	{
+	  /* Out of order: tell the peer what we got with a duplicate ACK
+	     right away.  */
+	  sack_add (sock, seg_start, seg_end);
 	  ack (sock);
 	  return GRUB_ERR_NONE;
 	}
@@ -936,12 +1223,17 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	  if ((nb_top->tail - nb_top->data) > 0)
 	    {
 	      grub_net_put_packet (&sock->packs, nb_top);
-	      do_ack = 1;
+	      sock->ack_pending++;
 	    }
 	  else
 	    grub_netbuff_free (nb_top);
 	}
-      if (do_ack)
+      sack_trim (sock);
+      /* Data is acked once per receive burst, see
+	 grub_net_tcp_flush_acks, or every few segments in a long one.
+	 A FIN or filling a hole is acked at once.  */
+      if (do_ack || had_sack
+	  || sock->ack_pending >= TCP_DELAYED_ACK_SEGMENTS)
 	ack (sock);
       while (sock->packs.first)
 	{
@@ -979,7 +1271,8 @@ grub_net_recv_tcp_packet (struct grub_net_buff *nb,
 	sock->their_start_seq = grub_be_to_cpu32 (tcph->seqnr);
 	sock->their_cur_seq = sock->their_start_seq + 1;
 	sock->my_cur_seq = sock->my_start_seq = grub_get_time_ms ();
-	sock->my_window = 8192;
+	init_window (sock);
+	parse_syn_options (sock, tcph);
 
 	sock->pq = grub_priority_queue_new (sizeof (struct grub_net_buff *),
 					    cmp);
@@ -26,6 +26,8 @@
 #include <grub/dl.h>
 #include <grub/file.h>
 #include <grub/priority_queue.h>
+#include <grub/env.h>
+#include <grub/time.h>
 #include <grub/i18n.h>
 
 GRUB_MOD_LICENSE ("GPLv3+");
@@ -42,6 +44,10 @@ enum
 enum
   {
     TFTP_DEFAULTSIZE_PACKET = 512,
+    TFTP_DEFAULT_BLKSIZE = 1024,
+    TFTP_MAX_BLKSIZE = 1432,
+    TFTP_DEFAULT_WINDOWSIZE = 8,
+    TFTP_MAX_WINDOWSIZE = 32
   };
 
 enum
@@ -103,12 +109,25 @@ typedef struct tftp_data
   grub_uint64_t block;
   grub_uint32_t block_size;
   grub_uint64_t ack_sent;
+  /* The number of blocks the server sends before waiting for an ack
+     (RFC 7440).  */
+  grub_uint32_t window_size;
+  /* The window size the request asked for; the server may only lower
+     it.  */
+  grub_uint32_t window_requested;
+  /* When the last in-order block arrived, or the last timeout.  */
+  grub_uint64_t last_progress;
+  unsigned timeouts;
   int have_oack;
   struct grub_error_saved save_err;
   grub_net_udp_socket_t sock;
   grub_priority_queue_t pq;
 } *tftp_data_t;
 
+/* The window size asked for on the next open.  It is halved after a
+   transfer which timed out and grows back after clean transfers.  */
+static grub_uint32_t window_hint = TFTP_MAX_WINDOWSIZE;
+
 static int
 cmp_block (grub_uint16_t a, grub_uint16_t b)
 {
@@ -181,7 +200,9 @@ tftp_receive (grub_net_udp_socket_t sock __attribute__ ((unused)),
     {
     case TFTP_OACK:
       data->block_size = TFTP_DEFAULTSIZE_PACKET;
-      data->have_oack = 1; 
+      /* A server ignoring the option acks every block.  */
+      data->window_size = 1;
+      data->have_oack = 1;
       for (ptr = nb->data + sizeof (tftph->opcode); ptr < nb->tail;)
 	{
 	  if (grub_memcmp (ptr, "tsize\0", sizeof ("tsize\0") - 1) == 0)
@@ -190,11 +211,24 @@ tftp_receive (grub_net_udp_socket_t sock __attribute__ ((unused)),
 	  if (grub_memcmp (ptr, "blksize\0", sizeof ("blksize\0") - 1) == 0)
 	    data->block_size = grub_strtoul ((char *) ptr + sizeof ("blksize\0")
 					     - 1, 0, 0);
+	  if (grub_memcmp (ptr, "windowsize\0", sizeof ("windowsize\0") - 1) == 0)
+	    data->window_size = grub_strtoul ((char *) ptr
+					      + sizeof ("windowsize\0") - 1,
+					      0, 0);
 	  while (ptr < nb->tail && *ptr)
 	    ptr++;
 	  ptr++;
 	}
+      if (data->window_size == 0)
+	data->window_size = 1;
+      if (data->window_size > data->window_requested)
+	{
+	  grub_dprintf ("tftp", "server raised windowsize to %u, using %u\n",
+			data->window_size, data->window_requested);
+	  data->window_size = data->window_requested;
+	}
       data->block = 0;
+      data->last_progress = grub_get_time_ms ();
       grub_netbuff_free (nb);
       err = ack (data, 0);
       grub_error_save (&data->save_err);
@@ -222,17 +256,39 @@ tftp_receive (grub_net_udp_socket_t sock __attribute__ ((unused)),
 	    tftph = (struct tftphdr *) nb_top->data;
 	    if (cmp_block (grub_be_to_cpu16 (tftph->u.data.block), data->block + 1) >= 0)
 	      break;
-	    ack (data, grub_be_to_cpu16 (tftph->u.data.block));
+	    /* With a window, duplicates are dropped: acking them would make
+	       the server resend whole windows we already have.  A lost ack
+	       is recovered from by the timeout in tftp_packets_pulled.  */
+	    if (data->window_size == 1)
+	      ack (data, grub_be_to_cpu16 (tftph->u.data.block));
 	    grub_netbuff_free (nb_top);
 	    grub_priority_queue_pop (data->pq);
 	  }
+	/* A block is missing: have the server resend the window from the
+	   last in-order block on.  The blocks after the gap wait in the
+	   queue.  */
+	if (cmp_block (grub_be_to_cpu16 (tftph->u.data.block), data->block + 1) > 0
+	    && data->ack_sent != data->block
+	    && file->device->net->packs.count < 50)
+	  {
+	    grub_dprintf ("tftp", "missing block %llu\n",
+			  (unsigned long long) data->block + 1);
+	    err = ack (data, data->block);
+	    if (err)
+	      return err;
+	  }
 	while (cmp_block (grub_be_to_cpu16 (tftph->u.data.block), data->block + 1) == 0)
 	  {
 	    unsigned size;
 
 	    grub_priority_queue_pop (data->pq);
 
-	    if (file->device->net->packs.count < 50)
+	    data->last_progress = grub_get_time_ms ();
+
+	    /* Ack once per window.  */
+	    if (data->block + 1 - data->ack_sent < data->window_size)
+	      err = 0;
+	    else if (file->device->net->packs.count < 50)
 	      err = ack (data, data->block + 1);
 	    else
 	      {
@@ -251,6 +307,8 @@ tftp_receive (grub_net_udp_socket_t sock __attribute__ ((unused)),
 	    data->block++;
 	    if (size < data->block_size)
 	      {
+		if (data->timeouts == 0 && window_hint < TFTP_MAX_WINDOWSIZE)
+		  window_hint *= 2;
 		if (data->ack_sent < data->block)
 		  ack (data, data->block);
 		file->device->net->eof = 1;
@@ -267,9 +325,9 @@ tftp_receive (grub_net_udp_socket_t sock __attribute__ ((unused)),
 		if (err)
 		  return err;
 	      }
-	    /* If there is data, puts packet in socket list. */
+	    /* If there is data, hands it to the reader.  */
 	    if ((nb_top->tail - nb_top->data) > 0)
-	      grub_net_put_packet (&file->device->net->packs, nb_top);
+	      grub_net_put_file_data (file, nb_top);
 	    else
 	      grub_netbuff_free (nb_top);
 	  }
@@ -314,10 +372,43 @@ tftp_open (struct grub_file *file, const char *filename)
   grub_err_t err;
   grub_uint8_t *nbd;
   grub_net_network_level_address_t addr;
+  const char *val;
+  unsigned long blksize = TFTP_DEFAULT_BLKSIZE;
+  unsigned long windowsize = TFTP_DEFAULT_WINDOWSIZE;
+  char blksize_str[sizeof ("XXXXXXXXXX")];
+  char windowsize_str[sizeof ("XXXXXXXXXX")];
+
+  val = grub_env_get ("tftp_blksize");
+  if (val)
+    {
+      blksize = grub_strtoul (val, 0, 0);
+      grub_errno = GRUB_ERR_NONE;
+      if (blksize < 8)
+	blksize = TFTP_DEFAULTSIZE_PACKET;
+      if (blksize > TFTP_MAX_BLKSIZE)
+	blksize = TFTP_MAX_BLKSIZE;
+    }
+
+  val = grub_env_get ("tftp_windowsize");
+  if (val)
+    {
+      windowsize = grub_strtoul (val, 0, 0);
+      grub_errno = GRUB_ERR_NONE;
+      if (windowsize < 1)
+	windowsize = 1;
+      if (windowsize > TFTP_MAX_WINDOWSIZE)
+	windowsize = TFTP_MAX_WINDOWSIZE;
+    }
+  if (windowsize > window_hint)
+    windowsize = window_hint;
+
+  grub_snprintf (blksize_str, sizeof (blksize_str), "%lu", blksize);
+  grub_snprintf (windowsize_str, sizeof (windowsize_str), "%lu", windowsize);
 
   data = grub_zalloc (sizeof (*data));
   if (!data)
     return grub_errno;
+  data->window_requested = windowsize;
 
   nb.head = open_data;
   nb.end = open_data + sizeof (open_data);
@@ -349,9 +440,9 @@ tftp_open (struct grub_file *file, const char *filename)
   rrqlen += grub_strlen ("blksize") + 1;
   rrq += grub_strlen ("blksize") + 1;
 
-  grub_strcpy (rrq, "1024");
-  rrqlen += grub_strlen ("1024") + 1;
-  rrq += grub_strlen ("1024") + 1;
+  grub_strcpy (rrq, blksize_str);
+  rrqlen += grub_strlen (blksize_str) + 1;
+  rrq += grub_strlen (blksize_str) + 1;
 
   grub_strcpy (rrq, "tsize");
   rrqlen += grub_strlen ("tsize") + 1;
@@ -360,6 +451,18 @@ tftp_open (struct grub_file *file, const char *filename)
   grub_strcpy (rrq, "0");
   rrqlen += grub_strlen ("0") + 1;
   rrq += grub_strlen ("0") + 1;
+
+  /* A window of one block is what plain TFTP does.  */
+  if (windowsize > 1)
+    {
+      grub_strcpy (rrq, "windowsize");
+      rrqlen += grub_strlen ("windowsize") + 1;
+      rrq += grub_strlen ("windowsize") + 1;
+
+      grub_strcpy (rrq, windowsize_str);
+      rrqlen += grub_strlen (windowsize_str) + 1;
+      rrq += grub_strlen (windowsize_str) + 1;
+    }
   hdrlen = sizeof (tftph->opcode) + rrqlen;
 
   err = grub_netbuff_unput (&nb, nb.tail - (nb.data + hdrlen));
@@ -475,12 +578,35 @@ static grub_err_t
 tftp_packets_pulled (struct grub_file *file)
 {
   tftp_data_t data = file->data;
+  grub_uint64_t since;
+
   if (file->device->net->packs.count >= 50)
     return 0;
 
   if (!file->device->net->eof)
     file->device->net->stall = 0;
-  if (data->ack_sent >= data->block)
+
+  /* Nothing arrived for a while: the end of the window or the ack got
+     lost.  Ack the last in-order block again so that the server resends
+     the window from there, and ask for smaller windows from now on.
+     Only the time spent inside the current read counts: a reader busy
+     elsewhere has not been waiting for the server.  */
+  since = data->last_progress;
+  if (since < file->device->net->read_start)
+    since = file->device->net->read_start;
+  if (!file->device->net->eof && data->sock
+      && grub_get_time_ms () - since >= GRUB_NET_INTERVAL)
+    {
+      grub_dprintf ("tftp", "timeout after block %llu\n",
+		    (unsigned long long) data->block);
+      data->last_progress = grub_get_time_ms ();
+      if (data->timeouts++ == 0 && data->window_size > 1)
+	window_hint = (data->window_size + 1) / 2;
+      return ack (data, data->block);
+    }
+
+  /* An ack held back while the packet list was full.  */
+  if (data->block - data->ack_sent < data->window_size)
     return 0;
   return ack (data, data->block);
 }
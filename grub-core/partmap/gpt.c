@@ -42,6 +42,9 @@ static const grub_gpt_part_type_t grub_gpt_partition_type_bios_boot = GRUB_GPT_P
 /* 512 << 7 = 65536 byte sectors.  */
 #define MAX_SECTOR_LOG 7
 
+/* Amount of the entry array fetched with one disk read.  */
+#define ENTRIES_CHUNK_SIZE 4096
+
 static struct grub_partition_map grub_gpt_partition_map;
 
 
@@ -53,11 +56,14 @@ grub_gpt_partition_map_iterate (grub_disk_t disk,
 {
   struct grub_partition part;
   struct grub_gpt_header gpt;
-  struct grub_gpt_partentry entry;
+  struct grub_gpt_partentry *entry;
   struct grub_msdos_partition_mbr mbr;
   grub_uint64_t entries;
+  grub_uint64_t offset, table_size;
+  grub_uint64_t chunk_start = 0, chunk_len = 0;
+  grub_uint32_t entry_size;
+  grub_uint8_t *chunk;
   unsigned int i;
-  int last_offset = 0;
   int sector_log = 0;
 
   /* Read the protective MBR.  */
@@ -90,22 +96,41 @@ grub_gpt_partition_map_iterate (grub_disk_t disk,
   grub_dprintf ("gpt", "Read a valid GPT header\n");
 
   entries = grub_le_to_cpu64 (gpt.partitions) << sector_log;
-  for (i = 0; i < grub_le_to_cpu32 (gpt.maxpart); i++)
+  entry_size = grub_le_to_cpu32 (gpt.partentry_size);
+  if (entry_size < sizeof (*entry))
+    return grub_error (GRUB_ERR_BAD_PART_TABLE, "invalid GPT entry size");
+  table_size = (grub_uint64_t) grub_le_to_cpu32 (gpt.maxpart) * entry_size;
+
+  /* The entries are read a chunk at a time rather than one by one.  */
+  chunk = grub_malloc (ENTRIES_CHUNK_SIZE);
+  if (!chunk)
+    return grub_errno;
+
+  for (i = 0, offset = 0; offset < table_size; i++, offset += entry_size)
     {
-      if (grub_disk_read (disk, entries, last_offset,
-			  sizeof (entry), &entry))
-	return grub_errno;
+      if (offset + sizeof (*entry) > chunk_start + chunk_len)
+	{
+	  chunk_start = offset;
+	  chunk_len = table_size - offset;
+	  if (chunk_len > ENTRIES_CHUNK_SIZE)
+	    chunk_len = ENTRIES_CHUNK_SIZE;
+	  if (chunk_len < sizeof (*entry))
+	    break;
+	  if (grub_disk_read (disk, entries, chunk_start, chunk_len, chunk))
+	    goto fail;
+	}
+      entry = (struct grub_gpt_partentry *) (chunk + (offset - chunk_start));
 
-      if (grub_memcmp (&grub_gpt_partition_type_empty, &entry.type,
+      if (grub_memcmp (&grub_gpt_partition_type_empty, &entry->type,
 		       sizeof (grub_gpt_partition_type_empty)))
 	{
 	  /* Calculate the first block and the size of the partition.  */
-	  part.start = grub_le_to_cpu64 (entry.start) << sector_log;
-	  part.len = (grub_le_to_cpu64 (entry.end)
-		      - grub_le_to_cpu64 (entry.start) + 1)  << sector_log;
-	  part.offset = entries;
+	  part.start = grub_le_to_cpu64 (entry->start) << sector_log;
+	  part.len = (grub_le_to_cpu64 (entry->end)
+		      - grub_le_to_cpu64 (entry->start) + 1)  << sector_log;
+	  part.offset = entries + (offset >> GRUB_DISK_SECTOR_BITS);
 	  part.number = i;
-	  part.index = last_offset;
+	  part.index = offset & (GRUB_DISK_SECTOR_SIZE - 1);
 	  part.partmap = &grub_gpt_partition_map;
 	  part.parent = disk->partition;
 
@@ -114,18 +139,16 @@ grub_gpt_partition_map_iterate (grub_disk_t disk,
 			(unsigned long long) part.len);
 
 	  if (hook (disk, &part, hook_data))
-	    return grub_errno;
-	}
-
-      last_offset += grub_le_to_cpu32 (gpt.partentry_size);
-      if (last_offset == GRUB_DISK_SECTOR_SIZE)
-	{
-	  last_offset = 0;
-	  entries++;
+	    goto fail;
 	}
     }
 
+  grub_free (chunk);
   return GRUB_ERR_NONE;
+
+ fail:
+  grub_free (chunk);
+  return grub_errno;
 }
 
 #ifdef GRUB_UTIL
@@ -37,6 +37,13 @@ GRUB_MOD_LICENSE ("GPLv3+");
 
 #define DEFAULT_STANDARD_COLOR  0x07
 
+/* Number of separate rectangles tracked between two refreshes.  Once all
+   are in use, a new rectangle is merged into the one growing least.  */
+#define DIRTY_REGION_COUNT	8
+
+/* Number of slots in the cache of rendered character cells.  */
+#define GLYPH_CACHE_SIZE	256
+
 struct grub_dirty_region
 {
   int top_left_x;
@@ -45,6 +52,17 @@ struct grub_dirty_region
   int bottom_right_y;
 };
 
+/* A character cell rendered in text layer format, index color with
+   transparency, keyed by the glyph and its colors.  */
+struct grub_glyph_cache_entry
+{
+  struct grub_font_glyph *glyph;
+  grub_video_color_t fg_color;
+  grub_video_color_t bg_color;
+  unsigned int width;
+  grub_uint8_t *data;
+};
+
 struct grub_colored_char
 {
   /* An Unicode codepoint.  */
@@ -93,8 +111,10 @@ struct grub_virtual_screen
   grub_video_color_t bg_color_display;
 
   /* Text buffer for virtual screen.  Contains (columns * rows) number
-     of entries.  */
+     of entries.  Rows are kept in a ring starting at first_row, so that
+     scrolling does not move them.  */
   struct grub_colored_char *text_buffer;
+  unsigned int first_row;
 
   int total_scroll;
 
@@ -123,7 +143,12 @@ static struct grub_video_render_target *text_layer;
 
 struct grub_gfxterm_background grub_gfxterm_background;
 
-static struct grub_dirty_region dirty_region;
+static struct grub_dirty_region dirty_regions[DIRTY_REGION_COUNT];
+static unsigned int dirty_region_count;
+
+static struct grub_glyph_cache_entry *glyph_cache;
+/* Set once the cache could not be allocated for this window.  */
+static int glyph_cache_disabled;
 
 static void dirty_region_reset (void);
 
@@ -168,6 +193,15 @@ set_term_color (grub_uint8_t term_color)
   grub_video_set_active_render_target (old_target);
 }
 
+static struct grub_colored_char *
+text_buffer_char (unsigned int cx, unsigned int cy)
+{
+  cy += virtual_screen.first_row;
+  if (cy >= virtual_screen.rows)
+    cy -= virtual_screen.rows;
+  return virtual_screen.text_buffer + cx + cy * virtual_screen.columns;
+}
+
 static void
 clear_char (struct grub_colored_char *c)
 {
@@ -193,6 +227,13 @@ grub_virtual_screen_free (void)
       grub_free (virtual_screen.text_buffer);
     }
 
+  /* Cached cells depend on the font and the character size.  */
+  if (glyph_cache)
+    grub_free (glyph_cache[0].data);
+  grub_free (glyph_cache);
+  glyph_cache = 0;
+  glyph_cache_disabled = 0;
+
   /* Reset virtual screen data.  */
   grub_memset (&virtual_screen, 0, sizeof (virtual_screen));
 
@@ -514,45 +555,92 @@ redraw_screen_rect (unsigned int x, unsigned int y,
 static void
 dirty_region_reset (void)
 {
-  dirty_region.top_left_x = -1;
-  dirty_region.top_left_y = -1;
-  dirty_region.bottom_right_x = -1;
-  dirty_region.bottom_right_y = -1;
+  dirty_region_count = 0;
   repaint_was_scheduled = 0;
 }
 
 static int
 dirty_region_is_empty (void)
 {
-  if ((dirty_region.top_left_x == -1)
-      || (dirty_region.top_left_y == -1)
-      || (dirty_region.bottom_right_x == -1)
-      || (dirty_region.bottom_right_y == -1))
-    return 1;
-  return 0;
+  return dirty_region_count == 0;
+}
+
+static grub_uint64_t
+dirty_region_area (const struct grub_dirty_region *r)
+{
+  return (grub_uint64_t) (r->bottom_right_x - r->top_left_x + 1)
+    * (r->bottom_right_y - r->top_left_y + 1);
+}
+
+static void
+dirty_region_merge (struct grub_dirty_region *r,
+		    const struct grub_dirty_region *with)
+{
+  if (with->top_left_x < r->top_left_x)
+    r->top_left_x = with->top_left_x;
+  if (with->top_left_y < r->top_left_y)
+    r->top_left_y = with->top_left_y;
+  if (with->bottom_right_x > r->bottom_right_x)
+    r->bottom_right_x = with->bottom_right_x;
+  if (with->bottom_right_y > r->bottom_right_y)
+    r->bottom_right_y = with->bottom_right_y;
 }
 
 static void
 dirty_region_add_real (int x, int y, unsigned int width, unsigned int height)
 {
-  if (dirty_region_is_empty ())
+  struct grub_dirty_region region;
+  unsigned int i;
+
+  region.top_left_x = x;
+  region.top_left_y = y;
+  region.bottom_right_x = x + width - 1;
+  region.bottom_right_y = y + height - 1;
+
+  /* Absorb every rectangle overlapping or touching the new one, so that
+     consecutive characters of a line end up in a single rectangle.  */
+  i = 0;
+  while (i < dirty_region_count)
     {
-      dirty_region.top_left_x = x;
-      dirty_region.top_left_y = y;
-      dirty_region.bottom_right_x = x + width - 1;
-      dirty_region.bottom_right_y = y + height - 1;
+      struct grub_dirty_region *r = &dirty_regions[i];
+
+      if (r->top_left_x > region.bottom_right_x + 1
+	  || region.top_left_x > r->bottom_right_x + 1
+	  || r->top_left_y > region.bottom_right_y + 1
+	  || region.top_left_y > r->bottom_right_y + 1)
+	{
+	  i++;
+	  continue;
+	}
+      dirty_region_merge (&region, r);
+      *r = dirty_regions[--dirty_region_count];
+      i = 0;
     }
-  else
+
+  if (dirty_region_count == DIRTY_REGION_COUNT)
     {
-      if (x < dirty_region.top_left_x)
-        dirty_region.top_left_x = x;
-      if (y < dirty_region.top_left_y)
-        dirty_region.top_left_y = y;
-      if ((x + (int)width - 1) > dirty_region.bottom_right_x)
-        dirty_region.bottom_right_x = x + width - 1;
-      if ((y + (int)height - 1) > dirty_region.bottom_right_y)
-        dirty_region.bottom_right_y = y + height - 1;
+      grub_uint64_t best_growth = 0;
+      unsigned int best = 0;
+
+      for (i = 0; i < dirty_region_count; i++)
+	{
+	  struct grub_dirty_region merged = dirty_regions[i];
+	  grub_uint64_t growth;
+
+	  dirty_region_merge (&merged, &region);
+	  growth = dirty_region_area (&merged)
+	    - dirty_region_area (&dirty_regions[i]);
+	  if (i == 0 || growth < best_growth)
+	    {
+	      best = i;
+	      best_growth = growth;
+	    }
+	}
+      dirty_region_merge (&dirty_regions[best], &region);
+      return;
     }
+
+  dirty_regions[dirty_region_count++] = region;
 }
 
 static void
@@ -583,24 +671,136 @@ dirty_region_add_virtualscreen (void)
 static void
 dirty_region_redraw (void)
 {
-  int x;
-  int y;
-  int width;
-  int height;
+  unsigned int i;
 
   if (dirty_region_is_empty ())
     return;
 
-  x = dirty_region.top_left_x;
-  y = dirty_region.top_left_y;
-
-  width = dirty_region.bottom_right_x - x + 1;
-  height = dirty_region.bottom_right_y - y + 1;
-
   if (repaint_was_scheduled && grub_gfxterm_decorator_hook)
     grub_gfxterm_decorator_hook ();
 
-  redraw_screen_rect (x, y, width, height);
+  for (i = 0; i < dirty_region_count; i++)
+    redraw_screen_rect (dirty_regions[i].top_left_x,
+			dirty_regions[i].top_left_y,
+			dirty_regions[i].bottom_right_x
+			- dirty_regions[i].top_left_x + 1,
+			dirty_regions[i].bottom_right_y
+			- dirty_regions[i].top_left_y + 1);
+}
+
+/* Render GLYPH in FG_COLOR over BG_COLOR into the WIDTH x HEIGHT cell of
+   ENTRY, the same way paint_char does on the text layer, which must be
+   active.  Return 0 if the cell cannot be represented exactly.  */
+static int
+glyph_cache_fill (struct grub_glyph_cache_entry *entry,
+		  struct grub_font_glyph *glyph,
+		  grub_video_color_t fg_color, grub_video_color_t bg_color,
+		  unsigned int width, unsigned int height, int top)
+{
+  grub_uint8_t red, green, blue, alpha;
+  grub_uint8_t fg, *ptr;
+  unsigned int i, j, bit;
+
+  /* Glyphs are blended on the text layer: opaque pixels take the mapped
+     foreground color and transparent ones keep the background.  */
+  grub_video_unmap_color (fg_color, &red, &green, &blue, &alpha);
+  if (alpha == 0)
+    fg = bg_color;
+  else if (alpha == 255)
+    fg = grub_video_map_rgba (red, green, blue, alpha);
+  else
+    return 0;
+
+  /* Blitting text layer format maps colors through the terminal
+     palette, which only leaves these values untouched.  */
+  if (fg >= 16 && fg != 0xf0)
+    return 0;
+
+  grub_memset (entry->data, bg_color, width * height);
+  for (j = 0, bit = 0; j < glyph->height; j++)
+    {
+      ptr = entry->data + (top + j) * width + glyph->offset_x;
+      for (i = 0; i < glyph->width; i++, bit++)
+	if (glyph->bitmap[bit / 8] & (0x80 >> (bit % 8)))
+	  ptr[i] = fg;
+    }
+
+  entry->glyph = glyph;
+  entry->fg_color = fg_color;
+  entry->bg_color = bg_color;
+  entry->width = width;
+  return 1;
+}
+
+/* Draw the cell of GLYPH at X, Y of the text layer, which must be
+   active, from the cache.  Return 0 if the caller has to render it.  */
+static int
+paint_cached_glyph (struct grub_font_glyph *glyph,
+		    grub_video_color_t fg_color, grub_video_color_t bg_color,
+		    unsigned int x, unsigned int y,
+		    unsigned int width, unsigned int height, int ascent)
+{
+  struct grub_glyph_cache_entry *entry;
+  struct grub_video_bitmap cell;
+  unsigned int cell_size;
+  int top;
+
+  if (glyph_cache_disabled
+      || width > 2 * virtual_screen.normal_char_width
+      || (bg_color >= 16 && bg_color != 0xf0))
+    return 0;
+
+  /* Only cells holding the whole glyph can be drawn as one block.  */
+  top = ascent - glyph->offset_y - glyph->height;
+  if (glyph->offset_x < 0 || top < 0
+      || (unsigned int) (glyph->offset_x + glyph->width) > width
+      || (unsigned int) (top + glyph->height) > height)
+    return 0;
+
+  cell_size = 2 * virtual_screen.normal_char_width
+    * virtual_screen.normal_char_height;
+  if (!glyph_cache)
+    {
+      unsigned int i;
+
+      glyph_cache = grub_zalloc (GLYPH_CACHE_SIZE * sizeof (*glyph_cache));
+      if (glyph_cache)
+	glyph_cache[0].data = grub_malloc (GLYPH_CACHE_SIZE * cell_size);
+      if (!glyph_cache || !glyph_cache[0].data)
+	{
+	  grub_free (glyph_cache);
+	  glyph_cache = 0;
+	  glyph_cache_disabled = 1;
+	  grub_errno = GRUB_ERR_NONE;
+	  return 0;
+	}
+      for (i = 1; i < GLYPH_CACHE_SIZE; i++)
+	glyph_cache[i].data = glyph_cache[0].data + i * cell_size;
+    }
+
+  entry = &glyph_cache[(((grub_addr_t) glyph >> 3) ^ (fg_color << 4)
+			^ bg_color) % GLYPH_CACHE_SIZE];
+  if ((entry->glyph != glyph || entry->fg_color != fg_color
+       || entry->bg_color != bg_color || entry->width != width)
+      && !glyph_cache_fill (entry, glyph, fg_color, bg_color,
+			    width, height, top))
+    return 0;
+
+  grub_memset (&cell, 0, sizeof (cell));
+  cell.mode_info.width = width;
+  cell.mode_info.height = height;
+  cell.mode_info.mode_type = GRUB_VIDEO_MODE_TYPE_INDEX_COLOR
+    | GRUB_VIDEO_MODE_TYPE_ALPHA;
+  cell.mode_info.blit_format = GRUB_VIDEO_BLIT_FORMAT_INDEXCOLOR_ALPHA;
+  cell.mode_info.bpp = 8;
+  cell.mode_info.bytes_per_pixel = 1;
+  cell.mode_info.pitch = width;
+  cell.mode_info.number_of_colors = 256;
+  cell.data = entry->data;
+
+  grub_video_blit_bitmap (&cell, GRUB_VIDEO_BLIT_REPLACE, x, y,
+			  0, 0, width, height);
+  return 1;
 }
 
 static inline void
@@ -615,13 +815,13 @@ paint_char (unsigned cx, unsigned cy)
   int ascent;
   unsigned int height;
   unsigned int width;
+  int left, top, right, bottom;
 
   if (cy + virtual_screen.total_scroll >= virtual_screen.rows)
     return;
 
   /* Find out active character.  */
-  p = (virtual_screen.text_buffer
-       + cx + (cy * virtual_screen.columns));
+  p = text_buffer_char (cx, cy);
 
   if (!p->code.base)
     return;
@@ -644,15 +844,42 @@ paint_char (unsigned cx, unsigned cy)
   x = cx * virtual_screen.normal_char_width;
   y = (cy + virtual_screen.total_scroll) * virtual_screen.normal_char_height;
 
-  /* Render glyph to text layer.  */
+  /* Render glyph to text layer.  Plain characters are drawn from the
+     cache: the font returns a stable glyph for them, while composed ones
+     are rebuilt in a shared buffer on every call.  */
   grub_video_set_active_render_target (text_layer);
-  grub_video_fill_rect (bgcolor, x, y, width, height);
-  grub_font_draw_glyph (glyph, color, x, y + ascent);
+  if (p->code.ncomb || p->code.attributes
+      || !paint_cached_glyph (glyph, color, bgcolor, x, y,
+			      width, height, ascent))
+    {
+      grub_video_fill_rect (bgcolor, x, y, width, height);
+      grub_font_draw_glyph (glyph, color, x, y + ascent);
+    }
   grub_video_set_active_render_target (render_target);
 
   /* Mark character to be drawn.  */
   dirty_region_add (virtual_screen.offset_x + x, virtual_screen.offset_y + y,
                     width, height);
+
+  /* Glyphs may reach out of their cell, mark that part too.  */
+  left = (int) x + glyph->offset_x;
+  top = (int) y + ascent - glyph->offset_y - glyph->height;
+  right = left + glyph->width;
+  bottom = top + glyph->height;
+  if (left < 0)
+    left = 0;
+  if (top < 0)
+    top = 0;
+  if (right > (int) virtual_screen.width)
+    right = virtual_screen.width;
+  if (bottom > (int) virtual_screen.height)
+    bottom = virtual_screen.height;
+  if (left < right && top < bottom
+      && (left < (int) x || top < (int) y
+	  || right > (int) (x + width) || bottom > (int) (y + height)))
+    dirty_region_add (virtual_screen.offset_x + left,
+		      virtual_screen.offset_y + top,
+		      right - left, bottom - top);
 }
 
 static inline void
@@ -804,24 +1031,19 @@ real_scroll (void)
 static void
 scroll_up (void)
 {
+  struct grub_colored_char *line;
   unsigned int i;
 
-  /* Clear first line in text buffer.  */
-  for (i = 0; i < virtual_screen.columns; i++)
-    grub_unicode_destroy_glyph (&virtual_screen.text_buffer[i].code);
-  
-  /* Scroll text buffer with one line to up.  */
-  grub_memmove (virtual_screen.text_buffer,
-                virtual_screen.text_buffer + virtual_screen.columns,
-                sizeof (*virtual_screen.text_buffer)
-                * virtual_screen.columns
-                * (virtual_screen.rows - 1));
+  /* Scroll text buffer with one line to up, reusing the first line as
+     the last one.  */
+  line = text_buffer_char (0, 0);
+  virtual_screen.first_row++;
+  if (virtual_screen.first_row == virtual_screen.rows)
+    virtual_screen.first_row = 0;
 
   /* Clear last line in text buffer.  */
-  for (i = virtual_screen.columns * (virtual_screen.rows - 1);
-       i < virtual_screen.columns * virtual_screen.rows;
-       i++)
-    clear_char (&(virtual_screen.text_buffer[i]));
+  for (i = 0; i < virtual_screen.columns; i++)
+    clear_char (&line[i]);
 
   virtual_screen.total_scroll++;
 }
@@ -881,9 +1103,7 @@ grub_gfxterm_putchar (struct grub_term_output *term,
 	}
 
       /* Find position on virtual screen, and fill information.  */
-      p = (virtual_screen.text_buffer +
-           virtual_screen.cursor_x +
-           virtual_screen.cursor_y * virtual_screen.columns);
+      p = text_buffer_char (virtual_screen.cursor_x, virtual_screen.cursor_y);
       grub_unicode_destroy_glyph (&p->code);
       grub_unicode_set_glyph (&p->code, c);
       grub_errno = GRUB_ERR_NONE;
@@ -0,0 +1,426 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/crypto.h>
+#include <grub/cryptodisk.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* Known answers for the AES paths of cryptodisk, which use AES-NI where
+   the CPU has it, checked against the FIPS and IEEE vectors and against
+   the generic libgcrypt cipher.  */
+
+#define SECTOR_BITS	9
+#define SECTOR_SIZE	(1 << SECTOR_BITS)
+#define RANDOM_SECTORS	4
+
+/* FIPS-197 appendix C.  */
+static const grub_uint8_t fips197_plain[16] =
+  {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+  };
+
+static const grub_uint8_t fips197_cipher[3][16] =
+  {
+    /* C.1, AES-128.  */
+    { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+      0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a },
+    /* C.2, AES-192.  */
+    { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+      0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 },
+    /* C.3, AES-256.  */
+    { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+      0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 }
+  };
+
+/* IEEE 1619-2007 vector 4: AES-128-XTS, data unit 0.  The plaintext of
+   both vectors is the bytes 0 to 255 twice.  */
+static const grub_uint8_t xts_key4[32] =
+  {
+    0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45,
+    0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26,
+    0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93,
+    0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95
+  };
+
+static const grub_uint8_t xts_cipher4[SECTOR_SIZE] =
+  {
+    0x27, 0xa7, 0x47, 0x9b, 0xef, 0xa1, 0xd4, 0x76,
+    0x48, 0x9f, 0x30, 0x8c, 0xd4, 0xcf, 0xa6, 0xe2,
+    0xa9, 0x6e, 0x4b, 0xbe, 0x32, 0x08, 0xff, 0x25,
+    0x28, 0x7d, 0xd3, 0x81, 0x96, 0x16, 0xe8, 0x9c,
+    0xc7, 0x8c, 0xf7, 0xf5, 0xe5, 0x43, 0x44, 0x5f,
+    0x83, 0x33, 0xd8, 0xfa, 0x7f, 0x56, 0x00, 0x00,
+    0x05, 0x27, 0x9f, 0xa5, 0xd8, 0xb5, 0xe4, 0xad,
+    0x40, 0xe7, 0x36, 0xdd, 0xb4, 0xd3, 0x54, 0x12,
+    0x32, 0x80, 0x63, 0xfd, 0x2a, 0xab, 0x53, 0xe5,
+    0xea, 0x1e, 0x0a, 0x9f, 0x33, 0x25, 0x00, 0xa5,
+    0xdf, 0x94, 0x87, 0xd0, 0x7a, 0x5c, 0x92, 0xcc,
+    0x51, 0x2c, 0x88, 0x66, 0xc7, 0xe8, 0x60, 0xce,
+    0x93, 0xfd, 0xf1, 0x66, 0xa2, 0x49, 0x12, 0xb4,
+    0x22, 0x97, 0x61, 0x46, 0xae, 0x20, 0xce, 0x84,
+    0x6b, 0xb7, 0xdc, 0x9b, 0xa9, 0x4a, 0x76, 0x7a,
+    0xae, 0xf2, 0x0c, 0x0d, 0x61, 0xad, 0x02, 0x65,
+    0x5e, 0xa9, 0x2d, 0xc4, 0xc4, 0xe4, 0x1a, 0x89,
+    0x52, 0xc6, 0x51, 0xd3, 0x31, 0x74, 0xbe, 0x51,
+    0xa1, 0x0c, 0x42, 0x11, 0x10, 0xe6, 0xd8, 0x15,
+    0x88, 0xed, 0xe8, 0x21, 0x03, 0xa2, 0x52, 0xd8,
+    0xa7, 0x50, 0xe8, 0x76, 0x8d, 0xef, 0xff, 0xed,
+    0x91, 0x22, 0x81, 0x0a, 0xae, 0xb9, 0x9f, 0x91,
+    0x72, 0xaf, 0x82, 0xb6, 0x04, 0xdc, 0x4b, 0x8e,
+    0x51, 0xbc, 0xb0, 0x82, 0x35, 0xa6, 0xf4, 0x34,
+    0x13, 0x32, 0xe4, 0xca, 0x60, 0x48, 0x2a, 0x4b,
+    0xa1, 0xa0, 0x3b, 0x3e, 0x65, 0x00, 0x8f, 0xc5,
+    0xda, 0x76, 0xb7, 0x0b, 0xf1, 0x69, 0x0d, 0xb4,
+    0xea, 0xe2, 0x9c, 0x5f, 0x1b, 0xad, 0xd0, 0x3c,
+    0x5c, 0xcf, 0x2a, 0x55, 0xd7, 0x05, 0xdd, 0xcd,
+    0x86, 0xd4, 0x49, 0x51, 0x1c, 0xeb, 0x7e, 0xc3,
+    0x0b, 0xf1, 0x2b, 0x1f, 0xa3, 0x5b, 0x91, 0x3f,
+    0x9f, 0x74, 0x7a, 0x8a, 0xfd, 0x1b, 0x13, 0x0e,
+    0x94, 0xbf, 0xf9, 0x4e, 0xff, 0xd0, 0x1a, 0x91,
+    0x73, 0x5c, 0xa1, 0x72, 0x6a, 0xcd, 0x0b, 0x19,
+    0x7c, 0x4e, 0x5b, 0x03, 0x39, 0x36, 0x97, 0xe1,
+    0x26, 0x82, 0x6f, 0xb6, 0xbb, 0xde, 0x8e, 0xcc,
+    0x1e, 0x08, 0x29, 0x85, 0x16, 0xe2, 0xc9, 0xed,
+    0x03, 0xff, 0x3c, 0x1b, 0x78, 0x60, 0xf6, 0xde,
+    0x76, 0xd4, 0xce, 0xcd, 0x94, 0xc8, 0x11, 0x98,
+    0x55, 0xef, 0x52, 0x97, 0xca, 0x67, 0xe9, 0xf3,
+    0xe7, 0xff, 0x72, 0xb1, 0xe9, 0x97, 0x85, 0xca,
+    0x0a, 0x7e, 0x77, 0x20, 0xc5, 0xb3, 0x6d, 0xc6,
+    0xd7, 0x2c, 0xac, 0x95, 0x74, 0xc8, 0xcb, 0xbc,
+    0x2f, 0x80, 0x1e, 0x23, 0xe5, 0x6f, 0xd3, 0x44,
+    0xb0, 0x7f, 0x22, 0x15, 0x4b, 0xeb, 0xa0, 0xf0,
+    0x8c, 0xe8, 0x89, 0x1e, 0x64, 0x3e, 0xd9, 0x95,
+    0xc9, 0x4d, 0x9a, 0x69, 0xc9, 0xf1, 0xb5, 0xf4,
+    0x99, 0x02, 0x7a, 0x78, 0x57, 0x2a, 0xee, 0xbd,
+    0x74, 0xd2, 0x0c, 0xc3, 0x98, 0x81, 0xc2, 0x13,
+    0xee, 0x77, 0x0b, 0x10, 0x10, 0xe4, 0xbe, 0xa7,
+    0x18, 0x84, 0x69, 0x77, 0xae, 0x11, 0x9f, 0x7a,
+    0x02, 0x3a, 0xb5, 0x8c, 0xca, 0x0a, 0xd7, 0x52,
+    0xaf, 0xe6, 0x56, 0xbb, 0x3c, 0x17, 0x25, 0x6a,
+    0x9f, 0x6e, 0x9b, 0xf1, 0x9f, 0xdd, 0x5a, 0x38,
+    0xfc, 0x82, 0xbb, 0xe8, 0x72, 0xc5, 0x53, 0x9e,
+    0xdb, 0x60, 0x9e, 0xf4, 0xf7, 0x9c, 0x20, 0x3e,
+    0xbb, 0x14, 0x0f, 0x2e, 0x58, 0x3c, 0xb2, 0xad,
+    0x15, 0xb4, 0xaa, 0x5b, 0x65, 0x50, 0x16, 0xa8,
+    0x44, 0x92, 0x77, 0xdb, 0xd4, 0x77, 0xef, 0x2c,
+    0x8d, 0x6c, 0x01, 0x7d, 0xb7, 0x38, 0xb1, 0x8d,
+    0xeb, 0x4a, 0x42, 0x7d, 0x19, 0x23, 0xce, 0x3f,
+    0xf2, 0x62, 0x73, 0x57, 0x79, 0xa4, 0x18, 0xf2,
+    0x0a, 0x28, 0x2d, 0xf9, 0x20, 0x14, 0x7b, 0xea,
+    0xbe, 0x42, 0x1e, 0xe5, 0x31, 0x9d, 0x05, 0x68,
+  };
+
+/* IEEE 1619-2007 vector 10: AES-256-XTS, data unit 0xff.  */
+static const grub_uint8_t xts_key10[64] =
+  {
+    0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45,
+    0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26,
+    0x62, 0x49, 0x77, 0x57, 0x24, 0x70, 0x93, 0x69,
+    0x99, 0x59, 0x57, 0x49, 0x66, 0x96, 0x76, 0x27,
+    0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93,
+    0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95,
+    0x02, 0x88, 0x41, 0x97, 0x16, 0x93, 0x99, 0x37,
+    0x51, 0x05, 0x82, 0x09, 0x74, 0x94, 0x45, 0x92
+  };
+
+static const grub_uint8_t xts_cipher10[SECTOR_SIZE] =
+  {
+    0x1c, 0x3b, 0x3a, 0x10, 0x2f, 0x77, 0x03, 0x86,
+    0xe4, 0x83, 0x6c, 0x99, 0xe3, 0x70, 0xcf, 0x9b,
+    0xea, 0x00, 0x80, 0x3f, 0x5e, 0x48, 0x23, 0x57,
+    0xa4, 0xae, 0x12, 0xd4, 0x14, 0xa3, 0xe6, 0x3b,
+    0x5d, 0x31, 0xe2, 0x76, 0xf8, 0xfe, 0x4a, 0x8d,
+    0x66, 0xb3, 0x17, 0xf9, 0xac, 0x68, 0x3f, 0x44,
+    0x68, 0x0a, 0x86, 0xac, 0x35, 0xad, 0xfc, 0x33,
+    0x45, 0xbe, 0xfe, 0xcb, 0x4b, 0xb1, 0x88, 0xfd,
+    0x57, 0x76, 0x92, 0x6c, 0x49, 0xa3, 0x09, 0x5e,
+    0xb1, 0x08, 0xfd, 0x10, 0x98, 0xba, 0xec, 0x70,
+    0xaa, 0xa6, 0x69, 0x99, 0xa7, 0x2a, 0x82, 0xf2,
+    0x7d, 0x84, 0x8b, 0x21, 0xd4, 0xa7, 0x41, 0xb0,
+    0xc5, 0xcd, 0x4d, 0x5f, 0xff, 0x9d, 0xac, 0x89,
+    0xae, 0xba, 0x12, 0x29, 0x61, 0xd0, 0x3a, 0x75,
+    0x71, 0x23, 0xe9, 0x87, 0x0f, 0x8a, 0xcf, 0x10,
+    0x00, 0x02, 0x08, 0x87, 0x89, 0x14, 0x29, 0xca,
+    0x2a, 0x3e, 0x7a, 0x7d, 0x7d, 0xf7, 0xb1, 0x03,
+    0x55, 0x16, 0x5c, 0x8b, 0x9a, 0x6d, 0x0a, 0x7d,
+    0xe8, 0xb0, 0x62, 0xc4, 0x50, 0x0d, 0xc4, 0xcd,
+    0x12, 0x0c, 0x0f, 0x74, 0x18, 0xda, 0xe3, 0xd0,
+    0xb5, 0x78, 0x1c, 0x34, 0x80, 0x3f, 0xa7, 0x54,
+    0x21, 0xc7, 0x90, 0xdf, 0xe1, 0xde, 0x18, 0x34,
+    0xf2, 0x80, 0xd7, 0x66, 0x7b, 0x32, 0x7f, 0x6c,
+    0x8c, 0xd7, 0x55, 0x7e, 0x12, 0xac, 0x3a, 0x0f,
+    0x93, 0xec, 0x05, 0xc5, 0x2e, 0x04, 0x93, 0xef,
+    0x31, 0xa1, 0x2d, 0x3d, 0x92, 0x60, 0xf7, 0x9a,
+    0x28, 0x9d, 0x6a, 0x37, 0x9b, 0xc7, 0x0c, 0x50,
+    0x84, 0x14, 0x73, 0xd1, 0xa8, 0xcc, 0x81, 0xec,
+    0x58, 0x3e, 0x96, 0x45, 0xe0, 0x7b, 0x8d, 0x96,
+    0x70, 0x65, 0x5b, 0xa5, 0xbb, 0xcf, 0xec, 0xc6,
+    0xdc, 0x39, 0x66, 0x38, 0x0a, 0xd8, 0xfe, 0xcb,
+    0x17, 0xb6, 0xba, 0x02, 0x46, 0x9a, 0x02, 0x0a,
+    0x84, 0xe1, 0x8e, 0x8f, 0x84, 0x25, 0x20, 0x70,
+    0xc1, 0x3e, 0x9f, 0x1f, 0x28, 0x9b, 0xe5, 0x4f,
+    0xbc, 0x48, 0x14, 0x57, 0x77, 0x8f, 0x61, 0x60,
+    0x15, 0xe1, 0x32, 0x7a, 0x02, 0xb1, 0x40, 0xf1,
+    0x50, 0x5e, 0xb3, 0x09, 0x32, 0x6d, 0x68, 0x37,
+    0x8f, 0x83, 0x74, 0x59, 0x5c, 0x84, 0x9d, 0x84,
+    0xf4, 0xc3, 0x33, 0xec, 0x44, 0x23, 0x88, 0x51,
+    0x43, 0xcb, 0x47, 0xbd, 0x71, 0xc5, 0xed, 0xae,
+    0x9b, 0xe6, 0x9a, 0x2f, 0xfe, 0xce, 0xb1, 0xbe,
+    0xc9, 0xde, 0x24, 0x4f, 0xbe, 0x15, 0x99, 0x2b,
+    0x11, 0xb7, 0x7c, 0x04, 0x0f, 0x12, 0xbd, 0x8f,
+    0x6a, 0x97, 0x5a, 0x44, 0xa0, 0xf9, 0x0c, 0x29,
+    0xa9, 0xab, 0xc3, 0xd4, 0xd8, 0x93, 0x92, 0x72,
+    0x84, 0xc5, 0x87, 0x54, 0xcc, 0xe2, 0x94, 0x52,
+    0x9f, 0x86, 0x14, 0xdc, 0xd2, 0xab, 0xa9, 0x91,
+    0x92, 0x5f, 0xed, 0xc4, 0xae, 0x74, 0xff, 0xac,
+    0x6e, 0x33, 0x3b, 0x93, 0xeb, 0x4a, 0xff, 0x04,
+    0x79, 0xda, 0x9a, 0x41, 0x0e, 0x44, 0x50, 0xe0,
+    0xdd, 0x7a, 0xe4, 0xc6, 0xe2, 0x91, 0x09, 0x00,
+    0x57, 0x5d, 0xa4, 0x01, 0xfc, 0x07, 0x05, 0x9f,
+    0x64, 0x5e, 0x8b, 0x7e, 0x9b, 0xfd, 0xef, 0x33,
+    0x94, 0x30, 0x54, 0xff, 0x84, 0x01, 0x14, 0x93,
+    0xc2, 0x7b, 0x34, 0x29, 0xea, 0xed, 0xb4, 0xed,
+    0x53, 0x76, 0x44, 0x1a, 0x77, 0xed, 0x43, 0x85,
+    0x1a, 0xd7, 0x7f, 0x16, 0xf5, 0x41, 0xdf, 0xd2,
+    0x69, 0xd5, 0x0d, 0x6a, 0x5f, 0x14, 0xfb, 0x0a,
+    0xab, 0x1c, 0xbb, 0x4c, 0x15, 0x50, 0xbe, 0x97,
+    0xf7, 0xab, 0x40, 0x66, 0x19, 0x3c, 0x4c, 0xaa,
+    0x77, 0x3d, 0xad, 0x38, 0x01, 0x4b, 0xd2, 0x09,
+    0x2f, 0xa7, 0x55, 0xc8, 0x24, 0xbb, 0x5e, 0x54,
+    0xc4, 0xf3, 0x6f, 0xfd, 0xa9, 0xfc, 0xea, 0x70,
+    0xb9, 0xc6, 0xe6, 0x93, 0xe1, 0x48, 0xc1, 0x51,
+  };
+
+static grub_cryptodisk_t
+open_dev (grub_cryptodisk_mode_t mode, const grub_uint8_t *key,
+	  grub_size_t keysize)
+{
+  grub_uint8_t k[64];
+  grub_cryptodisk_t dev;
+  gcry_err_code_t err;
+
+  dev = grub_zalloc (sizeof (*dev));
+  if (!dev)
+    return NULL;
+  dev->cipher = grub_crypto_cipher_open (GRUB_CIPHER_AES);
+  if (mode == GRUB_CRYPTODISK_MODE_XTS)
+    dev->secondary_cipher = grub_crypto_cipher_open (GRUB_CIPHER_AES);
+  if (!dev->cipher
+      || (mode == GRUB_CRYPTODISK_MODE_XTS && !dev->secondary_cipher))
+    goto fail;
+  dev->mode = mode;
+  dev->mode_iv = (mode == GRUB_CRYPTODISK_MODE_XTS
+		  ? GRUB_CRYPTODISK_MODE_IV_PLAIN64
+		  : GRUB_CRYPTODISK_MODE_IV_NULL);
+  dev->log_sector_size = SECTOR_BITS;
+
+  grub_memcpy (k, key, keysize);
+  err = grub_cryptodisk_setkey (dev, k, keysize);
+  grub_test_assert (err == GPG_ERR_NO_ERROR, "setkey failed: %d", err);
+  if (err)
+    goto fail;
+  return dev;
+
+ fail:
+  grub_crypto_cipher_close (dev->cipher);
+  grub_crypto_cipher_close (dev->secondary_cipher);
+  grub_free (dev);
+  return NULL;
+}
+
+static void
+close_dev (grub_cryptodisk_t dev)
+{
+  grub_crypto_cipher_close (dev->cipher);
+  grub_crypto_cipher_close (dev->secondary_cipher);
+  grub_cryptodisk_free_scratch (dev);
+  grub_free (dev);
+}
+
+static void
+test_fips197 (void)
+{
+  grub_uint8_t key[32], buf[16];
+  unsigned i;
+
+  for (i = 0; i < sizeof (key); i++)
+    key[i] = i;
+
+  for (i = 0; i < ARRAY_SIZE (fips197_cipher); i++)
+    {
+      grub_size_t keysize = 16 + 8 * i;
+      grub_cryptodisk_t dev;
+
+      dev = open_dev (GRUB_CRYPTODISK_MODE_ECB, key, keysize);
+      if (!dev)
+	continue;
+
+      grub_memcpy (buf, fips197_cipher[i], sizeof (buf));
+      grub_test_assert (grub_cryptodisk_decrypt (dev, buf, sizeof (buf), 0)
+			== GPG_ERR_NO_ERROR, "AES-%u: decrypt failed",
+			(unsigned) keysize * 8);
+      grub_test_assert (grub_memcmp (buf, fips197_plain, sizeof (buf)) == 0,
+			"AES-%u: cryptodisk differs from FIPS-197",
+			(unsigned) keysize * 8);
+
+      grub_memcpy (buf, fips197_cipher[i], sizeof (buf));
+      grub_crypto_ecb_decrypt (dev->cipher, buf, buf, sizeof (buf));
+      grub_test_assert (grub_memcmp (buf, fips197_plain, sizeof (buf)) == 0,
+			"AES-%u: libgcrypt differs from FIPS-197",
+			(unsigned) keysize * 8);
+
+      close_dev (dev);
+    }
+}
+
+static void
+test_xts_vector (const char *name, const grub_uint8_t *key,
+		 grub_size_t keysize, grub_disk_addr_t sector,
+		 const grub_uint8_t *cipher)
+{
+  grub_uint8_t *buf;
+  grub_cryptodisk_t dev;
+  unsigned i;
+
+  dev = open_dev (GRUB_CRYPTODISK_MODE_XTS, key, keysize);
+  buf = grub_malloc (SECTOR_SIZE);
+  if (!dev || !buf)
+    {
+      grub_test_assert (0, "%s: out of memory", name);
+      goto out;
+    }
+
+  grub_memcpy (buf, cipher, SECTOR_SIZE);
+  grub_test_assert (grub_cryptodisk_decrypt (dev, buf, SECTOR_SIZE, sector)
+		    == GPG_ERR_NO_ERROR, "%s: decrypt failed", name);
+  for (i = 0; i < SECTOR_SIZE; i++)
+    if (buf[i] != (i & 0xff))
+      break;
+  grub_test_assert (i == SECTOR_SIZE, "%s: wrong plaintext at byte %u",
+		    name, i);
+
+ out:
+  grub_free (buf);
+  if (dev)
+    close_dev (dev);
+}
+
+/* Multiply the XTS tweak by x in GF(2^128).  */
+static void
+xts_mul_x (grub_uint8_t *t)
+{
+  unsigned carry = 0, i;
+
+  for (i = 0; i < 16; i++)
+    {
+      unsigned c = t[i] >> 7;
+      t[i] = (t[i] << 1) | carry;
+      carry = c;
+    }
+  if (carry)
+    t[0] ^= 0x87;
+}
+
+/* Decrypt random sectors through cryptodisk and through an XTS built
+   here on the generic cipher.  */
+static void
+test_xts_random (grub_size_t keysize)
+{
+  grub_uint8_t key[64], tweak[16], *fast, *slow;
+  grub_uint32_t seed = keysize;
+  grub_cryptodisk_t dev;
+  unsigned i, j, s;
+
+  for (i = 0; i < keysize; i++)
+    {
+      seed = seed * 1103515245 + 12345;
+      key[i] = seed >> 16;
+    }
+
+  dev = open_dev (GRUB_CRYPTODISK_MODE_XTS, key, keysize);
+  fast = grub_malloc (RANDOM_SECTORS * SECTOR_SIZE);
+  slow = grub_malloc (RANDOM_SECTORS * SECTOR_SIZE);
+  if (!dev || !fast || !slow)
+    {
+      grub_test_assert (0, "XTS-%u: out of memory", (unsigned) keysize * 4);
+      goto out;
+    }
+
+  for (i = 0; i < RANDOM_SECTORS * SECTOR_SIZE; i++)
+    {
+      seed = seed * 1103515245 + 12345;
+      fast[i] = slow[i] = seed >> 16;
+    }
+
+  grub_test_assert (grub_cryptodisk_decrypt (dev, fast,
+					     RANDOM_SECTORS * SECTOR_SIZE,
+					     0x12345)
+		    == GPG_ERR_NO_ERROR, "XTS-%u: decrypt failed",
+		    (unsigned) keysize * 4);
+
+  for (s = 0; s < RANDOM_SECTORS; s++)
+    {
+      grub_uint8_t *sec = slow + s * SECTOR_SIZE;
+      grub_uint64_t n = 0x12345 + s;
+
+      grub_memset (tweak, 0, sizeof (tweak));
+      for (j = 0; j < 8; j++)
+	tweak[j] = n >> (8 * j);
+      grub_crypto_ecb_encrypt (dev->secondary_cipher, tweak, tweak,
+			       sizeof (tweak));
+      for (j = 0; j < SECTOR_SIZE; j += 16)
+	{
+	  grub_crypto_xor (sec + j, sec + j, tweak, 16);
+	  grub_crypto_ecb_decrypt (dev->cipher, sec + j, sec + j, 16);
+	  grub_crypto_xor (sec + j, sec + j, tweak, 16);
+	  xts_mul_x (tweak);
+	}
+    }
+
+  grub_test_assert (grub_memcmp (fast, slow,
+				 RANDOM_SECTORS * SECTOR_SIZE) == 0,
+		    "XTS-%u: cryptodisk differs from libgcrypt",
+		    (unsigned) keysize * 4);
+
+ out:
+  grub_free (fast);
+  grub_free (slow);
+  if (dev)
+    close_dev (dev);
+}
+
+static void
+cryptodisk_aes_test (void)
+{
+  test_fips197 ();
+  test_xts_vector ("IEEE 1619 vector 4", xts_key4, sizeof (xts_key4), 0,
+		   xts_cipher4);
+  test_xts_vector ("IEEE 1619 vector 10", xts_key10, sizeof (xts_key10), 0xff,
+		   xts_cipher10);
+  test_xts_random (32);
+  test_xts_random (48);
+  test_xts_random (64);
+}
+
+GRUB_FUNCTIONAL_TEST (cryptodisk_aes_test, cryptodisk_aes_test);
@@ -0,0 +1,125 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/time.h>
+#include <grub/deflate.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* Inflate throughput on the benchmark corpus, for Huffman coded, stored
+   and random access reads.  */
+
+#include "inflate_corpus.h"
+
+#define BENCH_ROUNDS 1000
+
+/* Wrap DATA into a raw deflate stream of one stored block.  */
+static grub_uint8_t *
+make_stored (const grub_uint8_t *data, grub_size_t size, grub_size_t *out_size)
+{
+  grub_uint8_t *out;
+
+  out = grub_malloc (size + 5);
+  if (!out)
+    return NULL;
+  out[0] = 1;
+  out[1] = size & 0xff;
+  out[2] = size >> 8;
+  out[3] = ~size & 0xff;
+  out[4] = (~size >> 8) & 0xff;
+  grub_memcpy (out + 5, data, size);
+  *out_size = size + 5;
+  return out;
+}
+
+static void
+bench_one (const char *name, int zlib, grub_uint8_t *in, grub_size_t in_size,
+	   grub_off_t off, grub_size_t len, const grub_uint8_t *expected,
+	   grub_uint8_t *out)
+{
+  grub_uint64_t start, end;
+  grub_ssize_t ret = 0;
+  unsigned i;
+
+  start = grub_get_time_ms ();
+  for (i = 0; i < BENCH_ROUNDS; i++)
+    {
+      if (zlib)
+	ret = grub_zlib_decompress ((char *) in, in_size, off,
+				    (char *) out, len);
+      else
+	ret = grub_deflate_decompress ((char *) in, in_size, off,
+				       (char *) out, len);
+      if (ret != (grub_ssize_t) len)
+	break;
+    }
+  end = grub_get_time_ms ();
+
+  grub_test_assert (ret == (grub_ssize_t) len,
+		    "%s: decompressed %" PRIdGRUB_SSIZE " bytes instead of %"
+		    PRIuGRUB_SIZE, name, ret, len);
+  if (ret != (grub_ssize_t) len)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+  grub_test_assert (grub_memcmp (out, expected + off, len) == 0,
+		    "%s: output differs from the corpus", name);
+  grub_bench_report (name, ((grub_uint64_t) BENCH_ROUNDS * len) >> 10, "KiB",
+		     start, end);
+}
+
+static void
+inflate_bench (void)
+{
+  grub_uint8_t *corpus, *out, *stored;
+  grub_size_t stored_size;
+
+  corpus = grub_malloc (GRUB_BENCH_CORPUS_SIZE);
+  out = grub_malloc (GRUB_BENCH_CORPUS_SIZE);
+  if (!corpus || !out)
+    {
+      grub_test_assert (0, "out of memory");
+      grub_free (corpus);
+      grub_free (out);
+      return;
+    }
+  grub_bench_corpus (corpus);
+
+  bench_one ("dynamic huffman", 1, (grub_uint8_t *) corpus_dynamic,
+	     sizeof (corpus_dynamic), 0, GRUB_BENCH_CORPUS_SIZE, corpus, out);
+  bench_one ("random access", 1, (grub_uint8_t *) corpus_dynamic,
+	     sizeof (corpus_dynamic), GRUB_BENCH_CORPUS_SIZE - 4096, 4096,
+	     corpus, out);
+
+  stored = make_stored (corpus, GRUB_BENCH_CORPUS_SIZE, &stored_size);
+  grub_test_assert (stored != NULL, "out of memory");
+  if (stored)
+    bench_one ("stored", 0, stored, stored_size, 0, GRUB_BENCH_CORPUS_SIZE,
+	       corpus, out);
+
+  grub_free (stored);
+  grub_free (corpus);
+  grub_free (out);
+}
+
+GRUB_FUNCTIONAL_TEST (inflate_bench, inflate_bench);
@@ -0,0 +1,420 @@
+/* A zlib stream (level 9) of the 16 KiB corpus built by grub_bench_corpus
+   in lib/bench.c: 12 KiB of text, 3 KiB of records and 1 KiB of noise.  */
+
+static const grub_uint8_t corpus_dynamic[] =
+{
+0x78, 0xda, 0x75, 0x5a, 0x07, 0x80, 0x55, 0xc5, 0xd5, 0x7e, 0xb7, 0xdf, 0x3b, 0xb7, 0x61, 0x89,
+0x20, 0x2a, 0x2e, 0x88, 0x60, 0x21, 0xe2, 0x2f, 0x08, 0x62, 0x4b, 0x50, 0x89, 0x52, 0x7e, 0x50,
+0x51, 0x31, 0x51, 0x89, 0x6f, 0xd9, 0x5d, 0x58, 0x81, 0x5d, 0xdc, 0x5d, 0x14, 0x45, 0x8d, 0xd8,
+0x11, 0xb0, 0xa2, 0x11, 0x35, 0x80, 0x58, 0x50, 0x24, 0x44, 0xd4, 0xc4, 0x16, 0x0b, 0x98, 0xa8,
+0x09, 0x62, 0x14, 0x0d, 0x24, 0xbf, 0x44, 0x8d, 0x44, 0x13, 0xec, 0x18, 0x15, 0x23, 0x96, 0xff,
+0x9c, 0xa9, 0x67, 0xde, 0x12, 0xe5, 0xbd, 0x9d, 0xef, 0xdd, 0x3b, 0x33, 0x67, 0xce, 0x9c, 0x3e,
+0x53, 0x3f, 0xa5, 0x75, 0xc2, 0xe4, 0xba, 0xe6, 0xf6, 0xba, 0xc9, 0x8d, 0x6d, 0x2d, 0x8d, 0x53,
+0xea, 0xea, 0x5b, 0x5b, 0x3b, 0xc4, 0x57, 0xb5, 0xa5, 0xa1, 0x6e, 0x6a, 0x6b, 0xc3, 0xf4, 0x29,
+0x8d, 0xd8, 0x64, 0x13, 0xaa, 0x13, 0x26, 0x35, 0xd6, 0x35, 0x34, 0x9e, 0xd3, 0x3c, 0xa1, 0xb1,
+0xae, 0xb9, 0xa5, 0xae, 0xa9, 0xb5, 0xad, 0xae, 0xa3, 0x15, 0xff, 0xc9, 0x9e, 0xcd, 0x2d, 0xad,
+0x0d, 0x8d, 0x0a, 0xe0, 0xd3, 0xa6, 0x66, 0xe8, 0x0a, 0x23, 0xcb, 0x3e, 0x6d, 0x8d, 0xd5, 0x86,
+0xba, 0x36, 0x1c, 0x59, 0xbc, 0x29, 0xbe, 0xeb, 0xc5, 0xfc, 0xbc, 0x5d, 0xad, 0x6b, 0x6c, 0xe9,
+0x68, 0x3b, 0xaf, 0xae, 0x71, 0x46, 0x07, 0x34, 0x18, 0x0c, 0xad, 0x7e, 0x91, 0x43, 0x9c, 0xdb,
+0xd6, 0xdc, 0xc1, 0xa9, 0x11, 0x83, 0xb5, 0x37, 0x4e, 0xe8, 0x80, 0x79, 0xe4, 0x94, 0x1d, 0x40,
+0x1e, 0x74, 0x11, 0x74, 0xd6, 0x4f, 0x6f, 0x6a, 0x6a, 0x6c, 0x13, 0xd3, 0x9d, 0xd3, 0x3a, 0x65,
+0xfa, 0x54, 0x9c, 0xaf, 0xb9, 0xa3, 0x4d, 0x77, 0xc2, 0x25, 0xb5, 0x36, 0xe9, 0x05, 0xf2, 0xde,
+0x53, 0x5a, 0xab, 0x0d, 0xd0, 0xa9, 0xa1, 0xb9, 0x7d, 0x72, 0x1d, 0x3c, 0xd3, 0x6b, 0xe5, 0xfd,
+0x70, 0x45, 0x55, 0xf8, 0x9f, 0x0f, 0xc9, 0x97, 0x07, 0x1f, 0xeb, 0x15, 0xc6, 0x3b, 0xf2, 0x81,
+0x9a, 0x5b, 0xa6, 0xcf, 0x90, 0xdf, 0x30, 0x10, 0xf0, 0x40, 0x2c, 0x13, 0xda, 0xd3, 0xaa, 0x6d,
+0x1d, 0xcd, 0x1d, 0xcd, 0xad, 0x2d, 0x4c, 0xad, 0x9c, 0x8f, 0x0e, 0x84, 0x4f, 0x6d, 0x6c, 0x99,
+0x2e, 0xfa, 0x30, 0x32, 0xa5, 0x9c, 0x41, 0xae, 0xb1, 0xbd, 0xb1, 0xda, 0x36, 0x61, 0x52, 0xdd,
+0xc4, 0xb6, 0xe9, 0xf5, 0x82, 0x0d, 0x9c, 0x18, 0xe0, 0x33, 0xc3, 0x69, 0xe5, 0xd2, 0xe4, 0x4b,
+0x12, 0xf1, 0x61, 0x61, 0x78, 0xc1, 0x3b, 0x41, 0x93, 0x60, 0x2a, 0x0e, 0x20, 0x58, 0x8d, 0xcb,
+0x42, 0x86, 0x8a, 0x77, 0x78, 0x13, 0x76, 0x58, 0x10, 0x88, 0x44, 0x88, 0xf7, 0x25, 0x4f, 0x25,
+0xcb, 0xc4, 0x53, 0xd1, 0x03, 0x27, 0xe7, 0xf3, 0xf0, 0xae, 0x4a, 0x1e, 0xda, 0x25, 0x43, 0x19,
+0xff, 0x55, 0xce, 0xc4, 0x85, 0x02, 0xc8, 0xe1, 0xbf, 0x89, 0x31, 0xe4, 0xb8, 0xfc, 0x89, 0x92,
+0x15, 0xb2, 0x6f, 0xf2, 0xa7, 0x2a, 0x92, 0x24, 0xdb, 0xad, 0x4d, 0x4c, 0x0e, 0x47, 0x77, 0x9b,
+0x49, 0x09, 0x90, 0xfd, 0x8c, 0x64, 0xe2, 0x42, 0xc5, 0xc2, 0x85, 0x48, 0x0a, 0xee, 0xe2, 0x1c,
+0x4c, 0xf2, 0xaa, 0x6a, 0x4b, 0xaf, 0x66, 0x2d, 0x5f, 0x1e, 0x43, 0x69, 0xc7, 0x8e, 0x9c, 0xed,
+0x00, 0x24, 0x67, 0xc5, 0x5e, 0x89, 0xef, 0x7a, 0xfd, 0xb6, 0x9c, 0x09, 0x56, 0x0f, 0xff, 0x84,
+0xb8, 0xab, 0xed, 0x97, 0x72, 0x2d, 0x69, 0x56, 0x12, 0x21, 0xd6, 0x8d, 0xa2, 0x23, 0x66, 0xe3,
+0x58, 0x2e, 0xcf, 0x48, 0x8b, 0xd4, 0x10, 0xdc, 0x32, 0xbe, 0x19, 0x9c, 0x16, 0xfe, 0x25, 0x68,
+0x66, 0x62, 0xf2, 0x26, 0xb5, 0xe3, 0x92, 0x56, 0xec, 0x24, 0x37, 0x8c, 0x4f, 0x21, 0x48, 0x67,
+0xb4, 0xa3, 0xe4, 0x09, 0x57, 0x46, 0x6b, 0x87, 0xe5, 0x32, 0x25, 0x29, 0x6a, 0x29, 0x92, 0x7b,
+0x7c, 0x12, 0xbe, 0x6a, 0xb1, 0x9c, 0x26, 0x23, 0x78, 0x82, 0x01, 0xf8, 0x02, 0x6b, 0x6e, 0x47,
+0x25, 0x13, 0x36, 0x85, 0xaf, 0x97, 0x0a, 0x30, 0xdd, 0x6b, 0x31, 0xbf, 0x54, 0x40, 0xf5, 0xaa,
+0x98, 0x9e, 0x2f, 0x97, 0xa8, 0x27, 0xf2, 0x80, 0xf7, 0xaf, 0x27, 0x42, 0x52, 0x35, 0xac, 0x12,
+0xa2, 0xc5, 0x57, 0x4b, 0x05, 0x0f, 0xbb, 0x30, 0x39, 0x26, 0x31, 0x3a, 0xea, 0x27, 0x39, 0x8e,
+0xfc, 0x23, 0xa7, 0x92, 0xd4, 0x9a, 0xa1, 0xf9, 0x94, 0x7c, 0xe8, 0x9a, 0xe9, 0xf8, 0x88, 0xd2,
+0x00, 0x28, 0x5d, 0x53, 0x96, 0x06, 0xb9, 0x26, 0x56, 0x01, 0xbc, 0x10, 0x8f, 0xe4, 0xee, 0x08,
+0xb1, 0x51, 0x76, 0x12, 0xfe, 0x09, 0x1b, 0x20, 0x26, 0xd7, 0x2b, 0x33, 0x02, 0x22, 0x46, 0x81,
+0xf7, 0x2c, 0xde, 0x48, 0xb1, 0x13, 0xba, 0x46, 0xd5, 0x4c, 0x2c, 0x93, 0xc8, 0xb4, 0xdc, 0x5f,
+0xc1, 0x6c, 0x23, 0x5b, 0x68, 0x07, 0xb9, 0xf6, 0x22, 0x35, 0xfc, 0x4b, 0x6e, 0x8d, 0x14, 0x04,
+0x25, 0xf7, 0x7c, 0x50, 0x65, 0x56, 0xc4, 0x23, 0x45, 0x64, 0x8d, 0x49, 0x56, 0xa2, 0x2f, 0x44,
+0x41, 0x8e, 0x46, 0xf6, 0x50, 0x32, 0x16, 0xc6, 0xc4, 0x9e, 0x52, 0x82, 0xa4, 0x65, 0xc0, 0x5f,
+0x04, 0x85, 0xe2, 0x77, 0xd1, 0x16, 0x8b, 0x6c, 0xa6, 0xbb, 0x4b, 0xf5, 0xc8, 0x76, 0x05, 0x7c,
+0x28, 0xea, 0x16, 0xf4, 0x30, 0xda, 0x2f, 0x99, 0xd5, 0x0b, 0x1a, 0x25, 0x6b, 0xb4, 0x70, 0x71,
+0xdb, 0x0b, 0xb3, 0x30, 0xf9, 0xc0, 0xec, 0x37, 0x67, 0x95, 0x64, 0x33, 0x90, 0xdb, 0xd9, 0x48,
+0xeb, 0x5d, 0x96, 0xcc, 0x51, 0x42, 0xc7, 0xb9, 0xcb, 0x9d, 0x20, 0x7c, 0x31, 0xc9, 0x40, 0x69,
+0x40, 0x5b, 0x15, 0x4b, 0xec, 0xa1, 0x24, 0x32, 0x93, 0x4b, 0xdd, 0x12, 0x7d, 0xa5, 0x6a, 0xb4,
+0x32, 0x6d, 0xac, 0x65, 0x37, 0x4e, 0xa2, 0xd1, 0x00, 0xf9, 0x6b, 0x9b, 0xf2, 0xea, 0xd2, 0x9c,
+0xf3, 0x1e, 0x72, 0x43, 0x14, 0xb3, 0x5a, 0x15, 0x5d, 0x72, 0x81, 0xf5, 0x66, 0x17, 0x05, 0xbb,
+0x85, 0xe6, 0x1a, 0x53, 0x22, 0x07, 0x23, 0xe6, 0xdc, 0x78, 0x4e, 0x39, 0x06, 0x50, 0x87, 0x7c,
+0x22, 0xc2, 0x63, 0x24, 0x58, 0x0a, 0x8d, 0x58, 0x3a, 0x8e, 0x8a, 0xec, 0xa4, 0x7e, 0x58, 0xbe,
+0x27, 0xd8, 0x44, 0xac, 0xac, 0xb0, 0x00, 0x62, 0x6f, 0xb4, 0xc5, 0xb5, 0x6c, 0x8c, 0xc5, 0x42,
+0x61, 0xf1, 0x44, 0x57, 0xca, 0x0e, 0xe1, 0x1d, 0x27, 0x69, 0x17, 0xce, 0x31, 0xff, 0xaa, 0x6a,
+0x8b, 0xc7, 0xfd, 0x2b, 0x27, 0xdf, 0x18, 0x3d, 0x64, 0xa3, 0x16, 0x49, 0x15, 0x0d, 0xd8, 0x11,
+0x86, 0xda, 0x76, 0x23, 0x58, 0xc4, 0x07, 0x09, 0xed, 0x10, 0xeb, 0xe4, 0x3f, 0xc8, 0x36, 0xe7,
+0x07, 0xe7, 0x34, 0x6a, 0x25, 0x8f, 0xb1, 0x4c, 0xd4, 0x25, 0xe5, 0x49, 0x45, 0x6a, 0x24, 0x7e,
+0x40, 0x09, 0xd0, 0x61, 0x98, 0xb0, 0xcf, 0x62, 0x1b, 0x9b, 0x34, 0xef, 0x6a, 0x5c, 0x09, 0x93,
+0x13, 0xc2, 0x2c, 0xb2, 0x23, 0x35, 0x23, 0x3c, 0xd2, 0x11, 0x1a, 0x83, 0xf3, 0x63, 0x0c, 0xd3,
+0xa2, 0xdc, 0x2b, 0x00, 0x9b, 0xc3, 0x62, 0x59, 0x5a, 0xb0, 0x98, 0xf8, 0xe6, 0xf6, 0x5f, 0x4b,
+0x00, 0xa7, 0x49, 0x2e, 0x43, 0x08, 0x12, 0xd5, 0x0a, 0xe5, 0x38, 0xc4, 0xdc, 0xb8, 0x91, 0x82,
+0x69, 0xd2, 0xa7, 0x21, 0xff, 0xc5, 0x24, 0x5a, 0x4c, 0x15, 0x2f, 0xe4, 0x04, 0x52, 0x54, 0x70,
+0x14, 0xe9, 0x29, 0xe5, 0x90, 0xf2, 0xb9, 0x24, 0x11, 0xfe, 0x37, 0x43, 0x0a, 0x5e, 0xc3, 0x6a,
+0x94, 0xcd, 0x17, 0x52, 0xd4, 0x22, 0xe9, 0x33, 0x36, 0x43, 0xac, 0x87, 0x4f, 0x21, 0xb9, 0xca,
+0x7b, 0x0a, 0x61, 0x20, 0xe1, 0x2b, 0xdf, 0x53, 0xca, 0x66, 0xbe, 0x68, 0xb9, 0x8d, 0x5c, 0xfe,
+0x14, 0x35, 0x72, 0xaf, 0x95, 0x41, 0x10, 0x1c, 0x13, 0x03, 0xca, 0x19, 0xa8, 0xe5, 0x15, 0xf1,
+0x98, 0x8e, 0xd0, 0x0d, 0x79, 0xca, 0x4a, 0x23, 0xa7, 0x85, 0xfc, 0xe1, 0x6c, 0x1d, 0xca, 0x96,
+0x72, 0xd6, 0xaa, 0x3d, 0x12, 0x53, 0x2a, 0xa9, 0x40, 0x8e, 0xaa, 0x30, 0xaf, 0x46, 0xaa, 0xa4,
+0x8b, 0x68, 0xa7, 0x2a, 0xa7, 0xd4, 0x97, 0xf3, 0x40, 0xbe, 0x2f, 0xa4, 0x56, 0xf2, 0x4c, 0x70,
+0x5c, 0xe9, 0x36, 0x31, 0xbf, 0x4c, 0xff, 0xca, 0x4c, 0x38, 0x69, 0xb9, 0x21, 0xb2, 0x08, 0xc3,
+0x7c, 0xc9, 0x3b, 0xc1, 0x17, 0x15, 0x15, 0x88, 0x5e, 0xf2, 0x05, 0x39, 0x8b, 0xfc, 0x91, 0xf8,
+0xf8, 0xba, 0x2a, 0xe3, 0x91, 0x9d, 0x31, 0xa9, 0xf5, 0xda, 0xad, 0x6d, 0xc7, 0x63, 0x28, 0x1b,
+0x0a, 0xa2, 0x21, 0xd4, 0x0e, 0x68, 0x50, 0x72, 0x68, 0x49, 0xad, 0xe8, 0x85, 0x71, 0x3a, 0xe7,
+0x21, 0x37, 0x08, 0x7a, 0x75, 0x74, 0x25, 0xc6, 0x8b, 0x6a, 0x8d, 0x94, 0xc9, 0x83, 0x4e, 0x44,
+0xb8, 0xfe, 0x09, 0x63, 0xa0, 0x54, 0x40, 0xd3, 0x61, 0x49, 0xa3, 0x0a, 0xc8, 0xb8, 0x41, 0x62,
+0x55, 0x85, 0x4d, 0xf8, 0xc3, 0xc5, 0xc7, 0xb8, 0x07, 0xae, 0xa8, 0x54, 0xff, 0x15, 0x3b, 0x55,
+0xe8, 0x60, 0x12, 0x0b, 0x25, 0xfd, 0x3c, 0x2e, 0x10, 0x4a, 0xc8, 0xd7, 0xd2, 0xc9, 0xe5, 0x68,
+0x77, 0x68, 0xbf, 0x20, 0x13, 0x33, 0x65, 0xb3, 0x89, 0x38, 0x88, 0x27, 0x66, 0x00, 0x62, 0xd2,
+0x71, 0xdb, 0xd4, 0xdc, 0x3a, 0xbe, 0x91, 0x0d, 0x3e, 0x8f, 0x68, 0x33, 0x1d, 0x06, 0xc8, 0x3f,
+0xdc, 0xc6, 0x49, 0x51, 0x64, 0x24, 0xa0, 0xb1, 0x24, 0x4f, 0x84, 0x48, 0xd2, 0x31, 0x9b, 0x1c,
+0x50, 0xbc, 0x43, 0x27, 0xa9, 0xaa, 0x7d, 0x6b, 0xaa, 0xe9, 0x45, 0x15, 0x8a, 0x73, 0x96, 0x3f,
+0x14, 0xaa, 0xab, 0x53, 0x26, 0xc9, 0x43, 0xb3, 0xbe, 0xda, 0x50, 0xd0, 0x32, 0x03, 0x74, 0x1d,
+0x92, 0x20, 0x9e, 0x2d, 0x51, 0xef, 0xcf, 0xb7, 0x57, 0xf1, 0x45, 0x78, 0xaa, 0xaa, 0x12, 0x5e,
+0x3e, 0x24, 0xe9, 0x6c, 0xd9, 0x5c, 0xe9, 0xc8, 0x49, 0xc4, 0x06, 0x8c, 0x43, 0x77, 0x4b, 0xa4,
+0xdc, 0xb8, 0x56, 0x3e, 0x94, 0xe8, 0x68, 0x67, 0x8a, 0xd2, 0x35, 0x0b, 0x65, 0xe1, 0xdd, 0x88,
+0xf8, 0x32, 0xe2, 0xf7, 0xc5, 0x43, 0xa5, 0xaa, 0x26, 0x66, 0x34, 0xb6, 0x52, 0x0d, 0x2f, 0xc6,
+0xa2, 0x1b, 0x80, 0x6b, 0xd0, 0xfc, 0xc6, 0x86, 0x18, 0x57, 0x6e, 0x78, 0x27, 0xa9, 0xe3, 0x3a,
+0xcc, 0xd3, 0x72, 0x46, 0x7d, 0xa5, 0xca, 0xcd, 0xc9, 0x06, 0xca, 0xb8, 0x91, 0xe9, 0x54, 0x56,
+0x25, 0x8c, 0x30, 0xa1, 0xd6, 0x98, 0xaa, 0xb1, 0x2d, 0xf2, 0x3d, 0xed, 0x2d, 0xc4, 0x3a, 0xb4,
+0x26, 0x93, 0xf4, 0xd1, 0x58, 0x40, 0x61, 0x2c, 0x31, 0x6d, 0x35, 0xc9, 0x4a, 0xa7, 0xe4, 0xc0,
+0xe4, 0xbd, 0xc8, 0x0f, 0x12, 0xa6, 0xc8, 0x12, 0x80, 0x2d, 0x17, 0x46, 0xd5, 0xa9, 0x0b, 0xec,
+0x10, 0xb6, 0x4d, 0xca, 0x18, 0x16, 0x29, 0xac, 0x5c, 0x42, 0x47, 0x5f, 0x8c, 0xbf, 0x44, 0x86,
+0x53, 0xe2, 0x62, 0x4f, 0x42, 0x1c, 0x18, 0xf1, 0x4c, 0x34, 0x28, 0x84, 0x54, 0xda, 0x76, 0x00,
+0x26, 0xd3, 0xd5, 0x8a, 0x2f, 0x79, 0x08, 0xcb, 0xb0, 0xac, 0x92, 0x1d, 0xcb, 0xab, 0xb2, 0x00,
+0x0d, 0xc9, 0xc4, 0x08, 0x26, 0x15, 0x21, 0x71, 0xac, 0xe8, 0x8b, 0xcb, 0x35, 0xf6, 0xd2, 0xec,
+0x81, 0x4c, 0x53, 0x61, 0x57, 0x95, 0x81, 0xe7, 0x3e, 0x98, 0x88, 0xa2, 0xed, 0xdf, 0xb9, 0xb4,
+0x68, 0x83, 0x82, 0x65, 0x29, 0xf5, 0x5e, 0x4d, 0xf0, 0xa3, 0x38, 0xab, 0x6c, 0xbd, 0x30, 0x87,
+0xcd, 0x53, 0x4c, 0xf1, 0xc9, 0x8a, 0xb0, 0xe9, 0x0e, 0x55, 0xb7, 0xab, 0xf2, 0x76, 0xa8, 0x6b,
+0xaa, 0x67, 0xd2, 0xd5, 0xa8, 0xb5, 0xc9, 0x42, 0x03, 0xd3, 0xd1, 0x14, 0xba, 0x80, 0x2a, 0xee,
+0x22, 0x51, 0xac, 0x26, 0x93, 0xc1, 0x48, 0x6f, 0x33, 0x09, 0xe9, 0xd2, 0x21, 0x1a, 0x43, 0x91,
+0x56, 0x39, 0x26, 0xb7, 0x2b, 0xed, 0xa6, 0xd8, 0x43, 0x37, 0x01, 0x7a, 0xa8, 0x20, 0xcb, 0x18,
+0x11, 0x1a, 0x6a, 0x4b, 0x45, 0x16, 0x6f, 0x6b, 0x77, 0x47, 0xc3, 0x03, 0xc9, 0x07, 0xe5, 0xb2,
+0xda, 0x6b, 0xf2, 0x13, 0x55, 0x43, 0x31, 0x26, 0xc5, 0x0e, 0x3f, 0xed, 0x04, 0x52, 0x25, 0x98,
+0x48, 0xb3, 0x71, 0x8a, 0x34, 0x91, 0xc2, 0x84, 0x11, 0x8d, 0x1f, 0x09, 0x6b, 0x74, 0xe1, 0xc0,
+0xb8, 0x47, 0xb1, 0x99, 0x3a, 0xbf, 0x92, 0x2f, 0x8a, 0xf9, 0xad, 0xd8, 0x9e, 0xf8, 0x39, 0x29,
+0x54, 0xc0, 0x31, 0xe5, 0x02, 0xed, 0xbc, 0x8c, 0x91, 0x9c, 0x89, 0x6d, 0x6f, 0x87, 0xf9, 0x06,
+0x11, 0xba, 0x4c, 0x24, 0x5f, 0x2b, 0xd4, 0x66, 0x17, 0xab, 0xcc, 0x0e, 0x5a, 0xaa, 0x56, 0x70,
+0x20, 0xab, 0x9c, 0x24, 0x0b, 0x6b, 0x23, 0x26, 0x40, 0x16, 0xc5, 0x8c, 0xa9, 0x55, 0x04, 0x92,
+0xcd, 0xb1, 0x6a, 0x65, 0x66, 0x0f, 0x48, 0x53, 0xd7, 0x22, 0x95, 0xbc, 0xd0, 0xb0, 0x8d, 0x38,
+0x49, 0xfe, 0x58, 0x15, 0x64, 0x6b, 0x1c, 0x1b, 0xe7, 0xbc, 0x9c, 0xd6, 0x8a, 0x31, 0xb4, 0x7d,
+0x63, 0x32, 0x80, 0x90, 0xc5, 0x60, 0x93, 0xfa, 0x71, 0x4a, 0x74, 0x31, 0xaa, 0x5a, 0x67, 0x67,
+0x95, 0x52, 0x7c, 0x85, 0x85, 0xc6, 0x7d, 0x96, 0x51, 0x34, 0xd3, 0x7c, 0x32, 0x55, 0x5a, 0x5d,
+0x1a, 0xa5, 0x6b, 0x96, 0xda, 0xa4, 0x4a, 0x06, 0xba, 0xe6, 0x2a, 0xd9, 0xce, 0x94, 0xfb, 0x44,
+0xfa, 0x04, 0x29, 0xc4, 0xc5, 0xd1, 0xd4, 0x51, 0x1a, 0x48, 0x62, 0x45, 0x34, 0x39, 0x26, 0xf6,
+0x96, 0xef, 0xca, 0xee, 0x92, 0x91, 0xdb, 0x89, 0x25, 0xb9, 0x0b, 0xe7, 0x22, 0x2b, 0x3a, 0xd8,
+0x7f, 0x4c, 0x96, 0x69, 0x27, 0xeb, 0x92, 0xe4, 0xe6, 0xda, 0x40, 0x82, 0xeb, 0x82, 0x9d, 0x31,
+0xa8, 0x50, 0x54, 0x5b, 0x4c, 0xed, 0xab, 0xa0, 0x3b, 0xab, 0x35, 0xfb, 0x2a, 0x74, 0x37, 0x19,
+0x3a, 0xda, 0x1b, 0x64, 0x29, 0xf5, 0xfb, 0x82, 0x96, 0xaa, 0xd6, 0x0e, 0x21, 0x09, 0xe2, 0x19,
+0xa9, 0x07, 0x6b, 0x23, 0x41, 0x02, 0x2e, 0x99, 0x89, 0xb4, 0x32, 0x6a, 0x54, 0x31, 0xd4, 0xe7,
+0xe1, 0xb4, 0x65, 0x16, 0xec, 0x74, 0xcd, 0x64, 0xb9, 0x6a, 0x0a, 0xe4, 0xbc, 0x90, 0x28, 0xb3,
+0x0a, 0x61, 0xf3, 0x69, 0x9e, 0xd8, 0x64, 0xca, 0x91, 0xda, 0x4d, 0x61, 0xe6, 0x23, 0xd2, 0x76,
+0x9d, 0x18, 0x49, 0x4f, 0xc0, 0xa8, 0x57, 0x90, 0x95, 0x1a, 0x5a, 0xb5, 0x36, 0x11, 0xb8, 0x96,
+0x4f, 0x15, 0xda, 0x98, 0x6c, 0x9f, 0x07, 0x54, 0xc4, 0xdd, 0x5b, 0xd5, 0x6f, 0x1d, 0x7e, 0x98,
+0x3a, 0x9e, 0x18, 0xa1, 0xdd, 0xf2, 0xc7, 0xf6, 0x29, 0x41, 0xd5, 0xc8, 0x1e, 0x2d, 0x17, 0x08,
+0xea, 0xab, 0x66, 0x39, 0x5c, 0xfe, 0x64, 0x9c, 0xa7, 0x42, 0x16, 0x95, 0x61, 0x55, 0xb7, 0x63,
+0x9f, 0x98, 0x49, 0x65, 0x49, 0x98, 0x0a, 0xbb, 0xa3, 0xfd, 0xb6, 0x2e, 0x48, 0x1a, 0xea, 0xe5,
+0x5b, 0x76, 0xd2, 0x60, 0x9c, 0x8f, 0xf2, 0x10, 0xbc, 0x3b, 0x39, 0xba, 0x10, 0x0b, 0xa0, 0xe2,
+0xd8, 0xac, 0x6a, 0x53, 0xc6, 0xe5, 0x55, 0x3b, 0xbb, 0x49, 0x55, 0xf1, 0x30, 0x19, 0x81, 0x15,
+0x10, 0x29, 0xa3, 0x29, 0x06, 0xe4, 0x24, 0x59, 0x15, 0x44, 0x5d, 0x45, 0xed, 0x64, 0xaa, 0x68,
+0x66, 0x5a, 0xe3, 0x5a, 0xec, 0xe3, 0x1f, 0xd3, 0x45, 0x08, 0x81, 0x89, 0xeb, 0xab, 0xa6, 0x10,
+0x4b, 0xa6, 0x96, 0xf5, 0x7d, 0x1d, 0xa8, 0x08, 0x7b, 0xd9, 0x6e, 0x9d, 0x24, 0x40, 0x0c, 0x25,
+0xcd, 0x4d, 0xa7, 0x72, 0x16, 0x95, 0x34, 0x78, 0xad, 0xd6, 0x57, 0x98, 0x90, 0xb1, 0x66, 0x07,
+0xb8, 0x9b, 0xd0, 0xe5, 0x33, 0xab, 0x54, 0x27, 0x62, 0x07, 0x6d, 0x93, 0xb8, 0x0f, 0x93, 0xf6,
+0x97, 0xda, 0x78, 0xa9, 0x03, 0xb5, 0x33, 0x4a, 0x75, 0x6f, 0x69, 0xd0, 0x46, 0x57, 0x55, 0xc8,
+0x4c, 0x8c, 0x21, 0x73, 0xd3, 0x0e, 0x15, 0xc0, 0x90, 0xcc, 0xcc, 0x5a, 0x9c, 0xde, 0x73, 0x99,
+0x72, 0x90, 0x6c, 0xc6, 0xce, 0x15, 0x05, 0xc9, 0x82, 0xd5, 0x72, 0x1a, 0x59, 0x8e, 0xd5, 0x75,
+0x18, 0x62, 0xb2, 0x4c, 0xd2, 0xa5, 0x1d, 0x84, 0xb2, 0x9b, 0xb4, 0x2c, 0x24, 0xd7, 0xa3, 0x35,
+0x4f, 0x0b, 0x87, 0x3e, 0x30, 0x92, 0x24, 0x6b, 0x5f, 0x44, 0xcc, 0x8e, 0xb6, 0x73, 0x4a, 0x5f,
+0xc5, 0xcf, 0x6d, 0xd2, 0x64, 0xea, 0xd0, 0x96, 0x73, 0x57, 0x18, 0x26, 0xdb, 0x14, 0xdb, 0x87,
+0x23, 0x76, 0xb8, 0xb3, 0xbd, 0x28, 0xc2, 0x28, 0x0f, 0x49, 0x27, 0x2d, 0x07, 0xc1, 0x74, 0x66,
+0xa4, 0x4a, 0xd6, 0x56, 0x94, 0x23, 0x78, 0x51, 0x35, 0x79, 0x49, 0xed, 0x61, 0x80, 0x9d, 0x9d,
+0x70, 0x96, 0x88, 0x28, 0x97, 0x96, 0x16, 0xe9, 0x56, 0xd2, 0xa0, 0x83, 0x3b, 0x5a, 0x51, 0x29,
+0x10, 0xd5, 0xfe, 0x76, 0x2b, 0x66, 0x16, 0x0a, 0x6d, 0x95, 0x39, 0xa4, 0x0d, 0x69, 0x96, 0x45,
+0x46, 0xe0, 0xbb, 0x8e, 0xaf, 0x68, 0xdc, 0x40, 0x54, 0x9d, 0xec, 0x92, 0x15, 0x8b, 0xe2, 0xd0,
+0x56, 0x3e, 0x6b, 0x99, 0x47, 0x25, 0x69, 0x6a, 0x3b, 0x99, 0x5d, 0xa8, 0xd2, 0xbb, 0x4e, 0x53,
+0xd6, 0x1a, 0x1f, 0x42, 0x32, 0x50, 0x7a, 0xf4, 0xac, 0x4b, 0xef, 0x2a, 0xd2, 0xa4, 0x25, 0x3e,
+0xab, 0x28, 0xaa, 0xe2, 0x0c, 0x62, 0x92, 0x3b, 0x95, 0x75, 0xed, 0x83, 0x6c, 0xc9, 0x24, 0xd1,
+0x51, 0xcb, 0x1b, 0x5a, 0x69, 0x1a, 0x08, 0xf2, 0xf8, 0x5e, 0x9d, 0x38, 0x74, 0xca, 0x51, 0x6c,
+0xff, 0x80, 0x87, 0x48, 0x32, 0xc9, 0xe0, 0x33, 0xd9, 0x85, 0x32, 0x71, 0xb2, 0x28, 0xc7, 0xa6,
+0xb5, 0x46, 0x69, 0x3a, 0xa4, 0x9a, 0xd6, 0x98, 0x40, 0xaa, 0x20, 0x3a, 0xcc, 0xa5, 0x47, 0x20,
+0x32, 0xe3, 0xa2, 0x61, 0x28, 0xdf, 0x2e, 0x15, 0xbd, 0xd9, 0x65, 0x45, 0x52, 0xf4, 0xd0, 0x26,
+0x52, 0x88, 0xa0, 0x3e, 0x19, 0xe0, 0xbe, 0xcb, 0x3e, 0x73, 0x20, 0xe7, 0x8f, 0x56, 0x6a, 0x6e,
+0xf9, 0x6a, 0xa3, 0x04, 0x8c, 0x9c, 0x16, 0x19, 0xee, 0x9b, 0x96, 0xae, 0x78, 0xb5, 0xe9, 0xe4,
+0x81, 0x16, 0xfc, 0xc5, 0x44, 0x26, 0x31, 0xad, 0x49, 0x98, 0xe9, 0xc9, 0xbd, 0x64, 0x97, 0xb1,
+0xd1, 0x76, 0x51, 0xa7, 0x49, 0x17, 0xfe, 0xc0, 0xb0, 0xcb, 0x23, 0x32, 0x91, 0xb5, 0xcb, 0xa3,
+0x05, 0x7d, 0x77, 0xc2, 0x8e, 0x20, 0x4c, 0xa5, 0x46, 0x49, 0x94, 0x0a, 0xd1, 0x91, 0xfb, 0x96,
+0x3f, 0x24, 0x75, 0x65, 0x4e, 0xac, 0xce, 0xeb, 0xe8, 0xf9, 0xa9, 0xb1, 0x78, 0xb4, 0x5a, 0x68,
+0x4e, 0xbf, 0xcd, 0x11, 0x80, 0x09, 0x85, 0xf4, 0x51, 0x90, 0xd2, 0x56, 0x1a, 0x8c, 0xe9, 0x2c,
+0xcb, 0xa6, 0xc7, 0x1c, 0xeb, 0xe2, 0x33, 0xa5, 0xef, 0x10, 0x5d, 0x30, 0x53, 0x08, 0x22, 0x5a,
+0xa1, 0x83, 0x0d, 0x3b, 0x5e, 0xa6, 0x16, 0x5c, 0x11, 0x62, 0x5b, 0x56, 0xf9, 0xc7, 0xaa, 0xfd,
+0x92, 0x48, 0xd5, 0xc4, 0x56, 0x32, 0x39, 0xd0, 0xd7, 0x2c, 0xaa, 0x96, 0x53, 0x36, 0xa9, 0x86,
+0xb9, 0xa3, 0x20, 0xfc, 0x10, 0x61, 0xf1, 0xa4, 0x46, 0x66, 0xd5, 0xaa, 0x98, 0x91, 0x26, 0xab,
+0x46, 0x29, 0x5d, 0x80, 0xaa, 0x3c, 0x12, 0x5f, 0xab, 0x4f, 0x91, 0x18, 0x4d, 0x51, 0xcd, 0x59,
+0x1f, 0x3d, 0x91, 0xd3, 0xf2, 0x61, 0x17, 0x0d, 0xac, 0xd4, 0xca, 0x4e, 0x60, 0xe1, 0x07, 0xaa,
+0xcc, 0x6a, 0xb7, 0x88, 0xb3, 0x94, 0x85, 0x25, 0x66, 0x94, 0xcd, 0xd4, 0x0e, 0xb5, 0x41, 0x26,
+0x91, 0x4b, 0x0b, 0xc6, 0xe7, 0xaa, 0x1a, 0xa5, 0x8e, 0x00, 0x78, 0x6e, 0x40, 0x0d, 0x8a, 0x0a,
+0x2f, 0xa8, 0xfa, 0xd0, 0xe3, 0x09, 0x4b, 0x9e, 0x4c, 0xee, 0xc9, 0xc8, 0xc6, 0x13, 0x46, 0x68,
+0xb1, 0xc5, 0xd2, 0x58, 0xab, 0x3c, 0x2b, 0x27, 0xce, 0xb8, 0x93, 0xe5, 0xd3, 0x07, 0x26, 0xa6,
+0x22, 0x44, 0x0c, 0x91, 0xd8, 0x45, 0x1a, 0x59, 0xdb, 0xe7, 0x47, 0x2a, 0xbb, 0x31, 0x9e, 0x47,
+0x57, 0x86, 0xac, 0xf4, 0x05, 0x8d, 0x89, 0x60, 0x91, 0x74, 0xfe, 0x48, 0x51, 0xed, 0xfd, 0x1c,
+0x6a, 0x6c, 0x69, 0xea, 0x41, 0x6d, 0x0a, 0x0d, 0x5b, 0xab, 0x56, 0x39, 0x96, 0x5e, 0xc5, 0xa0,
+0x75, 0x11, 0x2a, 0x3c, 0xb2, 0xad, 0xea, 0x7c, 0xb4, 0x72, 0x8a, 0xec, 0x94, 0x8f, 0xcd, 0x5d,
+0x25, 0xe9, 0xe3, 0xcc, 0x0f, 0x22, 0x59, 0xd4, 0xc7, 0x1d, 0x42, 0x39, 0xb5, 0x50, 0xc8, 0x7d,
+0x25, 0x56, 0x53, 0xc5, 0xeb, 0xf5, 0x44, 0x63, 0xb5, 0x1b, 0x95, 0x21, 0x0f, 0x1a, 0x15, 0xfb,
+0x9a, 0x83, 0x4e, 0xf6, 0x6a, 0x82, 0x6e, 0x7d, 0x57, 0x86, 0xf8, 0x03, 0xed, 0x4b, 0x94, 0xb5,
+0xf8, 0x6f, 0x02, 0xaf, 0x3d, 0x9d, 0xf2, 0xcf, 0x6d, 0xfa, 0xaa, 0x88, 0x08, 0x87, 0x4c, 0xe9,
+0xd1, 0x9c, 0xcb, 0xe8, 0xdd, 0x34, 0x5a, 0x51, 0x1b, 0xe5, 0xca, 0x6b, 0x54, 0xed, 0xba, 0x80,
+0x67, 0x15, 0xcf, 0xcd, 0xae, 0x58, 0x57, 0xa0, 0x24, 0x3b, 0xf5, 0xbd, 0x25, 0x9a, 0xb1, 0x8b,
+0xe8, 0x4b, 0x32, 0x87, 0x3b, 0x31, 0x1e, 0xb3, 0x13, 0xb3, 0xce, 0x79, 0x5d, 0xcb, 0x2e, 0x39,
+0xb6, 0x0a, 0x30, 0xa8, 0x4c, 0x53, 0x09, 0x21, 0xd9, 0xa4, 0xb9, 0x5a, 0x41, 0x6e, 0x74, 0x11,
+0xcf, 0x65, 0x72, 0x33, 0x6a, 0xec, 0xf4, 0x7d, 0x0a, 0x6d, 0x17, 0xec, 0x1a, 0x2d, 0xcd, 0x87,
+0xe4, 0xc4, 0xe6, 0x26, 0x9f, 0xfc, 0x5d, 0xf1, 0xc1, 0xd4, 0xe8, 0x4c, 0xae, 0x50, 0xbb, 0x2e,
+0x1a, 0x52, 0xf2, 0x7d, 0x52, 0xc7, 0xc6, 0x4c, 0xdc, 0x63, 0xb1, 0x33, 0xde, 0x26, 0x79, 0x23,
+0x44, 0xd6, 0xd0, 0x89, 0x3c, 0x90, 0x8a, 0x2b, 0x39, 0xb1, 0xb1, 0xce, 0x89, 0x6b, 0x63, 0x39,
+0x5a, 0x06, 0x32, 0xe5, 0xc5, 0x6a, 0x4d, 0x91, 0x46, 0x84, 0x72, 0x46, 0xfb, 0xda, 0xed, 0x7a,
+0xa6, 0x76, 0x1b, 0x36, 0x9b, 0x4c, 0x06, 0x5f, 0xb5, 0xef, 0xa6, 0x09, 0x40, 0x4e, 0x99, 0x85,
+0x0f, 0x30, 0xae, 0xdc, 0x16, 0x30, 0x5d, 0x43, 0x22, 0x46, 0x50, 0xde, 0xc5, 0x92, 0xe9, 0x86,
+0x65, 0x47, 0x9b, 0xed, 0x38, 0xd5, 0x38, 0x17, 0x72, 0x89, 0x4b, 0x1b, 0x50, 0x73, 0x75, 0xa6,
+0xad, 0xf6, 0x5c, 0x53, 0xc4, 0xe8, 0x54, 0x20, 0x04, 0x15, 0x32, 0x70, 0x26, 0x45, 0x12, 0x2b,
+0xd1, 0xd7, 0xd9, 0x8f, 0x4c, 0x2f, 0x8c, 0xd0, 0x12, 0xaf, 0x25, 0x6f, 0x0d, 0xa8, 0x4b, 0x15,
+0xe4, 0xd0, 0xcc, 0xca, 0x13, 0x6a, 0xd3, 0x6b, 0xfb, 0xb6, 0x90, 0xbc, 0xbf, 0x59, 0x73, 0xfa,
+0x25, 0xad, 0x18, 0x89, 0x99, 0xac, 0x1a, 0xbc, 0xad, 0x2f, 0xc4, 0x0f, 0xb4, 0xd1, 0xcb, 0x53,
+0xd6, 0x89, 0x16, 0xab, 0x09, 0xdd, 0xe4, 0x45, 0x2b, 0x75, 0x8f, 0x89, 0x54, 0x94, 0x55, 0x5d,
+0x4a, 0x9d, 0xbe, 0xd6, 0xab, 0xb0, 0x9c, 0x97, 0x96, 0x84, 0x68, 0xcb, 0xbb, 0x03, 0x32, 0xc6,
+0x56, 0xf9, 0x6b, 0x3b, 0xa9, 0x2e, 0x33, 0x5b, 0x1e, 0x31, 0xac, 0xa0, 0x97, 0xee, 0x74, 0x2d,
+0x16, 0x3d, 0x8e, 0xb1, 0x75, 0xe4, 0x88, 0x40, 0x09, 0x7e, 0x6d, 0x06, 0x58, 0xb5, 0x4e, 0xb6,
+0x65, 0xad, 0x98, 0xe4, 0x4e, 0xfa, 0x5a, 0x28, 0xbd, 0x71, 0x22, 0x0b, 0x8a, 0x76, 0x94, 0x6d,
+0x6e, 0xe9, 0xc9, 0x11, 0xd5, 0xcd, 0x17, 0x66, 0x5d, 0xc7, 0x90, 0x9d, 0xcc, 0xdb, 0xf4, 0xf4,
+0x94, 0xd1, 0xac, 0xc6, 0x84, 0xd7, 0xe6, 0xfc, 0x80, 0x12, 0x6b, 0xc5, 0xd0, 0x5a, 0x51, 0x58,
+0xa7, 0x54, 0xc1, 0x1c, 0xe1, 0x29, 0x17, 0x6c, 0xe2, 0x5a, 0x95, 0x4d, 0x59, 0x54, 0xf1, 0xd1,
+0xed, 0xd3, 0x26, 0xac, 0x37, 0xaa, 0xda, 0xa6, 0x5c, 0xbd, 0x39, 0xb8, 0xb0, 0x14, 0x59, 0x07,
+0xfe, 0x4c, 0x9f, 0xe7, 0x43, 0x3c, 0x64, 0xb3, 0x91, 0x44, 0x03, 0x9d, 0x22, 0x0a, 0x9c, 0x45,
+0xef, 0x12, 0x59, 0x84, 0xb9, 0xdc, 0x24, 0x43, 0x0a, 0x73, 0x33, 0xb7, 0x4a, 0x8f, 0x69, 0xa9,
+0xc5, 0x6b, 0x53, 0x32, 0xc9, 0xf4, 0xd2, 0xe9, 0x21, 0x6a, 0x27, 0x81, 0xdf, 0xee, 0xe9, 0x84,
+0x39, 0x0b, 0x35, 0x6a, 0x2b, 0x45, 0xd4, 0xbe, 0x9c, 0xa1, 0x8f, 0x17, 0x9b, 0xcc, 0x6d, 0x47,
+0x99, 0x29, 0xb0, 0x6a, 0xcd, 0x9d, 0x49, 0x5e, 0x04, 0xd2, 0xa9, 0xbd, 0x70, 0xc7, 0xe6, 0xe2,
+0x98, 0x7d, 0xbf, 0x98, 0x5b, 0x1d, 0xe2, 0xc5, 0xf0, 0xcc, 0xae, 0xe6, 0xc0, 0x4b, 0x9b, 0x2c,
+0x9a, 0xd6, 0xea, 0x2c, 0x83, 0x1c, 0x15, 0x12, 0x5b, 0x6f, 0x5d, 0x1c, 0xa2, 0x41, 0xaf, 0xbc,
+0xd8, 0x4d, 0xea, 0xf2, 0xb4, 0x50, 0x60, 0x79, 0x2e, 0x65, 0x0c, 0xda, 0x6d, 0x7f, 0xc1, 0xec,
+0x52, 0x16, 0xb9, 0xde, 0xd3, 0xc9, 0xa2, 0x59, 0xae, 0x58, 0x27, 0x1d, 0xaa, 0xcc, 0xa6, 0xa2,
+0x5c, 0x95, 0x43, 0x70, 0x2e, 0xfc, 0x17, 0x57, 0x69, 0x9f, 0xc7, 0x58, 0xd7, 0x92, 0x6a, 0xa2,
+0x75, 0x63, 0xed, 0x95, 0x0d, 0x21, 0x15, 0x03, 0x5e, 0x1f, 0xa6, 0xa5, 0x2f, 0x75, 0x35, 0x67,
+0x3b, 0x76, 0x9d, 0x9e, 0x50, 0x28, 0x03, 0x2f, 0xd2, 0x71, 0x81, 0xb8, 0xdb, 0xac, 0xc8, 0xff,
+0x58, 0x94, 0x46, 0x41, 0x58, 0x38, 0x0e, 0xb4, 0x23, 0xc4, 0x15, 0x3f, 0xcd, 0xe2, 0x4a, 0xe6,
+0x42, 0xbb, 0x80, 0x4f, 0xea, 0xe5, 0x71, 0xe6, 0x15, 0x8e, 0x07, 0xed, 0xef, 0x21, 0x76, 0xbc,
+0xcc, 0xcb, 0x1d, 0xdf, 0x87, 0xf6, 0xee, 0xf0, 0x49, 0x82, 0xc2, 0xcd, 0xa2, 0x32, 0x0a, 0xa0,
+0xbd, 0x17, 0x7c, 0xf2, 0xd0, 0x2d, 0x8b, 0x82, 0x85, 0x21, 0xb4, 0xf7, 0x83, 0x4f, 0x16, 0x17,
+0x51, 0x96, 0x39, 0x09, 0x8e, 0xfd, 0x3f, 0x38, 0x07, 0x83, 0x77, 0xc3, 0xcc, 0x8b, 0xa1, 0x7d,
+0x08, 0x8e, 0x17, 0x66, 0xa9, 0x9f, 0xbb, 0x51, 0x02, 0xed, 0x1f, 0x20, 0x41, 0x61, 0x12, 0x97,
+0x95, 0x00, 0xe8, 0xa8, 0x54, 0x7e, 0x84, 0xfd, 0xb3, 0x08, 0x3a, 0xbb, 0x61, 0x0a, 0xed, 0xff,
+0x85, 0x4f, 0x19, 0x55, 0x7c, 0x37, 0xf2, 0x8a, 0x0c, 0xda, 0x27, 0xe1, 0xeb, 0x5e, 0x91, 0xfa,
+0x5e, 0x99, 0xe4, 0xd0, 0x3e, 0x8d, 0xaf, 0xc7, 0xcd, 0xc3, 0x30, 0x72, 0x91, 0xf6, 0x7a, 0xf8,
+0x38, 0x51, 0x99, 0xa7, 0x59, 0xe2, 0x96, 0xd0, 0x6e, 0xc6, 0xe7, 0x6e, 0x19, 0xbb, 0x49, 0x99,
+0x77, 0x81, 0xf6, 0x34, 0xf8, 0x78, 0x1e, 0x63, 0x61, 0x51, 0xfa, 0x3b, 0x40, 0xfb, 0x5c, 0xf8,
+0x04, 0x4e, 0x10, 0xe5, 0x09, 0xf3, 0x76, 0x84, 0xf6, 0x45, 0xf0, 0xf1, 0x9d, 0xd2, 0x67, 0x5e,
+0xe9, 0xed, 0x04, 0xed, 0xcb, 0xe1, 0xe3, 0x3a, 0x5e, 0x91, 0xbb, 0x71, 0xb4, 0x33, 0xb4, 0xe7,
+0x22, 0xfd, 0x45, 0x5a, 0x56, 0xa2, 0xc4, 0x41, 0xde, 0xdc, 0x88, 0xeb, 0xcb, 0x93, 0x82, 0x55,
+0xc2, 0x6c, 0x17, 0x68, 0xdf, 0x8a, 0xfc, 0xf0, 0x8a, 0xa2, 0x08, 0x32, 0xa7, 0x2b, 0xb4, 0xef,
+0x40, 0x0c, 0x20, 0xcd, 0xfc, 0xa0, 0x1b, 0xb4, 0xef, 0xc5, 0xf1, 0xb3, 0xc8, 0x4b, 0xa3, 0x30,
+0xda, 0x15, 0xda, 0xbf, 0x42, 0xfa, 0x9c, 0x90, 0x45, 0x9e, 0x1b, 0x74, 0x87, 0xf6, 0x6f, 0x90,
+0x1e, 0xcf, 0x77, 0xcb, 0x24, 0x0a, 0x77, 0x83, 0xf6, 0x93, 0x9c, 0x3e, 0xe0, 0x57, 0x51, 0x94,
+0xc8, 0xfb, 0xdf, 0xe1, 0x7c, 0xb0, 0x79, 0x95, 0x20, 0xaf, 0xec, 0x01, 0xed, 0x35, 0x38, 0x5e,
+0x14, 0xb8, 0xb0, 0xa2, 0xa0, 0x07, 0xb4, 0xd7, 0x21, 0xbd, 0x29, 0x4b, 0x82, 0x28, 0x8e, 0xf7,
+0x84, 0xf6, 0x5f, 0xf9, 0x8e, 0x3b, 0xb0, 0xb5, 0x69, 0x86, 0x02, 0xf0, 0x16, 0xf2, 0xd7, 0x71,
+0xa2, 0x00, 0x18, 0xdc, 0x13, 0xda, 0xff, 0x44, 0xfe, 0x02, 0x33, 0xb2, 0x3c, 0x0d, 0x7a, 0x41,
+0xfb, 0x23, 0xa4, 0xd7, 0x8d, 0xd3, 0x28, 0x8a, 0xf9, 0xde, 0x7e, 0xce, 0xe7, 0x4b, 0x59, 0x98,
+0x06, 0x41, 0x6f, 0x68, 0x7f, 0x8d, 0xeb, 0x4f, 0x4a, 0x58, 0x40, 0x1a, 0xec, 0x8d, 0xbc, 0x04,
+0x21, 0x72, 0xc2, 0x28, 0x0e, 0x82, 0x24, 0xef, 0xc3, 0xd7, 0x82, 0x32, 0xe4, 0x97, 0xa5, 0x53,
+0x04, 0x7d, 0x01, 0xef, 0x00, 0xd8, 0x0d, 0xdd, 0xb4, 0x12, 0xf8, 0xee, 0x3e, 0x80, 0xbb, 0x01,
+0xce, 0xfc, 0x38, 0x74, 0x3d, 0xc7, 0xdb, 0x17, 0xf0, 0x9e, 0x80, 0x3d, 0xd8, 0xc1, 0x3c, 0x0e,
+0x03, 0x94, 0x9d, 0x3e, 0x0e, 0xf2, 0x2b, 0x29, 0xfd, 0xdc, 0xab, 0xec, 0x0f, 0xf8, 0xfb, 0x80,
+0x59, 0x5e, 0xe6, 0x7e, 0x5c, 0xb2, 0x7e, 0x80, 0x07, 0x3a, 0x28, 0x4f, 0x41, 0xc6, 0x98, 0xeb,
+0x7e, 0x1f, 0xf0, 0x61, 0xf8, 0x3e, 0x2b, 0x9d, 0xac, 0x92, 0xfb, 0x07, 0x00, 0x3e, 0x0a, 0xe9,
+0x71, 0x11, 0x15, 0x49, 0x7f, 0xc0, 0xc3, 0x1d, 0xe4, 0x5f, 0x12, 0x65, 0x69, 0x11, 0x1e, 0x08,
+0xf8, 0x78, 0xc0, 0xbe, 0x57, 0x54, 0xbc, 0x28, 0x60, 0x28, 0x9b, 0xe3, 0x70, 0xbc, 0x22, 0x77,
+0x98, 0xef, 0x79, 0x07, 0x01, 0x1e, 0x8f, 0xcf, 0xc3, 0x38, 0xf7, 0xf3, 0x28, 0x1e, 0x00, 0xb8,
+0x11, 0xe9, 0x4d, 0x13, 0xb7, 0x08, 0x59, 0x31, 0x10, 0xf0, 0x14, 0xa4, 0x27, 0x4a, 0xd2, 0xc0,
+0xf5, 0x82, 0x83, 0x01, 0xb7, 0x03, 0x4e, 0xbc, 0x2c, 0x2f, 0x33, 0x37, 0x19, 0x04, 0xf8, 0x7c,
+0xa4, 0x07, 0x08, 0x00, 0x01, 0xf1, 0x07, 0x03, 0x9e, 0x85, 0xe3, 0x3b, 0x61, 0xe8, 0xbb, 0x69,
+0x82, 0xb2, 0x7f, 0x15, 0xae, 0xb7, 0x74, 0xfc, 0xd8, 0xf3, 0x92, 0x21, 0x80, 0xaf, 0x75, 0x50,
+0xbf, 0x82, 0xc2, 0x83, 0x2d, 0x3a, 0x14, 0xf0, 0xcd, 0x38, 0x7f, 0xea, 0x87, 0x51, 0x10, 0x84,
+0x87, 0x01, 0xfe, 0x05, 0x8e, 0x07, 0xc2, 0xe9, 0x07, 0x51, 0xe5, 0x70, 0xc0, 0x77, 0x01, 0x06,
+0x76, 0x02, 0x37, 0x8b, 0xf2, 0x08, 0xc0, 0xf7, 0xe3, 0xfa, 0x80, 0xc4, 0x82, 0xb1, 0xe2, 0x48,
+0xc0, 0x0f, 0x3a, 0x5c, 0x21, 0xbd, 0x20, 0x60, 0x21, 0xea, 0xd6, 0x63, 0x80, 0xe3, 0x30, 0x89,
+0xa2, 0x24, 0x49, 0x7f, 0x08, 0xf8, 0x19, 0x4e, 0x3f, 0x70, 0x3f, 0x4e, 0x8b, 0xa1, 0x80, 0x9f,
+0x07, 0x5c, 0x26, 0x7e, 0x11, 0x17, 0x6e, 0x7a, 0x14, 0xe0, 0x97, 0x90, 0x9e, 0xbc, 0x64, 0x20,
+0x13, 0xe9, 0xd1, 0x80, 0xff, 0x8c, 0xcf, 0xfd, 0x22, 0x08, 0x83, 0xd0, 0x39, 0x06, 0xf0, 0x46,
+0x5c, 0x6f, 0x92, 0x26, 0x61, 0xea, 0x96, 0xc3, 0x00, 0x6f, 0xc2, 0xf9, 0xdc, 0x24, 0x8f, 0x23,
+0x8f, 0xeb, 0xee, 0x7b, 0xd8, 0x3f, 0x88, 0xfc, 0xc2, 0x8d, 0x8a, 0x63, 0x01, 0x6f, 0xc1, 0xf9,
+0x4a, 0x27, 0x8d, 0x9c, 0x38, 0x3b, 0x0e, 0xf0, 0x97, 0xd8, 0x3f, 0x87, 0x25, 0xc1, 0x16, 0x0e,
+0x07, 0xfc, 0x1d, 0xca, 0x47, 0x00, 0x4f, 0x73, 0x3f, 0x18, 0x81, 0xba, 0x0d, 0x92, 0xca, 0xb2,
+0x28, 0x61, 0x20, 0x95, 0x23, 0xb9, 0x2c, 0x72, 0x8b, 0x05, 0xdc, 0x8e, 0x9c, 0x51, 0xd0, 0xda,
+0xd9, 0x45, 0xfd, 0x49, 0xe2, 0x3c, 0xaf, 0x84, 0x68, 0x1b, 0x76, 0x03, 0x9c, 0x81, 0x2c, 0x17,
+0x61, 0xe1, 0x8e, 0x06, 0xdc, 0x0b, 0x30, 0x98, 0xa2, 0x4a, 0x1a, 0x17, 0xf9, 0x18, 0xc0, 0xfb,
+0xa2, 0xe4, 0xe7, 0x15, 0x17, 0x14, 0x24, 0x3d, 0x1e, 0xf0, 0x81, 0x38, 0x5e, 0x99, 0xbb, 0x79,
+0x16, 0xe5, 0x27, 0x40, 0x73, 0x30, 0x60, 0x18, 0x3a, 0xf2, 0xb3, 0xb8, 0x3c, 0x11, 0xf0, 0x91,
+0xf8, 0x3c, 0x82, 0xcd, 0xf4, 0xd2, 0x64, 0x2c, 0x34, 0x87, 0x01, 0x76, 0x2b, 0xa9, 0x9b, 0x85,
+0x09, 0xb7, 0x3d, 0xa3, 0x00, 0x87, 0x39, 0x98, 0xa3, 0x38, 0x0e, 0x4e, 0x06, 0x3c, 0xd6, 0x45,
+0xfd, 0x00, 0xeb, 0x19, 0xa4, 0xde, 0x29, 0x80, 0x7f, 0x02, 0x18, 0x8c, 0x67, 0x94, 0x45, 0x85,
+0x37, 0x0e, 0x70, 0x15, 0xe9, 0x43, 0x8a, 0xbd, 0x3c, 0x39, 0x15, 0xf0, 0x24, 0xa4, 0xaf, 0x88,
+0x5c, 0x27, 0xcd, 0xc2, 0x1f, 0x03, 0x6e, 0xc5, 0xf7, 0xf3, 0x4a, 0x89, 0xf2, 0xf9, 0x13, 0xc0,
+0xe7, 0x00, 0x2e, 0x4b, 0x30, 0x26, 0x45, 0xc5, 0x45, 0xdb, 0x76, 0x21, 0xce, 0x1f, 0xb8, 0x01,
+0xbc, 0x54, 0x9c, 0x0e, 0xf8, 0x32, 0xa4, 0x8f, 0xe5, 0x40, 0x2f, 0x4b, 0xce, 0x80, 0xe6, 0x1c,
+0xfe, 0x3c, 0x74, 0x8b, 0x20, 0x71, 0xc7, 0x03, 0xbe, 0x01, 0xd7, 0xcb, 0xf2, 0xd8, 0x29, 0x93,
+0xf2, 0xa7, 0x80, 0x17, 0x00, 0xce, 0xe3, 0x3c, 0x4e, 0x73, 0x37, 0x3c, 0x13, 0xf0, 0x62, 0xe4,
+0x1f, 0x2b, 0xb3, 0xd8, 0x4b, 0xc3, 0x2a, 0xe0, 0xa5, 0xf8, 0x7e, 0x14, 0xc2, 0x2f, 0x41, 0x8e,
+0xb6, 0x73, 0x05, 0xf2, 0xc3, 0x77, 0x02, 0xd7, 0x2d, 0xdd, 0x09, 0x80, 0x7f, 0xed, 0xa2, 0xbc,
+0x16, 0xa9, 0x93, 0x7a, 0xac, 0x01, 0xf0, 0x6f, 0x71, 0x3e, 0xdf, 0x8f, 0x42, 0xd0, 0xd7, 0x46,
+0xc0, 0xcf, 0xe2, 0xfa, 0xd2, 0xb0, 0x80, 0x21, 0x2a, 0x4d, 0x80, 0xff, 0x88, 0xfd, 0x83, 0xc0,
+0x07, 0x73, 0xeb, 0x4e, 0x04, 0xfc, 0x0a, 0xce, 0x0f, 0xca, 0xc4, 0x92, 0xd8, 0x9d, 0x04, 0xf8,
+0x2f, 0xd8, 0xdf, 0xf5, 0x1d, 0x50, 0xb7, 0x1c, 0x6d, 0xf3, 0x9b, 0xf8, 0x3c, 0xaa, 0xc0, 0x6e,
+0x15, 0xee, 0x59, 0x80, 0xdf, 0xc5, 0xf9, 0x42, 0xd8, 0xa1, 0x32, 0x4e, 0x26, 0x03, 0xfe, 0x10,
+0x71, 0xe1, 0xf8, 0x79, 0xc1, 0x82, 0x29, 0x80, 0x3f, 0xe3, 0xf3, 0xc5, 0x4e, 0x9a, 0xa7, 0xd1,
+0x54, 0xc0, 0xdb, 0x70, 0x3f, 0xfc, 0xac, 0x00, 0x8f, 0x95, 0xb5, 0xa0, 0x28, 0x7a, 0xb8, 0x3f,
+0x60, 0x9c, 0x62, 0x96, 0xb5, 0xa2, 0xaf, 0x02, 0x9c, 0x07, 0x6e, 0xe2, 0xfb, 0x4e, 0x86, 0xb6,
+0xbf, 0x0b, 0xe0, 0x18, 0x6c, 0x9b, 0x97, 0x07, 0xe9, 0xd9, 0x80, 0xbb, 0x02, 0x2e, 0x53, 0x27,
+0x66, 0x65, 0x12, 0xb6, 0x01, 0xee, 0x81, 0xcf, 0xc1, 0xf8, 0xa4, 0x7e, 0x1a, 0xb6, 0x03, 0xde,
+0xdb, 0x43, 0x1b, 0x97, 0x94, 0x81, 0xeb, 0x97, 0x1d, 0x80, 0xfb, 0x01, 0x2e, 0xca, 0x34, 0xf4,
+0x53, 0x56, 0x99, 0x0e, 0x78, 0x00, 0x3a, 0x49, 0x0f, 0x1c, 0x0e, 0x2b, 0xe3, 0x73, 0xa0, 0x79,
+0x28, 0x62, 0xb7, 0xcc, 0x03, 0xe6, 0xe6, 0xe8, 0x5b, 0x86, 0xe2, 0xfc, 0x29, 0x68, 0xb0, 0x93,
+0x06, 0x33, 0x00, 0x1f, 0x87, 0xf4, 0x81, 0x02, 0x85, 0xa5, 0x53, 0x39, 0x0f, 0xf0, 0x18, 0xc0,
+0x8e, 0x1f, 0xa5, 0x60, 0x24, 0x93, 0xf3, 0x01, 0x9f, 0x82, 0xcf, 0xc1, 0x5d, 0x81, 0x08, 0xb1,
+0x99, 0x80, 0xcf, 0xc0, 0xf9, 0x59, 0x98, 0x27, 0xe0, 0x6f, 0x2f, 0x00, 0xdc, 0x00, 0x38, 0x82,
+0xf9, 0x2b, 0xe0, 0x9d, 0x2f, 0x04, 0x3c, 0x19, 0x30, 0x0b, 0x13, 0x9f, 0xc1, 0x22, 0xd1, 0x77,
+0xb5, 0xf1, 0xf1, 0x2a, 0xe0, 0x00, 0xbc, 0xe0, 0x67, 0x80, 0xcf, 0xc3, 0xf9, 0x43, 0x58, 0x6c,
+0x11, 0xe5, 0x17, 0x03, 0xbe, 0x18, 0x70, 0x1a, 0x83, 0xb3, 0x87, 0x20, 0x60, 0x16, 0xe0, 0x2b,
+0x71, 0x7c, 0xd8, 0x0f, 0x2f, 0xf0, 0xd3, 0x4b, 0x00, 0x5f, 0x83, 0xcf, 0x23, 0x88, 0x05, 0x60,
+0xc0, 0x4b, 0x01, 0xdf, 0x84, 0xcf, 0x23, 0x10, 0xa8, 0x3c, 0x2b, 0x2e, 0x03, 0x7c, 0x3b, 0xf2,
+0x07, 0xc4, 0xdd, 0x01, 0xad, 0x41, 0xdf, 0x78, 0x27, 0x60, 0xbf, 0x84, 0xf7, 0xc1, 0x47, 0x5d,
+0x01, 0x78, 0x19, 0xd2, 0xe3, 0xc2, 0xe3, 0xb8, 0xf0, 0xae, 0x04, 0xbc, 0x92, 0xf3, 0xdf, 0x2f,
+0xe3, 0x2c, 0xf0, 0xaf, 0x02, 0xfc, 0x28, 0xf6, 0xf7, 0x02, 0xd8, 0xa3, 0x30, 0x9f, 0x0d, 0xf8,
+0x69, 0xec, 0x0f, 0xc6, 0xca, 0x49, 0xfc, 0xf4, 0x6a, 0xc0, 0xcf, 0xf1, 0xf1, 0x41, 0x7f, 0x93,
+0x3c, 0x9a, 0x03, 0x78, 0x2d, 0x60, 0x37, 0x06, 0x67, 0xe1, 0x31, 0x1f, 0x7d, 0xef, 0x6b, 0xb8,
+0xbe, 0xd0, 0x0f, 0x83, 0xd8, 0xf1, 0xe7, 0x01, 0x7e, 0x1d, 0xc7, 0xcf, 0xb2, 0x30, 0x0a, 0x03,
+0xef, 0x1a, 0xc0, 0x6f, 0x23, 0xfd, 0x39, 0xec, 0x5f, 0xe0, 0xc5, 0xd7, 0x02, 0xde, 0xec, 0xa1,
+0x7d, 0x00, 0xfa, 0x52, 0x3f, 0xb9, 0x0e, 0xf0, 0x27, 0x88, 0xb3, 0x92, 0x05, 0xac, 0x0c, 0xae,
+0x07, 0xbc, 0x15, 0xf9, 0x9d, 0xe5, 0x21, 0xa8, 0x1f, 0xbb, 0x01, 0xf0, 0xb7, 0xf8, 0x3c, 0x67,
+0x95, 0xd8, 0x8d, 0x4a, 0xf4, 0xed, 0x01, 0x04, 0x3d, 0x4e, 0xe9, 0x46, 0x8c, 0xb1, 0x64, 0x3e,
+0xfa, 0x4e, 0xc0, 0x2e, 0xbc, 0x0f, 0x1b, 0x12, 0xdf, 0x04, 0x78, 0x27, 0x1f, 0xe5, 0xad, 0xf4,
+0x60, 0x07, 0x93, 0x9b, 0x01, 0x77, 0xf7, 0x71, 0x3d, 0x51, 0x85, 0x31, 0xc7, 0xff, 0x39, 0xe0,
+0x9e, 0x80, 0x53, 0xd7, 0x4d, 0x43, 0x16, 0xe4, 0xb7, 0x00, 0xde, 0x07, 0x70, 0x02, 0x51, 0x57,
+0x58, 0xba, 0xc1, 0x02, 0xc0, 0xfd, 0x01, 0x47, 0x31, 0x03, 0x85, 0x60, 0x31, 0xc6, 0x0e, 0x83,
+0xf0, 0x79, 0x0a, 0xca, 0xed, 0xb1, 0xe2, 0x36, 0xc0, 0x47, 0xf8, 0x3c, 0xc0, 0x01, 0x3b, 0x98,
+0xe5, 0xb7, 0x43, 0xf3, 0x18, 0x9f, 0xc7, 0x6b, 0x4e, 0x02, 0x01, 0xd1, 0x2f, 0x00, 0x8f, 0xf4,
+0xd1, 0x3e, 0x47, 0x2e, 0xf0, 0xbf, 0x58, 0x08, 0xf8, 0x44, 0x9c, 0x1f, 0x26, 0xc8, 0xa3, 0x24,
+0x5c, 0x04, 0xf8, 0xc7, 0xf8, 0x7e, 0xc9, 0x8a, 0x28, 0x8d, 0x2b, 0x8b, 0x01, 0x9f, 0xe9, 0xa3,
+0x4d, 0xcd, 0x91, 0x07, 0x29, 0xc6, 0x26, 0x13, 0x71, 0xfe, 0xa4, 0x80, 0x00, 0xa2, 0xf4, 0x97,
+0x00, 0x6e, 0xc1, 0xe7, 0x61, 0x5a, 0xe6, 0x60, 0x62, 0xee, 0x04, 0x3c, 0x1d, 0xc7, 0x67, 0x6e,
+0x96, 0xa5, 0x95, 0xf2, 0x2e, 0xc0, 0x17, 0xf0, 0xf9, 0x93, 0x30, 0x86, 0xa0, 0xe9, 0x6e, 0xc0,
+0x97, 0x62, 0xff, 0x12, 0x36, 0x30, 0x66, 0xee, 0x3d, 0x80, 0xaf, 0x06, 0x9c, 0x81, 0x40, 0x42,
+0x88, 0x56, 0x59, 0x0a, 0xf8, 0x7a, 0xc0, 0xc0, 0x4b, 0x0f, 0x5c, 0xa4, 0x8b, 0xb1, 0xcf, 0x2d,
+0xb8, 0x3e, 0x07, 0x94, 0xc1, 0x0b, 0xe2, 0xfb, 0x00, 0x2f, 0xc2, 0xe7, 0x05, 0x18, 0x57, 0x27,
+0xac, 0x2c, 0x03, 0x7c, 0x0f, 0x3e, 0x07, 0x6f, 0x14, 0x56, 0x0a, 0xe7, 0x7e, 0xc0, 0xbf, 0x44,
+0x7a, 0x4a, 0x97, 0xc1, 0x96, 0x57, 0x96, 0x03, 0x7e, 0x18, 0xf9, 0x9f, 0x67, 0x10, 0x1b, 0xfa,
+0xf9, 0x2f, 0x01, 0x3f, 0x81, 0xfc, 0x29, 0x13, 0x08, 0x11, 0x58, 0xb0, 0x02, 0x9a, 0xab, 0x71,
+0xfe, 0x18, 0x14, 0x06, 0x8c, 0x0a, 0xc6, 0x56, 0x7f, 0xc0, 0xfd, 0x49, 0xc0, 0xf8, 0xe7, 0x9e,
+0xfb, 0x00, 0xe0, 0x97, 0x71, 0x3c, 0x90, 0x56, 0xd7, 0x0d, 0xb2, 0x95, 0x80, 0x37, 0xe0, 0xfc,
+0x71, 0x50, 0x26, 0x49, 0xc9, 0x1e, 0x04, 0xfc, 0x06, 0xf6, 0x77, 0xbd, 0xc4, 0xcd, 0x0a, 0xff,
+0x21, 0xc0, 0xef, 0xf8, 0x5c, 0x5f, 0xd2, 0xac, 0xcc, 0x2b, 0x0f, 0x03, 0xfe, 0x00, 0xe5, 0x21,
+0xcc, 0x5c, 0xf0, 0xa0, 0xd9, 0xaf, 0x01, 0xff, 0x1b, 0xfb, 0x7b, 0xae, 0x9b, 0x81, 0xd0, 0x62,
+0xec, 0xf6, 0x95, 0x8f, 0xf1, 0x65, 0x56, 0xa4, 0x41, 0x16, 0x3d, 0x82, 0x91, 0x57, 0x80, 0xf2,
+0xe0, 0x05, 0x25, 0x78, 0xf9, 0x47, 0x01, 0xc7, 0x01, 0xda, 0x17, 0xc7, 0xf1, 0xd2, 0x32, 0x7c,
+0x0c, 0x49, 0x47, 0x0c, 0xce, 0x39, 0x77, 0x99, 0xf7, 0x38, 0xe0, 0x5d, 0x10, 0x43, 0x7f, 0x07,
+0xb8, 0xf0, 0x04, 0xe0, 0x3d, 0x00, 0x27, 0xa1, 0x5f, 0x16, 0x49, 0x58, 0xfc, 0x16, 0x70, 0x6f,
+0xc4, 0xa0, 0xbc, 0x39, 0x70, 0x15, 0x63, 0xc3, 0xfd, 0x03, 0xee, 0x24, 0xb3, 0xd0, 0xa9, 0x44,
+0x4f, 0x41, 0xf3, 0xa0, 0x00, 0xe3, 0xbf, 0x14, 0x74, 0x2e, 0xf3, 0x9f, 0x06, 0x3c, 0x24, 0xe0,
+0xfe, 0xc3, 0x2d, 0x81, 0x84, 0x0b, 0xde, 0xff, 0x70, 0xee, 0x2b, 0xb7, 0xee, 0x7c, 0xfe, 0xd2,
+0x07, 0x6f, 0x1b, 0x36, 0xe8, 0xe9, 0x89, 0x97, 0xed, 0xb1, 0xf0, 0x92, 0xc5, 0xc7, 0x4c, 0xea,
+0x73, 0xc2, 0xf3, 0xf3, 0xff, 0xde, 0xb0, 0xe1, 0xf5, 0x0b, 0xf7, 0xdd, 0xdd, 0xd9, 0xf2, 0xd3,
+0x4b, 0xbb, 0x17, 0x9f, 0x7e, 0x3a, 0xbe, 0xeb, 0xe4, 0x37, 0x7a, 0xef, 0x50, 0x1d, 0xd2, 0xeb,
+0xe3, 0xb5, 0xf7, 0xcd, 0x3e, 0x79, 0xee, 0x75, 0xec, 0xc8, 0xff, 0xfc, 0x69, 0xca, 0x6e, 0x6f,
+0x3d, 0xb9, 0x6a, 0xd5, 0x63, 0x27, 0x6d, 0x78, 0xad, 0xcd, 0xfd, 0xf7, 0xeb, 0xcb, 0x76, 0xbd,
+0xe8, 0x85, 0x95, 0xe3, 0x1e, 0xd8, 0xab, 0xd7, 0xac, 0x75, 0xf3, 0x66, 0xfe, 0x6c, 0xc8, 0xfa,
+0xe9, 0x5f, 0xcf, 0x9a, 0x78, 0xfd, 0xb7, 0xfd, 0xf7, 0x9a, 0x3f, 0x79, 0xcc, 0xdc, 0xa6, 0xcf,
+0xbb, 0x9f, 0xb6, 0x63, 0xf3, 0x89, 0x47, 0x9e, 0xb2, 0xee, 0x64, 0xe7, 0xca, 0xd6, 0x79, 0x2f,
+0x0e, 0xfa, 0x60, 0xdc, 0xa3, 0x27, 0xbd, 0xf9, 0xde, 0xb4, 0xe1, 0x5f, 0x36, 0xee, 0xb4, 0xfa,
+0x9f, 0x37, 0xef, 0x30, 0xbf, 0x7a, 0xe3, 0xd0, 0xb9, 0xa3, 0x9e, 0xd8, 0x38, 0xe7, 0xa2, 0x43,
+0x16, 0x3f, 0x56, 0xdc, 0xbe, 0xe6, 0x80, 0x65, 0x2b, 0xf7, 0xdf, 0xfc, 0x71, 0x97, 0xaf, 0xcf,
+0x1e, 0x72, 0xd3, 0x73, 0x1f, 0xbd, 0x71, 0xda, 0x17, 0xdd, 0xc6, 0x0e, 0x9e, 0xb6, 0x61, 0xd0,
+0xd4, 0xdf, 0xbf, 0x73, 0xcf, 0x2d, 0x63, 0xc7, 0x7c, 0x32, 0xe3, 0xab, 0x7e, 0xce, 0xf2, 0x15,
+0xd5, 0x45, 0x5b, 0x66, 0xbf, 0xf0, 0x87, 0xf4, 0xbe, 0x05, 0x67, 0x6c, 0x9a, 0xdd, 0x7c, 0xc2,
+0x56, 0x7f, 0xde, 0xfc, 0x87, 0x5e, 0x1d, 0x5d, 0xac, 0x59, 0xfc, 0xc8, 0xa2, 0x81, 0xb3, 0x4e,
+0x7c, 0xf8, 0xd9, 0xad, 0xcf, 0x9c, 0xb4, 0xf7, 0xc8, 0x86, 0x7d, 0xf6, 0xa9, 0xef, 0x31, 0x35,
+0x7b, 0x71, 0xec, 0xb8, 0x8d, 0xa3, 0x77, 0xff, 0xe3, 0xd9, 0x37, 0x27, 0x5b, 0x86, 0x8e, 0x1c,
+0xb4, 0x70, 0xc6, 0x0f, 0x76, 0xfd, 0x7a, 0xde, 0x17, 0x6f, 0xb7, 0x6d, 0x1c, 0xf0, 0xeb, 0x51,
+0x93, 0x5e, 0x7c, 0x20, 0x1d, 0x35, 0x73, 0xdb, 0xc6, 0xe0, 0xf5, 0x97, 0x0e, 0xee, 0x7d, 0xda,
+0x83, 0xee, 0xc5, 0x23, 0xdf, 0x9f, 0x74, 0xe5, 0xda, 0xb1, 0xb3, 0x1f, 0x7e, 0x65, 0xe6, 0x98,
+0x37, 0xfe, 0x71, 0xc9, 0xdd, 0xe3, 0xbf, 0x1d, 0xf7, 0xfd, 0x07, 0xd2, 0x37, 0xd7, 0x2e, 0x9f,
+0xba, 0x7a, 0x9f, 0xbf, 0xf5, 0x3c, 0xac, 0xa5, 0xef, 0x2b, 0x6b, 0x5b, 0x0e, 0x3d, 0xbf, 0xef,
+0x15, 0xdf, 0xfd, 0xab, 0xdb, 0xe1, 0x73, 0x9e, 0x7a, 0x6f, 0xb7, 0x87, 0x8e, 0xf9, 0x62, 0xf5,
+0x9b, 0xf7, 0xbe, 0x76, 0x4d, 0xcf, 0xef, 0xb6, 0x6c, 0x19, 0x71, 0xd7, 0x27, 0xeb, 0x3f, 0x38,
+0xf6, 0xbe, 0xdd, 0xbd, 0x31, 0xdd, 0xe6, 0x0f, 0x7f, 0x65, 0x8f, 0x59, 0x7f, 0x5d, 0xdf, 0x98,
+0xf7, 0xeb, 0x35, 0x7c, 0xe5, 0xf7, 0x0e, 0x8e, 0xbe, 0x7b, 0xe9, 0xd9, 0xfd, 0x5f, 0x5b, 0x71,
+0x72, 0xc7, 0xa9, 0x0b, 0x47, 0xf7, 0x79, 0xf5, 0xfd, 0xec, 0xdb, 0xb5, 0x57, 0x9d, 0xfe, 0xdc,
+0x99, 0x3f, 0xde, 0xb6, 0x6a, 0xec, 0x1d, 0xe3, 0xde, 0xda, 0xb0, 0xcf, 0x98, 0x6f, 0x3a, 0x06,
+0xf4, 0xe9, 0x9a, 0xbf, 0x33, 0xfe, 0xd9, 0xcb, 0x7b, 0x3f, 0xb9, 0xea, 0xe3, 0x9b, 0xfa, 0xa6,
+0xab, 0x5e, 0xb8, 0xb6, 0x4f, 0x97, 0x01, 0x2b, 0xfb, 0x1e, 0x16, 0xad, 0xdf, 0x3b, 0xbb, 0x72,
+0xf8, 0xfc, 0xc7, 0xff, 0xf5, 0x87, 0xc1, 0x2f, 0x57, 0xef, 0xe8, 0x7f, 0xd6, 0x05, 0x4b, 0xd7,
+0xad, 0x3a, 0x74, 0xdd, 0x0b, 0x33, 0x0f, 0xb8, 0xaf, 0xdf, 0xea, 0x3e, 0x83, 0x77, 0xbe, 0x66,
+0xd2, 0xda, 0xd3, 0x7b, 0x0c, 0xea, 0x5f, 0xe9, 0xba, 0xf0, 0xaa, 0x4d, 0x23, 0x0f, 0x7c, 0x74,
+0xc2, 0x9c, 0xa7, 0x4e, 0xba, 0x62, 0xfe, 0xfd, 0x9f, 0xef, 0x32, 0x73, 0x6b, 0xcf, 0x05, 0x0b,
+0x67, 0x5f, 0x56, 0x9d, 0xf3, 0xee, 0xe2, 0x45, 0xaf, 0xbe, 0xf6, 0xfb, 0x97, 0x86, 0xf7, 0x98,
+0x3e, 0xe2, 0x8e, 0xcf, 0x3f, 0x6f, 0x78, 0xbb, 0xeb, 0xb0, 0x4d, 0xcb, 0xc6, 0x1e, 0xd0, 0xff,
+0x89, 0x73, 0x97, 0x66, 0xcf, 0x8d, 0x3e, 0xe6, 0xf0, 0xcd, 0xbf, 0xfd, 0xf0, 0x8d, 0xcd, 0x37,
+0x5f, 0xf5, 0xce, 0x65, 0xc7, 0x6d, 0xec, 0xf8, 0xf8, 0xbd, 0xfa, 0x39, 0x9b, 0xfe, 0x34, 0xf0,
+0x85, 0x23, 0x07, 0x6c, 0xb8, 0xf3, 0x97, 0xdd, 0xeb, 0xb6, 0x1e, 0xff, 0xd5, 0x1b, 0xfd, 0xfe,
+0x72, 0xc4, 0xec, 0x77, 0xbb, 0x8d, 0x58, 0x36, 0xeb, 0xdc, 0x5d, 0x7e, 0x78, 0xf4, 0x88, 0x77,
+0x56, 0xcd, 0x3b, 0xef, 0x98, 0x2e, 0xef, 0x5f, 0xfa, 0x8f, 0x6f, 0x4f, 0x3f, 0x74, 0xe2, 0xf2,
+0xa5, 0xa3, 0x57, 0x4c, 0xdb, 0xe1, 0xbb, 0x57, 0x2f, 0x1e, 0x97, 0x9f, 0xbc, 0xeb, 0xe0, 0x63,
+0x6f, 0x39, 0xad, 0xe5, 0xc9, 0x13, 0xe6, 0x76, 0xc4, 0x1f, 0x78, 0x7f, 0x5d, 0xb2, 0x60, 0xea,
+0x6d, 0xbf, 0xfb, 0xf2, 0xce, 0xa1, 0x2f, 0xf4, 0x7a, 0x79, 0xaf, 0x0b, 0xdd, 0xae, 0xcb, 0x5b,
+0x7f, 0x33, 0xe3, 0xf3, 0xeb, 0xb7, 0xd6, 0x5d, 0x3e, 0xfa, 0xc0, 0xcf, 0xee, 0x9c, 0x72, 0x6a,
+0xcb, 0x57, 0x4f, 0xed, 0xb6, 0xe4, 0x3f, 0x7b, 0x5d, 0x76, 0xc3, 0x33, 0x4f, 0xdf, 0x3d, 0xe7,
+0xe3, 0xf7, 0x27, 0xbc, 0x78, 0xc8, 0x46, 0xa7, 0xd7, 0x77, 0x67, 0xb5, 0x3d, 0xb1, 0xe5, 0xcb,
+0xba, 0x7f, 0xac, 0xdf, 0xda, 0xef, 0xbd, 0x39, 0x9f, 0xae, 0xd9, 0x30, 0x71, 0xd9, 0xfa, 0xa1,
+0x5f, 0xee, 0xb7, 0xe7, 0xbf, 0xc6, 0x9f, 0x72, 0xff, 0xd8, 0xde, 0xef, 0x37, 0xf6, 0xfb, 0xac,
+0xda, 0x70, 0xcd, 0xa7, 0x2b, 0x4f, 0xfa, 0xa6, 0xe7, 0xf4, 0x7d, 0x8f, 0x5b, 0x72, 0xfc, 0x5d,
+0x5f, 0xf5, 0xef, 0xf5, 0xda, 0xaf, 0x7e, 0xbe, 0xad, 0x7c, 0x67, 0xc5, 0x71, 0x4b, 0x6e, 0x6d,
+0xdf, 0xff, 0xde, 0xfa, 0xe7, 0xcf, 0x3f, 0x62, 0xe0, 0xa2, 0x86, 0x9f, 0xdf, 0xfa, 0xe1, 0x7e,
+0xbd, 0xaf, 0xeb, 0xbf, 0xe9, 0x90, 0x87, 0xb7, 0xac, 0x39, 0x6f, 0xc7, 0x3d, 0xbb, 0x5f, 0x33,
+0xe8, 0xdc, 0xa7, 0xfb, 0xfd, 0xee, 0xdb, 0x9e, 0x7d, 0x8e, 0x7b, 0xfe, 0xa0, 0xcb, 0x2f, 0x7e,
+0x6f, 0xeb, 0xe8, 0xb5, 0xdf, 0xae, 0xcb, 0xfc, 0x2f, 0x96, 0xff, 0xaa, 0x61, 0x69, 0x75, 0xe3,
+0xff, 0x7d, 0x34, 0x71, 0xe4, 0xa8, 0x7b, 0x07, 0x0c, 0x3b, 0x70, 0xc6, 0xa8, 0xf5, 0xdd, 0x6f,
+0x99, 0xf5, 0xb7, 0x8b, 0x16, 0x0c, 0x6b, 0x1f, 0x7f, 0xf6, 0xc2, 0xcd, 0xbb, 0xdf, 0xbc, 0x74,
+0x4d, 0xef, 0x3b, 0x77, 0xea, 0xbb, 0x62, 0xf0, 0x13, 0xf3, 0x46, 0x5c, 0x75, 0xe3, 0x37, 0x67,
+0x4f, 0xd9, 0xeb, 0x47, 0x6b, 0x0e, 0x59, 0xf7, 0x4d, 0xeb, 0x98, 0x5e, 0xb7, 0xbd, 0xf2, 0x9b,
+0xc3, 0xff, 0x72, 0xf5, 0x15, 0xbf, 0xff, 0xe7, 0xaa, 0xb9, 0x73, 0xef, 0x98, 0x12, 0xbd, 0x7b,
+0x70, 0x97, 0x47, 0x8e, 0xbd, 0xf8, 0x94, 0xc3, 0x76, 0xbe, 0x35, 0xda, 0x96, 0x3e, 0xf2, 0xf2,
+0x25, 0x67, 0x6c, 0x39, 0xf3, 0xb6, 0xb5, 0x5d, 0x06, 0xed, 0xf8, 0xe9, 0x67, 0xcf, 0x35, 0x7e,
+0x74, 0xcf, 0xfe, 0x43, 0x1f, 0x78, 0x7c, 0xe0, 0x7e, 0x07, 0xec, 0xf8, 0x76, 0xdd, 0xe5, 0x37,
+0x0c, 0xb8, 0xee, 0xea, 0xcf, 0x4e, 0xbc, 0xf4, 0xd1, 0x21, 0xdb, 0x8e, 0xfa, 0xf8, 0xef, 0x47,
+0x4d, 0x28, 0x67, 0x4e, 0xbb, 0xf2, 0xe5, 0x65, 0x87, 0x2d, 0x79, 0xbd, 0x9f, 0x3b, 0x60, 0x51,
+0x3a, 0xb6, 0xdf, 0x9f, 0x67, 0x9d, 0xb5, 0xad, 0xf7, 0x43, 0x7f, 0x3f, 0xef, 0x93, 0x97, 0x46,
+0xf7, 0x79, 0xf8, 0x81, 0xf0, 0x9c, 0x2f, 0x17, 0x3d, 0xb6, 0x64, 0xd8, 0xa1, 0xbd, 0x9e, 0xee,
+0x71, 0xd0, 0xac, 0x73, 0xcf, 0x7a, 0xab, 0xc7, 0x88, 0x9f, 0x8c, 0x9b, 0xb5, 0xa0, 0x6f, 0xb1,
+0xb8, 0xe9, 0xf1, 0xbb, 0x1f, 0xef, 0xbe, 0xf4, 0x9b, 0x9d, 0xeb, 0x2e, 0xea, 0x76, 0xc2, 0x33,
+0x1b, 0xb6, 0x2d, 0x72, 0xf7, 0xcd, 0xa7, 0x7d, 0xb1, 0xa1, 0xfb, 0x27, 0x87, 0x37, 0x2c, 0xf0,
+0xea, 0x4e, 0x1d, 0xb8, 0xb9, 0xd7, 0xea, 0xe1, 0xa7, 0x8e, 0x58, 0x7b, 0xc6, 0x80, 0x1d, 0xa6,
+0x0c, 0x59, 0x78, 0xf4, 0x15, 0xcb, 0x96, 0x3d, 0xb8, 0xf4, 0xc6, 0xa3, 0xe3, 0xbb, 0xcf, 0x58,
+0xf1, 0x8b, 0xc1, 0x0d, 0x03, 0x6f, 0xff, 0x6c, 0xda, 0x09, 0xa7, 0x2f, 0xff, 0xdb, 0xd7, 0x43,
+0x16, 0xcf, 0x6a, 0x7a, 0xe9, 0xf2, 0x0f, 0x56, 0x6f, 0x7a, 0x71, 0xb7, 0x69, 0x9b, 0x07, 0x0d,
+0xdc, 0xef, 0xb4, 0xff, 0x07, 0xfa, 0xff, 0x59, 0x35,
+};
@@ -0,0 +1,88 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/misc.h>
+
+void
+grub_bench_report (const char *name, grub_uint64_t count, const char *unit,
+		   grub_uint64_t start, grub_uint64_t end)
+{
+  grub_uint64_t ms = end - start;
+
+  if (!ms)
+    ms = 1;
+  grub_printf ("%s: %llu %s in %llu ms, %llu %s/s\n", name,
+	       (unsigned long long) count, unit, (unsigned long long) ms,
+	       (unsigned long long) grub_divmod64 (count * 1000, ms, 0), unit);
+}
+
+static const char *const words[] =
+  {
+    "grub", "kernel", "module", "disk", "partition", "sector", "block",
+    "inode", "extent", "menu", "entry", "boot", "loader", "linux",
+    "initrd", "root", "search", "file", "read", "write", "cache",
+    "buffer", "device", "volume", "the", "a", "of", "and", "to", "in",
+    "is", "for"
+  };
+
+static grub_uint32_t seed;
+
+static unsigned
+next_random (void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 16;
+}
+
+/* The compressed copies in inflate_corpus.h and zstd_corpus.h were made
+   from exactly this output, so it must not change.  */
+void
+grub_bench_corpus (grub_uint8_t *out)
+{
+  grub_size_t pos = 0, len;
+  grub_uint32_t i;
+  unsigned r;
+
+  seed = 1;
+  while (pos < GRUB_BENCH_CORPUS_TEXT)
+    {
+      r = next_random ();
+      len = grub_strlen (words[r % ARRAY_SIZE (words)]);
+      if (len > GRUB_BENCH_CORPUS_TEXT - pos)
+	len = GRUB_BENCH_CORPUS_TEXT - pos;
+      grub_memcpy (out + pos, words[r % ARRAY_SIZE (words)], len);
+      pos += len;
+      if (pos < GRUB_BENCH_CORPUS_TEXT)
+	out[pos++] = ((r >> 8) % 12 == 0) ? '\n' : ' ';
+    }
+
+  for (i = 0; pos < GRUB_BENCH_CORPUS_TEXT + GRUB_BENCH_CORPUS_RECORDS; i++)
+    {
+      unsigned j;
+
+      grub_set_unaligned32 (out + pos, grub_cpu_to_le32 (i));
+      grub_set_unaligned32 (out + pos + 4, grub_cpu_to_le32 (i * 7));
+      for (j = 8; j < 16; j++)
+	out[pos + j] = next_random () & 0x0f;
+      pos += 16;
+    }
+
+  while (pos < GRUB_BENCH_CORPUS_SIZE)
+    out[pos++] = (next_random () >> 7) & 0xff;
+}
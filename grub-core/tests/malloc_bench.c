@@ -0,0 +1,237 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/time.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* The time the heap takes to replay allocation traces shaped like those
+   of scripts, filesystem drivers, fonts and image loaders.  In grub-emu
+   this measures the host malloc; tests/mm_unit_test.c checks kern/mm.c
+   itself.  */
+
+#define TRACE_OPS	20000
+#define BENCH_ROUNDS	20
+#define MAX_LIVE	1024
+
+enum free_order
+  {
+    FREE_NEWEST,
+    FREE_OLDEST,
+    FREE_RANDOM
+  };
+
+struct trace_shape
+{
+  const char *name;
+  /* Sizes of small and big allocations, and how many allocations in 256
+     are big.  */
+  grub_uint32_t small_min, small_max;
+  grub_uint32_t big_min, big_max;
+  unsigned big_share;
+  /* The alignment of big allocations, 0 for none.  */
+  grub_uint32_t big_align;
+  /* How many blocks are live at most, and which goes first.  */
+  unsigned live;
+  enum free_order order;
+};
+
+static const struct trace_shape shapes[] =
+  {
+    /* Short-lived strings and argument vectors.  */
+    { "script", 8, 120, 256, 1024, 8, 0, 64, FREE_NEWEST },
+    /* Nodes, names and block buffers of a directory walk.  */
+    { "filesystem", 24, 200, 512, 8192, 64, 0, 256, FREE_OLDEST },
+    /* Many long-lived glyphs.  */
+    { "font", 32, 300, 1024, 4096, 4, 0, 1024, FREE_RANDOM },
+    /* Aligned buffers of kernels and images among small ones.  */
+    { "large aligned", 16, 256, 65536, 524288, 16, 4096, 8, FREE_RANDOM }
+  };
+
+struct trace_op
+{
+  grub_uint32_t size;
+  grub_uint16_t slot;
+  grub_uint8_t free;
+  grub_uint8_t aligned;
+};
+
+static grub_uint32_t seed;
+
+static unsigned
+next_random (void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static grub_uint32_t
+random_size (grub_uint32_t min, grub_uint32_t max)
+{
+  return min + next_random () % (max - min + 1);
+}
+
+/* Fill OPS with a trace of SHAPE that frees everything it allocates and
+   return the number of operations.  */
+static unsigned
+generate_trace (const struct trace_shape *shape, struct trace_op *ops)
+{
+  grub_uint16_t order[MAX_LIVE], free_slots[MAX_LIVE];
+  unsigned head = 0, count = 0, nfree, n = 0, i;
+
+  seed = 1;
+  for (nfree = 0; nfree < shape->live; nfree++)
+    free_slots[nfree] = shape->live - 1 - nfree;
+
+  while (n < TRACE_OPS - shape->live)
+    {
+      struct trace_op *op = &ops[n++];
+
+      if (count == shape->live || (count && next_random () % 3 == 0))
+	{
+	  unsigned k;
+
+	  switch (shape->order)
+	    {
+	    case FREE_OLDEST:
+	      k = 0;
+	      break;
+	    case FREE_RANDOM:
+	      k = next_random () % count;
+	      break;
+	    default:
+	      k = count - 1;
+	      break;
+	    }
+	  i = (head + k) % shape->live;
+	  op->slot = order[i];
+	  op->free = 1;
+	  op->size = 0;
+	  op->aligned = 0;
+	  free_slots[nfree++] = op->slot;
+	  if (k == 0)
+	    head = (head + 1) % shape->live;
+	  else
+	    order[i] = order[(head + count - 1) % shape->live];
+	  count--;
+	  continue;
+	}
+
+      op->slot = free_slots[--nfree];
+      op->free = 0;
+      op->aligned = 0;
+      if (next_random () % 256 < shape->big_share)
+	{
+	  op->size = random_size (shape->big_min, shape->big_max);
+	  op->aligned = !!shape->big_align;
+	}
+      else
+	op->size = random_size (shape->small_min, shape->small_max);
+      order[(head + count) % shape->live] = op->slot;
+      count++;
+    }
+
+  for (; count; count--)
+    {
+      ops[n].slot = order[(head + count - 1) % shape->live];
+      ops[n].free = 1;
+      ops[n].size = 0;
+      ops[n].aligned = 0;
+      n++;
+    }
+  return n;
+}
+
+static void
+bench_one (const struct trace_shape *shape, struct trace_op *ops)
+{
+  grub_uint8_t *live[MAX_LIVE];
+  grub_uint64_t start, end;
+  unsigned nops, round, i;
+  int failed = 0;
+
+  nops = generate_trace (shape, ops);
+  grub_memset (live, 0, sizeof (live));
+
+  start = grub_get_time_ms ();
+  for (round = 0; round < BENCH_ROUNDS && !failed; round++)
+    for (i = 0; i < nops; i++)
+      {
+	struct trace_op *op = &ops[i];
+
+	if (op->free)
+	  {
+	    grub_free (live[op->slot]);
+	    live[op->slot] = NULL;
+	    continue;
+	  }
+#ifndef GRUB_MACHINE_EMU
+	if (op->aligned)
+	  live[op->slot] = grub_memalign (shape->big_align, op->size);
+	else
+#endif
+	  live[op->slot] = grub_malloc (op->size);
+	if (!live[op->slot])
+	  {
+	    failed = 1;
+	    break;
+	  }
+	/* Touch the block as its user would.  */
+	live[op->slot][0] = op->slot;
+	live[op->slot][op->size - 1] = op->slot;
+      }
+  end = grub_get_time_ms ();
+
+  for (i = 0; i < MAX_LIVE; i++)
+    grub_free (live[i]);
+
+  grub_test_assert (!failed, "%s: allocation failed", shape->name);
+  if (failed)
+    {
+      grub_errno = GRUB_ERR_NONE;
+      return;
+    }
+
+  grub_bench_report (shape->name, (grub_uint64_t) nops * BENCH_ROUNDS,
+		     "operations", start, end);
+}
+
+static void
+malloc_bench (void)
+{
+  struct trace_op *ops;
+  unsigned i;
+
+  ops = grub_malloc (TRACE_OPS * sizeof (*ops));
+  if (!ops)
+    {
+      grub_test_assert (0, "out of memory");
+      return;
+    }
+
+  for (i = 0; i < ARRAY_SIZE (shapes); i++)
+    bench_one (&shapes[i], ops);
+
+  grub_free (ops);
+}
+
+GRUB_FUNCTIONAL_TEST (malloc_bench, malloc_bench);
@@ -0,0 +1,102 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/time.h>
+#include <grub/crypto.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* PBKDF2 iterations per second for the digests LUKS and GELI use, next to
+   a straightforward HMAC-per-iteration reference.  */
+
+#define BENCH_ITERATIONS 20000
+
+static const grub_uint8_t password[] = "correct horse battery staple";
+static const grub_uint8_t salt[32] = { 0x5a, 0x17, 0x3c };
+
+static gcry_err_code_t
+reference_pbkdf2 (const gcry_md_spec_t *md, unsigned int c,
+		  grub_uint8_t *DK)
+{
+  grub_uint8_t U[GRUB_CRYPTO_MAX_MDLEN];
+  grub_uint8_t tmp[sizeof (salt) + 4];
+  gcry_err_code_t err;
+  unsigned int u;
+
+  grub_memcpy (tmp, salt, sizeof (salt));
+  tmp[sizeof (salt) + 0] = 0;
+  tmp[sizeof (salt) + 1] = 0;
+  tmp[sizeof (salt) + 2] = 0;
+  tmp[sizeof (salt) + 3] = 1;
+  err = grub_crypto_hmac_buffer (md, password, sizeof (password) - 1,
+				 tmp, sizeof (tmp), U);
+  if (err)
+    return err;
+  grub_memcpy (DK, U, md->mdlen);
+  for (u = 1; u < c; u++)
+    {
+      err = grub_crypto_hmac_buffer (md, password, sizeof (password) - 1,
+				     U, md->mdlen, U);
+      if (err)
+	return err;
+      grub_crypto_xor (DK, DK, U, md->mdlen);
+    }
+  return GPG_ERR_NO_ERROR;
+}
+
+static void
+bench_one (const gcry_md_spec_t *md)
+{
+  grub_uint8_t fast[GRUB_CRYPTO_MAX_MDLEN];
+  grub_uint8_t slow[GRUB_CRYPTO_MAX_MDLEN];
+  char name[64];
+  grub_uint64_t start, end;
+  gcry_err_code_t err;
+
+  start = grub_get_time_ms ();
+  err = grub_crypto_pbkdf2 (md, password, sizeof (password) - 1,
+			    salt, sizeof (salt), BENCH_ITERATIONS,
+			    fast, md->mdlen);
+  end = grub_get_time_ms ();
+  grub_test_assert (err == 0, "gcry error %d", err);
+  grub_snprintf (name, sizeof (name), "%s pbkdf2", md->name);
+  grub_bench_report (name, BENCH_ITERATIONS, "iterations", start, end);
+
+  start = grub_get_time_ms ();
+  err = reference_pbkdf2 (md, BENCH_ITERATIONS, slow);
+  end = grub_get_time_ms ();
+  grub_test_assert (err == 0, "gcry error %d", err);
+  grub_snprintf (name, sizeof (name), "%s hmac reference", md->name);
+  grub_bench_report (name, BENCH_ITERATIONS, "iterations", start, end);
+
+  grub_test_assert (grub_memcmp (fast, slow, md->mdlen) == 0,
+		    "%s: PBKDF2 differs from the reference", md->name);
+}
+
+static void
+pbkdf2_bench (void)
+{
+  bench_one (GRUB_MD_SHA1);
+  bench_one (GRUB_MD_SHA256);
+  bench_one (GRUB_MD_SHA512);
+}
+
+GRUB_FUNCTIONAL_TEST (pbkdf2_bench, pbkdf2_bench);
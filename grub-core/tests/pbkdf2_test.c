@@ -25,6 +25,7 @@ GRUB_MOD_LICENSE ("GPLv3+");
 
 static struct
 {
+  const gcry_md_spec_t *md;
   const char *P;
   grub_size_t Plen;
   const char *S;
@@ -35,6 +36,7 @@ static struct
 } vectors[] = {
   /* RFC6070. */
   {
+    GRUB_MD_SHA1,
     "password", 8,
     "salt", 4,
     1, 20,
@@ -42,6 +44,7 @@ static struct
     "\x06\x2f\xe0\x37\xa6"
   },
   {
+    GRUB_MD_SHA1,
     "password", 8,
     "salt", 4,
     2, 20,
@@ -50,6 +53,7 @@ static struct
     "\xd8\xde\x89\x57"
   },
   {
+    GRUB_MD_SHA1,
     "password", 8,
     "salt", 4,
     4096, 20,
@@ -57,6 +61,7 @@ static struct
     "\x21\xd0\x65\xa4\x29\xc1"
   },
   {
+    GRUB_MD_SHA1,
     "passwordPASSWORDpassword", 24,
     "saltSALTsaltSALTsaltSALTsaltSALTsalt", 36,
     4096, 25,
@@ -64,10 +69,45 @@ static struct
     "\xe4\x4a\x8b\x29\x1a\x96\x4c\xf2\xf0\x70\x38"
   },
   {
+    GRUB_MD_SHA1,
     "pass\0word", 9,
     "sa\0lt", 5,
     4096, 16,
     "\x56\xfa\x6a\xa7\x55\x48\x09\x9d\xcc\x37\xd7\xf0\x34\x25\xe0\xc3"
+  },
+  {
+    GRUB_MD_SHA256,
+    "password", 8,
+    "salt", 4,
+    1, 32,
+    "\x12\x0f\xb6\xcf\xfc\xf8\xb3\x2c\x43\xe7\x22\x52\x56\xc4"
+    "\xf8\x37\xa8\x65\x48\xc9\x2c\xcc\x35\x48\x08\x05\x98\x7c"
+    "\xb7\x0b\xe1\x7b"
+  },
+  /* More than one output block.  */
+  {
+    GRUB_MD_SHA256,
+    "password", 8,
+    "salt", 4,
+    4096, 40,
+    "\xc5\xe4\x78\xd5\x92\x88\xc8\x41\xaa\x53\x0d\xb6\x84\x5c"
+    "\x4c\x8d\x96\x28\x93\xa0\x01\xce\x4e\x11\xa4\x96\x38\x73"
+    "\xaa\x98\x13\x4a\xf7\xad\x98\xc1\xb4\x58\xce\x3f"
+  },
+  /* Password longer than the hash block size.  */
+  {
+    GRUB_MD_SHA512,
+    "pppppppppppppppppppppppppppppppppppppppppppppppppp"
+    "pppppppppppppppppppppppppppppppppppppppppppppppppp"
+    "pppppppppppppppppppppppppppppppppppppppppppppppppp"
+    "pppppppppppppppppppppppppppppppppppppppppppppppppp", 200,
+    "salt", 4,
+    1000, 64,
+    "\x07\xab\x3c\xae\x71\x28\x6f\x2b\x70\x05\x02\xbf\x41\x1c"
+    "\x26\xf2\xe5\xca\xc7\x2f\x29\xad\xb3\x08\xdd\xcc\xbe\xee"
+    "\xea\x1b\xdf\x6d\x13\x84\xfd\x64\xe1\x52\x9d\x58\x69\x1d"
+    "\x80\x67\x1f\xef\xe1\x82\x5d\xc7\xb0\xa3\x20\x49\x3b\x07"
+    "\x55\x89\x53\x0c\xaa\xbf\x57\xe8"
   }
 };
 
@@ -79,8 +119,8 @@ pbkdf2_test (void)
   for (i = 0; i < ARRAY_SIZE (vectors); i++)
     {
       gcry_err_code_t err;
-      grub_uint8_t DK[32];
-      err = grub_crypto_pbkdf2 (GRUB_MD_SHA1,
+      grub_uint8_t DK[64];
+      err = grub_crypto_pbkdf2 (vectors[i].md,
 				(const grub_uint8_t *) vectors[i].P,
 				vectors[i].Plen,
 				(const grub_uint8_t *) vectors[i].S,
@@ -0,0 +1,96 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/time.h>
+#include <grub/zfs/zfs.h>
+#include <grub/zfs/zio.h>
+#include <grub/zfs/zio_checksum.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* Throughput of every fletcher4 and SHA-256 implementation this CPU can
+   run.  zfs_checksum_test checks that they agree with the reference.  */
+
+#define BENCH_BUFSIZE	(128 * 1024)
+#define BENCH_BYTES	(256 * 1024 * 1024)
+
+static grub_uint32_t seed;
+
+static grub_uint8_t
+next_random (void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 16;
+}
+
+static void
+bench_impls (const char *name, const zio_checksum_impl_t *impls,
+	     unsigned nimpls, const grub_uint8_t *buf)
+{
+  unsigned features = zio_checksum_cpu_features ();
+  grub_uint64_t start;
+  char impl_name[64];
+  zio_cksum_t zc;
+  unsigned i, n;
+
+  for (i = 0; i < nimpls; i++)
+    {
+      if ((impls[i].features & features) != impls[i].features)
+	{
+	  grub_printf ("%s %s: not supported by this CPU\n", name,
+		       impls[i].name);
+	  continue;
+	}
+      start = grub_get_time_ms ();
+      for (n = 0; n < BENCH_BYTES / BENCH_BUFSIZE; n++)
+	impls[i].func (buf, BENCH_BUFSIZE, GRUB_ZFS_LITTLE_ENDIAN, &zc);
+      grub_snprintf (impl_name, sizeof (impl_name), "%s %s", name,
+		     impls[i].name);
+      grub_bench_report (impl_name, BENCH_BYTES >> 20, "MiB", start,
+			 grub_get_time_ms ());
+    }
+}
+
+static void
+zfs_checksum_bench (void)
+{
+  grub_uint8_t *buf;
+  unsigned i;
+
+  buf = grub_malloc (BENCH_BUFSIZE);
+  if (!buf)
+    {
+      grub_test_assert (0, "out of memory");
+      return;
+    }
+  seed = 1;
+  for (i = 0; i < BENCH_BUFSIZE; i++)
+    buf[i] = next_random ();
+
+  bench_impls ("fletcher4", fletcher_4_impls, fletcher_4_nimpls, buf);
+  bench_impls ("sha256", zio_checksum_SHA256_impls,
+	       zio_checksum_SHA256_nimpls, buf);
+
+  grub_free (buf);
+}
+
+GRUB_FUNCTIONAL_TEST (zfs_checksum_bench, zfs_checksum_bench);
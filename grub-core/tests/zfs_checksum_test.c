@@ -0,0 +1,131 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/zfs/zfs.h>
+#include <grub/zfs/zio.h>
+#include <grub/zfs/zio_checksum.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+#define BUFSIZE	(128 * 1024)
+
+/* Lengths to compare, including a misaligned start and a partial
+   trailing SHA-256 block.  */
+static const struct
+{
+  grub_size_t offset, size;
+} cases[] =
+  {
+    { 0, 0 }, { 0, 4 }, { 0, 12 }, { 0, 60 }, { 0, 512 }, { 4, 508 },
+    { 0, 4096 }, { 4, 4092 }, { 0, 4100 }, { 0, BUFSIZE }
+  };
+
+static grub_uint32_t seed;
+
+static grub_uint8_t
+next_random (void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 16;
+}
+
+/* Check every implementation this CPU can run against the reference,
+   which comes first.  */
+static void
+check_impls (const char *name, const zio_checksum_impl_t *impls,
+	     unsigned nimpls, const grub_uint8_t *buf)
+{
+  unsigned features = zio_checksum_cpu_features ();
+  grub_zfs_endian_t endian;
+  zio_cksum_t expected, actual;
+  unsigned i, j;
+
+  for (i = 1; i < nimpls; i++)
+    {
+      if ((impls[i].features & features) != impls[i].features)
+	continue;
+      for (j = 0; j < ARRAY_SIZE (cases); j++)
+	for (endian = GRUB_ZFS_LITTLE_ENDIAN; endian <= GRUB_ZFS_BIG_ENDIAN;
+	     endian++)
+	  {
+	    impls[0].func (buf + cases[j].offset, cases[j].size, endian,
+			   &expected);
+	    impls[i].func (buf + cases[j].offset, cases[j].size, endian,
+			   &actual);
+	    grub_test_assert (grub_memcmp (&expected, &actual,
+					   sizeof (expected)) == 0,
+			      "%s %s: %u bytes at %u (%s endian) differ from %s",
+			      name, impls[i].name, (unsigned) cases[j].size,
+			      (unsigned) cases[j].offset,
+			      endian == GRUB_ZFS_BIG_ENDIAN ? "big" : "little",
+			      impls[0].name);
+	  }
+    }
+}
+
+static void
+zfs_checksum_test (void)
+{
+  /* SHA-256 of "abc" from FIPS 180-2.  */
+  static const grub_uint64_t abc_sha256[4] =
+    {
+      0xba7816bf8f01cfeaULL, 0x414140de5dae2223ULL,
+      0xb00361a396177a9cULL, 0xb410ff61f20015adULL
+    };
+  /* Fletcher-4 of the little endian words 1, 2, 3 and 4: the running
+     sums.  */
+  static const grub_uint8_t words[16] =
+    { 1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0 };
+  static const grub_uint64_t words_fletcher4[4] = { 10, 20, 35, 56 };
+  grub_uint8_t *buf;
+  zio_cksum_t zc;
+  unsigned i;
+
+  zio_checksum_SHA256 ("abc", 3, GRUB_ZFS_BIG_ENDIAN, &zc);
+  for (i = 0; i < 4; i++)
+    grub_test_assert (grub_be_to_cpu64 (zc.zc_word[i]) == abc_sha256[i],
+		      "SHA-256 of \"abc\" is wrong in word %u", i);
+
+  fletcher_4_impls[0].func (words, sizeof (words), GRUB_ZFS_LITTLE_ENDIAN,
+			    &zc);
+  for (i = 0; i < 4; i++)
+    grub_test_assert (grub_le_to_cpu64 (zc.zc_word[i]) == words_fletcher4[i],
+		      "fletcher4 of 1, 2, 3, 4 is wrong in word %u", i);
+
+  buf = grub_malloc (BUFSIZE + 4);
+  if (!buf)
+    {
+      grub_test_assert (0, "out of memory");
+      return;
+    }
+  seed = 1;
+  for (i = 0; i < BUFSIZE + 4; i++)
+    buf[i] = next_random ();
+
+  check_impls ("fletcher4", fletcher_4_impls, fletcher_4_nimpls, buf);
+  check_impls ("sha256", zio_checksum_SHA256_impls,
+	       zio_checksum_SHA256_nimpls, buf);
+
+  grub_free (buf);
+}
+
+GRUB_FUNCTIONAL_TEST (zfs_checksum_test, zfs_checksum_test);
@@ -0,0 +1,111 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <grub/test.h>
+#include <grub/dl.h>
+#include <grub/misc.h>
+#include <grub/mm.h>
+#include <grub/time.h>
+#include <zstd.h>
+
+GRUB_MOD_LICENSE ("GPLv3+");
+
+/* Zstd throughput on the benchmark corpus, decoding the frame once as
+   btrfs does to fill its extent cache, and once for every 4 KiB read.  */
+
+#include "zstd_corpus.h"
+
+#define BENCH_ROUNDS 1000
+
+/* The most Linux puts in one compressed btrfs extent.  */
+#define MAX_FRAME (128 * 1024)
+#define READ_SIZE 4096
+
+static void
+bench_one (const char *name, ZSTD_DCtx *dctx, grub_size_t read_size,
+	   const grub_uint8_t *expected, grub_uint8_t *frame, grub_uint8_t *out)
+{
+  grub_uint64_t start, end;
+  grub_size_t ret = 0, pos;
+  unsigned i;
+
+  start = grub_get_time_ms ();
+  for (i = 0; i < BENCH_ROUNDS; i++)
+    {
+      if (read_size == GRUB_BENCH_CORPUS_SIZE)
+	{
+	  ret = ZSTD_decompressDCtx (dctx, out, GRUB_BENCH_CORPUS_SIZE,
+				     corpus_zstd, sizeof (corpus_zstd));
+	  if (ZSTD_isError (ret) || ret != GRUB_BENCH_CORPUS_SIZE)
+	    break;
+	  continue;
+	}
+      for (pos = 0; pos < GRUB_BENCH_CORPUS_SIZE; pos += read_size)
+	{
+	  ret = ZSTD_decompressDCtx (dctx, frame, MAX_FRAME, corpus_zstd,
+				     sizeof (corpus_zstd));
+	  if (ZSTD_isError (ret) || ret != GRUB_BENCH_CORPUS_SIZE)
+	    break;
+	  grub_memcpy (out + pos, frame + pos, read_size);
+	}
+      if (pos < GRUB_BENCH_CORPUS_SIZE)
+	break;
+    }
+  end = grub_get_time_ms ();
+
+  grub_test_assert (!ZSTD_isError (ret) && ret == GRUB_BENCH_CORPUS_SIZE,
+		    "%s: %s", name, ZSTD_isError (ret) ? ZSTD_getErrorName (ret)
+		    : "short frame");
+  if (ZSTD_isError (ret) || ret != GRUB_BENCH_CORPUS_SIZE)
+    return;
+  grub_test_assert (grub_memcmp (out, expected, GRUB_BENCH_CORPUS_SIZE) == 0,
+		    "%s: output differs from the corpus", name);
+  grub_bench_report (name,
+		     ((grub_uint64_t) BENCH_ROUNDS * GRUB_BENCH_CORPUS_SIZE) >> 10,
+		     "KiB", start, end);
+}
+
+static void
+zstd_bench (void)
+{
+  grub_uint8_t *corpus, *out, *frame;
+  ZSTD_DCtx *dctx;
+
+  corpus = grub_malloc (GRUB_BENCH_CORPUS_SIZE);
+  out = grub_malloc (GRUB_BENCH_CORPUS_SIZE);
+  frame = grub_malloc (MAX_FRAME);
+  dctx = ZSTD_createDCtx ();
+  if (!corpus || !out || !frame || !dctx)
+    {
+      grub_test_assert (0, "out of memory");
+      goto out;
+    }
+  grub_bench_corpus (corpus);
+
+  bench_one ("whole frame", dctx, GRUB_BENCH_CORPUS_SIZE, corpus, frame,
+	     out);
+  bench_one ("frame per 4 KiB read", dctx, READ_SIZE, corpus, frame, out);
+
+ out:
+  ZSTD_freeDCtx (dctx);
+  grub_free (frame);
+  grub_free (corpus);
+  grub_free (out);
+}
+
+GRUB_FUNCTIONAL_TEST (zstd_bench, zstd_bench);
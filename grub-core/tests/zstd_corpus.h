@@ -0,0 +1,419 @@
+/* A zstd frame (level 3, 128 KiB window, no checksum or content size, as
+   Linux writes them for btrfs) of the 16 KiB corpus built by
+   grub_bench_corpus in lib/bench.c.  */
+
+static const grub_uint8_t corpus_zstd[] =
+{
+0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x38, 0x8d, 0xcd, 0x00, 0x3a, 0x27, 0x39, 0x38, 0x46, 0x10, 0x28,
+0xf3, 0xa4, 0x59, 0x03, 0xcb, 0x7d, 0x3d, 0x28, 0x36, 0xe4, 0x28, 0xd1, 0x5b, 0x4f, 0xca, 0xed,
+0x50, 0x87, 0x6d, 0x1d, 0xd9, 0x09, 0x16, 0xca, 0xa9, 0xc4, 0x86, 0x54, 0xf3, 0xfe, 0x69, 0xbb,
+0xf7, 0x9f, 0x16, 0x83, 0xb1, 0xb1, 0xd5, 0xde, 0x2c, 0x79, 0xdb, 0x73, 0x05, 0x34, 0x0c, 0xe6,
+0x93, 0x88, 0x9a, 0xc2, 0x2e, 0xa8, 0x16, 0x8b, 0xc6, 0x87, 0x92, 0x95, 0xbd, 0xb2, 0x57, 0x6e,
+0x29, 0xa5, 0x94, 0x29, 0x3d, 0x03, 0xbe, 0x02, 0xbd, 0x02, 0xff, 0x18, 0xf8, 0x35, 0xa8, 0xaa,
+0x4a, 0x2d, 0x7b, 0xc5, 0x7f, 0x90, 0x9f, 0x0a, 0xa5, 0xac, 0x8d, 0xb4, 0xce, 0xdf, 0x8f, 0x3f,
+0x83, 0x2f, 0x3d, 0xa3, 0x68, 0xfd, 0x23, 0xf0, 0x63, 0xa0, 0x65, 0xd9, 0xbc, 0x30, 0x48, 0xff,
+0x3a, 0xfe, 0x0b, 0xa8, 0x6a, 0x69, 0x71, 0x4a, 0xfa, 0xbf, 0xf1, 0x4f, 0xa1, 0x51, 0x56, 0x4b,
+0x41, 0xfb, 0xa7, 0xf1, 0x5b, 0x50, 0xa9, 0x7a, 0xc9, 0x8a, 0xcd, 0xbf, 0x8c, 0x5f, 0x0a, 0x9d,
+0xd8, 0x85, 0xd1, 0xec, 0xfe, 0x5f, 0xfc, 0x51, 0x20, 0x46, 0xb3, 0x2c, 0x93, 0xf7, 0xe7, 0xe2,
+0xaf, 0x00, 0xa3, 0xb6, 0x99, 0x75, 0xeb, 0x8f, 0xc5, 0x0f, 0x00, 0x68, 0xd5, 0xb5, 0x2b, 0xbb,
+0x7e, 0x38, 0x3f, 0x05, 0xb5, 0x8a, 0x37, 0x93, 0x30, 0xfe, 0x4d, 0xfc, 0x13, 0x48, 0x4d, 0xda,
+0xa9, 0xc1, 0xf9, 0x23, 0xf1, 0x4b, 0x20, 0xad, 0x75, 0x2b, 0x85, 0xf4, 0x0f, 0xe2, 0x8f, 0x60,
+0x6a, 0x19, 0x65, 0xad, 0x94, 0x7f, 0x9b, 0x1f, 0xca, 0xd5, 0xac, 0x58, 0x69, 0xd1, 0xfe, 0xdd,
+0xaf, 0x45, 0x0b, 0xbb, 0xae, 0x56, 0xe1, 0x0f, 0xf4, 0x67, 0xb1, 0x52, 0xd4, 0x8d, 0xd5, 0xfe,
+0x39, 0xfc, 0xd7, 0xd2, 0xe4, 0xbc, 0x32, 0x49, 0xfd, 0x35, 0xfc, 0x58, 0x26, 0x6b, 0x9c, 0x57,
+0xed, 0x37, 0xc0, 0x7f, 0x51, 0xb1, 0x5a, 0xb0, 0x62, 0xd8, 0x5f, 0x80, 0xdf, 0x4e, 0xd7, 0x2a,
+0x8b, 0xfa, 0x1f, 0xc0, 0x6f, 0xd5, 0x78, 0xe7, 0x85, 0x51, 0xd7, 0x5f, 0xc2, 0x5f, 0x49, 0x8c,
+0xa2, 0x55, 0xb3, 0xf5, 0x17, 0xc0, 0x5f, 0x2d, 0x88, 0x61, 0x35, 0xab, 0xb0, 0xff, 0x83, 0x9f,
+0xa2, 0x6c, 0x96, 0x69, 0x91, 0xba, 0xff, 0x06, 0x3f, 0xad, 0x5a, 0xc5, 0x62, 0x46, 0xad, 0x1f,
+0x83, 0x7f, 0x4e, 0x78, 0x25, 0x26, 0xe1, 0xf5, 0x03, 0xe0, 0x97, 0x30, 0x93, 0x58, 0x75, 0xe5,
+0xf5, 0x67, 0x7f, 0xc4, 0xae, 0xb0, 0x6b, 0x6e, 0xff, 0xfa, 0x43, 0x98, 0x51, 0xb4, 0x5e, 0xd5,
+0xbe, 0x71, 0x1b, 0xc9, 0xdb, 0x36, 0x91, 0x67, 0xbd, 0xcf, 0x5a, 0xcb, 0x59, 0x2f, 0xe8, 0xb3,
+0xf6, 0xd4, 0xd9, 0x53, 0xe7, 0x7d, 0x16, 0xa8, 0xc4, 0x59, 0x20, 0xce, 0x04, 0xe4, 0x9d, 0xd6,
+0x9c, 0x3a, 0x5b, 0xea, 0x4e, 0x9d, 0x89, 0xe4, 0x59, 0x5b, 0xe2, 0x38, 0x6b, 0xad, 0xf7, 0x6d,
+0xa7, 0x6e, 0xb3, 0xa7, 0xce, 0xb4, 0xd9, 0x53, 0x47, 0xf2, 0x80, 0xec, 0x28, 0xe8, 0xf3, 0x2c,
+0xc9, 0xb3, 0x24, 0x6f, 0x0b, 0x22, 0x79, 0xf6, 0xf3, 0x3c, 0x93, 0x47, 0x0a, 0xfa, 0x48, 0xde,
+0xf6, 0x79, 0x1e, 0xc9, 0xdb, 0x4c, 0x1e, 0xa9, 0xd4, 0x9d, 0x3a, 0xce, 0xda, 0xd3, 0x48, 0xe4,
+0x95, 0x3a, 0xa0, 0x4d, 0x54, 0xe2, 0x2c, 0xc9, 0xb3, 0x9c, 0xf7, 0xd9, 0xce, 0x7a, 0xdf, 0x66,
+0x4f, 0x1d, 0x67, 0x4d, 0x1e, 0xc9, 0x02, 0x7d, 0x9e, 0xb7, 0x9d, 0x3a, 0x6b, 0x49, 0x9e, 0xb5,
+0xb6, 0x64, 0x4b, 0x1d, 0xe7, 0x7d, 0x24, 0xcf, 0x9a, 0x38, 0xeb, 0x7d, 0xf6, 0x54, 0xe2, 0x48,
+0xde, 0x69, 0x13, 0x95, 0x38, 0xcb, 0x6d, 0xa3, 0xa0, 0xef, 0xd4, 0x59, 0xce, 0x8e, 0x44, 0x9e,
+0xf5, 0x3e, 0xef, 0xb3, 0xa3, 0xa0, 0x6f, 0x23, 0x79, 0x96, 0xe4, 0x59, 0x6b, 0x45, 0x25, 0xee,
+0xe4, 0x7d, 0xf6, 0xf3, 0x3c, 0x20, 0x6e, 0x13, 0x95, 0x38, 0xce, 0xfb, 0xac, 0xf5, 0x48, 0xa2,
+0x12, 0x57, 0xea, 0x6c, 0x90, 0xf7, 0x01, 0x71, 0x40, 0x5c, 0x90, 0xf5, 0xbe, 0x53, 0x27, 0x2a,
+0x71, 0x9c, 0xe5, 0xb6, 0xa1, 0xd2, 0xc8, 0xe4, 0x91, 0x38, 0x93, 0xf7, 0x95, 0x3a, 0xcb, 0x6d,
+0x40, 0x96, 0xb3, 0xa7, 0x4e, 0xe4, 0x9d, 0xba, 0x12, 0xc9, 0xdb, 0xec, 0x50, 0x69, 0xb4, 0x99,
+0x4a, 0x1d, 0xc9, 0xe3, 0xb6, 0x53, 0x67, 0x49, 0x5e, 0x69, 0x14, 0xf4, 0x91, 0x3c, 0x4b, 0x2a,
+0x75, 0xf6, 0x23, 0x79, 0xd6, 0xe4, 0x91, 0x4a, 0x1c, 0x67, 0x45, 0xa6, 0xaf, 0x5b, 0x73, 0xea,
+0x4a, 0x9d, 0xf7, 0x99, 0xac, 0xf7, 0x79, 0x9f, 0x15, 0x71, 0x23, 0xef, 0xb3, 0x6b, 0x4e, 0x5d,
+0x27, 0x2a, 0x71, 0xa5, 0xce, 0xf3, 0x4e, 0x1d, 0x77, 0xea, 0x4a, 0xdd, 0x46, 0xf2, 0x4e, 0xdd,
+0x36, 0x12, 0x79, 0x16, 0x68, 0xc8, 0xa4, 0x86, 0x03, 0x12, 0x95, 0x38, 0x92, 0x67, 0x4f, 0x9d,
+0x25, 0x59, 0x2b, 0x2a, 0x59, 0x92, 0x67, 0x4f, 0xdd, 0x76, 0xea, 0x6c, 0xa9, 0x2b, 0x75, 0x96,
+0xb3, 0xa2, 0x12, 0xe7, 0x7d, 0x96, 0xe4, 0x95, 0xba, 0x8d, 0xf3, 0xbe, 0xcd, 0x9e, 0x46, 0x41,
+0x9f, 0xc9, 0x23, 0x95, 0x3a, 0x6e, 0x13, 0x95, 0x38, 0xef, 0x1b, 0x05, 0x7d, 0x76, 0x24, 0xd4,
+0x91, 0x80, 0x86, 0x4c, 0x6a, 0xb6, 0xa0, 0x34, 0x26, 0x6e, 0x74, 0xb2, 0x43, 0xa5, 0x11, 0x9b,
+0xcd, 0xfb, 0x6c, 0xc9, 0xeb, 0xbe, 0xee, 0x33, 0x71, 0x6d, 0x36, 0x92, 0x77, 0xea, 0x36, 0x92,
+0x27, 0xc4, 0x50, 0xa9, 0x13, 0xda, 0x46, 0x41, 0x9f, 0x35, 0x79, 0xdc, 0xc6, 0x6d, 0x26, 0x8f,
+0x44, 0xf2, 0xb6, 0x35, 0xa7, 0x4e, 0xb4, 0x99, 0x46, 0x22, 0xce, 0x13, 0x22, 0x79, 0x56, 0x54,
+0xe2, 0x4c, 0x5f, 0x57, 0xea, 0xb6, 0x11, 0x9b, 0x21, 0x21, 0x0f, 0x08, 0xd3, 0x88, 0x44, 0x1a,
+0x02, 0xda, 0xbc, 0x6f, 0x1b, 0x05, 0x7d, 0x26, 0xef, 0x4b, 0x33, 0x3a, 0x7d, 0x9d, 0x29, 0x08,
+0xef, 0xb3, 0x5f, 0x69, 0xf4, 0x09, 0x31, 0xda, 0x86, 0x30, 0x7d, 0xa5, 0xd1, 0xc6, 0x7d, 0x9e,
+0x67, 0xda, 0x44, 0xdc, 0xc8, 0x74, 0xea, 0xb6, 0x91, 0x50, 0x47, 0xda, 0x4c, 0x1e, 0x69, 0x24,
+0xf2, 0x4a, 0x9d, 0xf7, 0x6d, 0xde, 0xb7, 0x99, 0x3c, 0xd2, 0x56, 0xea, 0xb6, 0x51, 0x9a, 0x0e,
+0x88, 0x91, 0x68, 0x1b, 0x05, 0xa5, 0xe1, 0xd2, 0x58, 0x51, 0x89, 0xdb, 0x46, 0x42, 0x43, 0x22,
+0x8f, 0xcd, 0x26, 0x2a, 0x71, 0x9f, 0xe7, 0x01, 0x6d, 0x42, 0xa3, 0x92, 0x69, 0xb4, 0x66, 0x3b,
+0x75, 0xdb, 0x9a, 0x34, 0x9e, 0x10, 0x50, 0x77, 0xc2, 0x4c, 0x7e, 0x9c, 0xe4, 0x5f, 0x63, 0x55,
+0xda, 0xd5, 0xa6, 0xe4, 0x47, 0x47, 0x7e, 0x1f, 0x62, 0x76, 0xb3, 0xea, 0x9a, 0xc8, 0xdf, 0x5d,
+0x29, 0x27, 0x9c, 0x31, 0x7e, 0xbc, 0xc0, 0x1f, 0x14, 0x2b, 0xcb, 0xd6, 0x3b, 0xef, 0x47, 0x41,
+0x7e, 0x35, 0xf1, 0x6a, 0xd6, 0xa4, 0x94, 0x7e, 0xa4, 0xc0, 0x4f, 0xda, 0x52, 0x35, 0xa3, 0x2e,
+0xec, 0xa3, 0x1e, 0xff, 0x88, 0x52, 0x15, 0x55, 0xe7, 0x8c, 0x1f, 0x21, 0xf0, 0x8b, 0xac, 0xbc,
+0xe0, 0x95, 0x69, 0xf2, 0xe3, 0x03, 0xfe, 0x34, 0x51, 0x8b, 0x91, 0xc2, 0x49, 0x3f, 0xe2, 0xf9,
+0x81, 0x2e, 0xc5, 0x34, 0x4b, 0xd5, 0xeb, 0xa3, 0x9d, 0x9f, 0xa3, 0x2e, 0x59, 0x61, 0x9a, 0x9d,
+0x1f, 0xeb, 0xfc, 0x3d, 0x50, 0xf1, 0x5e, 0xd5, 0xad, 0xee, 0x47, 0x39, 0x7f, 0x02, 0x34, 0x4b,
+0x83, 0xd5, 0xb5, 0xd7, 0xc7, 0x2b, 0x7e, 0x1e, 0xa2, 0x45, 0xb3, 0x48, 0xbd, 0xf9, 0x77, 0xb0,
+0x2c, 0x36, 0xeb, 0xb5, 0x7f, 0x64, 0xe2, 0xd7, 0x21, 0xbb, 0xd5, 0x34, 0xd2, 0xf8, 0xf1, 0x88,
+0x3f, 0x87, 0x78, 0x86, 0x51, 0x6b, 0xda, 0x47, 0x20, 0x7e, 0x04, 0x50, 0xd9, 0x85, 0x69, 0xdf,
+0xea, 0xa3, 0xf7, 0x1f, 0x80, 0xc2, 0x2e, 0x18, 0x6b, 0x96, 0x7d, 0x0c, 0xfa, 0x71, 0xb0, 0xae,
+0xb4, 0xb0, 0x39, 0xf6, 0x91, 0xfb, 0xd1, 0xc8, 0xac, 0x62, 0x55, 0x62, 0xd5, 0x47, 0x04, 0xfc,
+0x37, 0xc8, 0x8b, 0x5e, 0x61, 0xb4, 0x7e, 0x3c, 0xf3, 0xdb, 0x40, 0xab, 0xaa, 0xc6, 0x79, 0xa9,
+0x8f, 0x31, 0x58, 0x14, 0x16, 0xaf, 0xe3, 0x47, 0x31, 0xff, 0x19, 0xeb, 0x92, 0x56, 0xc4, 0xea,
+0x1f, 0x55, 0xf8, 0x69, 0xd0, 0x2a, 0x6c, 0x56, 0x58, 0xe9, 0xc7, 0x2f, 0xff, 0x0c, 0xb7, 0x62,
+0x37, 0x5e, 0xed, 0x8f, 0x22, 0xfc, 0x32, 0x5c, 0xd6, 0xc6, 0xf8, 0xbd, 0x3e, 0x7a, 0xf0, 0x9b,
+0xb9, 0x59, 0x75, 0x4d, 0xd9, 0xec, 0xa3, 0x95, 0xbf, 0x4c, 0xcc, 0xa8, 0x2c, 0x56, 0x0b, 0xfb,
+0x78, 0xc1, 0x6f, 0x00, 0xea, 0x7b, 0x2b, 0x0b, 0x9b, 0x1f, 0x29, 0xf8, 0x63, 0x80, 0x95, 0xca,
+0xe3, 0xfd, 0x61, 0xa0, 0xb4, 0xad, 0x55, 0x31, 0xfb, 0x91, 0xfa, 0xc9, 0xd0, 0x79, 0x2b, 0x58,
+0x69, 0x7c, 0xf8, 0xc9, 0x3f, 0xc6, 0x62, 0xf4, 0xde, 0xaf, 0xf5, 0x50, 0x93, 0xff, 0x05, 0xac,
+0x82, 0xf5, 0x82, 0x9a, 0x7d, 0xd8, 0xe7, 0x77, 0x21, 0xab, 0x31, 0x9b, 0x95, 0x5e, 0x0f, 0x21,
+0x91, 0xb5, 0xba, 0x56, 0xfc, 0x21, 0x23, 0xbf, 0x18, 0x2d, 0x5e, 0x94, 0x75, 0x59, 0xd6, 0x43,
+0x3e, 0x7f, 0x0b, 0x90, 0xa2, 0x14, 0xcd, 0xa6, 0xf6, 0xd0, 0x02, 0x3f, 0x0b, 0x57, 0x46, 0x69,
+0x56, 0xbb, 0xd7, 0x43, 0x40, 0xfe, 0x15, 0xae, 0x98, 0x55, 0xd9, 0xb4, 0xb4, 0x87, 0x7c, 0xfc,
+0x61, 0xb2, 0xab, 0x82, 0x12, 0xe2, 0xf1, 0x13, 0xe0, 0xb2, 0xac, 0x5a, 0x2d, 0xaa, 0x7a, 0x28,
+0xc7, 0x3f, 0x00, 0xca, 0x52, 0x2a, 0x21, 0x1b, 0xbf, 0x0a, 0x99, 0xb5, 0x19, 0xf6, 0xf4, 0xe1,
+0x19, 0x7f, 0x0a, 0x5a, 0x16, 0x27, 0xbd, 0x22, 0xf5, 0x50, 0x8c, 0x1f, 0x85, 0x2b, 0x9d, 0xd6,
+0xba, 0xf7, 0x61, 0x03, 0xfe, 0x13, 0x28, 0x4a, 0x2b, 0x35, 0xaf, 0xf9, 0x50, 0x8b, 0xdf, 0x84,
+0x23, 0x94, 0x19, 0x85, 0xd7, 0xc3, 0x05, 0xfc, 0x60, 0x2c, 0x29, 0xab, 0x09, 0x35, 0xf9, 0x10,
+0x8a, 0xbf, 0x04, 0xeb, 0x8a, 0x93, 0xa2, 0x60, 0x7d, 0xe8, 0xe6, 0xff, 0x32, 0xeb, 0x1a, 0x16,
+0xe1, 0x7d, 0x48, 0xc4, 0xef, 0xc5, 0x8a, 0x98, 0x76, 0x31, 0x69, 0x3d, 0x3c, 0xfd, 0x24, 0x50,
+0x19, 0xe9, 0x65, 0x55, 0xfb, 0x50, 0xe8, 0xef, 0x92, 0x59, 0x2a, 0x8b, 0xd6, 0x85, 0x3d, 0x1c,
+0xfd, 0x5c, 0xaa, 0x7a, 0xe7, 0xad, 0xa8, 0xf9, 0x90, 0x87, 0x7f, 0x04, 0x29, 0xa7, 0x85, 0x37,
+0xab, 0x0f, 0xd1, 0xfc, 0x02, 0xb0, 0xb4, 0xca, 0x33, 0x39, 0x1f, 0xca, 0xf0, 0x8b, 0x40, 0x65,
+0x17, 0x56, 0x2d, 0x48, 0x1f, 0x8e, 0xf9, 0xb7, 0x58, 0xd9, 0xbc, 0x63, 0x11, 0x3e, 0x5c, 0xe1,
+0x0f, 0x61, 0xde, 0x31, 0xa8, 0xd9, 0xfb, 0xf0, 0x84, 0x3f, 0x00, 0x31, 0x5a, 0x8b, 0x51, 0x5b,
+0x1f, 0x76, 0xf9, 0xb5, 0x58, 0xad, 0x9a, 0x57, 0xbb, 0xf6, 0x61, 0x00, 0x7e, 0x10, 0x96, 0x77,
+0x6a, 0x56, 0x76, 0x1f, 0x62, 0xf9, 0x3f, 0xa0, 0x54, 0x75, 0xab, 0x5d, 0x3e, 0xd4, 0xe0, 0xf7,
+0x40, 0x42, 0x19, 0xa9, 0x6a, 0x62, 0x0f, 0xa5, 0xfc, 0x1d, 0xc4, 0x49, 0xbf, 0x22, 0x15, 0x1f,
+0x46, 0xf0, 0x67, 0xa1, 0x19, 0xd4, 0xb4, 0x79, 0xf6, 0xd0, 0xfe, 0x58, 0xae, 0x45, 0x69, 0x55,
+0x29, 0xf8, 0x50, 0xfe, 0x1c, 0xd0, 0xeb, 0x92, 0x55, 0xb3, 0xae, 0x9f, 0x93, 0xff, 0x0a, 0xa5,
+0x17, 0x65, 0x2f, 0x5a, 0x7f, 0x4c, 0xaa, 0x5a, 0xaf, 0x2a, 0xde, 0xff, 0x03, 0xbf, 0x15, 0x7a,
+0x5d, 0x4c, 0xcb, 0x28, 0xed, 0xef, 0xc0, 0x5f, 0x25, 0x56, 0x8b, 0x56, 0x08, 0xb1, 0x5f, 0x91,
+0x7f, 0xc3, 0xae, 0x8f, 0xf0, 0xff, 0x1b, 0x14, 0x56, 0x61, 0x31, 0xca, 0xea, 0x27, 0x08, 0xfe,
+0x07, 0x60, 0x50, 0xc6, 0x88, 0x51, 0xf0, 0xa7, 0x24, 0xbf, 0x1b, 0x5f, 0x0d, 0xbb, 0xaa, 0xea,
+0xfa, 0xd9, 0xc8, 0xdf, 0xc6, 0xcc, 0xb0, 0x68, 0xc9, 0x88, 0xfd, 0x44, 0xe4, 0x67, 0xc3, 0x6a,
+0x96, 0xa5, 0xd1, 0xaa, 0xfa, 0xb9, 0xe7, 0x5f, 0x03, 0xa3, 0x31, 0xc2, 0x88, 0xdd, 0x9f, 0x81,
+0xfc, 0x6a, 0x44, 0x79, 0x2f, 0x6b, 0x2d, 0xea, 0xe7, 0x04, 0xfe, 0x34, 0xae, 0xf7, 0x52, 0xb6,
+0xc2, 0x7e, 0xe6, 0xf1, 0xe3, 0xa1, 0x56, 0xbb, 0xd6, 0xd2, 0xfe, 0x49, 0xc7, 0xef, 0x80, 0x3b,
+0xbf, 0x28, 0xec, 0xc6, 0x9f, 0x6e, 0xfc, 0x68, 0x4c, 0x4d, 0xca, 0x46, 0xed, 0xfe, 0x74, 0xc0,
+0x7f, 0x06, 0xcc, 0xa6, 0xb2, 0x2a, 0xb3, 0x7e, 0x92, 0xf1, 0xdf, 0x99, 0x82, 0x5b, 0x54, 0x56,
+0xfd, 0xa4, 0xf3, 0x9b, 0x51, 0x51, 0x49, 0x2f, 0x08, 0xad, 0x9f, 0x5b, 0xfc, 0x65, 0xc4, 0x8b,
+0x49, 0x59, 0x63, 0xf5, 0xd3, 0x8a, 0xdf, 0xce, 0x57, 0x26, 0x2d, 0xca, 0x62, 0x3f, 0xa5, 0xf8,
+0xc9, 0x88, 0xb6, 0xb2, 0x94, 0x6a, 0xf5, 0xe7, 0x12, 0xff, 0x18, 0x14, 0xd2, 0x8a, 0xb2, 0xb6,
+0x3f, 0x8d, 0xf8, 0xc5, 0xd0, 0xbe, 0x30, 0x2c, 0x5a, 0xed, 0xe7, 0xd0, 0x1f, 0xc6, 0xac, 0xf7,
+0x6a, 0x17, 0x75, 0x7f, 0x96, 0x7e, 0x30, 0xa6, 0x66, 0x23, 0xcd, 0xac, 0xfa, 0x53, 0xcd, 0xff,
+0xc5, 0xa5, 0x61, 0xd8, 0x37, 0xde, 0x9f, 0x3d, 0xfc, 0x75, 0xae, 0xae, 0x9a, 0x59, 0xcd, 0xfe,
+0x3c, 0xc0, 0x4f, 0x87, 0xb2, 0xea, 0xad, 0x5b, 0xf3, 0x27, 0x0d, 0xff, 0x9c, 0x0c, 0x83, 0x31,
+0xd6, 0xa9, 0xfd, 0x84, 0xe1, 0x6f, 0x80, 0xac, 0xd1, 0x82, 0xb3, 0x85, 0xdf, 0x8b, 0x8b, 0xc5,
+0x7b, 0xb5, 0xff, 0x4c, 0xe1, 0xef, 0x22, 0xb3, 0xd2, 0xb2, 0xd8, 0x65, 0xfd, 0xf4, 0xf2, 0x73,
+0x51, 0xd9, 0x09, 0xa7, 0xad, 0xea, 0xcf, 0x2d, 0xbf, 0x1c, 0x1a, 0x35, 0xea, 0xba, 0xf5, 0xb3,
+0x83, 0x7f, 0x8b, 0x4b, 0x2d, 0x75, 0xc5, 0x78, 0xfd, 0xac, 0xf2, 0x33, 0x60, 0x42, 0x6b, 0xaf,
+0x74, 0xfe, 0x9c, 0xf2, 0x6b, 0x61, 0x7d, 0x55, 0xa9, 0x5d, 0xea, 0xe7, 0x04, 0x7f, 0x16, 0x55,
+0xb5, 0x2e, 0x75, 0xb1, 0xf8, 0x13, 0xfb, 0xe3, 0x58, 0xd6, 0xda, 0x1a, 0x35, 0xf8, 0x93, 0xfe,
+0x58, 0x68, 0x35, 0x56, 0xdb, 0x8b, 0xbd, 0xf4, 0xe4, 0xbf, 0xc2, 0x52, 0xd9, 0x45, 0x5d, 0x8c,
+0x7a, 0xe9, 0xe7, 0xb7, 0x82, 0x6a, 0x96, 0x5a, 0x0d, 0xc3, 0x5e, 0x56, 0xf2, 0x57, 0x61, 0xcd,
+0x2b, 0x62, 0x5b, 0xd8, 0xcb, 0x47, 0xfe, 0x05, 0x54, 0x92, 0x5e, 0xf2, 0xde, 0xeb, 0xe5, 0x22,
+0x3f, 0x15, 0x92, 0x52, 0x95, 0xc2, 0xb0, 0xfb, 0xf2, 0x90, 0x7f, 0x8a, 0x09, 0x2b, 0x4a, 0x4d,
+0x0a, 0xbe, 0x2c, 0xe4, 0x87, 0x33, 0xad, 0x94, 0x50, 0x56, 0xf1, 0xa5, 0x9e, 0xff, 0x4d, 0xbd,
+0xd6, 0x35, 0x85, 0x55, 0x2f, 0xf7, 0xf8, 0xa5, 0xb8, 0xa6, 0x05, 0x2d, 0xa5, 0xf3, 0xe5, 0x1d,
+0x7f, 0x14, 0x97, 0xba, 0xd4, 0x54, 0x56, 0x2f, 0xe3, 0xf8, 0xa1, 0x98, 0x14, 0xab, 0xb4, 0x49,
+0xef, 0xcb, 0x35, 0xfe, 0x27, 0x64, 0x56, 0x0d, 0x8f, 0xf6, 0xe5, 0x9d, 0xdf, 0x89, 0x0b, 0x83,
+0x11, 0x5b, 0x9b, 0x2f, 0xc3, 0xf8, 0x9b, 0xa8, 0x74, 0x78, 0x85, 0x55, 0x2f, 0xbd, 0xf8, 0x99,
+0xc8, 0xb0, 0x5b, 0x5d, 0x5b, 0xe5, 0xcb, 0x2c, 0xfe, 0x25, 0xe8, 0xb5, 0x11, 0xbb, 0x5e, 0x2f,
+0xa9, 0xf8, 0x95, 0xb8, 0x26, 0x95, 0x70, 0x46, 0xf9, 0xf2, 0x89, 0xdf, 0xcd, 0x55, 0x2d, 0x76,
+0x55, 0x5d, 0x2f, 0x93, 0xf8, 0x93, 0xb8, 0x35, 0xbb, 0xe8, 0xa5, 0xee, 0xcb, 0x21, 0x7e, 0x05,
+0x50, 0x49, 0x2d, 0xfb, 0x84, 0x2f, 0x4d, 0x3f, 0x12, 0x91, 0x5e, 0x3b, 0x2d, 0xca, 0xbe, 0x5c,
+0xf3, 0x1f, 0xb1, 0x84, 0x53, 0x97, 0x56, 0x5f, 0x8a, 0x7e, 0x23, 0xaa, 0x56, 0xad, 0x4b, 0x59,
+0xf9, 0x72, 0x87, 0xbf, 0x08, 0x5b, 0x25, 0x16, 0x2b, 0x8d, 0x7a, 0x79, 0xc3, 0x4f, 0x84, 0x45,
+0xc5, 0xaf, 0x3a, 0xe1, 0x4b, 0x33, 0xff, 0x10, 0x43, 0x8d, 0xba, 0x2c, 0x8b, 0x7a, 0xf9, 0xc2,
+0x2f, 0x04, 0xbd, 0xa0, 0x75, 0xef, 0x75, 0x5f, 0x86, 0xf9, 0x83, 0xb8, 0xd1, 0xd2, 0xab, 0xc5,
+0x5f, 0x9a, 0xf0, 0x03, 0x51, 0x69, 0xf6, 0x6a, 0x55, 0xfe, 0x92, 0xcb, 0x3f, 0xb4, 0xbd, 0x26,
+0x75, 0x69, 0xd9, 0x4b, 0x2d, 0xff, 0xa7, 0xcd, 0x48, 0x35, 0x0b, 0xca, 0x97, 0x1c, 0xfc, 0x27,
+0xea, 0x9a, 0x97, 0xbc, 0xb3, 0x7a, 0x49, 0xe5, 0x37, 0x51, 0x96, 0x66, 0x2b, 0x78, 0x69, 0x2f,
+0xa3, 0xfc, 0x3f, 0x5c, 0xf4, 0xca, 0xab, 0x5a, 0xbd, 0x84, 0xf2, 0xb7, 0xc1, 0xe0, 0x9c, 0x56,
+0xa4, 0xf7, 0xa5, 0xf5, 0x7b, 0x98, 0xad, 0xe8, 0x75, 0x5d, 0xea, 0x65, 0xfc, 0x4b, 0x18, 0x56,
+0xdd, 0x0c, 0x9b, 0xd4, 0xc7, 0x3f, 0x3f, 0x9b, 0x7a, 0xdd, 0x0b, 0x56, 0x97, 0xfc, 0x42, 0xd4,
+0x66, 0x01, 0x39, 0x7c, 0xd0, 0xc5, 0xcb, 0x23, 0x6d, 0x2e, 0xf8, 0x83, 0x91, 0x3c, 0x24, 0x69,
+0x02, 0x10, 0x92, 0x9b, 0x3a, 0x60, 0x38, 0xd1, 0x00, 0x1a, 0x3a, 0xcc, 0xd0, 0xe6, 0x12, 0x2f,
+0xba, 0x88, 0xbe, 0x34, 0x00, 0xcf, 0x0e, 0x63, 0x54, 0x2c, 0x60, 0x61, 0x87, 0x8d, 0x3b, 0x77,
+0x9c, 0x60, 0x61, 0x0e, 0x18, 0xa1, 0x08, 0xb8, 0xec, 0xa0, 0x87, 0x0c, 0x0e, 0x63, 0xf2, 0xb0,
+0xf2, 0x48, 0x17, 0x1c, 0x36, 0x29, 0x47, 0x84, 0x42, 0x25, 0x53, 0xf6, 0x64, 0xd2, 0xe6, 0x7a,
+0x10, 0xe9, 0xfc, 0xd9, 0x83, 0xc7, 0x0c, 0x52, 0x90, 0xd8, 0x28, 0xe8, 0xc4, 0xce, 0x94, 0x39,
+0xc6, 0x98, 0x83, 0x54, 0x27, 0xcb, 0x22, 0xc7, 0x0d, 0x1a, 0x04, 0x90, 0xa1, 0xa2, 0x88, 0x0f,
+0x41, 0xb8, 0x19, 0x81, 0xca, 0x1d, 0x56, 0x4c, 0x10, 0x03, 0x86, 0x1c, 0x74, 0x34, 0x01, 0x82,
+0x52, 0xc3, 0x0d, 0x2c, 0x65, 0x00, 0xa9, 0x64, 0x88, 0x0d, 0xb4, 0x71, 0xe5, 0x8f, 0x0f, 0x6e,
+0x2c, 0xa0, 0xe5, 0xcc, 0x45, 0x87, 0x4b, 0xd4, 0x72, 0x08, 0x18, 0x27, 0xdc, 0x09, 0xe4, 0x89,
+0x36, 0x45, 0x68, 0x69, 0x56, 0xd8, 0x00, 0x25, 0x2b, 0xfc, 0x01, 0x13, 0xc7, 0x12, 0x34, 0x5c,
+0x22, 0x45, 0x15, 0x5c, 0xae, 0x68, 0x62, 0x5b, 0x44, 0x82, 0x10, 0x3e, 0xe8, 0x32, 0x87, 0x1a,
+0x61, 0x40, 0x20, 0xe3, 0x03, 0xa3, 0x3d, 0x2e, 0xb1, 0x44, 0x02, 0x2f, 0x50, 0xf4, 0x74, 0xd1,
+0x43, 0x9f, 0x1d, 0x94, 0x08, 0x04, 0x8e, 0xeb, 0x4f, 0xe5, 0x82, 0x82, 0x13, 0x6e, 0x48, 0xc2,
+0x05, 0x38, 0xa0, 0x90, 0xe0, 0x48, 0x15, 0xfa, 0x02, 0x0e, 0x9c, 0x3c, 0x1d, 0x90, 0x80, 0x13,
+0x52, 0x5c, 0x00, 0x85, 0x37, 0x04, 0xe9, 0xc2, 0x8a, 0x19, 0xaf, 0x93, 0x41, 0x4a, 0xf0, 0xa3,
+0x00, 0x1b, 0x08, 0xfd, 0xd0, 0x09, 0x16, 0x50, 0x90, 0x99, 0x82, 0x8e, 0x2f, 0x78, 0xb2, 0x4c,
+0x10, 0xc6, 0x15, 0x3f, 0xec, 0x68, 0x81, 0xc1, 0x23, 0x73, 0x7e, 0xe0, 0xe1, 0x24, 0x46, 0x0e,
+0x12, 0x1a, 0x70, 0xb3, 0xc5, 0x14, 0x43, 0x62, 0x10, 0x42, 0x04, 0x31, 0x5c, 0xca, 0x88, 0x01,
+0x06, 0x35, 0x1f, 0xc8, 0x00, 0x1f, 0xce, 0x8e, 0x28, 0x0d, 0x34, 0x32, 0x99, 0xd8, 0x20, 0x9e,
+0xe8, 0x29, 0xe3, 0x07, 0x92, 0x24, 0x9a, 0x18, 0x81, 0x8f, 0x17, 0xb0, 0x54, 0xf1, 0x24, 0x02,
+0x5a, 0xee, 0x08, 0xc2, 0x0b, 0x15, 0x53, 0x34, 0x90, 0x60, 0x08, 0x3f, 0xfa, 0xb8, 0x51, 0x02,
+0x23, 0x5b, 0xaa, 0xb8, 0xf2, 0xc1, 0x24, 0x5c, 0x30, 0x40, 0x44, 0xa7, 0x4b, 0x0a, 0x44, 0xf0,
+0x01, 0x54, 0x06, 0x08, 0x27, 0x2e, 0xc0, 0x78, 0x01, 0x4f, 0x23, 0xda, 0x1f, 0x06, 0xa4, 0x51,
+0x88, 0x95, 0x2d, 0x9b, 0x88, 0x21, 0x03, 0x18, 0x2f, 0x78, 0x30, 0x54, 0xa5, 0x93, 0x1a, 0xd6,
+0xb0, 0x84, 0x0a, 0x11, 0x77, 0x89, 0x96, 0x51, 0x24, 0x57, 0xce, 0x9c, 0x71, 0x03, 0x0f, 0x1e,
+0xd0, 0xe0, 0x03, 0x4d, 0xc2, 0x18, 0x72, 0x47, 0xcd, 0x1e, 0x3f, 0x2c, 0x79, 0x03, 0x89, 0x16,
+0x3f, 0x86, 0x70, 0x60, 0xd3, 0xa4, 0x0f, 0x1d, 0x26, 0x1f, 0x3e, 0xb1, 0x02, 0xf9, 0x94, 0xf0,
+0x47, 0x9a, 0x48, 0x28, 0x79, 0x33, 0xc6, 0x1d, 0x78, 0x5c, 0xc1, 0xc4, 0x06, 0x21, 0x00, 0xe3,
+0x02, 0x3b, 0x36, 0x29, 0xe1, 0x20, 0x14, 0xc6, 0x25, 0x22, 0x94, 0x69, 0x62, 0xf3, 0x63, 0x05,
+0x26, 0x42, 0xbc, 0xe1, 0xa1, 0x11, 0x25, 0x1e, 0xb1, 0x41, 0x20, 0x56, 0xfa, 0x08, 0x13, 0x86,
+0x26, 0x11, 0xe8, 0x82, 0x8d, 0x1c, 0x30, 0x30, 0x20, 0x25, 0xa9, 0x3e, 0x38, 0x33, 0xd4, 0x51,
+0xca, 0x61, 0x0b, 0x17, 0xbe, 0x58, 0x60, 0xc3, 0x45, 0x93, 0x04, 0x21, 0x9f, 0x44, 0xd0, 0x06,
+0x4f, 0x19, 0x3b, 0x68, 0xa8, 0x31, 0x41, 0x07, 0x4f, 0x38, 0xb0, 0x44, 0x24, 0x50, 0x5a, 0x18,
+0x62, 0x8a, 0x3c, 0x8d, 0x90, 0x61, 0x81, 0x00, 0x15, 0x04, 0xe1, 0xe6, 0x0e, 0x19, 0x29, 0x8e,
+0x44, 0x91, 0xc2, 0x05, 0xb4, 0x20, 0xb2, 0x89, 0x0c, 0x7e, 0xb6, 0x29, 0x0e, 0x08, 0x63, 0x0f,
+0x17, 0x15, 0xfa, 0xe8, 0x52, 0x01, 0x46, 0xde, 0x00, 0x41, 0x42, 0xc9, 0xc7, 0xe7, 0x05, 0x26,
+0x1a, 0x81, 0x42, 0x8b, 0x47, 0x10, 0x99, 0x04, 0x02, 0x8f, 0xa0, 0xd0, 0x42, 0x99, 0x3d, 0x30,
+0x3b, 0x41, 0xd0, 0xb1, 0x25, 0x84, 0x33, 0x77, 0x18, 0x11, 0x13, 0x65, 0x11, 0x11, 0x26, 0x98,
+0x7c, 0x41, 0x66, 0x88, 0xca, 0x18, 0x40, 0x24, 0x50, 0x08, 0x21, 0x74, 0xea, 0x38, 0xf2, 0x86,
+0x63, 0x22, 0x8a, 0x39, 0x72, 0xaa, 0xf8, 0x29, 0xa2, 0x02, 0x4c, 0xce, 0x88, 0xe3, 0x44, 0x0d,
+0x76, 0xbc, 0x49, 0x13, 0x87, 0x08, 0x30, 0x30, 0x02, 0xc5, 0x9c, 0x28, 0x6f, 0xf1, 0x42, 0x45,
+0x07, 0x3d, 0x41, 0x54, 0x50, 0xf0, 0x05, 0x4b, 0x1e, 0x5a, 0xcc, 0x08, 0xa1, 0x88, 0x3e, 0x06,
+0x31, 0x21, 0xcf, 0x20, 0x76, 0x8c, 0xf0, 0x61, 0xcb, 0x17, 0x5c, 0x20, 0x5f, 0x26, 0xe0, 0x81,
+0x39, 0xe2, 0x8c, 0x79, 0x02, 0xe3, 0xc0, 0x90, 0x7a, 0x42, 0x96, 0x35, 0xb8, 0x40, 0xc1, 0xb2,
+0x80, 0x3e, 0xf2, 0x5c, 0x59, 0xb2, 0xa0, 0x24, 0x4f, 0x1d, 0x57, 0x9a, 0xd0, 0x83, 0x87, 0x46,
+0x6e, 0x14, 0x2c, 0x5c, 0xbe, 0x4e, 0xcc, 0x74, 0xb0, 0x47, 0x11, 0x34, 0x5f, 0x9c, 0xc9, 0xf3,
+0xe7, 0x00, 0x3d, 0xec, 0xa1, 0x03, 0x14, 0x7a, 0x3c, 0xc1, 0x22, 0x21, 0x04, 0x4b, 0x99, 0x39,
+0x38, 0x7c, 0x36, 0xe0, 0x29, 0x04, 0x04, 0x3d, 0x00, 0xf9, 0xa4, 0x92, 0x00, 0x80, 0x35, 0xc6,
+0x58, 0xd1, 0x72, 0x47, 0x86, 0x60, 0xc0, 0x4d, 0x06, 0x82, 0x8c, 0x89, 0x23, 0xc5, 0x8c, 0xc4,
+0xc0, 0x0c, 0x17, 0x24, 0x31, 0xa4, 0x12, 0x31, 0xc8, 0xf4, 0xe9, 0xf3, 0x49, 0x15, 0x2a, 0x0a,
+0x29, 0x23, 0x91, 0x3c, 0x32, 0x69, 0xa1, 0x8d, 0x0b, 0x20, 0xb1, 0xe3, 0x0d, 0x0a, 0x52, 0x3c,
+0xf0, 0x89, 0x13, 0x59, 0x88, 0x30, 0xa1, 0xa4, 0x47, 0x90, 0x2c, 0xa5, 0x13, 0xaa, 0x68, 0xa0,
+0x83, 0x3c, 0xd8, 0xa0, 0xa1, 0x27, 0x91, 0x4b, 0x8d, 0x00, 0xa0, 0xf1, 0x84, 0x87, 0x31, 0x94,
+0xe0, 0x00, 0x22, 0x66, 0x8a, 0x10, 0xc4, 0x8d, 0x28, 0xce, 0xe8, 0x79, 0x22, 0x28, 0x12, 0x18,
+0x92, 0x88, 0x6c, 0xe4, 0x70, 0x85, 0x04, 0x40, 0x0e, 0xa1, 0x7c, 0xfe, 0x14, 0x11, 0xc3, 0xa5,
+0xc6, 0x1f, 0x41, 0x31, 0x3c, 0x80, 0x0b, 0x1f, 0xd3, 0x22, 0x99, 0x4c, 0xc1, 0x89, 0x05, 0x03,
+0x10, 0x62, 0x8e, 0x17, 0x18, 0xc2, 0xf4, 0xb1, 0xb4, 0xf8, 0x81, 0x02, 0x18, 0x94, 0xe1, 0x83,
+0xe6, 0xcc, 0x1f, 0x18, 0x1b, 0x2a, 0x40, 0x1d, 0x74, 0x20, 0x82, 0x81, 0x83, 0x1a, 0xf0, 0xf0,
+0xa3, 0x87, 0x1b, 0x34, 0xb8, 0xe9, 0x42, 0x07, 0x8e, 0x3a, 0x7e, 0x64, 0x65, 0x08, 0x69, 0x23,
+0xce, 0x14, 0xd3, 0xcf, 0x0c, 0x5d, 0x14, 0x8c, 0xec, 0x20, 0xc7, 0x8c, 0x6b, 0x02, 0x7d, 0x44,
+0xd1, 0x87, 0x0e, 0x87, 0x07, 0x0d, 0xa8, 0x65, 0x13, 0x21, 0x2a, 0x31, 0x73, 0x66, 0x0b, 0x32,
+0x1a, 0x91, 0x00, 0x1b, 0x2f, 0x7b, 0xda, 0x7c, 0x39, 0x23, 0x25, 0x93, 0x1c, 0x10, 0xf9, 0xc0,
+0x1e, 0x59, 0x80, 0xf9, 0x81, 0x13, 0x28, 0x94, 0x3c, 0x02, 0xc2, 0x1a, 0x77, 0x42, 0xf0, 0xc3,
+0x8b, 0x4c, 0x8e, 0x3a, 0x25, 0x20, 0xf1, 0x86, 0x0f, 0x1d, 0x31, 0xc0, 0x09, 0x83, 0x05, 0x17,
+0x27, 0x02, 0x2d, 0x3a, 0x90, 0xc7, 0x04, 0x23, 0x4d, 0xc6, 0xb4, 0x81, 0x24, 0x91, 0x1a, 0xe2,
+0x40, 0x23, 0x89, 0x97, 0x3f, 0xa6, 0xf0, 0x9e, 0x80, 0x36, 0x0c, 0x72, 0x83, 0x0a, 0x34, 0x74,
+0x12, 0xe4, 0x30, 0x05, 0x13, 0x12, 0x1c, 0x33, 0x6b, 0xe2, 0x6c, 0xb0, 0xc5, 0x13, 0x2b, 0xd4,
+0xb8, 0xe1, 0x64, 0xc8, 0x10, 0x30, 0x0a, 0x28, 0x62, 0x8a, 0x41, 0xdc, 0x58, 0xd9, 0x40, 0x0d,
+0x34, 0x6b, 0xf4, 0x81, 0x84, 0x05, 0x77, 0x0e, 0x01, 0x41, 0x34, 0x15, 0xb2, 0xa7, 0x06, 0x39,
+0xf2, 0xe4, 0xa9, 0x43, 0x91, 0x0b, 0x84, 0x2a, 0x10, 0x02, 0x15, 0x6c, 0x15, 0x70, 0x6c, 0x88,
+0xc2, 0x0c, 0x3d, 0x94, 0x58, 0x01, 0xc3, 0x45, 0x70, 0x05, 0x91, 0x35, 0x51, 0x78, 0xb0, 0xc4,
+0x92, 0x6c, 0xca, 0x12, 0x09, 0xe8, 0x03, 0x31, 0xf0, 0xe0, 0x88, 0x43, 0xf6, 0x88, 0x36, 0x10,
+0x87, 0x8f, 0x19, 0xb0, 0x04, 0xb5, 0x50, 0x47, 0x89, 0x39, 0x19, 0x30, 0xa1, 0xe6, 0x0e, 0x2f,
+0x62, 0xba, 0x60, 0xc3, 0x0e, 0x11, 0x14, 0x70, 0x21, 0x08, 0x9c, 0x49, 0x22, 0x31, 0x42, 0xa3,
+0x52, 0x8b, 0x91, 0xc6, 0xa7, 0x60, 0xfe, 0x3b, 0x26, 0x46, 0xef, 0xd7, 0x15, 0x9f, 0x8e, 0xf0,
+0xdb, 0x51, 0x87, 0x14, 0x16, 0xef, 0x4f, 0x41, 0xf8, 0xeb, 0x88, 0xd5, 0xb7, 0x5a, 0xcc, 0x7a,
+0x7a, 0xe5, 0x87, 0x40, 0x46, 0x59, 0x99, 0x36, 0x29, 0xeb, 0x69, 0x06, 0x3f, 0x1d, 0x99, 0x35,
+0xcc, 0x30, 0x59, 0x3d, 0xad, 0xe0, 0x9f, 0x43, 0xda, 0x78, 0x2d, 0xab, 0x56, 0x4f, 0xb5, 0x5f,
+0x0e, 0x4a, 0xbb, 0x24, 0x84, 0xb3, 0x7a, 0x5a, 0xfd, 0x71, 0xc0, 0x6b, 0x8d, 0x4a, 0x3a, 0x9f,
+0xc2, 0x1f, 0x8e, 0x8a, 0xd1, 0x2b, 0xc3, 0xa4, 0xfc, 0xb9, 0x49, 0x85, 0x84, 0xa8, 0x93, 0x3c,
+0xad, 0x34, 0x23, 0x22, 0x12, 0x44, 0x52, 0x50, 0x50, 0x50, 0x52, 0x48, 0x07, 0x63, 0x10, 0x40,
+0x40, 0x60, 0x68, 0x90, 0x6c, 0x4a, 0x25, 0x12, 0xdb, 0x3d, 0x13, 0xc0, 0x40, 0x0b, 0x89, 0x03,
+0xc3, 0xb2, 0x2a, 0xa2, 0x49, 0x0b, 0x07, 0xfc, 0x66, 0x03, 0x75, 0x71, 0x1e, 0xf5, 0xe8, 0xdd,
+0xe0, 0x22, 0x32, 0xd2, 0x8b, 0xc1, 0x1f, 0x7d, 0x31, 0x15, 0x6f, 0xe9, 0xa8, 0xdf, 0x9d, 0xee,
+0x99, 0xaf, 0x8b, 0x2c, 0xe5, 0xac, 0x7b, 0xe2, 0xbb, 0xa6, 0x5d, 0xbc, 0x4c, 0xe5, 0xb9, 0x28,
+0xf2, 0x12, 0x25, 0x50, 0x35, 0x8e, 0xc5, 0x7f, 0xe5, 0x13, 0xa1, 0x5a, 0x8b, 0x8d, 0x98, 0xb2,
+0x06, 0xae, 0x97, 0x28, 0xc4, 0x5f, 0x62, 0xa7, 0x24, 0xe6, 0xc9, 0x3e, 0x9d, 0x49, 0x3a, 0x1a,
+0xda, 0x18, 0xbd, 0x90, 0xa3, 0x26, 0x45, 0x47, 0xac, 0xe7, 0xaa, 0x64, 0x19, 0x22, 0xdf, 0x53,
+0xef, 0x7e, 0x14, 0x85, 0xe2, 0xa3, 0x62, 0xc4, 0xf8, 0x83, 0x9f, 0x23, 0x52, 0x93, 0x76, 0x85,
+0x53, 0x1f, 0xd5, 0x07, 0x68, 0x5a, 0x88, 0xcd, 0x6b, 0xe6, 0x6e, 0x1b, 0x51, 0xd8, 0x0f, 0xf1,
+0x9e, 0x52, 0x9b, 0x3e, 0xc7, 0xf1, 0xe8, 0x34, 0xae, 0xab, 0x08, 0x7f, 0x27, 0x54, 0x24, 0xdb,
+0x2a, 0x66, 0xae, 0xac, 0x0f, 0x2c, 0x1f, 0x06, 0xc7, 0x59, 0xff, 0x42, 0x32, 0x35, 0x3e, 0xba,
+0x2d, 0xee, 0xbd, 0x6f, 0x2d, 0x07, 0x9b, 0x67, 0x1d, 0xfb, 0xc0, 0xa0, 0x8f, 0x2b, 0x4d, 0xd4,
+0x14, 0xaa, 0xac, 0x0a, 0xe1, 0x23, 0x09, 0xc0, 0x21, 0xdb, 0x09, 0x2e, 0xc4, 0xab, 0x01, 0x3d,
+0xe8, 0xf7, 0x92, 0xa6, 0x17, 0xfc, 0xe4, 0x1a, 0xb6, 0x79, 0x3f, 0xcc, 0x79, 0x38, 0x7b, 0xd5,
+0x06, 0x4a, 0x64, 0x85, 0x1a, 0x70, 0x42, 0x83, 0xfc, 0x09, 0xab, 0x84, 0xad, 0xc2, 0x84, 0xbf,
+0x77, 0x04, 0xae, 0x21, 0xbb, 0xb2, 0x95, 0xa6, 0x9f, 0xe3, 0xda, 0xb1, 0xe7, 0x07, 0x31, 0x88,
+0x03, 0x5b, 0x49, 0x43, 0xed, 0xd9, 0x87, 0xa5, 0x57, 0x89, 0x71, 0x11, 0xd0, 0x4a, 0x39, 0xa3,
+0xfa, 0xd9, 0x56, 0x9a, 0xef, 0xf9, 0x0f, 0x4a, 0x7c, 0x65, 0x31, 0x70, 0xfc, 0x46, 0x08, 0xcb,
+0x32, 0x3b, 0x46, 0xc1, 0x94, 0x3c, 0x08, 0x15, 0x9b, 0x49, 0x25, 0x53, 0x27, 0x83, 0x3a, 0x84,
+0x98, 0xf9, 0x8d, 0xb4, 0xe0, 0x7d, 0xbf, 0x20, 0xa9, 0xc0, 0x53, 0x4f, 0xd5, 0x70, 0xf5, 0x6b,
+0xee, 0x13, 0x6f, 0xa2, 0x63, 0x02, 0x4b, 0x43, 0xe9, 0xce, 0xe0, 0x47, 0x0a, 0xb2, 0xb9, 0xdc,
+0x02, 0x8f, 0x9e, 0x86, 0xfc, 0xf4, 0x89, 0x68, 0x2e, 0x09, 0x1e, 0x0b, 0x56, 0xf4, 0x95, 0x06,
+0x61, 0x6f, 0x28, 0x05, 0x82, 0xd8, 0x66, 0x8e, 0x2a, 0xdf, 0x35, 0x9e, 0x7e, 0x80, 0x56, 0x5d,
+0x90, 0x31, 0xe1, 0x34, 0x17, 0x02, 0x1b, 0xdb, 0x94, 0x93, 0x74, 0x6d, 0x2c, 0x13, 0x74, 0xb6,
+0x22, 0x81, 0x6f, 0xec, 0xec, 0x54, 0x74, 0x4a, 0x34, 0x1b, 0xe1, 0x17, 0x3c, 0x55, 0x8f, 0xf9,
+0x1f, 0x1e, 0x7d, 0x13, 0xdc, 0xd5, 0x13, 0x94, 0xdc, 0xd6, 0xe8, 0xf3, 0x1b, 0x43, 0xec, 0x34,
+0xe7, 0x1a, 0xcb, 0x4c, 0xfa, 0x77, 0x5b, 0x19, 0x70, 0x14, 0x80, 0x9e, 0x0a, 0x4b, 0x06, 0x69,
+0x19, 0xe8, 0x9f, 0x0d, 0x12, 0xa9, 0x00, 0x4a, 0xd4, 0xcc, 0x83, 0x12, 0xe4, 0xd1, 0x66, 0x94,
+0x1f, 0x16, 0x04, 0xf6, 0x03, 0x81, 0x18, 0xdb, 0x20, 0x07, 0x96, 0x5e, 0xff, 0x8a, 0x4d, 0xe4,
+0x62, 0x0e, 0xe6, 0x59, 0xf7, 0x93, 0xe8, 0xce, 0x2f, 0x40, 0x14, 0x39, 0xb6, 0x26, 0x3c, 0x63,
+0x83, 0x0e, 0x0a, 0x84, 0xc2, 0x40, 0x1d, 0xb7, 0x48, 0x8c, 0x8b, 0xa7, 0x39, 0x30, 0x8b, 0x5b,
+0x48, 0x78, 0x72, 0x57, 0x7c, 0xbb, 0x39, 0x9b, 0xdb, 0xe0, 0x4b, 0x54, 0x1c, 0x94, 0xc0, 0x19,
+0xda, 0x00, 0xd6, 0xb9, 0xc5, 0x88, 0xa4, 0x20, 0xfc, 0x38, 0xd8, 0x2f, 0x5a, 0xf1, 0xe7, 0xda,
+0x24, 0xad, 0x2b, 0xb2, 0x14, 0xc1, 0x93, 0xcf, 0x19, 0x12, 0x22, 0xfd, 0x5c, 0xfb, 0x53, 0xaa,
+0x69, 0x16, 0xd4, 0x5b, 0xfc, 0xad, 0x64, 0x50, 0xdb, 0xc4, 0x0b, 0x83, 0xd3, 0x59, 0x2f, 0x84,
+0xaf, 0x51, 0x77, 0x56, 0xfe, 0xfe, 0x2d, 0x28, 0x51, 0x7e, 0x8f, 0x17, 0x36, 0xf0, 0x78, 0x2a,
+0xcc, 0xf0, 0x40, 0x9f, 0xb5, 0xea, 0x75, 0x79, 0x75, 0xa9, 0x16, 0xba, 0xb0, 0x4c, 0x95, 0xc4,
+0x93, 0x8d, 0xa6, 0x6b, 0x6e, 0x67, 0x69, 0xae, 0x31, 0x5b, 0x4c, 0x57, 0x9b, 0xc0, 0xe1, 0xbd,
+0x9d, 0x8d, 0xac, 0x1e, 0xe4, 0x06, 0x46, 0x5a, 0x7b, 0xa3, 0xbb, 0xa4, 0x41, 0x9b, 0xb1, 0x63,
+0x72, 0x1f, 0x95, 0x1a, 0x64, 0x99, 0x62, 0x55, 0x50, 0xc4, 0x5d, 0xe7, 0xb2, 0x2c, 0x2c, 0xeb,
+0x3f, 0x82, 0xa3, 0x61, 0x36, 0x93, 0xe1, 0x47, 0xbc, 0x44, 0x60, 0xe1, 0x22, 0xa0, 0xa3, 0x63,
+0xea, 0xee, 0x6b, 0xb6, 0x68, 0x90, 0x62, 0x0e, 0x58, 0x9e, 0x8c, 0x6e, 0x28, 0x0c, 0x13, 0xfc,
+0x32, 0xba, 0x65, 0x55, 0x52, 0x85, 0xef, 0x32, 0xf1, 0xea, 0xe0, 0xd4, 0x21, 0x95, 0xd2, 0x89,
+0x93, 0x8f, 0xdd, 0x7e, 0xf6, 0x21, 0xc2, 0xc4, 0x20, 0x81, 0x16, 0x96, 0xc7, 0xd1, 0xf7, 0x06,
+0x4c, 0x30, 0x7b, 0xdf, 0x57, 0xc2, 0x7e, 0x2a, 0x77, 0xeb, 0x29, 0xdf, 0xfa, 0x30, 0x28, 0x06,
+0xc3, 0x17, 0x96, 0x8d, 0x60, 0xee, 0x18, 0xee, 0x8f, 0x64, 0x61, 0xba, 0x2a, 0x86, 0xc4, 0x8e,
+0x1f, 0xbf, 0x88, 0x75, 0x8b, 0x3f, 0x1f, 0x16, 0x15, 0x3e, 0xb8, 0xe1, 0x4e, 0x30, 0x6f, 0xe7,
+0x71, 0x74, 0x08, 0xa7, 0xcf, 0x0b, 0x67, 0xaf, 0x43, 0xea, 0x75, 0xd7, 0x8e, 0x01, 0xf8, 0x90,
+0x6f, 0x20, 0xfc, 0x8f, 0x64, 0x2e, 0xb8, 0x7b, 0x9b, 0xe0, 0x3f, 0xc8, 0xc1, 0x95, 0x25, 0x30,
+0x5d, 0x20, 0x21, 0x0c, 0xf1, 0xcb, 0x0f, 0x44, 0x57, 0x03, 0x9b, 0x48, 0x89, 0x62, 0xa8, 0xd0,
+0xdc, 0xe9, 0x86, 0x2a, 0xcd, 0xd3, 0xff, 0xa0, 0x0b, 0x03, 0x14, 0x0f, 0x38, 0xb5, 0xbd, 0x35,
+0x78, 0xa0, 0x6c, 0x0c, 0x40, 0xc3, 0x0d, 0x77, 0xe1, 0x8d, 0x02, 0xf3, 0x3e, 0xf6, 0x4b, 0xa1,
+0x2f, 0xc8, 0x60, 0xfb, 0xe3, 0xc9, 0x0c, 0x38, 0x90, 0x1d, 0x71, 0x8a, 0x8a, 0x11, 0x0d, 0x7a,
+0x9f, 0x14, 0xb2, 0xa1, 0xc2, 0xfb, 0x40, 0x57, 0x6f, 0xf3, 0x3e, 0xca, 0x19, 0x28, 0xed, 0x94,
+0xcc, 0xf1, 0x8c, 0x3e, 0x67, 0x6d, 0x0b, 0x80, 0xab, 0xc5, 0x8f, 0x53, 0xd9, 0x65, 0xba, 0xb3,
+0xa8, 0xc4, 0x87, 0x12, 0xb5, 0xa0, 0x6f, 0x91, 0xfe, 0xca, 0xd6, 0xaa, 0xa1, 0xff, 0x65, 0x85,
+0x58, 0xd9, 0x55, 0xc6, 0x90, 0x16, 0x07, 0x73, 0x66, 0x17, 0x38, 0xf8, 0x19, 0xdd, 0x4f, 0x0c,
+0xd2, 0xc9, 0xfc, 0x19, 0xed, 0x66, 0x32, 0xd1, 0xa7, 0x35, 0xbe, 0x7d, 0x73, 0x78, 0xec, 0xa7,
+0x83, 0x42, 0x62, 0x64, 0x32, 0x40, 0x25, 0xe0, 0xff, 0xc7, 0x10, 0x65, 0x5b, 0x88, 0xbf, 0xa2,
+0xe3, 0x76, 0xd7, 0xd0, 0xdf, 0xee, 0x83, 0xf7, 0x8e, 0x9e, 0x4c, 0xa7, 0xfe, 0xc9, 0x9f, 0x50,
+0x38, 0x8f, 0x4f, 0x7b, 0xd2, 0x9a, 0xf1, 0x02, 0x84, 0x18, 0x90, 0xfb, 0x76, 0xb0, 0x7b, 0x12,
+0xf7, 0x12, 0xab, 0x38, 0xb4, 0x24, 0x29, 0x3a, 0xe9, 0xfd, 0x34, 0xdc, 0xfa, 0x73, 0xfa, 0xf7,
+0xf7, 0xa2, 0x83, 0x22, 0xcb, 0xde, 0x86, 0x1c, 0x25, 0x1d, 0x37, 0x97, 0x53, 0x19, 0x01, 0x34,
+0x45, 0x00, 0xfe, 0x39, 0x02, 0x66, 0x5d, 0xd1, 0x20, 0x5b, 0x70, 0x87, 0xe6, 0x57, 0x1c, 0x81,
+0x27, 0x19, 0x1a, 0xee, 0x75, 0x9a, 0x4b, 0xd4, 0xa2, 0xe0, 0x17, 0x9c, 0xbb, 0xf7, 0xa3, 0xbc,
+0x59, 0x5d, 0xd3, 0x14, 0x4d, 0x49, 0x0d, 0xc9, 0x5d, 0x76, 0x6b, 0xaa, 0xf6, 0x82, 0xab, 0x6f,
+0x64, 0xf8, 0x46, 0x37, 0xd1, 0xc5, 0xee, 0x90, 0xf7, 0x09, 0x1a, 0xed, 0xf9, 0x01, 0x80, 0x59,
+0x8a, 0xf3, 0xd6, 0xa1, 0x1c, 0xdf, 0x0b, 0xe8, 0xe7, 0x76, 0x17, 0x21, 0xf7, 0xc5, 0xad, 0x32,
+0x4e, 0xe3, 0xf3, 0x40, 0x68, 0xb9, 0x63, 0xb4, 0x4c, 0x5e, 0x43, 0x20, 0x46, 0x11, 0x8e, 0x7d,
+0xdc, 0x99, 0xea, 0x62, 0xb2, 0x42, 0xee, 0xfe, 0x01, 0x5a, 0xfd, 0x72, 0xe1, 0x83, 0x0a, 0x5b,
+0x03, 0x38, 0xa8, 0x0b, 0x00, 0x29, 0x14, 0xb8, 0x36, 0x4e, 0x30, 0x90, 0xac, 0xf1, 0xe5, 0xeb,
+0x34, 0x8f, 0x3a, 0x65, 0x4c, 0xf1, 0x33, 0xdc, 0x5b, 0xed, 0xe0, 0xc4, 0x2f, 0xb2, 0x43, 0x5d,
+0x21, 0x64, 0x7e, 0xe6, 0xed, 0x1c, 0x3c, 0xd5, 0x81, 0x9b, 0x32, 0x40, 0xca, 0x05, 0xb6, 0xdb,
+0x78, 0xe0, 0x3b, 0xcb, 0x01, 0x93, 0x23, 0xd6, 0x2b, 0xae, 0x4b, 0xd4, 0x50, 0x5a, 0x14, 0x02,
+0x15, 0x2e, 0x86, 0x47, 0x9a, 0x17, 0x69, 0x36, 0xc5, 0x35, 0x33, 0x72, 0x4f, 0xb7, 0x24, 0x31,
+0x10, 0x29, 0x8f, 0x6f, 0x41, 0x60, 0xde, 0x5e, 0x4e, 0xf2, 0x18, 0x0b, 0x92, 0x60, 0xbe, 0x88,
+0x31, 0x52, 0xe4, 0x75, 0x18, 0x81, 0x51, 0x2c, 0x9b, 0x32, 0xc1, 0xba, 0x3e, 0x69, 0x1d, 0xa9,
+0x1e, 0xd1, 0xa3, 0x0a, 0x89, 0x1d, 0xa0, 0x1c, 0x44, 0x7d, 0xd1, 0xd1, 0xc3, 0x09, 0x1a, 0x12,
+0xb1, 0x31, 0x49, 0x9c, 0xf1, 0x3a, 0xb6, 0x45, 0xc1, 0xe1, 0x5a, 0xdd, 0xd4, 0x90, 0xd1, 0xe2,
+0x62, 0x3a, 0x20, 0x62, 0x40, 0x2f, 0x35, 0xd0, 0x58, 0x68, 0xdd, 0x0b, 0x0a, 0x62, 0x1b, 0xbb,
+0xb3, 0x57, 0x16, 0x01, 0xe0, 0x86, 0xec, 0x9d, 0x5b, 0x18, 0x1e, 0x2b, 0x4d, 0xd8, 0x53, 0xf1,
+0x6c, 0xbf, 0x71, 0x8d, 0xf5, 0x28, 0x0a, 0x2a, 0xd5, 0x02, 0x40, 0xb3, 0x46, 0x86, 0xa9, 0x69,
+0xc3, 0xae, 0x03, 0x07, 0x8a, 0xbe, 0x17, 0x21, 0xa6, 0x72, 0x9b, 0x31, 0x60, 0xae, 0xe0, 0x74,
+0x16, 0xa8, 0x27, 0x69, 0x39, 0xe2, 0xc3, 0x9a, 0x5f, 0x02, 0x4d, 0x64, 0x0d, 0x62, 0x85, 0x5f,
+0x2d, 0x07, 0x9f, 0x6c, 0x69, 0xb5, 0x6e, 0xef, 0x04, 0x97, 0xa8, 0xac, 0x62, 0x2c, 0x76, 0xbc,
+0x84, 0xeb, 0xb4, 0x86, 0xae, 0xfc, 0x93, 0x6a, 0xa4, 0x88, 0x20, 0x2d, 0xa4, 0x51, 0x4f, 0x01,
+0xd6, 0xf4, 0xd0, 0xe3, 0x8b, 0xf6, 0xb8, 0xc6, 0x00, 0x94, 0x07, 0x0a, 0x81, 0x4f, 0x31, 0x48,
+0xf2, 0x31, 0x27, 0x77, 0x1e, 0x67, 0x68, 0x89, 0x06, 0x50, 0x33, 0x38, 0xac, 0x1c, 0x2c, 0x82,
+0x18, 0x6b, 0x2d, 0xdb, 0x3d, 0x13, 0x67, 0x48, 0x39, 0x9b, 0x47, 0x39, 0xcd, 0x1f, 0x8d, 0x18,
+0xdf, 0x6c, 0x31, 0x4e, 0xfa, 0x20, 0x1d, 0xa5, 0x11, 0x90, 0x7f, 0x32, 0x90, 0x4d, 0x9e, 0x82,
+0xc9, 0x3f, 0x6a, 0xd6, 0x32, 0xdd, 0xe1, 0xb2, 0x5b, 0x75, 0xf7, 0xaf, 0xba, 0x21, 0x95, 0x6f,
+0xaa, 0xf8, 0xf1, 0x77, 0xbd, 0x71, 0x8e, 0x6a, 0x17, 0xae, 0x92, 0x6b, 0xce, 0xd6, 0x60, 0x7d,
+0x86, 0xab, 0x41, 0xf3, 0xdd, 0x96, 0x1d, 0x9c, 0x63, 0xaa, 0xbe, 0xdf, 0xd5, 0xbb, 0x9b, 0x6b,
+0x5e, 0x25, 0x3b, 0x09, 0x62, 0xbb, 0x00, 0xd3, 0x96, 0x6e, 0x7f, 0xd9, 0xf2, 0x77, 0x6d, 0x2d,
+0xe1, 0x54, 0xcf, 0x8d, 0x1e, 0x47, 0x40, 0x31, 0x20, 0xa6, 0x4b, 0x0e, 0x85, 0x63, 0xc2, 0xb6,
+0xff, 0xd0, 0xc0, 0x05, 0x34, 0x85, 0x22, 0xa6, 0x66, 0xad, 0x78, 0x92, 0xc5, 0xda, 0x87, 0xa7,
+0x84, 0x2c, 0x1b, 0x18, 0x67, 0x00, 0xe3, 0x43, 0xcc, 0x42, 0x0b, 0xc2, 0x50, 0x43, 0xc9, 0x43,
+0x1f, 0x8e, 0x8e, 0x24, 0xd8, 0x0a, 0xfb, 0x7d, 0x9a, 0x0d, 0x17, 0xa1, 0xb8, 0xd4, 0x77, 0xd9,
+0x1b, 0x7f, 0xc6, 0x93, 0xac, 0x20, 0x50, 0xd6, 0x8d, 0x5c, 0x97, 0x90, 0x94, 0x94, 0x12, 0x8a,
+0xb9, 0x04, 0xfd, 0x33, 0x1f, 0x5b, 0xcd, 0x2d, 0x8b, 0x23, 0x84, 0xd0, 0xb2, 0x1e, 0xc4, 0x5d,
+0x89, 0x85, 0xa2, 0x13, 0x12, 0xe2, 0x6e, 0x26, 0x1e, 0x55, 0xfd, 0x04, 0x11, 0xaf, 0x6c, 0xbc,
+0x7a, 0x3d, 0xd8, 0x7f, 0xe2, 0x3f, 0x3c, 0xc7, 0xc0, 0x0a, 0xa4, 0x08, 0x8d, 0x87, 0xf3, 0x2f,
+0x44, 0xb9, 0x7b, 0xe6, 0x8e, 0x99, 0xe0, 0xe9, 0x1b, 0xbd, 0xf4, 0x89, 0x14, 0xb7, 0x95, 0xb2,
+0x04, 0x44, 0x16, 0xe5, 0x5a, 0x37, 0xf5, 0x8c, 0xc0, 0x23, 0x09, 0x24, 0x87, 0x87, 0x8e, 0x5e,
+0x26, 0x05, 0x25, 0x91, 0x00, 0x6e, 0x11, 0xc9, 0xc1, 0x0c, 0xc8, 0x13, 0xcb, 0x60, 0x53, 0x05,
+0xc1, 0x93, 0x20, 0x11, 0xb1, 0x6d, 0x92, 0x57, 0xb6, 0x9e, 0x14, 0x1c, 0x25, 0xec, 0x8d, 0xac,
+0x44, 0x97, 0x16, 0xb7, 0x5d, 0xdd, 0x54, 0x40, 0x53, 0xde, 0xeb, 0x8d, 0xc1, 0xdd, 0xb9, 0x52,
+0xee, 0xd6, 0xef, 0x59, 0xb5, 0xdc, 0xa3, 0x65, 0xac, 0x30, 0x74, 0x2d, 0x32, 0x81, 0x07, 0x14,
+0x8f, 0xd7, 0xa0, 0x9e, 0x53, 0xa2, 0x63, 0xaf, 0x2b, 0x90, 0xdc, 0x60, 0x50, 0x98, 0x58, 0x70,
+0x46, 0x02, 0xba, 0x58, 0xc1, 0x51, 0x2f, 0x39, 0xec, 0x6f, 0x2b, 0xf5, 0x39, 0x9a, 0x49, 0x8f,
+0xbc, 0xe6, 0xd8, 0x17, 0xef, 0x72, 0x99, 0x47, 0x58, 0xad, 0x14, 0x5a, 0x7e, 0xc4, 0x9f, 0x04,
+0xcc, 0x2a, 0xe8, 0x48, 0x9e, 0x7f, 0xe6, 0x5a, 0xcb, 0x34, 0x19, 0xe6, 0xa5, 0xb8, 0xe3, 0xe3,
+0xe4, 0x4d, 0x4a, 0x74, 0x54, 0xf0, 0x6c, 0xf0, 0xfb, 0x09, 0x95, 0x71, 0x43, 0x66, 0x0c, 0x2f,
+0x57, 0x2a, 0x60, 0xe6, 0x59, 0xda, 0xcb, 0x02, 0x28, 0x5b, 0x70, 0x13, 0x56, 0x49, 0x39, 0x0f,
+0xdf, 0xeb, 0xbb, 0x74, 0x05, 0x08, 0xad, 0x5d, 0x71, 0x39, 0x15, 0x8d, 0x18, 0xc6, 0xf1, 0xf3,
+0x1d, 0xb9, 0x8d, 0x84, 0x04, 0x87, 0x70, 0x51, 0x87, 0xc1, 0xce, 0x63, 0xa1, 0x2f, 0xc8, 0xb0,
+0x8e, 0xf4, 0x0a, 0xbf, 0x65, 0x50, 0x1a, 0xb0, 0x09, 0xa5, 0x97, 0xfa, 0x32, 0xef, 0xc8, 0x8c,
+0xbf, 0x6f, 0xb7, 0x8c, 0x4d, 0xe0, 0x57, 0x52, 0x7f, 0x50, 0xca, 0xb4, 0x7f, 0x3a, 0x28, 0x21,
+0xe3, 0x01, 0xd1, 0x53, 0xb4, 0x16, 0x18, 0x40, 0xe0, 0x13, 0x2f, 0x5a, 0x9d, 0x4d, 0x0e, 0x83,
+0xc7, 0x63, 0x5b, 0xdb, 0x90, 0x19, 0xc0, 0x92, 0x7d, 0xfc, 0x27, 0x0e, 0xe1, 0x00, 0x00, 0x21,
+0x68, 0x87, 0x01, 0xe9, 0xff, 0x2c, 0x36, 0x87, 0x4a, 0xda, 0xcd, 0x79, 0xa7, 0x54, 0x8c, 0x5d,
+0x89, 0x86, 0xbe, 0x90, 0x1d, 0x6a, 0x82, 0x8b, 0x79, 0xdb, 0x37, 0xb9, 0x60, 0x20, 0x71, 0xfd,
+0x7c, 0xa7, 0x2f, 0x3f, 0x9a, 0xef, 0x8e, 0xeb, 0xa4, 0x3c, 0xe4, 0xcd, 0x79, 0xe6, 0xb3, 0x3e,
+0xa7, 0xb7, 0xfe, 0xf9, 0x80, 0xc5, 0xc4, 0x4b, 0xa4, 0xdd, 0x68, 0x2e, 0xeb, 0x00, 0x53, 0xf6,
+0x6f, 0x13, 0x46, 0xd1, 0x8d, 0x4d, 0xfb, 0x1d, 0x69, 0xf1, 0x81, 0x0f, 0x38, 0x35, 0xaf, 0xe5,
+0xcd, 0x0a, 0x83, 0xdc, 0x24, 0x6b, 0xc3, 0x5d, 0xae, 0x3f, 0x5d, 0xfa, 0xcd, 0xda, 0xe2, 0x0a,
+0x0c, 0x6c, 0x55, 0xda, 0x78, 0xc5, 0xc1, 0x00, 0x34, 0x31, 0x55, 0x50, 0xe4, 0x4b, 0xe8, 0x50,
+0x60, 0x9b, 0x31, 0x15, 0xce, 0x29, 0x44, 0x0e, 0x6c, 0x8a, 0x39, 0x12, 0xfe, 0xa0, 0x48, 0xda,
+0x23, 0x77, 0x2e, 0x8e, 0xbe, 0x76, 0xbb, 0x2f, 0x68, 0xec, 0xb4, 0xf3, 0xc1, 0xc2, 0xb9, 0x78,
+0xa4, 0xf4, 0x39, 0x18, 0x6a, 0xf0, 0x30, 0x59, 0xe5, 0xac, 0x08, 0x52, 0x80, 0xf1, 0x2f, 0x46,
+0x4c, 0xae, 0x45, 0xa3, 0xf1, 0xc1, 0xea, 0xd7, 0xf8, 0x20, 0x5b, 0xb7, 0xc7, 0x58, 0x6e, 0xbf,
+0x84, 0xe0, 0x6d, 0x06, 0x2d, 0x9e, 0xa8, 0xe2, 0x01, 0x83, 0x81, 0xb4, 0x73, 0x1f, 0x2e, 0x64,
+0x61, 0x09, 0x68, 0x70, 0x51, 0x32, 0xba, 0x8d, 0x96, 0x0e, 0xa0, 0x58, 0x0b, 0xde, 0x21, 0x9d,
+0x54, 0x02, 0x29, 0xde, 0xa1, 0x26, 0x65, 0xe2, 0x23, 0x39, 0x17, 0xcc, 0x1e, 0xf1, 0xa9, 0x0d,
+0x62, 0xcf, 0x36, 0x5a, 0x09, 0x0b, 0xfc, 0xe5, 0xd3, 0xb0, 0x13, 0xd0, 0xe1, 0x86, 0x02, 0xf8,
+0x78, 0x92, 0xed, 0x25, 0xe7, 0xd2, 0x10, 0xbd, 0xe4, 0x60, 0x39, 0xaa, 0x0d, 0x35, 0x56, 0x59,
+0x5b, 0xd7, 0x2a, 0x59, 0xbb, 0xd3, 0xd0, 0xbc, 0xb9, 0x2e, 0x70, 0x4f, 0x5f, 0x02, 0xb4, 0xac,
+0xfa, 0xd5, 0x3e, 0x35, 0x0d, 0x02, 0xe0, 0x1c, 0x59, 0xa5, 0x28, 0x38, 0xa4, 0x04, 0x11, 0xdb,
+0x20, 0x98, 0xc9, 0x7c, 0x97, 0x9b, 0x04, 0xb3, 0x4b, 0x14, 0x0f, 0x5e, 0xc2, 0xb7, 0x6c, 0x57,
+0xee, 0x8b, 0x59, 0x9a, 0x12, 0xe0, 0xa7, 0xab, 0xe6, 0x9a, 0x49, 0xf3, 0xf4, 0x7b, 0x29, 0x2b,
+0x44, 0xc7, 0x13, 0xb8, 0x41, 0x7b, 0x6a, 0x92, 0xa2, 0x54, 0x3a, 0xfc, 0xf8, 0xd2, 0x57, 0xb3,
+0x5b, 0xff, 0x0a, 0x6a, 0x78, 0xa2, 0x80, 0x23, 0x6f, 0x45, 0x12, 0xb3, 0x0e, 0x65, 0x8b, 0x47,
+0x51, 0xeb, 0xaf, 0xff, 0x9b, 0x6c, 0x20, 0x78, 0x6a, 0x3c, 0x4b, 0x69, 0x1a, 0xd3, 0xd3, 0x0d,
+0x51, 0x1f, 0xd5, 0x9e, 0x17, 0x3a, 0xca, 0x5b, 0x9c, 0x2c, 0x16, 0x58, 0x0e, 0x6d, 0x62, 0x8a,
+0x47, 0x49, 0xe4, 0x63, 0x50, 0x46, 0x1f, 0x51, 0xd5, 0x81, 0xe2, 0x83, 0xce, 0x93, 0xe3, 0x4c,
+0x5b, 0x8c, 0x2c, 0xeb, 0x11, 0x81, 0x48, 0x1c, 0x1d, 0x8b, 0x2f, 0x38, 0x12, 0xa6, 0xe9, 0xb8,
+0x98, 0x79, 0x4f, 0x8d, 0x56, 0x79, 0x50, 0xaf, 0xac, 0x10, 0x7b, 0xe3, 0x63, 0xfc, 0x35, 0x43,
+0x3b, 0x5a, 0x4a, 0xe4, 0x23, 0x2e, 0x0c, 0xdd, 0x39, 0x19, 0x1e, 0xc1, 0xcd, 0xcf, 0x49, 0x19,
+0x8f, 0x66, 0x8b, 0xb1, 0x32, 0x04, 0x53, 0x6b, 0xdc, 0x14, 0xcf, 0xe6, 0xc5, 0xc5, 0x58, 0xd8,
+0x86, 0x4c, 0x1c, 0x7e, 0xc5, 0x43, 0xae, 0xd1, 0x9f, 0x79, 0x28, 0x1f, 0x97, 0xa9, 0xef, 0x5a,
+0x2e, 0x03, 0xed, 0x10, 0x85, 0x63, 0xfe, 0xe3, 0x63, 0x08, 0xa5, 0xb1, 0x89, 0x01, 0xce, 0x14,
+0xea, 0xad, 0xd3, 0x44, 0x38, 0x5b, 0x06, 0x12, 0xc5, 0x49, 0x5c, 0x0f, 0x33, 0x32, 0xca, 0xf3,
+0xa5, 0x58, 0xad, 0xea, 0x28, 0xf8, 0xbc, 0x16, 0x83, 0x69, 0x4d, 0x2a, 0x3d, 0x50, 0x76, 0xf1,
+0x10, 0xa5, 0x76, 0x7e, 0x7a, 0xbf, 0x17, 0x4b, 0x80, 0x84, 0x6b, 0xe5, 0x3e, 0x4a, 0x7a, 0x8e,
+0x10, 0x42, 0x41, 0x07, 0x27, 0xea, 0x07, 0x8c, 0xdc, 0x19, 0xaf, 0x70, 0x34, 0x99, 0x94, 0x1b,
+0xdc, 0x52, 0x55, 0xc7, 0x14, 0x22, 0xb4, 0x3b, 0x64, 0xcf, 0x46, 0xb6, 0x05, 0x4d, 0xf4, 0x44,
+0xa1, 0x07, 0xb0, 0x41, 0x02, 0x6e, 0xbe, 0x14, 0x46, 0x01, 0x8c, 0x8a, 0xb0, 0xf9, 0x7e, 0x07,
+0xda, 0xbb, 0x85, 0x40, 0x22, 0x18, 0x61, 0x35, 0xac, 0xe1, 0x89, 0x81, 0x34, 0xd2, 0xb3, 0x9a,
+0x3b, 0x15, 0xc4, 0x8d, 0x3e, 0x4e, 0xcb, 0xa6, 0x5a, 0x0f, 0x7b, 0xe1, 0x19, 0xc1, 0x44, 0x3c,
+0xce, 0x89, 0x2d, 0x20, 0x6f, 0x1a, 0xa0, 0xb8, 0x6a, 0xa8, 0x3b, 0x58, 0x1d, 0x94, 0x58, 0x3a,
+0x4c, 0xb8, 0x1f, 0x4d, 0xc4, 0xa0, 0xd9, 0x77, 0x94, 0xe4, 0x0e, 0x24, 0x45, 0xd6, 0xd0, 0xe4,
+0x5c, 0x66, 0xc7, 0x90, 0x48, 0x76, 0x40, 0xfc, 0xf1, 0xdb, 0xb2, 0x09, 0x65, 0xf0, 0x84, 0x68,
+0x01, 0xc6, 0xfe, 0xbe, 0x5b, 0x0f, 0xa5, 0xa7, 0x87, 0x75, 0x59, 0x70, 0xb2, 0xd0, 0xac, 0xe8,
+0xc1, 0xd1, 0xc7, 0x89, 0x8e, 0x79, 0xc4, 0xa4, 0x8e, 0xae, 0xd4, 0xc6, 0xcd, 0x16, 0x15, 0x27,
+0x4d, 0x50, 0x85, 0xcc, 0x87, 0x35, 0x48, 0xa0, 0x1d, 0x59, 0x00, 0x21, 0x1c, 0x78, 0x25, 0x1d,
+0xeb, 0x80, 0x10, 0x53, 0x9c, 0x37, 0x03, 0xb7, 0x6a, 0x63, 0x7a, 0xcb, 0x23, 0xc0, 0x34, 0xeb,
+0xfc, 0xbc, 0x20, 0x76, 0x85, 0xd7, 0x88, 0x95, 0x0c, 0x5a, 0xab, 0x47, 0xa1, 0x72, 0x58, 0xee,
+0xd7, 0x82, 0xb0, 0xca, 0x7c, 0x36, 0x71, 0xc2, 0x4b, 0x7b, 0x2e, 0x41, 0x45, 0x61, 0x66, 0xb8,
+0x20, 0xfa, 0x2d, 0xe7, 0x0a, 0x28, 0x57, 0x10, 0xf6, 0x0c, 0xb0, 0xef, 0x4b, 0x62, 0xc0, 0x79,
+0xd2, 0x8b, 0xca, 0x10, 0xb7, 0xa2, 0x38, 0x3e, 0x9b, 0xe1, 0x21, 0x4f, 0xa0, 0x6f, 0x50, 0xc0,
+0xb9, 0x4c, 0xf0, 0xde, 0x83, 0xe5, 0xa6, 0x56, 0x9a, 0x1d, 0x15, 0xb7, 0x18, 0x0c, 0xa6, 0x41,
+0xbb, 0x85, 0x57, 0xba, 0xab, 0x77, 0xc5, 0x66, 0x00, 0x6c, 0x39, 0x16, 0x40, 0x3d, 0x88, 0x81,
+0x84, 0x97, 0x54, 0x62, 0xf0, 0x38, 0x60, 0xa7, 0xa9, 0x21, 0xf8, 0x18, 0x3a, 0x4f, 0x67, 0x44,
+0xd8, 0x37, 0xa9, 0x80, 0x18, 0xe1, 0xd4, 0x99, 0xa5, 0x4e, 0xee, 0x34, 0xc0, 0x53, 0xc4, 0xb5,
+0x90, 0xde, 0x34, 0xe1, 0x52, 0xcc, 0xf7, 0x0a, 0x66, 0x30, 0xa2, 0xbd, 0xa8, 0x20, 0x63, 0xd8,
+0x7b, 0x8e, 0x25, 0x9f, 0xd8, 0x09, 0x71, 0x5e, 0x7c, 0x20, 0x88, 0x67, 0x15, 0x09, 0x94, 0xcf,
+0xdd, 0xd9, 0xfe, 0xae, 0x7e, 0x81, 0xc9, 0x58, 0xd9, 0xd6, 0xc7, 0x70, 0xb6, 0x07, 0xbb, 0x61,
+0xef, 0x2c, 0x2b, 0xa6, 0xda, 0x27, 0xd8, 0x78, 0xa1, 0xae, 0xb5, 0x0a, 0x10, 0x4e, 0x17, 0x24,
+0x57, 0x9e, 0x30, 0x7d, 0x7f, 0xbb, 0xb1, 0x8a, 0xb1, 0xe2, 0x51, 0x5d, 0xd4, 0x2d, 0xa9, 0x65,
+0x3a, 0x68, 0xfc, 0x88, 0x34, 0x0a, 0x36, 0x1b, 0x59, 0x93, 0xde, 0x27, 0xa5, 0x8e, 0x8d, 0x56,
+0xa1, 0xf7, 0xfe, 0xd4, 0xec, 0x14, 0xff, 0x65, 0xc3, 0x3f, 0xbb, 0x7f, 0x14, 0xa9, 0xb9, 0x2b,
+0xa6, 0x9c, 0x7c, 0x05, 0x64, 0x00, 0x31, 0x7c, 0xd7, 0xc2, 0xee, 0x35, 0x7b, 0xd7, 0x0f, 0x16,
+0x4e, 0x32, 0x29, 0x34, 0x2e, 0xff, 0xcb, 0x2e, 0xf4, 0xea, 0x9a, 0xb3, 0x1b, 0xa0, 0x5f, 0x8a,
+0x1c, 0xe9, 0xfd, 0x37, 0x1b, 0x52, 0xd9, 0x80, 0x3c, 0xcb, 0xf0, 0x5b, 0x9a, 0x7b, 0xed, 0x73,
+0x21, 0x68, 0x41, 0xff, 0x1e, 0x0d, 0x7b, 0xd2, 0x8b, 0x01,
+};
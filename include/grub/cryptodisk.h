@@ -82,6 +82,11 @@ struct grub_cryptodisk
   char uuid[GRUB_CRYPTODISK_MAX_UUID_LENGTH + 1];
   grub_uint8_t lrw_key[GRUB_CRYPTODISK_GF_BYTES];
   grub_uint8_t *lrw_precalc;
+  /* Per-sector tweak buffer for XTS and scratch space for accelerated
+     CBC decryption.  */
+  grub_uint8_t *sector_buf;
+  /* Hardware-accelerated expansion of the primary key, or NULL.  */
+  struct grub_cryptodisk_accel *accel;
   grub_uint8_t iv_prefix[64];
   grub_size_t iv_prefix_len;
   grub_uint8_t key[GRUB_CRYPTODISK_MAX_KEYLEN];
@@ -137,6 +142,9 @@ gcry_err_code_t
 grub_cryptodisk_decrypt (struct grub_cryptodisk *dev,
 			 grub_uint8_t * data, grub_size_t len,
 			 grub_disk_addr_t sector);
+/* Wipe and free what setkey and decrypt allocated in DEV.  */
+void
+grub_cryptodisk_free_scratch (grub_cryptodisk_t dev);
 grub_err_t
 grub_cryptodisk_insert (grub_cryptodisk_t newdev, const char *name,
 			grub_disk_t source);
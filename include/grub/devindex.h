@@ -0,0 +1,60 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GRUB_DEVINDEX_HEADER
+#define GRUB_DEVINDEX_HEADER	1
+
+#include <grub/err.h>
+#include <grub/device.h>
+
+/* Session-wide memo of device identities, shared by the search
+   commands.  Values are dropped whenever a disk is written, the disk
+   cache is invalidated, or the set of disk drivers, partition maps or
+   filesystems changes.  */
+
+typedef enum grub_devindex_key
+  {
+    GRUB_DEVINDEX_FS_UUID,
+    GRUB_DEVINDEX_FS_LABEL,
+    GRUB_DEVINDEX_PART_UUID,
+    GRUB_DEVINDEX_PART_LABEL,
+    GRUB_DEVINDEX_DISK_UUID,
+    GRUB_DEVINDEX_NKEYS
+  } grub_devindex_key_t;
+
+/* Return the KEY of DEV in a newly allocated string, or NULL if it has
+   none.  */
+typedef char *(*grub_devindex_probe_t) (grub_device_t dev);
+
+/* Return KEY of device NAME, calling PROBE the first time it is asked
+   for.  The string is owned by the index and valid until the next call;
+   NULL means the device has no such value.  */
+const char *
+EXPORT_FUNC (grub_devindex_get) (const char *name, grub_devindex_key_t key,
+				 grub_devindex_probe_t probe);
+
+/* Like grub_device_iterate, but the devices already known are visited
+   first without touching the disks, and the full enumeration is only
+   done if HOOK did not stop on one of them.  */
+int EXPORT_FUNC (grub_devindex_iterate) (grub_device_iterate_hook_t hook,
+					 void *hook_data);
+
+/* Forget everything.  */
+void EXPORT_FUNC (grub_devindex_invalidate) (void);
+
+#endif /* ! GRUB_DEVINDEX_HEADER */
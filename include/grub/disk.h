@@ -66,6 +66,21 @@ typedef enum
 
 typedef int (*grub_disk_dev_iterate_hook_t) (const char *name, void *data);
 
+/* An asynchronous read of SIZE sectors, in the native sector size, from
+   the sector SECTOR of DISK into BUF.  ERR is valid once the device's
+   poll function reported the request as complete.  */
+struct grub_disk_io
+{
+  struct grub_disk *disk;
+  grub_disk_addr_t sector;
+  grub_size_t size;
+  char *buf;
+  grub_err_t err;
+
+  /* Device-specific data.  */
+  void *data;
+};
+
 /* Disk device.  */
 struct grub_disk_dev
 {
@@ -93,6 +108,14 @@ struct grub_disk_dev
   grub_err_t (*write) (struct grub_disk *disk, grub_disk_addr_t sector,
 		       grub_size_t size, const char *buf);
 
+  /* Start the read IO and return without waiting for it.  At most
+     DISK->queue_depth reads are in flight on a disk.  Optional.  */
+  grub_err_t (*submit) (struct grub_disk *disk, struct grub_disk_io *io);
+
+  /* Return non-zero if IO is complete, blocking until it is if WAIT is
+     non-zero.  Required if SUBMIT is set.  */
+  int (*poll) (struct grub_disk *disk, struct grub_disk_io *io, int wait);
+
 #ifdef GRUB_UTIL
   struct grub_disk_memberlist *(*memberlist) (struct grub_disk *disk);
   const char * (*raidname) (struct grub_disk *disk);
@@ -132,6 +155,11 @@ struct grub_disk
   /* The id used by the disk cache manager.  */
   unsigned long id;
 
+  /* Number of asynchronous reads the device can have in flight.  1, the
+     default, means reads are synchronous only.  Set by the device's
+     open function.  */
+  unsigned int queue_depth;
+
   /* The partition information. This is machine-specific.  */
   struct grub_partition *partition;
 
@@ -142,6 +170,21 @@ struct grub_disk
   /* Caller-specific data passed to the read hook.  */
   void *read_hook_data;
 
+  /* Byte position following the last read and the number of bytes read
+     sequentially up to it, used to detect streaming access.  */
+  grub_uint64_t stream_pos;
+  grub_uint64_t stream_len;
+
+  /* Readahead window used in streaming mode.  READAHEAD_SIZE is the size
+     of the window and READAHEAD_LEN the amount of valid data in it,
+     starting at READAHEAD_SECTOR.  The data is stale once
+     grub_disk_generation differs from READAHEAD_GENERATION.  */
+  char *readahead;
+  grub_size_t readahead_size;
+  grub_size_t readahead_len;
+  grub_disk_addr_t readahead_sector;
+  grub_uint32_t readahead_generation;
+
   /* Device-specific data.  */
   void *data;
 };
@@ -160,8 +203,16 @@ typedef struct grub_disk_memberlist *grub_disk_memberlist_t;
 #define GRUB_DISK_SECTOR_SIZE	0x200
 #define GRUB_DISK_SECTOR_BITS	9
 
+/* The disk cache is GRUB_DISK_CACHE_WAYS-way set associative.  */
+#define GRUB_DISK_CACHE_SETS	128
+#define GRUB_DISK_CACHE_WAYS	8
+
 /* The maximum number of disk caches.  */
-#define GRUB_DISK_CACHE_NUM	1021
+#define GRUB_DISK_CACHE_NUM	(GRUB_DISK_CACHE_SETS * GRUB_DISK_CACHE_WAYS)
+
+/* Cache buffers are carved out of slabs of this many entries, so that
+   a cache miss doesn't cost a malloc.  */
+#define GRUB_DISK_CACHE_SLAB_NUM	16
 
 /* The size of a disk cache in 512B units. Must be at least as big as the
    largest supported sector size, currently 16K.  */
@@ -176,6 +227,17 @@ typedef struct grub_disk_memberlist *grub_disk_memberlist_t;
 /* This is called from the memory manager.  */
 void grub_disk_cache_invalidate_all (void);
 
+/* Bumped on every disk write and by grub_disk_cache_invalidate_all.
+   Modules keeping data parsed from disk compare it against the value
+   they saw when parsing to know when to drop it.  */
+extern grub_uint32_t EXPORT_VAR(grub_disk_generation);
+
+/* Called when a disk appears, goes away or gets different contents
+   without going through grub_disk_write, as when a loopback device is
+   replaced.  Drops cached sectors, bumps grub_disk_generation and
+   unmounts cached filesystems.  */
+void EXPORT_FUNC(grub_disk_changed) (void);
+
 void EXPORT_FUNC(grub_disk_dev_register) (grub_disk_dev_t dev);
 void EXPORT_FUNC(grub_disk_dev_unregister) (grub_disk_dev_t dev);
 static inline int
@@ -199,6 +261,25 @@ grub_err_t EXPORT_FUNC(grub_disk_read) (grub_disk_t disk,
 					grub_off_t offset,
 					grub_size_t size,
 					void *buf);
+
+/* A read for grub_disk_read_batch.  ERR receives the result.  If BUF is
+   NULL, the data is only brought into the disk cache, and only if that
+   can be done asynchronously.  */
+struct grub_disk_read_request
+{
+  grub_disk_t disk;
+  grub_disk_addr_t sector;
+  grub_off_t offset;
+  grub_size_t size;
+  void *buf;
+  grub_err_t err;
+};
+
+/* Perform the NREQS reads in REQS, keeping as many of them in flight at
+   once as the devices allow.  Return the error of the first failed
+   request.  */
+grub_err_t EXPORT_FUNC(grub_disk_read_batch) (struct grub_disk_read_request *reqs,
+					      grub_size_t nreqs);
 grub_err_t grub_disk_write (grub_disk_t disk,
 			    grub_disk_addr_t sector,
 			    grub_off_t offset,
@@ -213,10 +294,27 @@ extern grub_err_t (*EXPORT_VAR(grub_disk_write_weak)) (grub_disk_t disk,
 
 grub_uint64_t EXPORT_FUNC(grub_disk_get_size) (grub_disk_t disk);
 
-#if DISK_CACHE_STATS
+/* Per-device disk cache statistics.  */
+struct grub_disk_cache_stats
+{
+  enum grub_disk_dev_id dev_id;
+  unsigned long disk_id;
+  unsigned long hits;
+  unsigned long misses;
+};
+
+typedef int (*grub_disk_cache_stats_hook_t) (const struct grub_disk_cache_stats *stats,
+					     void *data);
+
 void
 EXPORT_FUNC(grub_disk_cache_get_performance) (unsigned long *hits, unsigned long *misses);
-#endif
+int
+EXPORT_FUNC(grub_disk_cache_stats_iterate) (grub_disk_cache_stats_hook_t hook,
+					    void *hook_data);
+
+/* Get and set the memory the disk cache may use, in bytes.  */
+grub_size_t EXPORT_FUNC(grub_disk_cache_get_budget) (void);
+void EXPORT_FUNC(grub_disk_cache_set_budget) (grub_size_t size);
 
 extern void (* EXPORT_VAR(grub_disk_firmware_fini)) (void);
 extern int EXPORT_VAR(grub_disk_firmware_is_tainted);
@@ -233,13 +331,22 @@ grub_stop_disk_firmware (void)
     }
 }
 
-/* Disk cache.  */
+/* The entry holds valid data.  */
+#define GRUB_DISK_CACHE_VALID		(1 << 0)
+/* The entry was filled by a small (metadata) read rather than by a bulk
+   read.  Such entries are evicted last.  */
+#define GRUB_DISK_CACHE_METADATA	(1 << 1)
+
+/* Disk cache.  DATA is owned by the entry even when it isn't valid, and is
+   reused for the next block stored in it.  */
 struct grub_disk_cache
 {
   enum grub_disk_dev_id dev_id;
   unsigned long disk_id;
   grub_disk_addr_t sector;
   char *data;
+  grub_uint32_t last_use;
+  grub_uint8_t flags;
   int lock;
 };
 
@@ -45,6 +45,12 @@ struct grub_font
   grub_uint32_t num_chars;
   struct char_index_entry *char_index;
   grub_uint16_t *bmp_idx;
+  /* Glyphs decoded in one go when the font was loaded, or NULL.  */
+  void *atlas;
+  /* The other loaded fonts, most similar first, to take missing glyphs
+     from, and the font list generation it was made for.  */
+  struct grub_font **fallback;
+  unsigned fallback_gen;
 };
 
 /* Font type used to access font functions.  */
@@ -47,6 +47,15 @@ typedef int (*grub_fs_dir_hook_t) (const char *filename,
 				   const struct grub_dirhook_info *info,
 				   void *data);
 
+/* A magic number at a fixed byte offset from the start of the device.
+   Lists of signatures are terminated by an entry with LEN 0.  */
+struct grub_fs_signature
+{
+  grub_uint32_t offset;
+  grub_uint32_t len;
+  const char *magic;
+};
+
 /* Filesystem descriptor.  */
 struct grub_fs
 {
@@ -83,6 +92,22 @@ struct grub_fs
   /* Get writing time of filesystem. */
   grub_err_t (*mtime) (grub_device_t device, grub_int32_t *timebuf);
 
+  /* Mount DEVICE and return the filesystem instance in DATA, and free an
+     instance.  Optional: drivers providing them get their instances with
+     grub_fs_mount and grub_fs_unmount, which keep them mounted across
+     opens.  DEVICE stays open as long as the instance lives.  */
+  grub_err_t (*mount) (grub_device_t device, void **data);
+  void (*unmount) (void *data);
+
+  /* Signatures one of which must be present for the filesystem to be
+     recognized at all, or NULL if it can't be told by a fixed magic.
+     grub_fs_probe skips the full mount when none of them matches.  */
+  const struct grub_fs_signature *signatures;
+
+  /* Free what the driver keeps across mounts, such as caches of blocks.
+     Optional.  Called by grub_fs_flush_caches when memory runs out.  */
+  void (*flush_caches) (void);
+
 #ifdef GRUB_UTIL
   /* Determine sectors available for embedding.  */
   grub_err_t (*embed) (grub_device_t device, unsigned int *nsectors,
@@ -118,9 +143,18 @@ grub_fs_register (grub_fs_t fs)
 }
 #endif
 
+/* Unmount the cached instances of FS, or of all filesystems if FS is
+   NULL, which are not in use, and stop handing out the others.  Called
+   when a device may go away or change behind the disk layer's back.  */
+void EXPORT_FUNC(grub_fs_mount_cache_flush) (grub_fs_t fs);
+
+/* Have every driver free the caches it keeps across mounts.  */
+void EXPORT_FUNC(grub_fs_flush_caches) (void);
+
 static inline void
 grub_fs_unregister (grub_fs_t fs)
 {
+  grub_fs_mount_cache_flush (fs);
   grub_list_remove (GRUB_AS_LIST (fs));
 }
 
@@ -128,4 +162,15 @@ grub_fs_unregister (grub_fs_t fs)
 
 grub_fs_t EXPORT_FUNC(grub_fs_probe) (grub_device_t device);
 
+/* Get an instance of FS mounted on DEVICE in DATA, sharing it with other
+   users of the same device.  Release it with grub_fs_unmount.  */
+grub_err_t EXPORT_FUNC(grub_fs_mount) (grub_fs_t fs, grub_device_t device,
+				       void **data);
+void EXPORT_FUNC(grub_fs_unmount) (grub_fs_t fs, void *data);
+
+/* Read ahead what grub_fs_probe looks at on each of DISKS, overlapping
+   the reads where the disk drivers allow it.  */
+void EXPORT_FUNC(grub_fs_probe_prefetch) (struct grub_disk **disks,
+					  grub_size_t ndisks);
+
 #endif /* ! GRUB_FS_HEADER */
@@ -88,4 +88,22 @@ EXPORT_FUNC(grub_fshelp_read_file) (grub_disk_t disk, grub_fshelp_node_t node,
 				    grub_off_t filesize, int log2blocksize,
 				    grub_disk_addr_t blocks_start);
 
+/* Like grub_fshelp_read_file, but GET_EXTENT translates the file block
+   BLOCK to a disk block and stores in COUNT how many blocks starting at
+   BLOCK are stored contiguously.  Contiguous blocks are read with a
+   single disk read.  */
+grub_ssize_t
+EXPORT_FUNC(grub_fshelp_read_file_extent) (grub_disk_t disk,
+					   grub_fshelp_node_t node,
+					   grub_disk_read_hook_t read_hook,
+					   void *read_hook_data,
+					   grub_off_t pos, grub_size_t len,
+					   char *buf,
+					   grub_disk_addr_t (*get_extent) (grub_fshelp_node_t node,
+									   grub_disk_addr_t block,
+									   grub_disk_addr_t *count),
+					   grub_off_t filesize,
+					   int log2blocksize,
+					   grub_disk_addr_t blocks_start);
+
 #endif /* ! GRUB_FSHELP_HEADER */
@@ -22,6 +22,7 @@
 
 #include <grub/types.h>
 #include <grub/symbol.h>
+#include <grub/err.h>
 #include <config.h>
 
 #ifndef NULL
@@ -37,6 +38,15 @@ void *EXPORT_FUNC(grub_realloc) (void *ptr, grub_size_t size);
 void *EXPORT_FUNC(grub_memalign) (grub_size_t align, grub_size_t size);
 #endif
 
+#ifndef GRUB_MACHINE_EMU
+/* Called when the heap cannot satisfy an allocation, to hand the heap a
+   region of at least BYTES in one piece with grub_mm_init_region.  It must
+   not allocate from the heap itself.  */
+typedef grub_err_t (*grub_mm_add_region_func_t) (grub_size_t bytes);
+
+extern grub_mm_add_region_func_t EXPORT_VAR (grub_mm_add_region_fn);
+#endif
+
 void grub_mm_check_real (const char *file, int line);
 #define grub_mm_check() grub_mm_check_real (GRUB_FILE, __LINE__);
 
@@ -24,6 +24,8 @@
 /* Magic words.  */
 #define GRUB_MM_FREE_MAGIC	0x2d3c2808
 #define GRUB_MM_ALLOC_MAGIC	0x6db08fa4
+/* A free small block kept on a size class list rather than in the ring.  */
+#define GRUB_MM_CACHE_MAGIC	0x4b1a7c53
 
 typedef struct grub_mm_header
 {
@@ -59,6 +61,9 @@ typedef struct grub_mm_region
 
 #ifndef GRUB_MACHINE_EMU
 extern grub_mm_region_t EXPORT_VAR (grub_mm_base);
+
+/* Give the blocks on the size class lists back to their regions.  */
+void EXPORT_FUNC (grub_mm_flush_caches) (void);
 #endif
 
 #endif
@@ -277,6 +277,14 @@ typedef struct grub_net
   int eof;
   int stall;
   int port;
+  /* The part of a read not satisfied yet, which received data goes to
+     directly while it is polling.  READ_BUF is NULL when the data is
+     skipped.  */
+  char *read_buf;
+  grub_size_t read_len;
+  /* When the current read started, so that protocols can tell time
+     spent waiting for the server from time the reader spent elsewhere.  */
+  grub_uint64_t read_start;
 } *grub_net_t;
 
 extern grub_net_t (*EXPORT_VAR (grub_net_open)) (const char *name);
@@ -511,6 +519,9 @@ grub_env_set_net_property (const char *intername, const char *suffix,
 void
 grub_net_poll_cards (unsigned time, int *stop_condition);
 
+grub_err_t
+grub_net_put_file_data (grub_file_t file, struct grub_net_buff *nb);
+
 void grub_bootp_init (void);
 void grub_bootp_fini (void);
 
@@ -531,6 +542,9 @@ grub_net_network_level_interface_unregister (struct grub_net_network_level_inter
 void
 grub_net_tcp_retransmit (void);
 
+void
+grub_net_tcp_flush_acks (void);
+
 void
 grub_net_link_layer_add_address (struct grub_net_card *card,
 				 const grub_net_network_level_address_t *nl,
@@ -18,6 +18,24 @@ struct grub_net_buff
   grub_uint8_t *end;
 };
 
+/* Buffers of NETBUFF_ALIGN bytes, which every frame fits in, are kept for
+   reuse when freed, up to this many.  */
+#define NETBUFF_POOL_SIZE 128
+
+struct grub_netbuff_stats
+{
+  /* Buffers allocated from the heap and taken from the pool.  */
+  grub_uint64_t heap_allocs;
+  grub_uint64_t pool_allocs;
+  /* Buffers given back to the heap and put in the pool.  */
+  grub_uint64_t heap_frees;
+  grub_uint64_t pool_frees;
+  /* Buffers in the pool now.  */
+  unsigned pooled;
+};
+
+extern struct grub_netbuff_stats grub_netbuff_stats;
+
 grub_err_t grub_netbuff_put (struct grub_net_buff *net_buff, grub_size_t len);
 grub_err_t grub_netbuff_unput (struct grub_net_buff *net_buff, grub_size_t len);
 grub_err_t grub_netbuff_push (struct grub_net_buff *net_buff, grub_size_t len);
@@ -27,5 +45,6 @@ grub_err_t grub_netbuff_clear (struct grub_net_buff *net_buff);
 struct grub_net_buff * grub_netbuff_alloc (grub_size_t len);
 struct grub_net_buff * grub_netbuff_make_pkt (grub_size_t len);
 void grub_netbuff_free (struct grub_net_buff *net_buff);
+void grub_netbuff_free_pool (void);
 
 #endif
@@ -97,6 +97,27 @@ void grub_unit_test_fini (void);
     grub_test_unregister (#name);		\
   }
 
+/* Benchmarks are functional tests which all_functional_test leaves out,
+   as they take long and what they produce is figures.  Load one and run
+   functional_test to get them.  */
+
+/* Print that COUNT UNITs took from START to END, in milliseconds as from
+   grub_get_time_ms, and the rate per second.  */
+void grub_bench_report (const char *name, grub_uint64_t count,
+			const char *unit, grub_uint64_t start,
+			grub_uint64_t end);
+
+/* The corpus the compression benchmarks decode, which they check their
+   output against: text, then fixed-size records, then noise.  */
+#define GRUB_BENCH_CORPUS_TEXT		12288
+#define GRUB_BENCH_CORPUS_RECORDS	3072
+#define GRUB_BENCH_CORPUS_NOISE		1024
+#define GRUB_BENCH_CORPUS_SIZE		(GRUB_BENCH_CORPUS_TEXT \
+					 + GRUB_BENCH_CORPUS_RECORDS \
+					 + GRUB_BENCH_CORPUS_NOISE)
+
+void grub_bench_corpus (grub_uint8_t *out);
+
 void
 grub_video_checksum (const char *basename_in);
 void
@@ -0,0 +1,44 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GRUB_AESNI_CPU_HEADER
+#define GRUB_AESNI_CPU_HEADER	1
+
+#include <grub/types.h>
+
+#define GRUB_AESNI_BLOCKSIZE 16
+#define GRUB_AESNI_MAX_ROUNDS 14
+
+/* Round keys as consumed by the routines in lib/x86_64/aesni.S.  */
+struct grub_aesni_key
+{
+  grub_uint32_t enc[4 * (GRUB_AESNI_MAX_ROUNDS + 1)];
+  grub_uint32_t dec[4 * (GRUB_AESNI_MAX_ROUNDS + 1)];
+  unsigned rounds;
+};
+
+void grub_aesni_encrypt_blocks (const grub_uint32_t *keys, unsigned rounds,
+				void *out, const void *in,
+				grub_size_t nblocks);
+void grub_aesni_decrypt_blocks (const grub_uint32_t *keys, unsigned rounds,
+				void *out, const void *in,
+				grub_size_t nblocks);
+void grub_aesni_imc (grub_uint32_t *out, const grub_uint32_t *in);
+grub_uint32_t grub_aesni_subword (grub_uint32_t w);
+
+#endif
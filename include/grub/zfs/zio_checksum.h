@@ -23,6 +23,12 @@
 #ifndef _SYS_ZIO_CHECKSUM_H
 #define	_SYS_ZIO_CHECKSUM_H
 
+/*
+ * Signature for checksum functions.
+ */
+typedef void zio_checksum_t(const void *data, grub_uint64_t size, 
+			    grub_zfs_endian_t endian, zio_cksum_t *zcp);
+
 extern void zio_checksum_SHA256 (const void *, grub_uint64_t,
 				 grub_zfs_endian_t endian, zio_cksum_t *);
 extern void fletcher_2 (const void *, grub_uint64_t, grub_zfs_endian_t endian,
@@ -30,4 +36,46 @@ extern void fletcher_2 (const void *, grub_uint64_t, grub_zfs_endian_t endian,
 extern void fletcher_4 (const void *, grub_uint64_t, grub_zfs_endian_t endian,
 			zio_cksum_t *);
 
+#if defined (__x86_64__) && (defined (__clang__) || __GNUC__ >= 9)
+#define ZIO_CHECKSUM_X86	1
+#endif
+
+/* Instruction set extensions the CPU has and its state is set up for.  */
+#define ZIO_CPU_SSSE3	(1 << 0)
+#define ZIO_CPU_SSE4_1	(1 << 1)
+#define ZIO_CPU_AVX2	(1 << 2)
+#define ZIO_CPU_SHA	(1 << 3)
+
+extern unsigned zio_checksum_cpu_features (void);
+
+/*
+ * One implementation of a checksum, usable when the CPU has all of
+ * ZIO_CPU_* FEATURES.
+ */
+typedef struct zio_checksum_impl {
+  const char		*name;
+  zio_checksum_t	*func;
+  unsigned		features;
+} zio_checksum_impl_t;
+
+/*
+ * Every implementation of fletcher_4 and zio_checksum_SHA256, the plain
+ * reference first.  Both use the last one the CPU supports.
+ */
+extern const zio_checksum_impl_t fletcher_4_impls[];
+extern const unsigned fletcher_4_nimpls;
+extern const zio_checksum_impl_t zio_checksum_SHA256_impls[];
+extern const unsigned zio_checksum_SHA256_nimpls;
+
+static inline zio_checksum_t *
+zio_checksum_impl_select (const zio_checksum_impl_t *impls, unsigned nimpls)
+{
+  unsigned features = zio_checksum_cpu_features ();
+
+  while ((impls[nimpls - 1].features & features)
+	 != impls[nimpls - 1].features)
+    nimpls--;
+  return impls[nimpls - 1].func;
+}
+
 #endif	/* _SYS_ZIO_CHECKSUM_H */
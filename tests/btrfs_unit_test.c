@@ -0,0 +1,514 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Build the driver into the test, so that its chunk map and the logical
+   to physical mapping can be checked on a filesystem that spans several
+   memory disks, without making one with mkfs.btrfs.  */
+#include "../grub-core/fs/btrfs.c"
+
+#include <grub/test.h>
+
+#define NDISKS		3
+#define DISK_SIZE	(1 << 20)
+#define SBLOCK_OFFSET	0x10000
+
+/* Where the leaf of the chunk tree is, on the first two disks.  */
+#define TREE_ADDR	0x100000
+#define TREE_OFFSET	0x20000
+#define TREE_ITEMS	0x800
+
+#define CHUNK_TYPE_DATA		0x01
+#define CHUNK_TYPE_SYSTEM	0x02
+
+/* The id of a device that isn't there.  */
+#define MISSING		9
+
+struct test_chunk
+{
+  grub_uint64_t start;
+  grub_uint64_t size;
+  grub_uint64_t type;
+  grub_uint64_t stripe_length;
+  grub_uint16_t nstripes;
+  grub_uint16_t nsubstripes;
+  struct
+  {
+    grub_uint64_t id;
+    grub_uint64_t offset;
+  } stripes[4];
+};
+
+static const struct test_chunk sys_chunk =
+  { TREE_ADDR, 0x10000, GRUB_BTRFS_CHUNK_TYPE_RAID1 | CHUNK_TYPE_SYSTEM,
+    0x10000, 2, 0, { { 1, TREE_OFFSET }, { 2, TREE_OFFSET } } };
+
+static const struct test_chunk raid1_chunk =
+  { 0x200000, 0x10000, GRUB_BTRFS_CHUNK_TYPE_RAID1 | CHUNK_TYPE_DATA,
+    0x10000, 2, 0, { { 1, 0x40000 }, { 3, 0x40000 } } };
+
+static const struct test_chunk raid10_chunk =
+  { 0x300000, 0x40000, GRUB_BTRFS_CHUNK_TYPE_RAID10 | CHUNK_TYPE_DATA,
+    0x1000, 4, 2, { { 2, 0x60000 }, { 3, 0x60000 },
+		    { 2, 0x80000 }, { 3, 0x80000 } } };
+
+/* The first copy is on a missing device.  */
+static const struct test_chunk degraded_chunk =
+  { 0x400000, 0x10000, GRUB_BTRFS_CHUNK_TYPE_RAID1 | CHUNK_TYPE_DATA,
+    0x10000, 2, 0, { { MISSING, 0xc0000 }, { 3, 0xc0000 } } };
+
+/* Claims mirroring but has a single stripe, on a missing device.  */
+static const struct test_chunk short_chunk =
+  { 0x500000, 0x10000, GRUB_BTRFS_CHUNK_TYPE_RAID1 | CHUNK_TYPE_DATA,
+    0x10000, 1, 0, { { MISSING, 0xd0000 } } };
+
+static const struct test_chunk *const tree_chunks[] =
+  { &sys_chunk, &raid1_chunk, &raid10_chunk, &degraded_chunk, &short_chunk };
+
+static grub_uint8_t disks[NDISKS][DISK_SIZE];
+static unsigned opens;
+
+static int
+test_disk_iterate (grub_disk_dev_iterate_hook_t hook, void *hook_data,
+		   grub_disk_pull_t pull)
+{
+  char name[sizeof ("btrfs0")];
+  unsigned i;
+
+  if (pull != GRUB_DISK_PULL_NONE)
+    return 0;
+  for (i = 0; i < NDISKS; i++)
+    {
+      grub_snprintf (name, sizeof (name), "btrfs%u", i);
+      if (hook (name, hook_data))
+	return 1;
+    }
+  return 0;
+}
+
+static grub_err_t
+test_disk_open (const char *name, grub_disk_t disk)
+{
+  if (grub_strncmp (name, "btrfs", 5) != 0
+      || name[5] < '0' || name[5] >= '0' + NDISKS || name[6])
+    return grub_error (GRUB_ERR_UNKNOWN_DEVICE, "not a test disk");
+
+  disk->id = name[5] - '0';
+  disk->total_sectors = DISK_SIZE >> GRUB_DISK_SECTOR_BITS;
+  disk->max_agglomerate = GRUB_DISK_MAX_MAX_AGGLOMERATE;
+  opens++;
+  return GRUB_ERR_NONE;
+}
+
+static void
+test_disk_close (grub_disk_t disk __attribute__ ((unused)))
+{
+}
+
+static grub_err_t
+test_disk_read (grub_disk_t disk, grub_disk_addr_t sector,
+		grub_size_t size, char *buf)
+{
+  grub_memcpy (buf, disks[disk->id] + (sector << GRUB_DISK_SECTOR_BITS),
+	       size << GRUB_DISK_SECTOR_BITS);
+  return GRUB_ERR_NONE;
+}
+
+static grub_err_t
+test_disk_write (grub_disk_t disk __attribute__ ((unused)),
+		 grub_disk_addr_t sector __attribute__ ((unused)),
+		 grub_size_t size __attribute__ ((unused)),
+		 const char *buf __attribute__ ((unused)))
+{
+  return grub_error (GRUB_ERR_NOT_IMPLEMENTED_YET, "read-only test disk");
+}
+
+static struct grub_disk_dev test_disk_dev =
+  {
+    .name = "btrfstest",
+    .id = GRUB_DISK_DEVICE_MEMDISK_ID,
+    .iterate = test_disk_iterate,
+    .open = test_disk_open,
+    .close = test_disk_close,
+    .read = test_disk_read,
+    .write = test_disk_write,
+    .next = 0
+  };
+
+static grub_uint8_t
+pattern (grub_uint64_t addr)
+{
+  return addr ^ (addr >> 8) ^ (addr >> 16);
+}
+
+/* Store CHUNK as a chunk item at P and return its size.  */
+static grub_size_t
+put_chunk (grub_uint8_t *p, const struct test_chunk *chunk)
+{
+  struct grub_btrfs_chunk_item *item = (struct grub_btrfs_chunk_item *) p;
+  struct grub_btrfs_chunk_stripe *stripe;
+  unsigned i;
+
+  grub_memset (item, 0, sizeof (*item));
+  item->size = grub_cpu_to_le64 (chunk->size);
+  item->type = grub_cpu_to_le64 (chunk->type);
+  item->stripe_length = grub_cpu_to_le64 (chunk->stripe_length);
+  item->nstripes = grub_cpu_to_le16 (chunk->nstripes);
+  item->nsubstripes = grub_cpu_to_le16 (chunk->nsubstripes);
+  stripe = (struct grub_btrfs_chunk_stripe *) (item + 1);
+  for (i = 0; i < chunk->nstripes; i++)
+    {
+      grub_memset (&stripe[i], 0, sizeof (stripe[i]));
+      stripe[i].device_id = grub_cpu_to_le64 (chunk->stripes[i].id);
+      stripe[i].offset = grub_cpu_to_le64 (chunk->stripes[i].offset);
+    }
+  return sizeof (*item) + chunk->nstripes * sizeof (*stripe);
+}
+
+static void
+put_key (struct grub_btrfs_key *key, grub_uint64_t start)
+{
+  key->object_id = grub_cpu_to_le64_compile_time (GRUB_BTRFS_OBJECT_ID_CHUNK);
+  key->type = GRUB_BTRFS_ITEM_TYPE_CHUNK;
+  key->offset = grub_cpu_to_le64 (start);
+}
+
+/* Store the byte of ADDR on every copy that isn't on a missing device.  */
+static void
+put_byte (const struct test_chunk *chunk, grub_uint64_t addr)
+{
+  grub_uint64_t off = addr - chunk->start;
+  grub_uint64_t stripe_offset = off;
+  unsigned first = 0, copies = chunk->nstripes, i;
+
+  if (chunk->nsubstripes)
+    {
+      grub_uint64_t nr = off / chunk->stripe_length;
+      unsigned groups = chunk->nstripes / chunk->nsubstripes;
+
+      first = (nr % groups) * chunk->nsubstripes;
+      copies = chunk->nsubstripes;
+      stripe_offset = (nr / groups) * chunk->stripe_length
+	+ off % chunk->stripe_length;
+    }
+  for (i = first; i < first + copies; i++)
+    if (chunk->stripes[i].id != MISSING)
+      disks[chunk->stripes[i].id - 1][chunk->stripes[i].offset
+				      + stripe_offset] = pattern (addr);
+}
+
+static void
+make_disks (void)
+{
+  struct btrfs_header *head;
+  struct grub_btrfs_leaf_node *leaf;
+  grub_uint8_t *items;
+  grub_uint64_t addr;
+  grub_size_t off = TREE_ITEMS;
+  unsigned d, i;
+
+  grub_memset (disks, 0, sizeof (disks));
+
+  for (d = 0; d < NDISKS; d++)
+    {
+      struct grub_btrfs_superblock *sb;
+      struct grub_btrfs_key *key;
+
+      sb = (struct grub_btrfs_superblock *) (disks[d] + SBLOCK_OFFSET);
+      grub_memcpy (sb->signature, GRUB_BTRFS_SIGNATURE,
+		   sizeof (sb->signature));
+      grub_memset (sb->uuid, 0x5a, sizeof (sb->uuid));
+      sb->generation = grub_cpu_to_le64_compile_time (1);
+      sb->chunk_tree = grub_cpu_to_le64_compile_time (TREE_ADDR);
+      sb->this_device.device_id = grub_cpu_to_le64 (d + 1);
+      sb->this_device.size = grub_cpu_to_le64_compile_time (DISK_SIZE);
+      key = (struct grub_btrfs_key *) sb->bootstrap_mapping;
+      put_key (key, sys_chunk.start);
+      put_chunk ((grub_uint8_t *) (key + 1), &sys_chunk);
+    }
+
+  /* A leaf holding every chunk, on both copies of the system chunk.  */
+  head = (struct btrfs_header *) (disks[0] + TREE_OFFSET);
+  head->nitems = grub_cpu_to_le32 (ARRAY_SIZE (tree_chunks));
+  head->level = 0;
+  leaf = (struct grub_btrfs_leaf_node *) (head + 1);
+  items = (grub_uint8_t *) (head + 1);
+  for (i = 0; i < ARRAY_SIZE (tree_chunks); i++)
+    {
+      grub_size_t size = put_chunk (items + off, tree_chunks[i]);
+
+      put_key (&leaf[i].key, tree_chunks[i]->start);
+      leaf[i].offset = grub_cpu_to_le32 (off);
+      leaf[i].size = grub_cpu_to_le32 (size);
+      off += size;
+    }
+  grub_memcpy (disks[1] + TREE_OFFSET, disks[0] + TREE_OFFSET,
+	       sizeof (*head) + off);
+
+  for (i = 1; i < ARRAY_SIZE (tree_chunks); i++)
+    for (addr = tree_chunks[i]->start;
+	 addr < tree_chunks[i]->start + tree_chunks[i]->size; addr++)
+      put_byte (tree_chunks[i], addr);
+
+  grub_disk_cache_invalidate_all ();
+}
+
+static grub_device_t
+open_fs (struct grub_btrfs_data **data)
+{
+  grub_device_t dev;
+  void *mount_data = NULL;
+
+  dev = grub_device_open ("btrfs0");
+  grub_test_assert (dev != NULL, "opening btrfs0 failed: %s", grub_errmsg);
+  if (!dev)
+    return NULL;
+  grub_test_assert (grub_btrfs_mount (dev, &mount_data) == GRUB_ERR_NONE,
+		    "mount failed: %s", grub_errmsg);
+  *data = mount_data;
+  if (!mount_data)
+    {
+      grub_device_close (dev);
+      return NULL;
+    }
+  return dev;
+}
+
+static void
+close_fs (grub_device_t dev, struct grub_btrfs_data *data)
+{
+  grub_btrfs_unmount (data);
+  grub_device_close (dev);
+  grub_errno = GRUB_ERR_NONE;
+}
+
+static int
+read_matches (struct grub_btrfs_data *data, grub_uint64_t addr,
+	      grub_size_t size)
+{
+  grub_uint8_t *buf;
+  grub_size_t i;
+  int ok;
+
+  buf = grub_malloc (size);
+  if (!buf)
+    return 0;
+  ok = grub_btrfs_read_logical (data, addr, buf, size, 0) == GRUB_ERR_NONE;
+  for (i = 0; ok && i < size; i++)
+    if (buf[i] != pattern (addr + i))
+      ok = 0;
+  grub_free (buf);
+  return ok;
+}
+
+/* Mounting maps the whole chunk tree, each chunk once and in order.  */
+static void
+load_test (void)
+{
+  struct grub_btrfs_data *data;
+  grub_device_t dev;
+  unsigned i;
+
+  dev = open_fs (&data);
+  if (!dev)
+    return;
+
+  grub_test_assert (data->n_chunks == ARRAY_SIZE (tree_chunks),
+		    "%u chunks mapped, expected %u", data->n_chunks,
+		    (unsigned) ARRAY_SIZE (tree_chunks));
+  for (i = 0; i < data->n_chunks && i < ARRAY_SIZE (tree_chunks); i++)
+    {
+      const struct test_chunk *want = tree_chunks[i];
+      struct grub_btrfs_mapped_chunk *got = &data->chunks[i];
+
+      grub_test_assert (got->start == want->start && got->size == want->size
+			&& got->type == want->type
+			&& got->nstripes == want->nstripes
+			&& got->nsubstripes == want->nsubstripes,
+			"chunk %u mapped wrongly", i);
+      grub_test_assert (got->nstripes == 0
+			|| (got->stripes[got->nstripes - 1].offset
+			    == want->stripes[want->nstripes - 1].offset
+			    && (got->stripes[got->nstripes - 1].device_id
+				== grub_cpu_to_le64
+				(want->stripes[want->nstripes - 1].id))),
+			"stripes of chunk %u mapped wrongly", i);
+    }
+
+  grub_test_assert (chunk_map_find (data, raid1_chunk.start)
+		    == &data->chunks[1], "first byte of a chunk not found");
+  grub_test_assert (chunk_map_find (data, raid1_chunk.start
+				    + raid1_chunk.size - 1)
+		    == &data->chunks[1], "last byte of a chunk not found");
+  grub_test_assert (chunk_map_find (data, raid1_chunk.start
+				    + raid1_chunk.size) == NULL,
+		    "address between chunks found");
+  grub_test_assert (chunk_map_find (data, sys_chunk.start - 1) == NULL,
+		    "address before the first chunk found");
+  grub_test_assert (chunk_map_find (data, ~(grub_uint64_t) 0) == NULL,
+		    "address past the last chunk found");
+
+  close_fs (dev, data);
+}
+
+/* A chunk item is checked against its size before it is mapped.  */
+static void
+insert_test (void)
+{
+  struct grub_btrfs_data data;
+  grub_uint8_t buf[sizeof (struct grub_btrfs_chunk_item)
+		   + 4 * sizeof (struct grub_btrfs_chunk_stripe)];
+  struct grub_btrfs_chunk_item *item = (struct grub_btrfs_chunk_item *) buf;
+  grub_size_t size;
+
+  grub_memset (&data, 0, sizeof (data));
+  size = put_chunk (buf, &raid10_chunk);
+
+  grub_test_assert (chunk_map_insert (&data, raid10_chunk.start, item,
+				      size - 1) == GRUB_ERR_BAD_FS,
+		    "truncated chunk item mapped");
+  grub_test_assert (chunk_map_insert (&data, raid10_chunk.start, item,
+				      sizeof (struct grub_btrfs_chunk_item) - 1)
+		    == GRUB_ERR_BAD_FS, "chunk item without stripes mapped");
+  grub_test_assert (data.n_chunks == 0, "invalid chunk items were mapped");
+  grub_errno = GRUB_ERR_NONE;
+
+  grub_test_assert (chunk_map_insert (&data, raid10_chunk.start, item, size)
+		    == GRUB_ERR_NONE, "mapping a chunk failed: %s",
+		    grub_errmsg);
+  grub_test_assert (chunk_map_insert (&data, raid10_chunk.start, item, size)
+		    == GRUB_ERR_NONE && data.n_chunks == 1,
+		    "mapping a chunk twice added it twice");
+
+  grub_free (data.chunks[0].stripes);
+  grub_free (data.chunks);
+}
+
+/* Reads of the mirrored and striped chunks land on the right copies, and
+   each member device is looked up only once.  */
+static void
+read_test (void)
+{
+  struct grub_btrfs_data *data;
+  struct grub_btrfs_mapped_chunk *chunk;
+  grub_device_t dev;
+  unsigned before, i;
+
+  dev = open_fs (&data);
+  if (!dev)
+    return;
+
+  grub_test_assert (read_matches (data, raid1_chunk.start, raid1_chunk.size),
+		    "RAID1 chunk read wrongly");
+  grub_test_assert (read_matches (data, raid10_chunk.start + 0x800,
+				  raid10_chunk.size - 0x1000),
+		    "RAID10 chunk read wrongly");
+
+  chunk = chunk_map_find (data, raid10_chunk.start);
+  for (i = 0; i < chunk->nstripes; i += chunk->nsubstripes)
+    grub_test_assert (chunk->stripes[i].dev != NULL,
+		      "device of RAID10 stripe %u not kept", i);
+
+  before = opens;
+  grub_test_assert (read_matches (data, raid10_chunk.start,
+				  raid10_chunk.size),
+		    "RAID10 chunk read wrongly the second time");
+  grub_test_assert (opens == before,
+		    "member devices looked up again (%u opens)",
+		    opens - before);
+
+  close_fs (dev, data);
+}
+
+/* A mirror with one copy on a missing device reads the other one, and a
+   chunk with no usable copy fails instead of reading past its stripes.  */
+static void
+missing_device_test (void)
+{
+  struct grub_btrfs_data *data;
+  grub_device_t dev;
+  grub_uint8_t buf[0x200];
+
+  dev = open_fs (&data);
+  if (!dev)
+    return;
+
+  grub_test_assert (read_matches (data, degraded_chunk.start,
+				  degraded_chunk.size),
+		    "degraded RAID1 chunk read wrongly: %s", grub_errmsg);
+  grub_test_assert (grub_errno == GRUB_ERR_NONE,
+		    "error left after a degraded read: %s", grub_errmsg);
+
+  grub_test_assert (grub_btrfs_read_logical (data, short_chunk.start, buf,
+					     sizeof (buf), 0)
+		    == GRUB_ERR_BAD_FS,
+		    "read of a chunk without a usable copy succeeded");
+  grub_errno = GRUB_ERR_NONE;
+
+  close_fs (dev, data);
+}
+
+/* Chunks that weren't mapped at mount are looked up in the chunk tree
+   when they are first read.  */
+static void
+lookup_test (void)
+{
+  struct grub_btrfs_data *data;
+  grub_device_t dev;
+  unsigned i;
+
+  dev = open_fs (&data);
+  if (!dev)
+    return;
+
+  /* Forget all but the system chunk, which holds the chunk tree.  */
+  for (i = 1; i < data->n_chunks; i++)
+    grub_free (data->chunks[i].stripes);
+  data->n_chunks = 1;
+
+  grub_test_assert (read_matches (data, raid10_chunk.start + 0x1800, 0x2000),
+		    "unmapped chunk read wrongly: %s", grub_errmsg);
+  grub_test_assert (data->n_chunks == 2
+		    && data->chunks[1].start == raid10_chunk.start,
+		    "looked up chunk not mapped");
+
+  grub_test_assert (read_matches (data, raid1_chunk.start, 0x200),
+		    "second unmapped chunk read wrongly: %s", grub_errmsg);
+  grub_test_assert (data->n_chunks == 3
+		    && data->chunks[1].start == raid1_chunk.start
+		    && data->chunks[2].start == raid10_chunk.start,
+		    "looked up chunks out of order");
+
+  close_fs (dev, data);
+}
+
+static void
+btrfs_test (void)
+{
+  grub_disk_dev_register (&test_disk_dev);
+  make_disks ();
+
+  load_test ();
+  insert_test ();
+  read_test ();
+  missing_device_test ();
+  lookup_test ();
+
+  grub_disk_dev_unregister (&test_disk_dev);
+}
+
+GRUB_UNIT_TEST ("btrfs_unit_test", btrfs_test);
@@ -728,6 +728,46 @@ search_part_label_test (void)
   close_disk (&data);
 }
 
+static void
+search_part_label_changed_test (void)
+{
+  struct test_data data;
+  const char *test_result;
+  char *expected_result;
+
+  open_disk (&data);
+
+  expected_result = grub_xasprintf ("%s,gpt1", data.dev->disk->name);
+  grub_env_unset ("test_result");
+  grub_search_part_label ("EFI SYSTEM", "test_result", 0, NULL, 0);
+  test_result = grub_env_get ("test_result");
+  grub_test_assert (test_result && strcmp (test_result, expected_result) == 0,
+		    "wrong device: %s (%s)", test_result, expected_result);
+
+  /* Rename the partition on disk, the previous result must not stick.  */
+  data.raw->primary_entries[0].name[0] =
+    data.raw->backup_entries[0].name[0] = grub_cpu_to_le16_compile_time ('X');
+  sync_disk (&data);
+
+  grub_env_unset ("test_result");
+  grub_search_part_label ("XFI SYSTEM", "test_result", 0, NULL, 0);
+  test_result = grub_env_get ("test_result");
+  grub_test_assert (test_result && strcmp (test_result, expected_result) == 0,
+		    "wrong device: %s (%s)", test_result, expected_result);
+  grub_free (expected_result);
+
+  grub_env_unset ("test_result");
+  grub_search_part_label ("EFI SYSTEM", "test_result", 0, NULL, 0);
+  test_result = grub_env_get ("test_result");
+  grub_test_assert (test_result == NULL,
+		    "unexpected device: %s", test_result);
+  grub_test_assert (grub_errno == GRUB_ERR_FILE_NOT_FOUND,
+		    "unexpected error: %s", grub_errmsg);
+  grub_errno = GRUB_ERR_NONE;
+
+  close_disk (&data);
+}
+
 static void
 search_part_uuid_test (void)
 {
@@ -816,6 +856,8 @@ grub_unit_test_init (void)
   grub_test_register ("gpt_invalid_partsize_test", invalid_partsize_test);
   grub_test_register ("gpt_weird_disk_size_test", weird_disk_size_test);
   grub_test_register ("gpt_search_part_label_test", search_part_label_test);
+  grub_test_register ("gpt_search_part_label_changed_test",
+		      search_part_label_changed_test);
   grub_test_register ("gpt_search_uuid_test", search_part_uuid_test);
   grub_test_register ("gpt_search_disk_uuid_test", search_disk_uuid_test);
 }
@@ -834,6 +876,7 @@ grub_unit_test_fini (void)
   grub_test_unregister ("gpt_invalid_partsize_test");
   grub_test_unregister ("gpt_weird_disk_size_test");
   grub_test_unregister ("gpt_search_part_label_test");
+  grub_test_unregister ("gpt_search_part_label_changed_test");
   grub_test_unregister ("gpt_search_part_uuid_test");
   grub_test_unregister ("gpt_search_disk_uuid_test");
   grub_fini_all ();
@@ -0,0 +1,341 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* The utilities allocate with the host malloc.  Build the firmware heap
+   from kern/mm.c under other names, so that it manages the arenas below
+   while everything else in this program keeps using the host.  */
+#define grub_malloc		test_mm_malloc
+#define grub_zalloc		test_mm_zalloc
+#define grub_free		test_mm_free
+#define grub_realloc		test_mm_realloc
+#define grub_memalign		test_mm_memalign
+#define grub_mm_init_region	test_mm_init_region
+#define grub_mm_flush_caches	test_mm_flush_caches
+#define grub_mm_base		test_mm_base
+#define grub_mm_add_region_fn	test_mm_add_region_fn
+
+#include "../grub-core/kern/mm.c"
+
+#include <grub/test.h>
+
+#define ARENA_SIZE	(1 << 20)
+#define NBLOCKS		1024
+
+static grub_uint8_t arenas[3][ARENA_SIZE];
+
+static struct
+{
+  grub_uint8_t *ptr;
+  grub_size_t size;
+} blocks[NBLOCKS];
+
+static grub_uint32_t seed;
+
+static grub_uint32_t
+next_random (void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+static void
+fill (unsigned i)
+{
+  grub_size_t j;
+
+  for (j = 0; j < blocks[i].size; j++)
+    blocks[i].ptr[j] = i * 131 + j;
+}
+
+static int
+intact (unsigned i, grub_size_t size)
+{
+  grub_size_t j;
+
+  for (j = 0; j < size; j++)
+    if (blocks[i].ptr[j] != (grub_uint8_t) (i * 131 + j))
+      return 0;
+  return 1;
+}
+
+static grub_mm_region_t
+region_of (void *ptr)
+{
+  grub_mm_region_t r;
+
+  for (r = grub_mm_base; r; r = r->next)
+    if ((grub_uint8_t *) ptr > (grub_uint8_t *) (r + 1)
+	&& (grub_uint8_t *) ptr <= (grub_uint8_t *) (r + 1) + r->size)
+      return r;
+  return 0;
+}
+
+/* Whether every region is back to a single free block spanning all of
+   it, i.e. everything freed has been coalesced.  */
+static int
+all_coalesced (void)
+{
+  grub_mm_region_t r;
+
+  grub_mm_flush_caches ();
+  for (r = grub_mm_base; r; r = r->next)
+    if (r->first->magic != GRUB_MM_FREE_MAGIC
+	|| r->first->next != r->first
+	|| r->first->size << GRUB_MM_ALIGN_LOG2 != r->size)
+      return 0;
+  return 1;
+}
+
+static void
+heap_reset (void)
+{
+  grub_mm_flush_caches ();
+  grub_mm_base = 0;
+  grub_mm_add_region_fn = 0;
+  grub_errno = GRUB_ERR_NONE;
+}
+
+/* Allocate, free and reallocate blocks of mixed sizes, small ones served
+   from the size class lists and large ones from the rings, and check that
+   no block is overwritten by another.  */
+static void
+integrity_test (void)
+{
+  unsigned i, round;
+  grub_size_t old;
+
+  grub_mm_init_region (arenas[0], ARENA_SIZE);
+  grub_mm_init_region (arenas[1], ARENA_SIZE);
+
+  seed = 1;
+  for (round = 0; round < 8; round++)
+    {
+      for (i = 0; i < NBLOCKS; i++)
+	{
+	  if (blocks[i].ptr)
+	    {
+	      if (next_random () & 1)
+		continue;
+	      grub_test_assert (intact (i, blocks[i].size),
+				"block %u (%u bytes) overwritten", i,
+				(unsigned) blocks[i].size);
+	      grub_free (blocks[i].ptr);
+	    }
+	  blocks[i].size = (next_random () & 3) ? next_random () % 512
+	    : next_random () % 8192;
+	  blocks[i].ptr = grub_malloc (blocks[i].size);
+	  grub_test_assert (blocks[i].ptr != 0, "allocating %u bytes failed",
+			    (unsigned) blocks[i].size);
+	  if (!blocks[i].ptr)
+	    return;
+	  fill (i);
+	}
+
+      for (i = round; i < NBLOCKS; i += 8)
+	{
+	  old = blocks[i].size;
+	  blocks[i].size = next_random () % 4096;
+	  blocks[i].ptr = grub_realloc (blocks[i].ptr, blocks[i].size);
+	  grub_test_assert (blocks[i].ptr != 0, "reallocating to %u bytes failed",
+			    (unsigned) blocks[i].size);
+	  if (!blocks[i].ptr)
+	    return;
+	  grub_test_assert (intact (i, old < blocks[i].size
+				    ? old : blocks[i].size),
+			    "realloc of block %u from %u to %u bytes lost data",
+			    i, (unsigned) old, (unsigned) blocks[i].size);
+	  fill (i);
+	}
+    }
+
+  for (i = 0; i < NBLOCKS; i++)
+    {
+      grub_test_assert (intact (i, blocks[i].size),
+			"block %u (%u bytes) overwritten", i,
+			(unsigned) blocks[i].size);
+      grub_free (blocks[i].ptr);
+      blocks[i].ptr = 0;
+    }
+  grub_test_assert (all_coalesced (), "free blocks did not coalesce");
+  heap_reset ();
+}
+
+static void
+align_test (void)
+{
+  grub_size_t align, size;
+  grub_uint8_t *p, *q;
+
+  grub_mm_init_region (arenas[0], ARENA_SIZE);
+
+  for (size = 1; size < 70000; size = size * 3 + 1)
+    {
+      p = grub_malloc (size);
+      grub_test_assert (((grub_addr_t) p & (GRUB_MM_ALIGN - 1)) == 0,
+			"%u bytes at %p not aligned to a cell",
+			(unsigned) size, p);
+      grub_free (p);
+    }
+
+  for (align = 1; align <= 0x10000; align <<= 1)
+    for (size = 1; size < 20000; size = size * 7 + 3)
+      {
+	/* Something in front, so that alignment needs a split.  */
+	q = grub_malloc (align * 3 / 2);
+	p = grub_memalign (align, size);
+	grub_test_assert (p != 0, "memalign (%u, %u) failed",
+			  (unsigned) align, (unsigned) size);
+	grub_test_assert (((grub_addr_t) p & (align - 1)) == 0,
+			  "memalign (%u, %u) returned %p", (unsigned) align,
+			  (unsigned) size, p);
+	if (p)
+	  grub_memset (p, 0xa5, size);
+	grub_free (q);
+	grub_free (p);
+      }
+
+  grub_test_assert (all_coalesced (), "free blocks did not coalesce");
+  heap_reset ();
+}
+
+static void
+realloc_test (void)
+{
+  grub_uint8_t *p, *q, *in_front;
+
+  grub_mm_init_region (arenas[0], ARENA_SIZE);
+
+  p = grub_realloc (0, 100);
+  grub_test_assert (p != 0, "realloc of NULL did not allocate");
+  blocks[0].ptr = p;
+  blocks[0].size = 100;
+  fill (0);
+
+  /* Shrinking keeps the block.  */
+  q = grub_realloc (p, 10);
+  grub_test_assert (q == p, "shrinking moved the block");
+
+  /* Growing past a neighbour moves it and keeps the contents.  */
+  in_front = grub_malloc (16);
+  blocks[0].ptr = grub_realloc (q, 50000);
+  grub_test_assert (blocks[0].ptr != 0, "growing to 50000 bytes failed");
+  if (blocks[0].ptr)
+    grub_test_assert (intact (0, 10), "growing lost the contents");
+  grub_free (in_front);
+
+  grub_test_assert (grub_realloc (blocks[0].ptr, 0) == 0,
+		    "realloc to 0 bytes did not free");
+  blocks[0].ptr = 0;
+
+  /* A failed realloc leaves the block alone.  */
+  p = grub_malloc (64);
+  grub_memset (p, 0x5a, 64);
+  grub_test_assert (grub_realloc (p, 2 * ARENA_SIZE) == 0,
+		    "realloc beyond the heap succeeded");
+  grub_test_assert (grub_errno == GRUB_ERR_OUT_OF_MEMORY,
+		    "failed realloc did not report out of memory");
+  grub_errno = GRUB_ERR_NONE;
+  grub_test_assert (p[0] == 0x5a && p[63] == 0x5a,
+		    "failed realloc changed the block");
+  grub_free (p);
+
+  grub_test_assert (all_coalesced (), "free blocks did not coalesce");
+  heap_reset ();
+}
+
+static unsigned regions_added;
+
+static grub_err_t
+add_region (grub_size_t bytes)
+{
+  if (regions_added || bytes > ARENA_SIZE)
+    return grub_error (GRUB_ERR_OUT_OF_MEMORY, "no more arenas");
+  regions_added++;
+  grub_mm_init_region (arenas[2], ARENA_SIZE);
+  return GRUB_ERR_NONE;
+}
+
+static void
+regions_test (void)
+{
+  grub_mm_region_t small, large;
+  grub_uint8_t *p, *q, *r;
+
+  /* Two halves of one arena, the upper one first, merge into a single
+     region.  */
+  grub_mm_init_region (arenas[0] + ARENA_SIZE / 2, ARENA_SIZE / 2);
+  grub_mm_init_region (arenas[0], ARENA_SIZE / 2);
+  grub_test_assert (grub_mm_base && !grub_mm_base->next,
+		    "adjacent regions were not merged");
+  p = grub_malloc (ARENA_SIZE * 3 / 4);
+  grub_test_assert (p != 0, "allocating across the merged halves failed");
+  grub_free (p);
+  grub_test_assert (all_coalesced (), "merged region did not coalesce");
+  heap_reset ();
+
+  /* Separate regions are kept smallest first, and a request too large
+     for one goes to the next.  */
+  grub_mm_init_region (arenas[1], ARENA_SIZE);
+  grub_mm_init_region (arenas[0], ARENA_SIZE / 4);
+  small = grub_mm_base;
+  large = small ? small->next : 0;
+  grub_test_assert (large && small->size < large->size,
+		    "regions are not ordered by size");
+  if (!large)
+    return;
+
+  p = grub_malloc (ARENA_SIZE / 8);
+  q = grub_malloc (ARENA_SIZE / 2);
+  grub_test_assert (region_of (p) == small, "small block not in small region");
+  grub_test_assert (region_of (q) == large, "large block not in large region");
+
+  /* Nothing left that fits, and no way to grow.  */
+  grub_test_assert (grub_malloc (ARENA_SIZE * 3 / 4) == 0,
+		    "allocation larger than the free space succeeded");
+  grub_test_assert (grub_errno == GRUB_ERR_OUT_OF_MEMORY,
+		    "failed allocation did not report out of memory");
+  grub_errno = GRUB_ERR_NONE;
+
+  /* The platform hook adds a region once the others are full.  */
+  grub_mm_add_region_fn = add_region;
+  regions_added = 0;
+  r = grub_malloc (ARENA_SIZE * 3 / 4);
+  grub_test_assert (r != 0 && regions_added == 1,
+		    "the added region was not used");
+  grub_test_assert (region_of (r) && region_of (r) != small
+		    && region_of (r) != large,
+		    "block not in the added region");
+  grub_errno = GRUB_ERR_NONE;
+
+  grub_free (p);
+  grub_free (q);
+  grub_free (r);
+  grub_test_assert (all_coalesced (), "free blocks did not coalesce");
+  heap_reset ();
+}
+
+static void
+mm_test (void)
+{
+  integrity_test ();
+  align_test ();
+  realloc_test ();
+  regions_test ();
+}
+
+GRUB_UNIT_TEST ("mm_unit_test", mm_test);
@@ -0,0 +1,223 @@
+/*
+ *  GRUB  --  GRand Unified Bootloader
+ *  Copyright (C) 2026  Free Software Foundation, Inc.
+ *
+ *  GRUB is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  GRUB is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with GRUB.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Build the driver into the test, so that its cache of verified blocks
+   can be checked without a pool.  */
+#include "../grub-core/fs/zfs/zfs.c"
+
+#include <grub/test.h>
+
+#define GUID		0x1234567890abcdefULL
+#define BLOCK_SIZE	(ZIO_CACHE_MAX_BYTES / 8)
+#define NBLOCKS		(ZIO_CACHE_MAX_BYTES / BLOCK_SIZE)
+
+static char block[BLOCK_SIZE];
+
+static void
+make_bp (blkptr_t *bp, unsigned n)
+{
+  grub_memset (bp, 0, sizeof (*bp));
+  bp->blk_dva[0].dva_word[0] = 0x100 + n;
+  bp->blk_dva[0].dva_word[1] = 0x2000 + n * 0x100;
+  bp->blk_prop = 0x8000000000070003ULL;
+  bp->blk_birth = 42;
+  bp->blk_cksum.zc_word[0] = 0xdeadbeef00000000ULL + n;
+  bp->blk_cksum.zc_word[1] = 0xfeedface;
+  bp->blk_cksum.zc_word[2] = n * 3;
+  bp->blk_cksum.zc_word[3] = n * 5;
+}
+
+static void
+fill (unsigned n, grub_size_t size)
+{
+  grub_size_t i;
+
+  for (i = 0; i < size; i++)
+    block[i] = n * 131 + i;
+}
+
+static void
+put (unsigned n, enum zio_cache_class class, grub_size_t size)
+{
+  blkptr_t bp;
+
+  make_bp (&bp, n);
+  fill (n, size);
+  zio_cache_put (&bp, GUID, class, block, size);
+}
+
+/* Return whether the cache returns the right copy of block N.  */
+static int
+cached (unsigned n, grub_size_t size)
+{
+  blkptr_t bp;
+  char *buf;
+  int ok;
+
+  make_bp (&bp, n);
+  buf = zio_cache_get (&bp, GUID, size);
+  if (!buf)
+    return 0;
+  fill (n, size);
+  ok = grub_memcmp (buf, block, size) == 0;
+  grub_free (buf);
+  return ok;
+}
+
+static int
+cached_bp (const blkptr_t *bp, grub_uint64_t guid)
+{
+  char *buf;
+
+  buf = zio_cache_get (bp, guid, 512);
+  grub_free (buf);
+  return buf != NULL;
+}
+
+/* A block is found only under the pool and block pointer it was read
+   with, and only once.  */
+static void
+lookup_test (void)
+{
+  blkptr_t bp, other;
+
+  zio_cache_flush ();
+  put (1, ZIO_CACHE_META, 512);
+  grub_test_assert (cached (1, 512), "block not cached");
+  grub_test_assert (!cached (1, 1024), "block found under another size");
+  grub_test_assert (!cached (2, 512), "block found under another pointer");
+
+  make_bp (&bp, 1);
+  grub_test_assert (!cached_bp (&bp, GUID + 1),
+		    "block found under another pool");
+  other = bp;
+  other.blk_dva[0].dva_word[1]++;
+  grub_test_assert (!cached_bp (&other, GUID),
+		    "block found under another DVA");
+  other = bp;
+  other.blk_prop++;
+  grub_test_assert (!cached_bp (&other, GUID),
+		    "block found under other properties");
+  other = bp;
+  other.blk_birth++;
+  grub_test_assert (!cached_bp (&other, GUID),
+		    "block found under another birth");
+  other = bp;
+  other.blk_cksum.zc_word[3]++;
+  grub_test_assert (!cached_bp (&other, GUID),
+		    "block found under another checksum");
+
+  /* Only the first DVA names the block.  */
+  other = bp;
+  other.blk_dva[1].dva_word[0] = 0x5000;
+  grub_test_assert (cached_bp (&other, GUID),
+		    "block not found when another DVA was added");
+
+  put (1, ZIO_CACHE_META, 512);
+  grub_test_assert (zio_cache_bytes == 512, "block cached twice");
+}
+
+/* No block takes more than an eighth of the cache.  */
+static void
+size_test (void)
+{
+  zio_cache_flush ();
+  put (1, ZIO_CACHE_DATA, BLOCK_SIZE + 1);
+  grub_test_assert (zio_cache_bytes == 0, "oversized block cached");
+  put (2, ZIO_CACHE_DATA, BLOCK_SIZE);
+  grub_test_assert (cached (2, BLOCK_SIZE), "largest block not cached");
+}
+
+/* Data blocks never evict metadata, metadata evicts the least recently
+   used data first.  */
+static void
+eviction_test (void)
+{
+  unsigned i;
+
+  zio_cache_flush ();
+  for (i = 0; i < NBLOCKS; i++)
+    put (i, ZIO_CACHE_META, BLOCK_SIZE);
+  grub_test_assert (zio_cache_bytes == ZIO_CACHE_MAX_BYTES,
+		    "cache not full of metadata");
+  put (NBLOCKS, ZIO_CACHE_DATA, BLOCK_SIZE);
+  grub_test_assert (!cached (NBLOCKS, BLOCK_SIZE),
+		    "data block cached in place of metadata");
+  for (i = 0; i < NBLOCKS; i++)
+    grub_test_assert (cached (i, BLOCK_SIZE),
+		      "metadata block %u evicted by data", i);
+
+  /* Metadata evicts its own least recently used blocks.  */
+  put (NBLOCKS, ZIO_CACHE_META, BLOCK_SIZE);
+  grub_test_assert (!cached (0, BLOCK_SIZE) && cached (NBLOCKS, BLOCK_SIZE),
+		    "least recently used metadata block not evicted");
+
+  zio_cache_flush ();
+  for (i = 0; i < NBLOCKS; i++)
+    put (i, ZIO_CACHE_DATA, BLOCK_SIZE);
+  /* Block 0 becomes the most recently used.  */
+  grub_test_assert (cached (0, BLOCK_SIZE), "data block not cached");
+  put (NBLOCKS, ZIO_CACHE_META, BLOCK_SIZE);
+  grub_test_assert (cached (NBLOCKS, BLOCK_SIZE),
+		    "metadata block not cached in place of data");
+  grub_test_assert (cached (0, BLOCK_SIZE) && !cached (1, BLOCK_SIZE),
+		    "wrong data block evicted by metadata");
+  put (NBLOCKS + 1, ZIO_CACHE_DATA, BLOCK_SIZE);
+  grub_test_assert (cached (NBLOCKS, BLOCK_SIZE),
+		    "metadata block evicted by data");
+  grub_test_assert (cached (NBLOCKS + 1, BLOCK_SIZE)
+		    && !cached (2, BLOCK_SIZE),
+		    "least recently used data block not evicted");
+  grub_test_assert (zio_cache_bytes <= ZIO_CACHE_MAX_BYTES,
+		    "cache grew past its limit");
+}
+
+/* The cache is emptied when the disks change and when memory runs out.  */
+static void
+flush_test (void)
+{
+  zio_cache_flush ();
+  put (1, ZIO_CACHE_META, 512);
+  grub_disk_cache_invalidate_all ();
+  grub_test_assert (!cached (1, 512), "block kept after the disks changed");
+  grub_test_assert (zio_cache_bytes == 0, "cache not emptied");
+
+  put (1, ZIO_CACHE_META, 512);
+  put (2, ZIO_CACHE_DATA, 512);
+  grub_fs_register (&grub_zfs_fs);
+  grub_fs_flush_caches ();
+  grub_fs_unregister (&grub_zfs_fs);
+  grub_test_assert (zio_cache_bytes == 0
+		    && !zio_cache_lru_tail[ZIO_CACHE_META]
+		    && !zio_cache_lru_tail[ZIO_CACHE_DATA],
+		    "cache not emptied when memory ran out");
+  grub_test_assert (!cached (1, 512) && !cached (2, 512),
+		    "block kept when memory ran out");
+}
+
+static void
+zfs_test (void)
+{
+  lookup_test ();
+  size_test ();
+  eviction_test ();
+  flush_test ();
+  zio_cache_flush ();
+}
+
+GRUB_UNIT_TEST ("zfs_unit_test", zfs_test);